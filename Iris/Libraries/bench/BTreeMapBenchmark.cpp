@@ -0,0 +1,101 @@
+#include "ContainerInput.hpp"
+
+#include <map>
+
+#include <Iris/Container/BTreeMap.hpp>
+
+// BTreeMap against std::map with uint64 keys and values at 1k, 100k and 10M entries: inserting keys one at a time in
+// random and in ascending order, bulk loading sorted pairs, LookupCount successful and failed finds, range queries of
+// RangeLength entries from a lower bound, and one pass over every entry.
+// Run 'IrisBench --filter "^(BTreeMap|std::map)/"' for the comparison
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		constexpr size_t RangeCount = 1024;
+
+		constexpr size_t RangeLength = 64;
+
+		template<class Map>
+		auto LowerBound(const Map& map, uint64 key)
+		{
+			if constexpr (requires { map.lowerBound(key); })
+				return map.lowerBound(key);
+			else
+				return map.lower_bound(key);
+		}
+
+		template<class Map>
+		void RegisterMap(const std::string& name)
+		{
+			for (const auto& size : ContainerSizes)
+			{
+				const auto count = size.count;
+
+				for (const bool sorted : { false, true })
+				{
+					Register(name + (sorted ? "/append/" : "/insert/") + size.name, [count, sorted](State& state)
+						{
+							const auto pairs = MakePairs(count, sorted);
+
+							state.setItemsPerIteration(count);
+							for (auto _ : state)
+							{
+								Map map;
+
+								for (const auto& pair : pairs)
+									map.insert(pair);
+
+								DoNotOptimize(map.size());
+							}
+						});
+				}
+
+				Register(name + "/bulk/" + size.name, [count](State& state)
+					{
+						const auto pairs = MakePairs(count, true);
+
+						state.setItemsPerIteration(count);
+						for (auto _ : state)
+						{
+							const Map map(pairs.begin(), pairs.end());
+							DoNotOptimize(map.size());
+						}
+					});
+
+				Register(name + "/range/" + size.name, [count](State& state)
+					{
+						const auto& map = FilledMap<Map>(count);
+						auto lookups = MakeLookups(count, true);
+						lookups.resize(RangeCount);
+
+						state.setItemsPerIteration(RangeCount * RangeLength);
+						for (auto _ : state)
+						{
+							uint64 sum = 0;
+
+							for (const auto key : lookups)
+							{
+								auto it = LowerBound(map, key);
+
+								for (size_t i = 0; (i < RangeLength) && (it != map.end()); ++i, ++it)
+									sum += it->second;
+							}
+
+							DoNotOptimize(sum);
+						}
+					});
+			}
+
+			RegisterMapReads<Map>(name);
+		}
+
+		const bool gBTreeMap = []()
+			{
+				RegisterMap<BTreeMap<uint64, uint64>>("BTreeMap");
+				RegisterMap<std::map<uint64, uint64>>("std::map");
+				return true;
+			}();
+	}
+}
\ No newline at end of file
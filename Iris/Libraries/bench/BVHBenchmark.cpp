@@ -0,0 +1,194 @@
+#include "Benchmark.hpp"
+
+#include <vector>
+
+#include <Iris/Math/BVH.hpp>
+
+// BVH build, refit and queries over a synthetic heightfield of about a million triangles. The scene is built once
+// and shared, so only the query loops are timed; the build benchmarks rebuild it from scratch every iteration
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		// 708 x 708 quads, two triangles each: 1,002,528 triangles
+		constexpr uint32 GridSize = 708;
+
+		constexpr float32 CellSize = 1.f;
+
+		// Rays are shot down from a camera over a 32 x 32 tile, which keeps neighbouring rays coherent
+		constexpr uint32 TileSize = 32;
+
+		struct Scene
+		{
+			std::vector<Vector3> vertices;
+
+			std::vector<uint32> indices;
+
+			std::vector<AABB> bounds;
+
+			BVH bvh;
+
+			std::vector<Ray> rays;
+		};
+
+		bool IntersectTriangle(const Scene& scene, uint32 triangle, const Ray& ray, float32& distance)
+		{
+			const auto* index = scene.indices.data() + static_cast<size_t>(triangle) * 3;
+			return ray.intersects(scene.vertices[index[0]], scene.vertices[index[1]], scene.vertices[index[2]], distance);
+		}
+
+		Scene MakeScene()
+		{
+			Scene scene;
+			scene.vertices.reserve(static_cast<size_t>(GridSize + 1) * (GridSize + 1));
+
+			for (uint32 z = 0; z <= GridSize; ++z)
+			{
+				for (uint32 x = 0; x <= GridSize; ++x)
+				{
+					const auto height = 4.f * Math::Sin(static_cast<float32>(x) * 0.05f) * Math::Cos(static_cast<float32>(z) * 0.07f) + RandomFloat(-0.25f, 0.25f);
+					scene.vertices.push_back(Vector3{ static_cast<float32>(x) * CellSize, height, static_cast<float32>(z) * CellSize });
+				}
+			}
+
+			scene.indices.reserve(static_cast<size_t>(GridSize) * GridSize * 6);
+
+			for (uint32 z = 0; z < GridSize; ++z)
+			{
+				for (uint32 x = 0; x < GridSize; ++x)
+				{
+					const auto corner = z * (GridSize + 1) + x;
+					scene.indices.insert(scene.indices.end(), { corner, corner + GridSize + 1, corner + 1 });
+					scene.indices.insert(scene.indices.end(), { corner + 1, corner + GridSize + 1, corner + GridSize + 2 });
+				}
+			}
+
+			scene.bounds.reserve(scene.indices.size() / 3);
+
+			for (size_t i = 0; i < scene.indices.size(); i += 3)
+			{
+				const auto& v0 = scene.vertices[scene.indices[i]];
+				scene.bounds.push_back(AABB{ v0, v0 }.merge(scene.vertices[scene.indices[i + 1]]).merge(scene.vertices[scene.indices[i + 2]]));
+			}
+
+			scene.bvh.build(scene.bounds, 0);
+
+			const Vector3 eye{ GridSize * CellSize * 0.5f, 40.f, GridSize * CellSize * 0.25f };
+
+			for (uint32 y = 0; y < TileSize; ++y)
+			{
+				for (uint32 x = 0; x < TileSize; ++x)
+				{
+					const Vector3 target{ eye.x + (static_cast<float32>(x) - TileSize * 0.5f) * 0.5f, 0.f, eye.z + 60.f + static_cast<float32>(y) * 0.5f };
+					scene.rays.push_back(Ray{ eye, (target - eye).normalize() });
+				}
+			}
+
+			return scene;
+		}
+
+		const Scene& GetScene()
+		{
+			static const Scene scene = MakeScene();
+			return scene;
+		}
+	}
+
+	IRIS_BENCHMARK("BVH/build/1M")
+	{
+		const auto& scene = GetScene();
+
+		state.setItemsPerIteration(scene.bounds.size());
+		for (auto _ : state)
+		{
+			BVH bvh;
+			bvh.build(scene.bounds, 1);
+			DoNotOptimize(bvh.nodes().size());
+		}
+	}
+
+	IRIS_BENCHMARK("BVH/build/1M/threads")
+	{
+		const auto& scene = GetScene();
+
+		state.setItemsPerIteration(scene.bounds.size());
+		for (auto _ : state)
+		{
+			BVH bvh;
+			bvh.build(scene.bounds, 0);
+			DoNotOptimize(bvh.nodes().size());
+		}
+	}
+
+	IRIS_BENCHMARK("BVH/refit/1M")
+	{
+		const auto& scene = GetScene();
+		auto bvh = scene.bvh;
+
+		state.setItemsPerIteration(scene.bounds.size());
+		for (auto _ : state)
+		{
+			bvh.refit(scene.bounds);
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("BVH/raycast/1M/batch1024")
+	{
+		const auto& scene = GetScene();
+		const auto intersect = [&scene](uint32 triangle, const Ray& ray, float32& distance) { return IntersectTriangle(scene, triangle, ray, distance); };
+		std::vector<BVH::Hit> hits(scene.rays.size());
+
+		state.setItemsPerIteration(scene.rays.size());
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < scene.rays.size(); ++i)
+				hits[i] = scene.bvh.raycast(scene.rays[i], intersect);
+
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("BVH/raycastPacket/1M/batch1024")
+	{
+		const auto& scene = GetScene();
+		const auto intersect = [&scene](uint32 triangle, const Ray& ray, float32& distance) { return IntersectTriangle(scene, triangle, ray, distance); };
+		std::vector<BVH::Hit> hits(scene.rays.size());
+
+		state.setItemsPerIteration(scene.rays.size());
+		for (auto _ : state)
+		{
+			scene.bvh.raycast(scene.rays, hits, intersect);
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("BVH/overlap(AABB)/1M")
+	{
+		const auto& scene = GetScene();
+		const AABB box{ Vector3{ 300.f, -10.f, 300.f }, Vector3{ 308.f, 10.f, 308.f } };
+		Array<uint32> result;
+
+		for (auto _ : state)
+		{
+			result.resize(0);
+			scene.bvh.overlap(box, result);
+			DoNotOptimize(result.size());
+		}
+	}
+
+	IRIS_BENCHMARK("BVH/overlap(Sphere)/1M")
+	{
+		const auto& scene = GetScene();
+		const Sphere sphere{ Vector3{ 300.f, 0.f, 300.f }, 4.f };
+		Array<uint32> result;
+
+		for (auto _ : state)
+		{
+			result.resize(0);
+			scene.bvh.overlap(sphere, result);
+			DoNotOptimize(result.size());
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,645 @@
+#include "Benchmark.hpp"
+
+#include <cmath>
+#include <cctype>
+#include <regex>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <Iris/Common/CPUFeature.hpp>
+
+#if !defined(IRIS_BENCH_BUILD_TYPE)
+	#define IRIS_BENCH_BUILD_TYPE "Unknown"
+#endif
+
+namespace Iris::Bench
+{
+	State::State(uint64 _iterations) noexcept
+		: mIterations(_iterations)
+	{}
+
+	State::Iterator State::begin() noexcept
+	{
+		mStart = std::chrono::steady_clock::now();
+		return Iterator{ this, mIterations };
+	}
+
+	State::Sentinel State::end() const noexcept
+	{
+		return Sentinel{};
+	}
+
+	uint64 State::iterations() const noexcept
+	{
+		return mIterations;
+	}
+
+	double State::loopSeconds() const noexcept
+	{
+		return mLoopSeconds;
+	}
+
+	void State::stopTimer() noexcept
+	{
+		mLoopSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart).count();
+	}
+
+	void State::setItemsPerIteration(uint64 _items) noexcept
+	{
+		mItemsPerIteration = _items;
+	}
+
+	uint64 State::itemsPerIteration() const noexcept
+	{
+		return mItemsPerIteration;
+	}
+
+	void State::setCounter(const std::string& _name, double _value)
+	{
+		for (auto& [name, value] : mCounters)
+		{
+			if (name == _name)
+			{
+				value = _value;
+				return;
+			}
+		}
+
+		mCounters.emplace_back(_name, _value);
+	}
+
+	const std::vector<std::pair<std::string, double>>& State::counters() const noexcept
+	{
+		return mCounters;
+	}
+
+	void ClobberMemory() noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+
+	float32 RandomFloat(float32 min, float32 max) noexcept
+	{
+		// xorshift32; fixed seed so every run and every baseline sees the same inputs
+		static uint32 state = 2463534242u;
+
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+
+		return min + (max - min) * static_cast<float32>(state >> 8) * (1.f / 16777216.f);
+	}
+}
+
+namespace Iris::Bench::Detail
+{
+	struct Entry
+	{
+		std::string name;
+
+		Function function;
+	};
+
+	struct Result
+	{
+		std::string name;
+
+		uint64 iterations = 0;
+
+		double nsPerOp = 0;
+
+		double nsPerOpMin = 0;
+
+		double itemsPerSecond = 0;
+
+		// From the last repetition
+		std::vector<std::pair<std::string, double>> counters;
+	};
+
+	struct Options
+	{
+		std::string filter;
+
+		std::string jsonPath;
+
+		std::string comparePath;
+
+		double minTime = 0.1;
+
+		double threshold = 10.0;
+
+		int repetitions = 5;
+
+		bool list = false;
+	};
+
+	std::vector<Entry>& Registry()
+	{
+		static std::vector<Entry> registry;
+		return registry;
+	}
+
+	double RunOnce(const Entry& entry, uint64 iterations, uint64& items, std::vector<std::pair<std::string, double>>& counters)
+	{
+		State state{ iterations };
+
+		const auto start = std::chrono::steady_clock::now();
+		entry.function(state);
+		const auto stop = std::chrono::steady_clock::now();
+
+		items = state.itemsPerIteration();
+		counters = state.counters();
+
+		// Bodies that never enter the loop are timed as a whole
+		return (state.loopSeconds() >= 0) ? state.loopSeconds() : std::chrono::duration<double>(stop - start).count();
+	}
+
+	// Grows the iteration count until one run lasts 'minTime', then takes the median of the repetitions
+	Result Run(const Entry& entry, const Options& options)
+	{
+		uint64 items = 1;
+		uint64 iterations = 1;
+		std::vector<std::pair<std::string, double>> counters;
+
+		for (;;)
+		{
+			const double seconds = RunOnce(entry, iterations, items, counters);
+
+			if (seconds >= options.minTime || iterations >= (uint64(1) << 40))
+				break;
+
+			const double scale = (seconds > 0) ? options.minTime * 1.4 / seconds : 10.0;
+			iterations = std::max(iterations + 1, static_cast<uint64>(static_cast<double>(iterations) * std::min(scale, 10.0)));
+		}
+
+		std::vector<double> samples;
+		for (int i = 0; i < options.repetitions; ++i)
+		{
+			samples.push_back(RunOnce(entry, iterations, items, counters) * 1e9 / static_cast<double>(iterations));
+		}
+
+		std::sort(samples.begin(), samples.end());
+
+		Result result;
+		result.name = entry.name;
+		result.iterations = iterations;
+		result.nsPerOp = samples[samples.size() / 2];
+		result.nsPerOpMin = samples.front();
+		result.itemsPerSecond = static_cast<double>(items) * 1e9 / result.nsPerOp;
+		result.counters = std::move(counters);
+		return result;
+	}
+
+	std::string Escape(const std::string& text)
+	{
+		std::string escaped;
+
+		for (const char c : text)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+
+			escaped += c;
+		}
+
+		return escaped;
+	}
+
+	std::string CompilerName()
+	{
+#if defined(__clang__)
+		return "clang " __clang_version__;
+#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+		return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+		return "unknown";
+#endif
+	}
+
+	void WriteJson(std::ostream& out, const std::vector<Result>& results, const Options& options)
+	{
+		const auto& cpu = CPUFeature::Get();
+
+		out << std::boolalpha << "{\n";
+		out << "  \"context\": {\n";
+		out << "    \"compiler\": \"" << Escape(CompilerName()) << "\",\n";
+		out << "    \"build_type\": \"" << IRIS_BENCH_BUILD_TYPE << "\",\n";
+		out << "    \"cpu\": { \"sse41\": " << cpu.sse41 << ", \"avx\": " << cpu.avx << ", \"avx2\": " << cpu.avx2
+			<< ", \"fma\": " << cpu.fma << ", \"f16c\": " << cpu.f16c << " },\n";
+		out << "    \"min_time\": " << options.minTime << ",\n";
+		out << "    \"repetitions\": " << options.repetitions << "\n";
+		out << "  },\n";
+		out << "  \"benchmarks\": [\n";
+
+		char buffer[512];
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const auto& result = results[i];
+			std::snprintf(buffer, sizeof(buffer),
+				"    { \"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.4f, \"ns_per_op_min\": %.4f, \"items_per_second\": %.6e",
+				Escape(result.name).c_str(), static_cast<unsigned long long>(result.iterations),
+				result.nsPerOp, result.nsPerOpMin, result.itemsPerSecond);
+			out << buffer;
+
+			if (!result.counters.empty())
+			{
+				out << ", \"counters\": {";
+
+				for (size_t k = 0; k < result.counters.size(); ++k)
+				{
+					std::snprintf(buffer, sizeof(buffer), "%s \"%s\": %.6g", (k == 0) ? "" : ",",
+						Escape(result.counters[k].first).c_str(), result.counters[k].second);
+					out << buffer;
+				}
+
+				out << " }";
+			}
+
+			out << " }" << ((i + 1 < results.size()) ? "," : "") << "\n";
+		}
+
+		out << "  ]\n";
+		out << "}\n";
+	}
+
+	// Just enough JSON to read back a baseline; accepts any well-formed document and keeps what Compare needs
+	class JsonReader
+	{
+	public:
+
+		explicit JsonReader(std::string _text) : mText(std::move(_text)) {}
+
+		// name -> ns_per_op of every entry in the top-level "benchmarks" array
+		std::unordered_map<std::string, double> readBaseline()
+		{
+			std::unordered_map<std::string, double> baseline;
+
+			expect('{');
+			if (!consume('}'))
+			{
+				do
+				{
+					const auto key = readString();
+					expect(':');
+
+					if (key == "benchmarks")
+						readBenchmarks(baseline);
+					else
+						skipValue();
+				} while (consume(','));
+
+				expect('}');
+			}
+
+			return baseline;
+		}
+
+	private:
+
+		void readBenchmarks(std::unordered_map<std::string, double>& baseline)
+		{
+			expect('[');
+			if (consume(']'))
+				return;
+
+			do
+			{
+				std::string name;
+				double nsPerOp = -1;
+
+				expect('{');
+				if (!consume('}'))
+				{
+					do
+					{
+						const auto key = readString();
+						expect(':');
+
+						if (key == "name")
+							name = readString();
+						else if (key == "ns_per_op")
+							nsPerOp = readNumber();
+						else
+							skipValue();
+					} while (consume(','));
+
+					expect('}');
+				}
+
+				if (!name.empty() && nsPerOp >= 0)
+					baseline[name] = nsPerOp;
+			} while (consume(','));
+
+			expect(']');
+		}
+
+		void skipValue()
+		{
+			skipSpace();
+			const char c = peek();
+
+			if (c == '"')
+			{
+				readString();
+			}
+			else if (c == '{' || c == '[')
+			{
+				const char close = (c == '{') ? '}' : ']';
+				++mPos;
+
+				if (consume(close))
+					return;
+
+				do
+				{
+					if (c == '{')
+					{
+						readString();
+						expect(':');
+					}
+					skipValue();
+				} while (consume(','));
+
+				expect(close);
+			}
+			else if (c == 't' || c == 'f' || c == 'n')
+			{
+				while (mPos < mText.size() && std::isalpha(static_cast<unsigned char>(mText[mPos])))
+					++mPos;
+			}
+			else
+			{
+				readNumber();
+			}
+		}
+
+		std::string readString()
+		{
+			expect('"');
+
+			std::string text;
+			while (mPos < mText.size() && mText[mPos] != '"')
+			{
+				if (mText[mPos] == '\\' && mPos + 1 < mText.size())
+					++mPos;
+
+				text += mText[mPos++];
+			}
+
+			expect('"');
+			return text;
+		}
+
+		double readNumber()
+		{
+			skipSpace();
+
+			const char* begin = mText.c_str() + mPos;
+			char* end = nullptr;
+			const double value = std::strtod(begin, &end);
+
+			if (end == begin)
+				fail("number");
+
+			mPos += static_cast<size_t>(end - begin);
+			return value;
+		}
+
+		void skipSpace()
+		{
+			while (mPos < mText.size() && std::isspace(static_cast<unsigned char>(mText[mPos])))
+				++mPos;
+		}
+
+		char peek()
+		{
+			skipSpace();
+			return (mPos < mText.size()) ? mText[mPos] : '\0';
+		}
+
+		bool consume(char c)
+		{
+			if (peek() != c)
+				return false;
+
+			++mPos;
+			return true;
+		}
+
+		void expect(char c)
+		{
+			if (!consume(c))
+				fail(std::string("'") + c + "'");
+		}
+
+		[[noreturn]] void fail(const std::string& expected)
+		{
+			throw std::runtime_error("malformed baseline: expected " + expected + " at offset " + std::to_string(mPos));
+		}
+
+	private:
+
+		std::string mText;
+
+		size_t mPos = 0;
+
+	};
+
+	std::unordered_map<std::string, double> LoadBaseline(const std::string& path)
+	{
+		std::ifstream file(path);
+		if (!file)
+			throw std::runtime_error("cannot open baseline '" + path + "'");
+
+		std::stringstream text;
+		text << file.rdbuf();
+
+		return JsonReader{ text.str() }.readBaseline();
+	}
+
+	void PrintUsage()
+	{
+		std::puts(
+			"usage: IrisBench [options]\n"
+			"  --filter <regex>        run only benchmarks whose name matches\n"
+			"  --min-time <seconds>    minimum duration of one measured run (default 0.1)\n"
+			"  --repetitions <n>       measured runs per benchmark; the median is reported (default 5)\n"
+			"  --json <path>           write the results as JSON ('-' for stdout)\n"
+			"  --compare <path>        compare against a baseline written by --json\n"
+			"  --threshold <percent>   slowdown reported as a regression (default 10)\n"
+			"  --list                  print the benchmark names and exit\n"
+			"exit status: 0 on success, 1 when --compare found a regression, 2 on a usage or I/O error");
+	}
+
+	Options ParseOptions(int argc, char** argv)
+	{
+		Options options;
+
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string arg = argv[i];
+
+			auto value = [&]() -> std::string
+				{
+					if (i + 1 >= argc)
+						throw std::invalid_argument(arg + " needs a value");
+
+					return argv[++i];
+				};
+
+			if (arg == "--filter")
+				options.filter = value();
+			else if (arg == "--min-time")
+				options.minTime = std::stod(value());
+			else if (arg == "--repetitions")
+				options.repetitions = std::max(1, std::stoi(value()));
+			else if (arg == "--json")
+				options.jsonPath = value();
+			else if (arg == "--compare")
+				options.comparePath = value();
+			else if (arg == "--threshold")
+				options.threshold = std::stod(value());
+			else if (arg == "--list")
+				options.list = true;
+			else if (arg == "--help" || arg == "-h")
+			{
+				PrintUsage();
+				std::exit(0);
+			}
+			else
+				throw std::invalid_argument("unknown option " + arg);
+		}
+
+		return options;
+	}
+}
+
+namespace Iris::Bench
+{
+	bool Register(std::string name, Function function)
+	{
+		Detail::Registry().push_back(Detail::Entry{ std::move(name), std::move(function) });
+		return true;
+	}
+
+	int Main(int argc, char** argv)
+	{
+		try
+		{
+			const auto options = Detail::ParseOptions(argc, argv);
+			const std::regex filter(options.filter);
+
+			std::vector<const Detail::Entry*> selected;
+			for (const auto& entry : Detail::Registry())
+			{
+				if (options.filter.empty() || std::regex_search(entry.name, filter))
+					selected.push_back(&entry);
+			}
+
+			if (options.list)
+			{
+				for (const auto* entry : selected)
+					std::puts(entry->name.c_str());
+
+				return 0;
+			}
+
+			const auto baseline = options.comparePath.empty() ? std::unordered_map<std::string, double>{} : Detail::LoadBaseline(options.comparePath);
+			const bool compare = !options.comparePath.empty();
+
+			// With JSON on stdout the table goes to stderr so the output stays parseable
+			FILE* table = (options.jsonPath == "-") ? stderr : stdout;
+
+			if (compare)
+				std::fprintf(table, "%-48s %14s %14s %9s\n", "benchmark", "ns/op", "baseline", "delta");
+			else
+				std::fprintf(table, "%-48s %14s %16s %12s\n", "benchmark", "ns/op", "items/s", "iterations");
+
+			std::vector<Detail::Result> results;
+			int regressions = 0;
+
+			for (const auto* entry : selected)
+			{
+				const auto result = Detail::Run(*entry, options);
+				results.push_back(result);
+
+				if (!compare)
+				{
+					std::fprintf(table, "%-48s %14.3f %16.4g %12llu", result.name.c_str(), result.nsPerOp, result.itemsPerSecond,
+						static_cast<unsigned long long>(result.iterations));
+
+					for (const auto& [name, value] : result.counters)
+						std::fprintf(table, "  %s=%.4g", name.c_str(), value);
+
+					std::fputc('\n', table);
+					continue;
+				}
+
+				const auto base = baseline.find(result.name);
+				if (base == baseline.end() || base->second <= 0)
+				{
+					std::fprintf(table, "%-48s %14.3f %14s %9s\n", result.name.c_str(), result.nsPerOp, "-", "new");
+					continue;
+				}
+
+				const double delta = (result.nsPerOp - base->second) * 100.0 / base->second;
+				const char* verdict = "";
+
+				if (delta > options.threshold)
+				{
+					verdict = "  REGRESSION";
+					++regressions;
+				}
+				else if (delta < -options.threshold)
+				{
+					verdict = "  improved";
+				}
+
+				std::fprintf(table, "%-48s %14.3f %14.3f %+8.1f%%%s\n", result.name.c_str(), result.nsPerOp, base->second, delta, verdict);
+			}
+
+			if (!options.jsonPath.empty())
+			{
+				if (options.jsonPath == "-")
+				{
+					std::ostringstream out;
+					Detail::WriteJson(out, results, options);
+					std::fputs(out.str().c_str(), stdout);
+				}
+				else
+				{
+					std::ofstream out(options.jsonPath);
+					if (!out)
+						throw std::runtime_error("cannot write '" + options.jsonPath + "'");
+
+					Detail::WriteJson(out, results, options);
+				}
+			}
+
+			if (compare)
+			{
+				std::fprintf(table, "%d regression(s) over %.1f%% against %s\n", regressions, options.threshold, options.comparePath.c_str());
+			}
+
+			return (regressions > 0) ? 1 : 0;
+		}
+		catch (const std::exception& e)
+		{
+			std::fprintf(stderr, "IrisBench: %s\n", e.what());
+			return 2;
+		}
+	}
+}
\ No newline at end of file
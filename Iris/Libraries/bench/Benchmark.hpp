@@ -0,0 +1,243 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include <Iris/Common/Numeric.hpp>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+
+namespace Iris::Bench
+{
+	// Passed to every benchmark; the body runs once per iteration of 'for (auto _ : state)'. Only that loop is timed,
+	// so setup before it and teardown after it do not count
+	class State
+	{
+	public:
+
+		struct Sentinel {};
+
+		// User-provided destructor so 'auto _' in the loop is not reported as an unused variable
+		struct Value
+		{
+			~Value() {}
+		};
+
+		class Iterator
+		{
+		public:
+
+			Iterator(State* _state, uint64 _remaining)noexcept : mState(_state), mRemaining(_remaining) {}
+
+			Iterator& operator++()noexcept { --mRemaining; return *this; }
+
+			Value operator*()const noexcept { return Value{}; }
+
+			bool operator!=(Sentinel)const noexcept
+			{
+				if (mRemaining != 0)
+					return true;
+
+				mState->stopTimer();
+				return false;
+			}
+
+		private:
+
+			State* mState;
+
+			uint64 mRemaining;
+
+		};
+
+		explicit State(uint64 _iterations)noexcept;
+
+		// Starts the timer
+		Iterator begin()noexcept;
+
+		Sentinel end()const noexcept;
+
+		uint64 iterations()const noexcept;
+
+		// Seconds spent in the loop, or a negative value when the body never ran it
+		double loopSeconds()const noexcept;
+
+		// Elements processed per iteration; batched benchmarks set this so the report can give throughput
+		void setItemsPerIteration(uint64 _items)noexcept;
+
+		uint64 itemsPerIteration()const noexcept;
+
+		// Extra per-run figures reported next to the timing, e.g. allocations per item; setting a name again replaces it
+		void setCounter(const std::string& _name, double _value);
+
+		const std::vector<std::pair<std::string, double>>& counters()const noexcept;
+
+	private:
+
+		void stopTimer()noexcept;
+
+	private:
+
+		uint64 mIterations;
+
+		uint64 mItemsPerIteration = 1;
+
+		std::chrono::steady_clock::time_point mStart;
+
+		double mLoopSeconds = -1;
+
+		std::vector<std::pair<std::string, double>> mCounters;
+
+	};
+
+	using Function = std::function<void(State&)>;
+
+	bool Register(std::string name, Function function);
+
+	// Registers 'name' and 'name/batch1024': the first applies 'function' to one input over and over, the second
+	// sweeps it across 1024 inputs so the result reflects throughput rather than latency
+	template<class Input, class Fty>
+	bool RegisterUnary(const std::string& name, Fty function);
+
+	template<class Left, class Right, class Fty>
+	bool RegisterBinary(const std::string& name, Fty function);
+
+	// Forces 'value' to be materialized so the computation producing it is not optimized away
+	template<class T>
+	void DoNotOptimize(const T& value)noexcept;
+
+	// Also makes the compiler assume 'value' changed, so work on it cannot be hoisted out of the loop
+	template<class T>
+	void DoNotOptimize(T& value)noexcept;
+
+	void ClobberMemory()noexcept;
+
+	// Deterministic inputs shared by all benchmarks
+	float32 RandomFloat(float32 min, float32 max)noexcept;
+
+	// Specialized per input type (see MathInput.hpp) for RegisterUnary and RegisterBinary
+	template<class T>
+	T MakeInput();
+
+	// Parses the command line, runs the selected benchmarks and returns the process exit code
+	int Main(int argc, char** argv);
+}
+
+#define IRIS_BENCH_CONCAT_IMPL(a, b) a##b
+#define IRIS_BENCH_CONCAT(a, b) IRIS_BENCH_CONCAT_IMPL(a, b)
+
+// IRIS_BENCHMARK(name) { ... } defines and registers a benchmark body taking 'Bench::State& state'
+#define IRIS_BENCHMARK(name) \
+	static void IRIS_BENCH_CONCAT(IrisBenchmark, __LINE__)(::Iris::Bench::State& state); \
+	[[maybe_unused]] static const bool IRIS_BENCH_CONCAT(IrisBenchmarkRegistered, __LINE__) = ::Iris::Bench::Register(name, IRIS_BENCH_CONCAT(IrisBenchmark, __LINE__)); \
+	static void IRIS_BENCH_CONCAT(IrisBenchmark, __LINE__)([[maybe_unused]] ::Iris::Bench::State& state)
+
+namespace Iris::Bench
+{
+	inline constexpr size_t BatchSize = 1024;
+
+	template<class Input, class Fty>
+	inline bool RegisterUnary(const std::string& name, Fty function)
+	{
+		Register(name, [function](State& state)
+			{
+				Input input = MakeInput<Input>();
+
+				for (auto _ : state)
+				{
+					DoNotOptimize(input);
+					DoNotOptimize(function(input));
+				}
+			});
+
+		return Register(name + "/batch1024", [function](State& state)
+			{
+				std::vector<Input> inputs(BatchSize);
+				for (auto& input : inputs)
+					input = MakeInput<Input>();
+
+				std::vector<decltype(function(inputs[0]))> outputs(BatchSize);
+				state.setItemsPerIteration(BatchSize);
+
+				for (auto _ : state)
+				{
+					for (size_t i = 0; i < BatchSize; ++i)
+						outputs[i] = function(inputs[i]);
+
+					ClobberMemory();
+				}
+			});
+	}
+
+	template<class Left, class Right, class Fty>
+	inline bool RegisterBinary(const std::string& name, Fty function)
+	{
+		Register(name, [function](State& state)
+			{
+				Left left = MakeInput<Left>();
+				Right right = MakeInput<Right>();
+
+				for (auto _ : state)
+				{
+					DoNotOptimize(left);
+					DoNotOptimize(right);
+					DoNotOptimize(function(left, right));
+				}
+			});
+
+		return Register(name + "/batch1024", [function](State& state)
+			{
+				std::vector<Left> lefts(BatchSize);
+				std::vector<Right> rights(BatchSize);
+				for (size_t i = 0; i < BatchSize; ++i)
+				{
+					lefts[i] = MakeInput<Left>();
+					rights[i] = MakeInput<Right>();
+				}
+
+				std::vector<decltype(function(lefts[0], rights[0]))> outputs(BatchSize);
+				state.setItemsPerIteration(BatchSize);
+
+				for (auto _ : state)
+				{
+					for (size_t i = 0; i < BatchSize; ++i)
+						outputs[i] = function(lefts[i], rights[i]);
+
+					ClobberMemory();
+				}
+			});
+	}
+
+	template<class T>
+	inline void DoNotOptimize(const T& value) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		const volatile char sink = *reinterpret_cast<const volatile char*>(&value);
+		static_cast<void>(sink);
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	template<class T>
+	inline void DoNotOptimize(T& value) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		volatile char* bytes = reinterpret_cast<volatile char*>(&value);
+		bytes[0] = bytes[0];
+		_ReadWriteBarrier();
+#else
+		// GCC may take the register alternative for a type wider than a register and clobber it; those stay in memory
+		if constexpr (sizeof(T) <= sizeof(void*))
+			asm volatile("" : "+m,r"(value) : : "memory");
+		else
+			asm volatile("" : "+m"(value) : : "memory");
+#endif
+	}
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Benchmark.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <typeindex>
+
+namespace Iris::Bench
+{
+	// Container sizes shared by the map benchmarks. Entries named /10M take hundreds of MB and several seconds each,
+	// so the CTest smoke run filters them out
+	struct ContainerSize
+	{
+		const char* name;
+
+		size_t count;
+	};
+
+	inline constexpr ContainerSize ContainerSizes[] = { { "1k", 1'000 }, { "100k", 100'000 }, { "10M", 10'000'000 } };
+
+	// Lookups per iteration, so large containers are timed over a fixed sample rather than every key
+	inline constexpr size_t LookupCount = 65536;
+
+	// splitmix64 finalizer; a bijection, so distinct inputs give distinct keys
+	constexpr uint64 MixKey(uint64 x) noexcept
+	{
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+		return x ^ (x >> 31);
+	}
+
+	// Key number 'index' in a scattered order; MakeKey(i) == MakeKey(j) only if i == j
+	constexpr uint64 MakeKey(size_t index) noexcept
+	{
+		return MixKey(static_cast<uint64>(index) * 0x9E3779B97F4A7C15ull);
+	}
+
+	// Keys 0 to count - 1
+	inline std::vector<uint64> MakeKeys(size_t count)
+	{
+		std::vector<uint64> keys(count);
+
+		for (size_t i = 0; i < count; ++i)
+			keys[i] = MakeKey(i);
+
+		return keys;
+	}
+
+	// LookupCount keys drawn at random from the first 'count', or from past them so that none is present
+	inline std::vector<uint64> MakeLookups(size_t count, bool hit)
+	{
+		std::vector<uint64> lookups(LookupCount);
+
+		for (size_t i = 0; i < LookupCount; ++i)
+		{
+			const auto index = static_cast<size_t>(MixKey(i + 1) % count);
+			lookups[i] = MakeKey(hit ? index : (count + index));
+		}
+
+		return lookups;
+	}
+
+	// Pairs (MakeKey(i), i) for i in [0, count), in key order for 'sorted' and scattered otherwise
+	inline std::vector<std::pair<uint64, uint64>> MakePairs(size_t count, bool sorted = false)
+	{
+		std::vector<std::pair<uint64, uint64>> pairs(count);
+
+		for (size_t i = 0; i < count; ++i)
+			pairs[i] = { MakeKey(i), i };
+
+		if (sorted)
+			std::sort(pairs.begin(), pairs.end());
+
+		return pairs;
+	}
+
+	// The map of MakePairs(count) built through its range constructor. Only the last one requested is kept, so
+	// consecutive entries on one map share it and the /10M maps of different types are never alive together
+	template<class Map>
+	const Map& FilledMap(size_t count)
+	{
+		struct Cache
+		{
+			std::type_index type = typeid(void);
+
+			size_t count = 0;
+
+			std::shared_ptr<const void> map;
+		};
+
+		static Cache cache;
+
+		if (cache.type != typeid(Map) || cache.count != count)
+		{
+			cache.map.reset();
+
+			const auto pairs = MakePairs(count);
+			cache.map = std::make_shared<const Map>(pairs.begin(), pairs.end());
+			cache.type = typeid(Map);
+			cache.count = count;
+		}
+
+		return *static_cast<const Map*>(cache.map.get());
+	}
+
+	// find(hit), find(miss) and iterate entries at each of ContainerSizes for any map with find() and pair iterators
+	template<class Map>
+	void RegisterMapReads(const std::string& name)
+	{
+		for (const auto& size : ContainerSizes)
+		{
+			const auto count = size.count;
+
+			for (const bool hit : { true, false })
+			{
+				Register(name + (hit ? "/find(hit)/" : "/find(miss)/") + size.name, [count, hit](State& state)
+					{
+						const auto& map = FilledMap<Map>(count);
+						const auto lookups = MakeLookups(count, hit);
+
+						state.setItemsPerIteration(LookupCount);
+						for (auto _ : state)
+						{
+							uint64 sum = 0;
+
+							for (const auto key : lookups)
+							{
+								const auto it = map.find(key);
+
+								if (it != map.end())
+									sum += it->second;
+							}
+
+							DoNotOptimize(sum);
+						}
+					});
+			}
+
+			Register(name + "/iterate/" + size.name, [count](State& state)
+				{
+					const auto& map = FilledMap<Map>(count);
+
+					state.setItemsPerIteration(count);
+					for (auto _ : state)
+					{
+						uint64 sum = 0;
+
+						for (const auto& [key, value] : map)
+							sum += value;
+
+						DoNotOptimize(sum);
+					}
+				});
+		}
+	}
+}
\ No newline at end of file
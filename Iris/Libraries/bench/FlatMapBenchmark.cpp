@@ -0,0 +1,90 @@
+#include "ContainerInput.hpp"
+
+#include <Iris/Container/FlatMap.hpp>
+#include <Iris/Container/FlatSet.hpp>
+#include <Iris/Container/SortedMap.hpp>
+
+// FlatMap against SortedMap for tables built once and read often, with uint64 keys and values at 1k, 100k and
+// 10M entries: bulk construction from unsorted pairs, LookupCount successful and failed finds, and one pass over
+// every entry. The insert entries build one key at a time instead; FlatMap's is quadratic, so they only run at 1k.
+// Run 'IrisBench --filter "^(FlatMap|SortedMap)/"' for the comparison
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		template<class Map>
+		void RegisterMap(const std::string& name)
+		{
+			for (const auto& size : ContainerSizes)
+			{
+				const auto count = size.count;
+
+				Register(name + "/build/" + size.name, [count](State& state)
+					{
+						const auto pairs = MakePairs(count);
+
+						state.setItemsPerIteration(count);
+						for (auto _ : state)
+						{
+							const Map map(pairs.begin(), pairs.end());
+							DoNotOptimize(map.size());
+						}
+					});
+
+				if (count > 1'000)
+					continue;
+
+				Register(name + "/insert/" + size.name, [count](State& state)
+					{
+						const auto pairs = MakePairs(count);
+
+						state.setItemsPerIteration(count);
+						for (auto _ : state)
+						{
+							Map map;
+
+							for (const auto& pair : pairs)
+								map.insert(pair);
+
+							DoNotOptimize(map.size());
+						}
+					});
+			}
+
+			RegisterMapReads<Map>(name);
+		}
+
+		const bool gFlatMap = []()
+			{
+				RegisterMap<FlatMap<uint64, uint64>>("FlatMap");
+				RegisterMap<SortedMap<uint64, uint64>>("SortedMap");
+
+				// FlatSet shares FlatMap's search, so only its lookups are measured
+				for (const auto& size : ContainerSizes)
+				{
+					const auto count = size.count;
+
+					Register(std::string{ "FlatSet/contains(hit)/" } + size.name, [count](State& state)
+						{
+							const auto keys = MakeKeys(count);
+							const FlatSet<uint64> set(keys.begin(), keys.end());
+							const auto lookups = MakeLookups(count, true);
+
+							state.setItemsPerIteration(LookupCount);
+							for (auto _ : state)
+							{
+								size_t found = 0;
+
+								for (const auto key : lookups)
+									found += set.contains(key);
+
+								DoNotOptimize(found);
+							}
+						});
+				}
+
+				return true;
+			}();
+	}
+}
\ No newline at end of file
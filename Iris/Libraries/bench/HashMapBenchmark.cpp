@@ -0,0 +1,49 @@
+#include "ContainerInput.hpp"
+
+#include <unordered_map>
+
+#include <Iris/Container/HashMap.hpp>
+
+// HashMap against std::unordered_map with uint64 keys and values at 1k, 100k and 10M entries: inserting every key
+// into an empty map, LookupCount successful and failed finds, and one pass over every entry.
+// Run 'IrisBench --filter "^(HashMap|std::unordered_map)/"' for the comparison; add "/10M$" for the large size only
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		template<class Map>
+		void RegisterMap(const std::string& name)
+		{
+			for (const auto& size : ContainerSizes)
+			{
+				const auto count = size.count;
+
+				Register(name + "/insert/" + size.name, [count](State& state)
+					{
+						const auto keys = MakeKeys(count);
+
+						state.setItemsPerIteration(count);
+						for (auto _ : state)
+						{
+							Map map;
+
+							for (const auto key : keys)
+								map.emplace(key, key);
+
+							DoNotOptimize(map.size());
+						}
+					});
+			}
+
+			RegisterMapReads<Map>(name);
+		}
+
+		const bool gHashMap = []()
+			{
+				RegisterMap<HashMap<uint64, uint64>>("HashMap");
+				RegisterMap<std::unordered_map<uint64, uint64>>("std::unordered_map");
+				return true;
+			}();
+	}
+}
\ No newline at end of file
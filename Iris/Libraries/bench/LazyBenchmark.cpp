@@ -0,0 +1,149 @@
+#include "MathInput.hpp"
+
+#include <Iris/Math/LazyExpression.hpp>
+
+// The same expressions over 1024 elements written with the eager operators and with Lazy::Evaluate. The gap matters
+// most in unoptimized builds, so run the suite from a Debug build as well; the JSON context records the build type:
+//
+//   cmake -S . -B build-debug -DCMAKE_BUILD_TYPE=Debug && cmake --build build-debug --target IrisBench
+//   build-debug/bench/IrisBench --filter ^Lazy/ --json lazy-debug.json
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		constexpr float32 Scale = 0.75f;
+
+		struct Inputs
+		{
+			std::vector<Vector3> a, b, c, output;
+
+			std::vector<float32> scalars;
+
+			Vector3 d;
+
+			Quaternion rotation;
+
+			Inputs()
+				: a(BatchSize), b(BatchSize), c(BatchSize), output(BatchSize), scalars(BatchSize)
+				, d(MakeInput<Vector3>()), rotation(MakeInput<Quaternion>())
+			{
+				for (size_t i = 0; i < BatchSize; ++i)
+				{
+					a[i] = MakeInput<Vector3>();
+					b[i] = MakeInput<Vector3>();
+					c[i] = MakeInput<Vector3>();
+				}
+			}
+		};
+	}
+
+	IRIS_BENCHMARK("Lazy/a+b*s-cross(c,d)/eager/batch1024")
+	{
+		Inputs in;
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < BatchSize; ++i)
+				in.output[i] = in.a[i] + in.b[i] * Scale - in.c[i].cross(in.d);
+
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("Lazy/a+b*s-cross(c,d)/lazy/batch1024")
+	{
+		Inputs in;
+		const std::span<const Vector3> a{ in.a }, b{ in.b }, c{ in.c };
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			Lazy::Evaluate(Lazy::Each(a) + Lazy::Each(b) * Scale - Lazy::Cross(Lazy::Each(c), in.d), std::span<Vector3>{ in.output });
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("Lazy/(a+b)*0.5-(c-d)*s+a*b/eager/batch1024")
+	{
+		Inputs in;
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < BatchSize; ++i)
+				in.output[i] = (in.a[i] + in.b[i]) * 0.5f - (in.c[i] - in.d) * Scale + in.a[i] * in.b[i];
+
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("Lazy/(a+b)*0.5-(c-d)*s+a*b/lazy/batch1024")
+	{
+		Inputs in;
+		const std::span<const Vector3> a{ in.a }, b{ in.b }, c{ in.c };
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			Lazy::Evaluate((Lazy::Each(a) + Lazy::Each(b)) * 0.5f - (Lazy::Each(c) - in.d) * Scale + Lazy::Each(a) * Lazy::Each(b), std::span<Vector3>{ in.output });
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("Lazy/dot(a,b)*s+dot(c,d)/eager/batch1024")
+	{
+		Inputs in;
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < BatchSize; ++i)
+				in.scalars[i] = in.a[i].dot(in.b[i]) * Scale + in.c[i].dot(in.d);
+
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("Lazy/dot(a,b)*s+dot(c,d)/lazy/batch1024")
+	{
+		Inputs in;
+		const std::span<const Vector3> a{ in.a }, b{ in.b }, c{ in.c };
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			Lazy::Evaluate(Lazy::Dot(Lazy::Each(a), Lazy::Each(b)) * Scale + Lazy::Dot(Lazy::Each(c), in.d), std::span<float32>{ in.scalars });
+			ClobberMemory();
+		}
+	}
+
+	// Rotate needs whole values, so the lazy tree falls back to the eager operators per element
+	IRIS_BENCHMARK("Lazy/rotate(a,q)+b/eager/batch1024")
+	{
+		Inputs in;
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < BatchSize; ++i)
+				in.output[i] = in.a[i].rotate(in.rotation) + in.b[i];
+
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("Lazy/rotate(a,q)+b/lazy/batch1024")
+	{
+		Inputs in;
+		const std::span<const Vector3> a{ in.a }, b{ in.b };
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			Lazy::Evaluate(Lazy::Rotate(Lazy::Each(a), in.rotation) + Lazy::Each(b), std::span<Vector3>{ in.output });
+			ClobberMemory();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#include "Benchmark.hpp"
+
+int main(int argc, char** argv)
+{
+	return Iris::Bench::Main(argc, argv);
+}
\ No newline at end of file
@@ -0,0 +1,260 @@
+#include "MathInput.hpp"
+
+#include <Iris/Math/BatchTransform.hpp>
+
+// SinCos and the Fast* approximations, then every Vector2, Vector3, Quaternion and Matrix4x4 operation, each as a single call and as a 1024-element sweep
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		constexpr float32 BlendFactor = 0.3f;
+
+		const bool gTrig = []()
+			{
+				RegisterUnary<float32>("Math/Sin+Cos", [](float32 x) { return Vector2{ Math::Sin(x), Math::Cos(x) }; });
+				RegisterUnary<float32>("Math/SinCos", [](float32 x) { Vector2 v; Math::SinCos(x, v.y, v.x); return v; });
+				RegisterUnary<float32>("Math/FastSin", [](float32 x) { return Math::FastSin(x); });
+				RegisterUnary<float32>("Math/FastCos", [](float32 x) { return Math::FastCos(x); });
+				RegisterBinary<float32, float32>("Math/FastAtan2", [](float32 x, float32 y) { return Math::FastAtan2(x, y); });
+				RegisterUnary<float32>("Math/FastAcos", [](float32 x) { return Math::FastAcos(x / Math::Pi); });
+				return true;
+			}();
+
+		const bool gVector2 = []()
+			{
+				RegisterUnary<Vector2>("Vector2/operator-()", [](const Vector2& v) { return -v; });
+				RegisterBinary<Vector2, Vector2>("Vector2/operator+", [](const Vector2& a, const Vector2& b) { return a + b; });
+				RegisterBinary<Vector2, Vector2>("Vector2/operator-", [](const Vector2& a, const Vector2& b) { return a - b; });
+				RegisterBinary<Vector2, Vector2>("Vector2/operator*", [](const Vector2& a, const Vector2& b) { return a * b; });
+				RegisterBinary<Vector2, float32>("Vector2/operator*(float32)", [](const Vector2& a, float32 s) { return a * s; });
+				RegisterBinary<Vector2, Vector2>("Vector2/operator/", [](const Vector2& a, const Vector2& b) { return a / b; });
+				RegisterBinary<Vector2, Vector2>("Vector2/operator+=", [](Vector2 a, const Vector2& b) { return a += b; });
+				RegisterBinary<Vector2, Vector2>("Vector2/operator==", [](const Vector2& a, const Vector2& b) { return a == b; });
+				RegisterUnary<Vector2>("Vector2/lengthSq", [](const Vector2& v) { return v.lengthSq(); });
+				RegisterUnary<Vector2>("Vector2/length", [](const Vector2& v) { return v.length(); });
+				RegisterBinary<Vector2, Vector2>("Vector2/distanceSq", [](const Vector2& a, const Vector2& b) { return a.distanceSq(b); });
+				RegisterBinary<Vector2, Vector2>("Vector2/distance", [](const Vector2& a, const Vector2& b) { return a.distance(b); });
+				RegisterBinary<Vector2, Vector2>("Vector2/dot", [](const Vector2& a, const Vector2& b) { return a.dot(b); });
+				RegisterBinary<Vector2, Vector2>("Vector2/cross", [](const Vector2& a, const Vector2& b) { return a.cross(b); });
+				RegisterBinary<Vector2, Vector2>("Vector2/angle", [](const Vector2& a, const Vector2& b) { return a.angle(b); });
+				RegisterUnary<Vector2>("Vector2/inverse", [](const Vector2& v) { return v.inverse(); });
+				RegisterUnary<Vector2>("Vector2/normalize", [](const Vector2& v) { return v.normalize(); });
+				RegisterUnary<Vector2>("Vector2/normalize(threshold)", [](const Vector2& v) { return v.normalize(1e-6f); });
+				RegisterBinary<Vector2, float32>("Vector2/rotate", [](const Vector2& v, float32 r) { return v.rotate(r); });
+				RegisterBinary<Vector2, Vector2>("Vector2/project", [](const Vector2& a, const Vector2& b) { return a.project(b); });
+				RegisterBinary<Vector2, Vector2>("Vector2/reflect", [](const Vector2& a, const Vector2& b) { return a.reflect(b); });
+				RegisterUnary<Vector2>("Vector2/isZero", [](const Vector2& v) { return v.isZero(); });
+				RegisterUnary<Vector2>("Vector2/hasZero", [](const Vector2& v) { return v.hasZero(); });
+				RegisterUnary<Vector2>("Vector2/MakeUnit", [](const Vector2& v) { return Vector2::MakeUnit(v.x, v.y); });
+				RegisterUnary<float32>("Vector2/FromAngle", [](float32 r) { return Vector2::FromAngle(r); });
+				RegisterBinary<Vector2, Vector2>("Vector2/Lerp", [](const Vector2& a, const Vector2& b) { return Vector2::Lerp(a, b, BlendFactor); });
+				RegisterBinary<Vector2, Vector2>("Vector2/Slerp", [](const Vector2& a, const Vector2& b) { return Vector2::Slerp(a, b, BlendFactor); });
+				return true;
+			}();
+
+		const bool gVector3 = []()
+			{
+				RegisterUnary<Vector3>("Vector3/operator-()", [](const Vector3& v) { return -v; });
+				RegisterBinary<Vector3, Vector3>("Vector3/operator+", [](const Vector3& a, const Vector3& b) { return a + b; });
+				RegisterBinary<Vector3, Vector3>("Vector3/operator-", [](const Vector3& a, const Vector3& b) { return a - b; });
+				RegisterBinary<Vector3, Vector3>("Vector3/operator*", [](const Vector3& a, const Vector3& b) { return a * b; });
+				RegisterBinary<Vector3, float32>("Vector3/operator*(float32)", [](const Vector3& a, float32 s) { return a * s; });
+				RegisterBinary<Vector3, Vector3>("Vector3/operator/", [](const Vector3& a, const Vector3& b) { return a / b; });
+				RegisterBinary<Vector3, Vector3>("Vector3/operator+=", [](Vector3 a, const Vector3& b) { return a += b; });
+				RegisterBinary<Vector3, Vector3>("Vector3/operator==", [](const Vector3& a, const Vector3& b) { return a == b; });
+				RegisterUnary<Vector3>("Vector3/lengthSq", [](const Vector3& v) { return v.lengthSq(); });
+				RegisterUnary<Vector3>("Vector3/length", [](const Vector3& v) { return v.length(); });
+				RegisterBinary<Vector3, Vector3>("Vector3/distanceSq", [](const Vector3& a, const Vector3& b) { return a.distanceSq(b); });
+				RegisterBinary<Vector3, Vector3>("Vector3/distance", [](const Vector3& a, const Vector3& b) { return a.distance(b); });
+				RegisterBinary<Vector3, Vector3>("Vector3/dot", [](const Vector3& a, const Vector3& b) { return a.dot(b); });
+				RegisterBinary<Vector3, Vector3>("Vector3/cross", [](const Vector3& a, const Vector3& b) { return a.cross(b); });
+				RegisterUnary<Vector3>("Vector3/inverse", [](const Vector3& v) { return v.inverse(); });
+				RegisterUnary<Vector3>("Vector3/normalize", [](const Vector3& v) { return v.normalize(); });
+				RegisterUnary<Vector3>("Vector3/normalize(threshold)", [](const Vector3& v) { return v.normalize(1e-6f); });
+				RegisterBinary<Vector3, Quaternion>("Vector3/rotate", [](const Vector3& v, const Quaternion& q) { return v.rotate(q); });
+				RegisterBinary<Vector3, Vector3>("Vector3/project", [](const Vector3& a, const Vector3& b) { return a.project(b); });
+				RegisterBinary<Vector3, Vector3>("Vector3/reflect", [](const Vector3& a, const Vector3& b) { return a.reflect(b); });
+				RegisterBinary<Vector3, Matrix4x4>("Vector3/transform", [](const Vector3& v, const Matrix4x4& m) { return v.transform(m); });
+				RegisterUnary<Vector3>("Vector3/isZero", [](const Vector3& v) { return v.isZero(); });
+				RegisterUnary<Vector3>("Vector3/hasZero", [](const Vector3& v) { return v.hasZero(); });
+				RegisterUnary<Vector3>("Vector3/MakeUnit", [](const Vector3& v) { return Vector3::MakeUnit(v.x, v.y, v.z); });
+				RegisterBinary<Vector3, Vector3>("Vector3/Lerp", [](const Vector3& a, const Vector3& b) { return Vector3::Lerp(a, b, BlendFactor); });
+				RegisterBinary<Vector3, Vector3>("Vector3/Slerp", [](const Vector3& a, const Vector3& b) { return Vector3::Slerp(a, b, BlendFactor); });
+				return true;
+			}();
+
+		const bool gQuaternion = []()
+			{
+				RegisterUnary<Quaternion>("Quaternion/operator-()", [](const Quaternion& q) { return -q; });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/operator+", [](const Quaternion& a, const Quaternion& b) { return a + b; });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/operator-", [](const Quaternion& a, const Quaternion& b) { return a - b; });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/operator*", [](const Quaternion& a, const Quaternion& b) { return a * b; });
+				RegisterBinary<Quaternion, float32>("Quaternion/operator*(float32)", [](const Quaternion& a, float32 s) { return a * s; });
+				RegisterBinary<Quaternion, float32>("Quaternion/operator/(float32)", [](const Quaternion& a, float32 s) { return a / (s + 4.f); });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/operator*=", [](Quaternion a, const Quaternion& b) { return a *= b; });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/operator==", [](const Quaternion& a, const Quaternion& b) { return a == b; });
+				RegisterUnary<Quaternion>("Quaternion/lengthSq", [](const Quaternion& q) { return q.lengthSq(); });
+				RegisterUnary<Quaternion>("Quaternion/length", [](const Quaternion& q) { return q.length(); });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/dot", [](const Quaternion& a, const Quaternion& b) { return a.dot(b); });
+				RegisterUnary<Quaternion>("Quaternion/inverse", [](const Quaternion& q) { return q.inverse(); });
+				RegisterUnary<Quaternion>("Quaternion/conjugate", [](const Quaternion& q) { return q.conjugate(); });
+				RegisterUnary<Quaternion>("Quaternion/normalize", [](const Quaternion& q) { return q.normalize(); });
+				RegisterUnary<Quaternion>("Quaternion/normalize(threshold)", [](const Quaternion& q) { return q.normalize(1e-6f); });
+				RegisterBinary<Vector3, float32>("Quaternion/FromAxisAngle", [](const Vector3& axis, float32 r) { return Quaternion::FromAxisAngle(axis, r); });
+				RegisterUnary<Matrix4x4>("Quaternion/FromMatrix4x4", [](const Matrix4x4& m) { return Quaternion::FromMatrix4x4(m); });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/Lerp", [](const Quaternion& a, const Quaternion& b) { return Quaternion::Lerp(a, b, BlendFactor); });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/Slerp", [](const Quaternion& a, const Quaternion& b) { return Quaternion::Slerp(a, b, BlendFactor); });
+				RegisterBinary<Quaternion, Quaternion>("Quaternion/Nlerp", [](const Quaternion& a, const Quaternion& b) { return Quaternion::Nlerp(a, b, BlendFactor); });
+				return true;
+			}();
+
+		// The inverse as it was before the shared sub-determinant kernel: the 24-term determinant, then every cofactor
+		// as its own six-term 3x3 determinant. Kept only as the baseline for Matrix4x4/inverse
+		float32 Cofactor(const Matrix4x4& m, size_t row, size_t column)
+		{
+			size_t r[3], c[3];
+
+			for (size_t i = 0, k = 0; i < 4; ++i)
+				if (i != row) r[k++] = i;
+
+			for (size_t i = 0, k = 0; i < 4; ++i)
+				if (i != column) c[k++] = i;
+
+			const auto& a = m.m;
+			const float32 minor = a[r[0]][c[0]] * a[r[1]][c[1]] * a[r[2]][c[2]] + a[r[0]][c[1]] * a[r[1]][c[2]] * a[r[2]][c[0]] + a[r[0]][c[2]] * a[r[1]][c[0]] * a[r[2]][c[1]]
+				- a[r[0]][c[0]] * a[r[1]][c[2]] * a[r[2]][c[1]] - a[r[0]][c[1]] * a[r[1]][c[0]] * a[r[2]][c[2]] - a[r[0]][c[2]] * a[r[1]][c[1]] * a[r[2]][c[0]];
+
+			return ((row + column) % 2 == 0) ? minor : -minor;
+		}
+
+		Matrix4x4 CofactorInverse(const Matrix4x4& m)
+		{
+			const float32 det = m.m00 * m.m11 * m.m22 * m.m33 + m.m00 * m.m12 * m.m23 * m.m31 + m.m00 * m.m13 * m.m21 * m.m32
+				+ m.m01 * m.m10 * m.m23 * m.m32 + m.m01 * m.m12 * m.m20 * m.m33 + m.m01 * m.m13 * m.m22 * m.m30
+				+ m.m02 * m.m10 * m.m21 * m.m33 + m.m02 * m.m11 * m.m23 * m.m30 + m.m02 * m.m13 * m.m20 * m.m31
+				+ m.m03 * m.m10 * m.m22 * m.m31 + m.m03 * m.m11 * m.m20 * m.m32 + m.m03 * m.m12 * m.m21 * m.m30
+				- m.m00 * m.m11 * m.m23 * m.m32 - m.m00 * m.m12 * m.m21 * m.m33 - m.m00 * m.m13 * m.m22 * m.m31
+				- m.m01 * m.m10 * m.m22 * m.m33 - m.m01 * m.m12 * m.m23 * m.m30 - m.m01 * m.m13 * m.m20 * m.m32
+				- m.m02 * m.m10 * m.m23 * m.m31 - m.m02 * m.m11 * m.m20 * m.m33 - m.m02 * m.m13 * m.m21 * m.m30
+				- m.m03 * m.m10 * m.m21 * m.m32 - m.m03 * m.m11 * m.m22 * m.m30 - m.m03 * m.m12 * m.m20 * m.m31;
+
+			if (det == 0.f)
+				return Matrix4x4::Identity();
+
+			Matrix4x4 adjoint;
+
+			for (size_t row = 0; row < 4; ++row)
+			{
+				for (size_t column = 0; column < 4; ++column)
+					adjoint.m[column][row] = Cofactor(m, row, column);
+			}
+
+			return adjoint * (1.f / det);
+		}
+
+		const bool gMatrix4x4 = []()
+			{
+				RegisterBinary<Matrix4x4, Matrix4x4>("Matrix4x4/operator*", [](const Matrix4x4& a, const Matrix4x4& b) { return a * b; });
+				RegisterBinary<Matrix4x4, float32>("Matrix4x4/operator*(float32)", [](const Matrix4x4& a, float32 s) { return a * s; });
+				RegisterBinary<Matrix4x4, Matrix4x4>("Matrix4x4/operator*=", [](Matrix4x4 a, const Matrix4x4& b) { return a *= b; });
+				RegisterUnary<Matrix4x4>("Matrix4x4/determinant", [](const Matrix4x4& m) { return m.determinant(); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/adjoint", [](const Matrix4x4& m) { return m.adjoint(); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/transpose", [](const Matrix4x4& m) { return m.transpose(); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/inverse", [](const Matrix4x4& m) { return m.inverse(); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/inverse(cofactor)", [](const Matrix4x4& m) { return CofactorInverse(m); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/inverseChecked", [](const Matrix4x4& m) { return m.inverseChecked(); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/inverseAffine", [](const Matrix4x4& m) { return m.inverseAffine(); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/inverseRigid", [](const Matrix4x4& m) { return m.inverseRigid(); });
+				RegisterUnary<Matrix4x4>("Matrix4x4/isAffine", [](const Matrix4x4& m) { return m.isAffine(); });
+				RegisterUnary<Vector3>("Matrix4x4/Translate", [](const Vector3& v) { return Matrix4x4::Translate(v); });
+				RegisterUnary<float32>("Matrix4x4/RotateX", [](float32 r) { return Matrix4x4::RotateX(r); });
+				RegisterUnary<float32>("Matrix4x4/RotateY", [](float32 r) { return Matrix4x4::RotateY(r); });
+				RegisterUnary<float32>("Matrix4x4/RotateZ", [](float32 r) { return Matrix4x4::RotateZ(r); });
+				RegisterUnary<Vector3>("Matrix4x4/Scaling", [](const Vector3& v) { return Matrix4x4::Scaling(v); });
+				RegisterUnary<float32>("Matrix4x4/Scaling(float32)", [](float32 s) { return Matrix4x4::Scaling(s); });
+				RegisterBinary<Vector3, float32>("Matrix4x4/FromAxisAngle", [](const Vector3& axis, float32 r) { return Matrix4x4::FromAxisAngle(axis, r); });
+				return true;
+			}();
+	}
+
+	IRIS_BENCHMARK("BatchTransform/TransformPoints/batch1024")
+	{
+		const auto matrix = MakeInput<Matrix4x4>();
+		std::vector<Vector3> input(BatchSize), output(BatchSize);
+		for (auto& v : input)
+			v = MakeInput<Vector3>();
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			TransformPoints(matrix, input, output);
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("BatchTransform/TransformDirections/batch1024")
+	{
+		const auto matrix = MakeInput<Matrix4x4>();
+		std::vector<Vector3> input(BatchSize), output(BatchSize);
+		for (auto& v : input)
+			v = MakeInput<Vector3>();
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			TransformDirections(matrix, input, output);
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("BatchTransform/TransformPointsStream/batch1024")
+	{
+		const auto matrix = MakeInput<Matrix4x4>();
+		std::vector<Vector3> input(BatchSize), output(BatchSize);
+		for (auto& v : input)
+			v = MakeInput<Vector3>();
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			TransformPointsStream(matrix, input, output);
+			ClobberMemory();
+		}
+	}
+
+	// Compare with Quaternion/Slerp/batch1024 and Quaternion/Nlerp/batch1024, which loop over the scalar functions
+	IRIS_BENCHMARK("Quaternion/SlerpBatch/batch1024")
+	{
+		std::vector<Quaternion> from(BatchSize), to(BatchSize), output(BatchSize);
+		for (size_t i = 0; i < BatchSize; ++i)
+		{
+			from[i] = MakeInput<Quaternion>();
+			to[i] = MakeInput<Quaternion>();
+		}
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			Quaternion::SlerpBatch(from, to, BlendFactor, output);
+			ClobberMemory();
+		}
+	}
+
+	IRIS_BENCHMARK("Quaternion/NlerpBatch/batch1024")
+	{
+		std::vector<Quaternion> from(BatchSize), to(BatchSize), output(BatchSize);
+		for (size_t i = 0; i < BatchSize; ++i)
+		{
+			from[i] = MakeInput<Quaternion>();
+			to[i] = MakeInput<Quaternion>();
+		}
+
+		state.setItemsPerIteration(BatchSize);
+		for (auto _ : state)
+		{
+			Quaternion::NlerpBatch(from, to, BlendFactor, output);
+			ClobberMemory();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Benchmark.hpp"
+
+#include <Iris/Math/Vector2.hpp>
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Quaternion.hpp>
+#include <Iris/Math/Matrix4x4.hpp>
+
+namespace Iris::Bench
+{
+	// Components are kept away from zero so the throwing divisions never fire inside a timed loop
+
+	inline float32 RandomComponent() noexcept
+	{
+		const float32 magnitude = RandomFloat(0.25f, 4.f);
+		return (RandomFloat(0.f, 1.f) < 0.5f) ? -magnitude : magnitude;
+	}
+
+	template<>
+	inline float32 MakeInput<float32>()
+	{
+		return RandomFloat(-Math::Pi, Math::Pi);
+	}
+
+	template<>
+	inline Vector2 MakeInput<Vector2>()
+	{
+		return Vector2{ RandomComponent(), RandomComponent() };
+	}
+
+	template<>
+	inline Vector3 MakeInput<Vector3>()
+	{
+		return Vector3{ RandomComponent(), RandomComponent(), RandomComponent() };
+	}
+
+	template<>
+	inline Quaternion MakeInput<Quaternion>()
+	{
+		return Quaternion{ RandomComponent(), RandomComponent(), RandomComponent(), RandomComponent() }.normalize();
+	}
+
+	// Rigid transform with a uniform scale, so every inverse variant applies
+	template<>
+	inline Matrix4x4 MakeInput<Matrix4x4>()
+	{
+		const auto axis = MakeInput<Vector3>().normalize();
+		const auto angle = MakeInput<float32>();
+		const auto offset = MakeInput<Vector3>();
+
+		return Matrix4x4::FromAxisAngle(axis, angle) * Matrix4x4::Translate(offset);
+	}
+}
\ No newline at end of file
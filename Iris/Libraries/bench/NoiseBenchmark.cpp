@@ -0,0 +1,119 @@
+#include "MathInput.hpp"
+
+#include <Iris/Math/Noise.hpp>
+
+// Perlin and simplex noise one point at a time, through the SIMD batch Fbm and through the grid fill; items/s is samples per second
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		constexpr size_t GridSize2D = 256;
+
+		constexpr size_t GridSize3D = 64;
+
+		NoiseSettings MakeSettings(NoiseType type, uint32 octaves)
+		{
+			NoiseSettings settings;
+			settings.type = type;
+			settings.octaves = octaves;
+			settings.frequency = 0.05f;
+			return settings;
+		}
+
+		const bool gNoise = []()
+			{
+				RegisterUnary<Vector2>("Noise/Perlin2D", [](const Vector2& p) { return Perlin(p); });
+				RegisterUnary<Vector2>("Noise/Simplex2D", [](const Vector2& p) { return Simplex(p); });
+				RegisterUnary<Vector3>("Noise/Perlin3D", [](const Vector3& p) { return Perlin(p); });
+				RegisterUnary<Vector3>("Noise/Simplex3D", [](const Vector3& p) { return Simplex(p); });
+				RegisterUnary<Vector3>("Noise/Perlin4D", [](const Vector3& p) { return Perlin(p, p.x * 0.5f); });
+				RegisterUnary<Vector3>("Noise/Simplex4D", [](const Vector3& p) { return Simplex(p, p.x * 0.5f); });
+
+				for (const auto type : { NoiseType::Perlin, NoiseType::Simplex })
+				{
+					const std::string name = (type == NoiseType::Perlin) ? "Perlin" : "Simplex";
+					const auto settings = MakeSettings(type, 4);
+
+					Register("Noise/Fbm2D/" + name + "/4octaves/batch1024", [settings](State& state)
+						{
+							std::vector<Vector2> points(BatchSize);
+							std::vector<float32> values(BatchSize);
+							for (auto& p : points)
+								p = MakeInput<Vector2>() * 50.f;
+
+							state.setItemsPerIteration(BatchSize);
+							for (auto _ : state)
+							{
+								Fbm(points, values, settings);
+								ClobberMemory();
+							}
+						});
+
+					Register("Noise/Fbm3D/" + name + "/4octaves/batch1024", [settings](State& state)
+						{
+							std::vector<Vector3> points(BatchSize);
+							std::vector<float32> values(BatchSize);
+							for (auto& p : points)
+								p = MakeInput<Vector3>() * 50.f;
+
+							state.setItemsPerIteration(BatchSize);
+							for (auto _ : state)
+							{
+								Fbm(points, values, settings);
+								ClobberMemory();
+							}
+						});
+
+					Register("Noise/Fbm4D/" + name + "/4octaves/batch1024", [settings](State& state)
+						{
+							std::vector<Vector3> points(BatchSize);
+							std::vector<float32> values(BatchSize);
+							for (auto& p : points)
+								p = MakeInput<Vector3>() * 50.f;
+
+							state.setItemsPerIteration(BatchSize);
+							for (auto _ : state)
+							{
+								Fbm(points, 0.75f, values, settings);
+								ClobberMemory();
+							}
+						});
+
+					// One octave, so samples per second compare directly with the single-point entries
+					for (const size_t threads : { size_t{ 1 }, size_t{ 0 } })
+					{
+						const std::string suffix = (threads == 0) ? "/threads" : "";
+
+						Register("Noise/FillNoiseGrid2D/" + name + "/256x256" + suffix, [type, threads](State& state)
+							{
+								std::vector<float32> values(GridSize2D * GridSize2D);
+								const auto settings = MakeSettings(type, 1);
+
+								state.setItemsPerIteration(values.size());
+								for (auto _ : state)
+								{
+									FillNoiseGrid(Vector2{ 0.f, 0.f }, Vector2{ 1.f, 1.f }, GridSize2D, GridSize2D, values, settings, threads);
+									ClobberMemory();
+								}
+							});
+
+						Register("Noise/FillNoiseGrid3D/" + name + "/64x64x64" + suffix, [type, threads](State& state)
+							{
+								std::vector<float32> values(GridSize3D * GridSize3D * GridSize3D);
+								const auto settings = MakeSettings(type, 1);
+
+								state.setItemsPerIteration(values.size());
+								for (auto _ : state)
+								{
+									FillNoiseGrid(Vector3{ 0.f, 0.f, 0.f }, Vector3{ 1.f, 1.f, 1.f }, GridSize3D, GridSize3D, GridSize3D, values, settings, threads);
+									ClobberMemory();
+								}
+							});
+					}
+				}
+
+				return true;
+			}();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "MathInput.hpp"
+
+#include <Iris/Math/Skinning.hpp>
+
+#include <array>
+
+// Four-influence skinning of a 1024 vertex SoA mesh against a 64 bone palette, with and without normals; items/s is
+// vertices per second
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		constexpr size_t PaletteSize = 64;
+
+		struct SkinningMesh
+		{
+			std::vector<float32> px, py, pz, nx, ny, nz;
+
+			std::vector<std::array<uint16, 4>> bones;
+
+			std::vector<std::array<float32, 4>> weights;
+
+			std::vector<float32> ox, oy, oz, onx, ony, onz;
+
+			SkinningMesh()
+				: px(BatchSize), py(BatchSize), pz(BatchSize), nx(BatchSize), ny(BatchSize), nz(BatchSize)
+				, bones(BatchSize), weights(BatchSize)
+				, ox(BatchSize), oy(BatchSize), oz(BatchSize), onx(BatchSize), ony(BatchSize), onz(BatchSize)
+			{
+				for (size_t i = 0; i < BatchSize; ++i)
+				{
+					const auto position = MakeInput<Vector3>();
+					const auto normal = MakeInput<Vector3>().normalize();
+
+					px[i] = position.x;
+					py[i] = position.y;
+					pz[i] = position.z;
+					nx[i] = normal.x;
+					ny[i] = normal.y;
+					nz[i] = normal.z;
+
+					for (size_t k = 0; k < 4; ++k)
+						bones[i][k] = static_cast<uint16>(RandomFloat(0.f, 1.f) * (PaletteSize - 1));
+
+					weights[i] = { 0.4f, 0.3f, 0.2f, 0.1f };
+				}
+			}
+
+			SkinningInput input(bool normals) const
+			{
+				SkinningInput result;
+				result.positionX = px;
+				result.positionY = py;
+				result.positionZ = pz;
+				result.bones = bones;
+				result.weights = weights;
+
+				if (normals)
+				{
+					result.normalX = nx;
+					result.normalY = ny;
+					result.normalZ = nz;
+				}
+
+				return result;
+			}
+
+			SkinningOutput output(bool normals)
+			{
+				SkinningOutput result;
+				result.positionX = ox;
+				result.positionY = oy;
+				result.positionZ = oz;
+
+				if (normals)
+				{
+					result.normalX = onx;
+					result.normalY = ony;
+					result.normalZ = onz;
+				}
+
+				return result;
+			}
+		};
+
+		const bool gSkinning = []()
+			{
+				for (const bool normals : { false, true })
+				{
+					const std::string suffix = normals ? "/normals/batch1024" : "/batch1024";
+
+					Register("Skinning/SkinLinear" + suffix, [normals](State& state)
+						{
+							std::vector<Matrix4x4> palette(PaletteSize);
+							for (auto& bone : palette)
+								bone = MakeInput<Matrix4x4>();
+
+							SkinningMesh mesh;
+							const auto input = mesh.input(normals);
+							const auto output = mesh.output(normals);
+
+							state.setItemsPerIteration(BatchSize);
+							for (auto _ : state)
+							{
+								SkinLinear(palette, input, output);
+								ClobberMemory();
+							}
+						});
+
+					Register("Skinning/SkinDualQuaternion" + suffix, [normals](State& state)
+						{
+							std::vector<DualQuaternion> palette(PaletteSize);
+							for (auto& bone : palette)
+								bone = DualQuaternion{ MakeInput<Quaternion>(), MakeInput<Vector3>() };
+
+							SkinningMesh mesh;
+							const auto input = mesh.input(normals);
+							const auto output = mesh.output(normals);
+
+							state.setItemsPerIteration(BatchSize);
+							for (auto _ : state)
+							{
+								SkinDualQuaternion(palette, input, output);
+								ClobberMemory();
+							}
+						});
+				}
+
+				return true;
+			}();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "Benchmark.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <Iris/Container/Array.hpp>
+#include <Iris/Container/SmallArray.hpp>
+
+// SmallArray<uint32, 8> against Array<uint32> on many short lists, the per-actor case it exists for: filling
+// ListCount lists with addLast, then copying them. Every entry reports allocs/list, counted through
+// CountingAllocator, next to the timing. Lists of 4 and 8 elements stay inline; 16 spills to the heap.
+// 'mixed' draws lengths of 0 to 12, so nearly a third of the lists spill.
+// Run 'IrisBench --filter "^(SmallArray|Array)/"' for the comparison
+
+namespace Iris::Bench
+{
+	namespace
+	{
+		constexpr size_t ListCount = 1024;
+
+		uint64 gAllocations = 0;
+
+		// std::allocator that counts every allocate call in gAllocations
+		template<class Type>
+		struct CountingAllocator
+		{
+			using value_type = Type;
+
+			CountingAllocator() = default;
+
+			template<class Other>
+			CountingAllocator(const CountingAllocator<Other>&) noexcept {}
+
+			Type* allocate(size_t count)
+			{
+				++gAllocations;
+				return std::allocator<Type>{}.allocate(count);
+			}
+
+			void deallocate(Type* pointer, size_t count) noexcept
+			{
+				std::allocator<Type>{}.deallocate(pointer, count);
+			}
+
+			template<class Other>
+			bool operator==(const CountingAllocator<Other>&) const noexcept { return true; }
+		};
+
+		using Small = SmallArray<uint32, 8, CountingAllocator<uint32>>;
+
+		using Heap = Array<uint32, CountingAllocator<uint32>>;
+
+		std::vector<size_t> MakeLengths(size_t length)
+		{
+			std::vector<size_t> lengths(ListCount, length);
+
+			if (length == 0)
+			{
+				for (auto& l : lengths)
+					l = static_cast<size_t>(RandomFloat(0.f, 12.99f));
+			}
+
+			return lengths;
+		}
+
+		void SetAllocationCounter(State& state, uint64 allocations)
+		{
+			state.setCounter("allocs/list", static_cast<double>(allocations) / static_cast<double>(state.iterations() * ListCount));
+		}
+
+		template<class List>
+		void RegisterList(const std::string& name)
+		{
+			// 0 stands for the mixed lengths
+			for (const size_t length : { size_t{ 4 }, size_t{ 8 }, size_t{ 16 }, size_t{ 0 } })
+			{
+				const std::string suffix = (length == 0) ? "mixed" : ("len" + std::to_string(length));
+				const auto lengths = MakeLengths(length);
+
+				size_t elements = 0;
+				for (const auto l : lengths)
+					elements += l;
+
+				Register(name + "/addLast/" + suffix, [lengths, elements](State& state)
+					{
+						std::vector<List> lists(ListCount);
+
+						state.setItemsPerIteration(elements);
+						gAllocations = 0;
+						for (auto _ : state)
+						{
+							for (size_t i = 0; i < ListCount; ++i)
+							{
+								auto& list = lists[i];
+								list = List{};
+
+								for (size_t k = 0; k < lengths[i]; ++k)
+									list.addLast(static_cast<uint32>(k));
+							}
+
+							ClobberMemory();
+						}
+
+						SetAllocationCounter(state, gAllocations);
+					});
+
+				Register(name + "/copy/" + suffix, [lengths, elements](State& state)
+					{
+						std::vector<List> sources(ListCount);
+
+						for (size_t i = 0; i < ListCount; ++i)
+						{
+							for (size_t k = 0; k < lengths[i]; ++k)
+								sources[i].addLast(static_cast<uint32>(k));
+						}
+
+						state.setItemsPerIteration(elements);
+						gAllocations = 0;
+						for (auto _ : state)
+						{
+							uint64 sum = 0;
+
+							for (const auto& source : sources)
+							{
+								const List copy = source;
+								copy.forEach([&sum](uint32 value) { sum += value; });
+							}
+
+							DoNotOptimize(sum);
+						}
+
+						SetAllocationCounter(state, gAllocations);
+					});
+			}
+		}
+
+		const bool gSmallArray = []()
+			{
+				RegisterList<Small>("SmallArray");
+				RegisterList<Heap>("Array");
+				return true;
+			}();
+	}
+}
\ No newline at end of file
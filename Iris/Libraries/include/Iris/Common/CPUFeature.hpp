@@ -0,0 +1,32 @@
+#pragma once
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define IRIS_SIMD_X86 1
+#endif
+
+// MSVC accepts any intrinsic regardless of /arch, so no per-function target is needed
+#if defined(_MSC_VER) && !defined(__clang__)
+	#define IRIS_TARGET_AVX2
+	#define IRIS_TARGET_F16C
+#else
+	#define IRIS_TARGET_AVX2 __attribute__((target("avx,avx2,fma")))
+	#define IRIS_TARGET_F16C __attribute__((target("avx,f16c")))
+#endif
+
+namespace Iris
+{
+	struct CPUFeature final
+	{
+		bool sse41 = false;
+
+		bool avx = false;
+
+		bool avx2 = false;
+
+		bool fma = false;
+
+		bool f16c = false;
+
+		static const CPUFeature& Get()noexcept;
+	};
+}
\ No newline at end of file
@@ -32,4 +32,8 @@ namespace Iris::Concept
 
 	template<class T, class U>
 	concept LineageOf = std::is_base_of_v<T, U> || std::is_base_of_v<U, T>;
+
+	// Hashers and comparators that accept keys of other types, as std::less<> does
+	template<class T>
+	concept Transparent = requires { typename T::is_transparent; };
 }
\ No newline at end of file
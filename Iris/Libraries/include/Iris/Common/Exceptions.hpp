@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <cstdio>
+#include <cstring>
 
 namespace Iris::Error
 {
@@ -46,10 +47,10 @@ namespace Iris::Error
 
 		static void MakeMessage(Message& msg, const char* title, const char* text)
 		{
-			size_t buf = (sizeof(title) + sizeof(text)) * CHAR_BIT;
+			const size_t buf = std::strlen(title) + std::strlen(text) + 2;
 			msg.text = new char[buf];
 			msg.used = true;
-			sprintf_s(msg.text, buf, "%s %s", title, text);
+			std::snprintf(msg.text, buf, "%s %s", title, text);
 		}
 
 	private:
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <bit>
 #include <cstdint>
 #include <limits>
 
@@ -77,164 +78,164 @@ namespace Iris
 
 		explicit constexpr operator bool ()const noexcept;
 
-		template<class T, class U>
-		friend constexpr auto operator+(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr auto operator+(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr auto operator+(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr auto operator+(Numeric<V> left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr auto operator-(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr auto operator-(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr auto operator-(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr auto operator-(Numeric<V> left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr auto operator*(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr auto operator*(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr auto operator*(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr auto operator*(Numeric<V> left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr auto operator/(Numeric<T> left, Numeric<U> right);
+		template<class V, class U>
+		friend constexpr auto operator/(Numeric<V> left, Numeric<U> right);
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr auto operator/(Numeric<T> left, U right);
+		template<class V, Concept::Arithmetic U>
+		friend constexpr auto operator/(Numeric<V> left, U right);
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator%(Numeric<T> left, Numeric<U> right);
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator%(Numeric<V> left, Numeric<U> right);
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator%(Numeric<T> left, U right);
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator%(Numeric<V> left, U right);
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator&(Numeric<T> left, Numeric<U> right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator&(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator&(Numeric<T> left, U right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator&(Numeric<V> left, U right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator|(Numeric<T> left, Numeric<U> right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator|(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator|(Numeric<T> left, U right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator|(Numeric<V> left, U right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator^(Numeric<T> left, Numeric<U> right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator^(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr auto operator^(Numeric<T> left, U right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr auto operator^(Numeric<V> left, U right)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr auto operator~(Numeric<T> numeric)noexcept;
+		template<Concept::Integral V>
+		friend constexpr auto operator~(Numeric<V> numeric)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr auto operator<<(Numeric<T> numeric, size_t shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr auto operator<<(Numeric<V> numeric, size_t shift)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr auto operator<<(Numeric<T> numeric, Numeric<size_t> shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr auto operator<<(Numeric<V> numeric, Numeric<size_t> shift)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr auto operator>>(Numeric<T> numeric, size_t shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr auto operator>>(Numeric<V> numeric, size_t shift)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr auto operator>>(Numeric<T> numeric, Numeric<size_t> shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr auto operator>>(Numeric<V> numeric, Numeric<size_t> shift)noexcept;
 
-		template<class T, class U>
-		friend constexpr Numeric<T>& operator+=(Numeric<T>& left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr Numeric<V>& operator+=(Numeric<V>& left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr Numeric<T>& operator+=(Numeric<T>& left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr Numeric<V>& operator+=(Numeric<V>& left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr Numeric<T>& operator-=(Numeric<T>& left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr Numeric<V>& operator-=(Numeric<V>& left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr Numeric<T>& operator-=(Numeric<T>& left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr Numeric<V>& operator-=(Numeric<V>& left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr Numeric<T>& operator*=(Numeric<T>& left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr Numeric<V>& operator*=(Numeric<V>& left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr Numeric<T>& operator*=(Numeric<T>& left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr Numeric<V>& operator*=(Numeric<V>& left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr Numeric<T>& operator/=(Numeric<T>& left, Numeric<U> right);
+		template<class V, class U>
+		friend constexpr Numeric<V>& operator/=(Numeric<V>& left, Numeric<U> right);
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr Numeric<T>& operator/=(Numeric<T>& left, U right);
+		template<class V, Concept::Arithmetic U>
+		friend constexpr Numeric<V>& operator/=(Numeric<V>& left, U right);
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator%=(Numeric<T>& left, Numeric<U> right);
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator%=(Numeric<V>& left, Numeric<U> right);
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator%=(Numeric<T>& left, U right);
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator%=(Numeric<V>& left, U right);
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator&=(Numeric<T>& left, Numeric<U> right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator&=(Numeric<V>& left, Numeric<U> right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator&=(Numeric<T>& left, U right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator&=(Numeric<V>& left, U right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator|=(Numeric<T>& left, Numeric<U> right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator|=(Numeric<V>& left, Numeric<U> right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator|=(Numeric<T>& left, U right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator|=(Numeric<V>& left, U right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator^=(Numeric<T>& left, Numeric<U> right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator^=(Numeric<V>& left, Numeric<U> right)noexcept;
 
-		template<Concept::Integral T, Concept::Integral U>
-		friend constexpr Numeric<T>& operator^=(Numeric<T>& left, U right)noexcept;
+		template<Concept::Integral V, Concept::Integral U>
+		friend constexpr Numeric<V>& operator^=(Numeric<V>& left, U right)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr Numeric<T>& operator<<=(Numeric<T> numeric, size_t shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr Numeric<V>& operator<<=(Numeric<V> numeric, size_t shift)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr Numeric<T>& operator<<=(Numeric<T> numeric, Numeric<size_t> shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr Numeric<V>& operator<<=(Numeric<V> numeric, Numeric<size_t> shift)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr Numeric<T>& operator>>=(Numeric<T> numeric, size_t shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr Numeric<V>& operator>>=(Numeric<V> numeric, size_t shift)noexcept;
 
-		template<Concept::Integral T>
-		friend constexpr Numeric<T>& operator>>=(Numeric<T> numeric, Numeric<size_t> shift)noexcept;
+		template<Concept::Integral V>
+		friend constexpr Numeric<V>& operator>>=(Numeric<V> numeric, Numeric<size_t> shift)noexcept;
 
-		template<class T, class U>
-		friend constexpr bool operator==(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr bool operator==(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr bool operator==(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr bool operator==(Numeric<V> left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr bool operator!=(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr bool operator!=(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr bool operator!=(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr bool operator!=(Numeric<V> left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr bool operator<(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr bool operator<(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr bool operator<(Numeric<T>left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr bool operator<(Numeric<V>left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr bool operator>(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr bool operator>(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr bool operator>(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr bool operator>(Numeric<V> left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr bool operator<=(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr bool operator<=(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr bool operator<=(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr bool operator<=(Numeric<V> left, U right)noexcept;
 
-		template<class T, class U>
-		friend constexpr bool operator>=(Numeric<T> left, Numeric<U> right)noexcept;
+		template<class V, class U>
+		friend constexpr bool operator>=(Numeric<V> left, Numeric<U> right)noexcept;
 
-		template<class T, Concept::Arithmetic U>
-		friend constexpr bool operator>=(Numeric<T> left, U right)noexcept;
+		template<class V, Concept::Arithmetic U>
+		friend constexpr bool operator>=(Numeric<V> left, U right)noexcept;
 
 		static constexpr Numeric<T> Min()noexcept;
 
@@ -779,4 +780,239 @@ namespace Iris
 	{
 		return min <= value && value <= max;
 	}
+}
+
+namespace Iris
+{
+	// IEEE 754 binary16; conversions round to nearest even and keep infinities and NaN
+	struct float16 final
+	{
+		uint16 bits = 0;
+
+		constexpr float16()noexcept = default;
+
+		explicit constexpr float16(float32 _value)noexcept;
+
+		constexpr operator float32()const noexcept;
+
+		static constexpr float16 FromBits(uint16 bits)noexcept;
+	};
+
+	// [0, 1] in 8 bits; out-of-range values are clamped and NaN becomes 0
+	struct unorm8 final
+	{
+		uint8 bits = 0;
+
+		constexpr unorm8()noexcept = default;
+
+		explicit constexpr unorm8(float32 _value)noexcept;
+
+		constexpr operator float32()const noexcept;
+
+		static constexpr unorm8 FromBits(uint8 bits)noexcept;
+	};
+
+	// [-1, 1] in 16 bits; -32768 and -32767 both decode to -1
+	struct snorm16 final
+	{
+		int16 bits = 0;
+
+		constexpr snorm16()noexcept = default;
+
+		explicit constexpr snorm16(float32 _value)noexcept;
+
+		constexpr operator float32()const noexcept;
+
+		static constexpr snorm16 FromBits(int16 bits)noexcept;
+	};
+
+	// Four [0, 1] channels in one 32-bit word: x in bits 0-9, y in 10-19, z in 20-29, w in 30-31
+	struct unorm1010102 final
+	{
+		uint32 bits = 0;
+
+		constexpr unorm1010102()noexcept = default;
+
+		constexpr unorm1010102(float32 _x, float32 _y, float32 _z, float32 _w = 1.f)noexcept;
+
+		constexpr float32 x()const noexcept;
+
+		constexpr float32 y()const noexcept;
+
+		constexpr float32 z()const noexcept;
+
+		constexpr float32 w()const noexcept;
+
+		static constexpr unorm1010102 FromBits(uint32 bits)noexcept;
+	};
+}
+
+namespace Iris::Detail
+{
+	// Adding and removing 1.5 * 2^23 drops the fraction under the default round-to-nearest-even mode; valid for |value| < 2^22
+	inline constexpr int32 RoundToNearestEven(float32 value) noexcept
+	{
+		return static_cast<int32>((value + 12582912.f) - 12582912.f);
+	}
+
+	// Maps NaN to 0 and clamps to [0, scale] before rounding, matching the SSE conversion
+	inline constexpr int32 QuantizeUnorm(float32 value, float32 scale) noexcept
+	{
+		const auto clamped = (value > 0.f) ? (value < 1.f ? value : 1.f) : 0.f;
+		return RoundToNearestEven(clamped * scale);
+	}
+
+	inline constexpr int32 QuantizeSnorm(float32 value, float32 scale) noexcept
+	{
+		const auto clamped = (value != value) ? 0.f : (value < -1.f) ? -1.f : (value > 1.f) ? 1.f : value;
+		return RoundToNearestEven(clamped * scale);
+	}
+
+	inline constexpr uint16 FloatToHalf(float32 value) noexcept
+	{
+		const auto bits = std::bit_cast<uint32>(value);
+		const auto sign = static_cast<uint16>((bits >> 16) & 0x8000u);
+		auto magnitude = bits & 0x7FFFFFFFu;
+
+		// Infinity, or NaN with the quiet bit forced so the payload cannot collapse to infinity
+		if (magnitude >= 0x7F800000u)
+			return static_cast<uint16>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x0200u | ((magnitude >> 13) & 0x03FFu) : 0u));
+
+		// 65520 and above round to infinity
+		if (magnitude >= 0x477FF000u)
+			return static_cast<uint16>(sign | 0x7C00u);
+
+		// Below the smallest normal half: denormal or zero
+		if (magnitude < 0x38800000u)
+		{
+			if (magnitude < 0x33000000u)
+				return sign;
+
+			const auto shift = 126u - (magnitude >> 23);
+			const auto mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+			auto half = mantissa >> shift;
+			const auto remainder = mantissa & ((1u << shift) - 1u);
+			const auto halfway = 1u << (shift - 1u);
+
+			if (remainder > halfway || (remainder == halfway && (half & 1u) != 0))
+				++half;
+
+			return static_cast<uint16>(sign | half);
+		}
+
+		// Rebias the exponent from 127 to 15 and round the dropped 13 bits to nearest even
+		magnitude -= 0x38000000u;
+		return static_cast<uint16>(sign | ((magnitude + 0x0FFFu + ((magnitude >> 13) & 1u)) >> 13));
+	}
+
+	inline constexpr float32 HalfToFloat(uint16 half) noexcept
+	{
+		const auto sign = static_cast<uint32>(half & 0x8000u) << 16;
+		const auto exponent = (half >> 10) & 0x1Fu;
+		const auto mantissa = static_cast<uint32>(half & 0x03FFu);
+
+		// NaN comes back quiet, as the hardware conversion does
+		if (exponent == 0x1Fu)
+			return std::bit_cast<float32>(sign | 0x7F800000u | ((mantissa != 0 ? (mantissa | 0x0200u) : 0u) << 13));
+
+		if (exponent == 0)
+		{
+			if (mantissa == 0)
+				return std::bit_cast<float32>(sign);
+
+			// Denormal: mantissa * 2^-24 is exact in float32
+			const auto denormal = static_cast<float32>(mantissa) * (1.f / 16777216.f);
+			return sign ? -denormal : denormal;
+		}
+
+		return std::bit_cast<float32>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+	}
+}
+
+namespace Iris
+{
+	inline constexpr float16::float16(float32 _value) noexcept
+		: bits(Detail::FloatToHalf(_value))
+	{}
+
+	inline constexpr float16::operator float32() const noexcept
+	{
+		return Detail::HalfToFloat(bits);
+	}
+
+	inline constexpr float16 float16::FromBits(uint16 bits) noexcept
+	{
+		float16 result;
+		result.bits = bits;
+		return result;
+	}
+
+	inline constexpr unorm8::unorm8(float32 _value) noexcept
+		: bits(static_cast<uint8>(Detail::QuantizeUnorm(_value, 255.f)))
+	{}
+
+	inline constexpr unorm8::operator float32() const noexcept
+	{
+		return static_cast<float32>(bits) * (1.f / 255.f);
+	}
+
+	inline constexpr unorm8 unorm8::FromBits(uint8 bits) noexcept
+	{
+		unorm8 result;
+		result.bits = bits;
+		return result;
+	}
+
+	inline constexpr snorm16::snorm16(float32 _value) noexcept
+		: bits(static_cast<int16>(Detail::QuantizeSnorm(_value, 32767.f)))
+	{}
+
+	inline constexpr snorm16::operator float32() const noexcept
+	{
+		const auto value = static_cast<float32>(bits) * (1.f / 32767.f);
+		return value < -1.f ? -1.f : value;
+	}
+
+	inline constexpr snorm16 snorm16::FromBits(int16 bits) noexcept
+	{
+		snorm16 result;
+		result.bits = bits;
+		return result;
+	}
+
+	inline constexpr unorm1010102::unorm1010102(float32 _x, float32 _y, float32 _z, float32 _w) noexcept
+		: bits(static_cast<uint32>(Detail::QuantizeUnorm(_x, 1023.f))
+			| (static_cast<uint32>(Detail::QuantizeUnorm(_y, 1023.f)) << 10)
+			| (static_cast<uint32>(Detail::QuantizeUnorm(_z, 1023.f)) << 20)
+			| (static_cast<uint32>(Detail::QuantizeUnorm(_w, 3.f)) << 30))
+	{}
+
+	inline constexpr float32 unorm1010102::x() const noexcept
+	{
+		return static_cast<float32>(bits & 0x3FFu) * (1.f / 1023.f);
+	}
+
+	inline constexpr float32 unorm1010102::y() const noexcept
+	{
+		return static_cast<float32>((bits >> 10) & 0x3FFu) * (1.f / 1023.f);
+	}
+
+	inline constexpr float32 unorm1010102::z() const noexcept
+	{
+		return static_cast<float32>((bits >> 20) & 0x3FFu) * (1.f / 1023.f);
+	}
+
+	inline constexpr float32 unorm1010102::w() const noexcept
+	{
+		return static_cast<float32>(bits >> 30) * (1.f / 3.f);
+	}
+
+	inline constexpr unorm1010102 unorm1010102::FromBits(uint32 bits) noexcept
+	{
+		unorm1010102 result;
+		result.bits = bits;
+		return result;
+	}
+
+	static_assert(sizeof(float16) == 2 && sizeof(unorm8) == 1 && sizeof(snorm16) == 2 && sizeof(unorm1010102) == 4);
 }
\ No newline at end of file
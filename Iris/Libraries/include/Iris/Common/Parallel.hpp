@@ -0,0 +1,117 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <system_error>
+
+namespace Iris
+{
+	// Runs function(t) for every t in [0, taskCount): task 0 on the calling thread, the others on threads of their
+	// own. Returns only after every task has finished. If the system cannot start another thread, the remaining
+	// tasks run on the calling thread instead. If tasks throw, the first exception is rethrown here once all
+	// threads are joined, so a failing task never leaves a joinable thread behind.
+	template<class Fty>
+	void ParallelFor(size_t taskCount, Fty&& function);
+
+	// Runs 'first' on a new thread and 'second' on the calling thread, with the same joining and exception rules
+	template<class First, class Second>
+	void ParallelInvoke(First&& first, Second&& second);
+}
+
+namespace Iris::Detail
+{
+	// Collects the first exception thrown by any task
+	class TaskErrors
+	{
+	public:
+
+		template<class Fty, class ...Args>
+		void run(Fty& _function, Args&& ..._args)noexcept
+		{
+			try
+			{
+				_function(std::forward<Args>(_args)...);
+			}
+			catch (...)
+			{
+				std::lock_guard lock(mMutex);
+
+				if (!mError)
+					mError = std::current_exception();
+			}
+		}
+
+		void rethrow()
+		{
+			if (mError)
+				std::rethrow_exception(mError);
+		}
+
+	private:
+
+		std::mutex mMutex;
+
+		std::exception_ptr mError;
+
+	};
+}
+
+namespace Iris
+{
+	template<class Fty>
+	inline void ParallelFor(size_t taskCount, Fty&& function)
+	{
+		if (taskCount == 0)
+			return;
+
+		Detail::TaskErrors errors;
+
+		{
+			// jthread joins on destruction, so leaving this scope by any path waits for every started task
+			std::vector<std::jthread> workers;
+			workers.reserve(taskCount - 1);
+
+			for (size_t t = 1; t < taskCount; ++t)
+			{
+				try
+				{
+					workers.emplace_back([&errors, &function, t]() { errors.run(function, t); });
+				}
+				catch (const std::system_error&)
+				{
+					errors.run(function, t);
+				}
+			}
+
+			errors.run(function, size_t{ 0 });
+		}
+
+		errors.rethrow();
+	}
+
+	template<class First, class Second>
+	inline void ParallelInvoke(First&& first, Second&& second)
+	{
+		Detail::TaskErrors errors;
+
+		{
+			std::jthread worker;
+
+			try
+			{
+				worker = std::jthread([&errors, &first]() { errors.run(first); });
+			}
+			catch (const std::system_error&)
+			{
+				errors.run(first);
+			}
+
+			errors.run(second);
+		}
+
+		errors.rethrow();
+	}
+}
\ No newline at end of file
@@ -174,50 +174,50 @@ namespace Iris
 		template<class U>
 		friend class WeakPtr;
 
-		template<class T, class ...Args>
-		friend std::enable_if_t<not std::is_array_v<T>, SharedPtr<T>> MakeShared(Args&& ...args);
+		template<class V, class ...Args>
+		friend std::enable_if_t<not std::is_array_v<V>, SharedPtr<V>> MakeShared(Args&& ...args);
 
-		template<class T, class Allocator, class ...Args>
-		friend std::enable_if_t<not std::is_array_v<T>, SharedPtr<T>> AllocateShared(const Allocator& allocator, Args&& ...args);
+		template<class V, class Allocator, class ...Args>
+		friend std::enable_if_t<not std::is_array_v<V>, SharedPtr<V>> AllocateShared(const Allocator& allocator, Args&& ...args);
 
 		template<class To, class From>
 		friend SharedPtr<To> Cast(const SharedPtr<From>&);
 
-		template<class T>
-		friend bool operator==(const WeakPtr<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator==(const WeakPtr<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const PtrHandle<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator==(const PtrHandle<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const SharedPtr<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator==(const SharedPtr<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const SharedPtr<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator==(const SharedPtr<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const SharedPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator==(const SharedPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator==(const SharedPtr<T>& a, std::nullptr_t);
+		template<class V>
+		friend bool operator==(const SharedPtr<V>& a, std::nullptr_t);
 
-		template<class T>
-		friend bool operator!=(const WeakPtr<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const WeakPtr<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const PtrHandle<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const PtrHandle<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const SharedPtr<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const SharedPtr<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const SharedPtr<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const SharedPtr<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const SharedPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator!=(const SharedPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator!=(const SharedPtr<T>& a, std::nullptr_t);
+		template<class V>
+		friend bool operator!=(const SharedPtr<V>& a, std::nullptr_t);
 	};
 
 	template<class T>
@@ -281,41 +281,41 @@ namespace Iris
 		template<class To, class From>
 		friend WeakPtr<To> Cast(const WeakPtr<From>&);
 
-		template<class T>
-		friend bool operator==(const SharedPtr<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator==(const SharedPtr<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const PtrHandle<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator==(const PtrHandle<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const WeakPtr<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator==(const WeakPtr<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const WeakPtr<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator==(const WeakPtr<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const WeakPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator==(const WeakPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator==(const WeakPtr<T>& a, std::nullptr_t);
+		template<class V>
+		friend bool operator==(const WeakPtr<V>& a, std::nullptr_t);
 
-		template<class T>
-		friend bool operator!=(const SharedPtr<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const SharedPtr<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const PtrHandle<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const PtrHandle<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const WeakPtr<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const WeakPtr<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const WeakPtr<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const WeakPtr<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const WeakPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator!=(const WeakPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator!=(const WeakPtr<T>& a, std::nullptr_t);
+		template<class V>
+		friend bool operator!=(const WeakPtr<V>& a, std::nullptr_t);
 	};
 
 	template<class T>
@@ -361,41 +361,41 @@ namespace Iris
 		template<class U>
 		PtrHandle(const std::shared_ptr<U>& _shared)noexcept;
 
-		template<class T>
-		friend bool operator==(const SharedPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator==(const SharedPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator==(const WeakPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator==(const WeakPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator==(const PtrHandle<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator==(const PtrHandle<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const PtrHandle<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator==(const PtrHandle<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator==(const PtrHandle<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator==(const PtrHandle<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator==(const PtrHandle<T>& a, std::nullptr_t);
+		template<class V>
+		friend bool operator==(const PtrHandle<V>& a, std::nullptr_t);
 
-		template<class T>
-		friend bool operator!=(const SharedPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator!=(const SharedPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator!=(const WeakPtr<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator!=(const WeakPtr<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator!=(const PtrHandle<T>& a, const SharedPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const PtrHandle<V>& a, const SharedPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const PtrHandle<T>& a, const WeakPtr<T>& b);
+		template<class V>
+		friend bool operator!=(const PtrHandle<V>& a, const WeakPtr<V>& b);
 
-		template<class T>
-		friend bool operator!=(const PtrHandle<T>& a, const PtrHandle<T>& b);
+		template<class V>
+		friend bool operator!=(const PtrHandle<V>& a, const PtrHandle<V>& b);
 
-		template<class T>
-		friend bool operator!=(const PtrHandle<T>& a, std::nullptr_t);
+		template<class V>
+		friend bool operator!=(const PtrHandle<V>& a, std::nullptr_t);
 	};
 
 	template<class T, class ...Args>
@@ -527,7 +527,7 @@ namespace Iris
 	template<class T>
 	template<class Deleter>
 	inline SharedPtr<T>::SharedPtr(std::nullptr_t, Deleter _deleter)
-		: mPtr(std::nullptr_t, _deleter)
+		: mPtr(nullptr, _deleter)
 	{
 
 	}
@@ -535,7 +535,7 @@ namespace Iris
 	template<class T>
 	template<class Deleter, class Allocator>
 	inline SharedPtr<T>::SharedPtr(std::nullptr_t, Deleter _deleter, Allocator _allocator)
-		: mPtr(std::nullptr_t, _deleter, _allocator)
+		: mPtr(nullptr, _deleter, _allocator)
 	{
 
 	}
@@ -350,9 +350,11 @@ namespace Iris
 
 		bool empty()const noexcept;
 
-		friend bool operator==(const Array& a, const Array& b);
+		template<class T, class A>
+		friend bool operator==(const Array<T, A>& a, const Array<T, A>& b);
 
-		friend bool operator!=(const Array& a, const Array& b);
+		template<class T, class A>
+		friend bool operator!=(const Array<T, A>& a, const Array<T, A>& b);
 
 	private:
 
@@ -0,0 +1,1361 @@
+#pragma once
+
+#include <new>
+#include <tuple>
+#include <memory>
+#include <utility>
+#include <iterator>
+
+#include <Iris/Container/FlatSet.hpp>
+
+namespace Iris::Detail
+{
+	// Target bytes per node, four cache lines: one node search streams adjacent lines instead of chasing pointers
+	inline constexpr size_t BTreeNodeSize = 256;
+
+	// Leaves form a ring through the map's header, so end() survives inserts and --end() reaches the last element
+	struct BTreeLink
+	{
+		BTreeLink* prev;
+
+		BTreeLink* next;
+	};
+}
+
+namespace Iris
+{
+	#define DECLARE_BTREEMAP_TEMPLATE template<class Key, class Vty, class Comparator = std::less<Key>, class Allocator = std::allocator<std::pair<Key,Vty>>>
+	#define BTREEMAP_TEMPLATE template<class Key, class Vty, class Comparator, class Allocator>
+
+	// In-memory B+tree with the API of SortedMap. Elements live only in leaves of about 256 bytes, linked in key order,
+	// and internal nodes hold separator keys and children, so a lookup touches a handful of nodes rather than one node
+	// per level of a binary tree, and iteration walks contiguous arrays. Nodes split on insert; appending past the last
+	// key leaves full leaves behind, which suits timelines. Erase frees a node once it is empty but never merges
+	// siblings, which keeps erase cheap at the cost of sparse leaves after mass erasure; copying compacts.
+	// Elements are std::pair<Key, Vty> as in FlatMap; keys must not be modified through iterators.
+	// Insert and erase invalidate every iterator.
+	DECLARE_BTREEMAP_TEMPLATE
+	class BTreeMap
+	{
+	private:
+
+		template<bool IsConst>
+		class Iterator;
+
+	public:
+
+		using key_type			= Key;
+		using mapped_type		= Vty;
+		using key_compare		= Comparator;
+
+		using value_type		= std::pair<Key, Vty>;
+		using allocator_type	= Allocator;
+		using size_type			= size_t;
+		using difference_type	= std::ptrdiff_t;
+		using pointer			= typename std::allocator_traits<Allocator>::pointer;
+		using const_pointer		= typename std::allocator_traits<Allocator>::const_pointer;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+		using iterator					= Iterator<false>;
+		using const_iterator			= Iterator<true>;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		BTreeMap()noexcept;
+
+		explicit BTreeMap(const Comparator& _comparator, const Allocator& _alloc = Allocator{});
+
+		// Sorted input is loaded in O(n) into full leaves; anything else is sorted first. The first of equivalent keys wins
+		template<class InputIterator>
+		BTreeMap(InputIterator _first, InputIterator _last, const Comparator& _comparator = Comparator{}, const Allocator& _alloc = Allocator{});
+
+		BTreeMap(std::initializer_list<value_type> _iniList, const Comparator& _comparator = Comparator{}, const Allocator& _alloc = Allocator{});
+
+		BTreeMap(const BTreeMap& _other);
+
+		BTreeMap(BTreeMap&& _other)noexcept;
+
+		~BTreeMap();
+
+		BTreeMap& operator=(const BTreeMap& _other);
+
+		BTreeMap& operator=(BTreeMap&& _other)noexcept;
+
+		BTreeMap& operator=(std::initializer_list<value_type> _iniList);
+
+		Vty& operator[](const Key& _key);
+
+		Vty& operator[](Key&& _key);
+
+		template<class... Args>
+		std::pair<iterator, bool> emplace(Args&&... _args);
+
+		std::pair<iterator, bool> insert(const value_type& _value);
+
+		std::pair<iterator, bool> insert(value_type&& _value);
+
+		// Bulk-loads like the range constructor when the map is empty
+		template<class InputIterator>
+		void insert(InputIterator _first, InputIterator _last);
+
+		void insert(std::initializer_list<value_type> _iniList);
+
+		iterator begin()noexcept;
+
+		const_iterator begin()const noexcept;
+
+		iterator end()noexcept;
+
+		const_iterator end()const noexcept;
+
+		const_iterator cbegin()const noexcept;
+
+		const_iterator cend()const noexcept;
+
+		reverse_iterator rbegin()noexcept;
+
+		const_reverse_iterator rbegin()const noexcept;
+
+		reverse_iterator rend()noexcept;
+
+		const_reverse_iterator rend()const noexcept;
+
+		const_reverse_iterator crbegin()const noexcept;
+
+		const_reverse_iterator crend()const noexcept;
+
+		/// @throw Error::OutOfRange when the key is absent
+		Vty& at(const Key& _key);
+
+		/// @throw Error::OutOfRange when the key is absent
+		const Vty& at(const Key& _key)const;
+
+		iterator find(const Key& _key);
+
+		const_iterator find(const Key& _key)const;
+
+		bool contains(const Key& _key)const;
+
+		size_type count(const Key& _key)const;
+
+		// First element whose key is not less than '_key'; with upperBound, bounds a range query
+		iterator lowerBound(const Key& _key);
+
+		const_iterator lowerBound(const Key& _key)const;
+
+		// First element whose key is greater than '_key'
+		iterator upperBound(const Key& _key);
+
+		const_iterator upperBound(const Key& _key)const;
+
+		// Lookups by any type a transparent comparator accepts, e.g. String::view_type for String keys
+		template<class K>
+		Vty& at(const K& _key) requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		const Vty& at(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		iterator find(const K& _key) requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		const_iterator find(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		bool contains(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		size_type count(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		iterator lowerBound(const K& _key) requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		const_iterator lowerBound(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		iterator upperBound(const K& _key) requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		const_iterator upperBound(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		/// @return The number of erased elements, 0 or 1
+		size_type erase(const Key& _key);
+
+		/// @return The iterator following the erased element
+		iterator erase(const_iterator _where);
+
+		void swap(BTreeMap& _other)noexcept;
+
+		void clear()noexcept;
+
+		size_type size()const noexcept;
+
+		bool empty()const noexcept;
+
+	private:
+
+		// Each node has one slot of slack, so an insert lands first and the node splits afterwards
+		static constexpr size_t LeafCapacity = Max<size_t>((Detail::BTreeNodeSize - sizeof(Detail::BTreeLink) - sizeof(size_t)) / sizeof(value_type), 4) - 1;
+
+		static constexpr size_t InternalCapacity = Max<size_t>((Detail::BTreeNodeSize - sizeof(size_t) * 2) / (sizeof(Key) + sizeof(void*)), 8) - 1;
+
+		// Split nodes keep at least four children, so a height of 40 takes more insertions than size_t counts
+		static constexpr size_t MaxHeight = 40;
+
+		struct Leaf : Detail::BTreeLink
+		{
+			size_t count;
+
+			alignas(value_type) unsigned char storage[sizeof(value_type) * (LeafCapacity + 1)];
+
+			value_type* values()noexcept { return std::launder(reinterpret_cast<value_type*>(storage)); }
+
+			const value_type* values()const noexcept { return std::launder(reinterpret_cast<const value_type*>(storage)); }
+		};
+
+		// children[i] holds the keys below keys[i] and not below keys[i - 1]
+		struct Internal
+		{
+			size_t count;
+
+			alignas(Key) unsigned char storage[sizeof(Key) * (InternalCapacity + 1)];
+
+			void* children[InternalCapacity + 2];
+
+			Key* keys()noexcept { return std::launder(reinterpret_cast<Key*>(storage)); }
+
+			const Key* keys()const noexcept { return std::launder(reinterpret_cast<const Key*>(storage)); }
+		};
+
+		// Internal nodes and child indices met on the way down; level 0 is the leaf's parent
+		struct Path
+		{
+			Internal* nodes[MaxHeight];
+
+			size_t indices[MaxHeight];
+		};
+
+		using LeafAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Leaf>;
+
+		using InternalAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Internal>;
+
+		static const Key& KeyOf(const value_type& value) noexcept;
+
+		static const Key& Identity(const Key& key) noexcept;
+
+		// Child to descend into: the number of separators not greater than '_key'
+		template<class K>
+		size_t childIndex(const Internal* _node, const K& _key)const;
+
+		template<class K>
+		size_t lowerIndex(const Leaf* _leaf, const K& _key)const;
+
+		template<class K>
+		size_t upperIndex(const Leaf* _leaf, const K& _key)const;
+
+		// The only leaf that can hold '_key'; 'mRoot' must not be null
+		template<class K>
+		Leaf* findLeaf(const K& _key)const;
+
+		template<class K>
+		Leaf* findLeaf(const K& _key, Path& _path)const;
+
+		template<class K>
+		iterator lowerBoundOf(const K& _key)const;
+
+		template<class K>
+		iterator upperBoundOf(const K& _key)const;
+
+		template<class K>
+		iterator findOf(const K& _key)const;
+
+		// Constructs value_type from '_args' when '_key' is absent; '_key' is only read before construction
+		template<class K, class... Args>
+		std::pair<iterator, bool> emplaceWith(const K& _key, Args&&... _args);
+
+		// Adds 'separator' and the new right sibling 'child' to the parents in '_path', splitting upward as needed
+		void insertIntoParents(Path& _path, Key separator, void* child);
+
+		iterator eraseAt(Leaf* _leaf, size_t _index, Path& _path);
+
+		// Fills the empty map from sorted, unique input
+		template<class ForwardIterator>
+		void loadSorted(ForwardIterator _first, ForwardIterator _last);
+
+		template<class InputIterator>
+		void insertRange(InputIterator _first, InputIterator _last);
+
+		Leaf* allocateLeaf();
+
+		Internal* allocateInternal();
+
+		void linkLeafAfter(Detail::BTreeLink* _position, Leaf* _leaf)noexcept;
+
+		void unlinkLeaf(Leaf* _leaf)noexcept;
+
+		void freeLeaf(Leaf* _leaf)noexcept;
+
+		void freeInternal(Internal* _node)noexcept;
+
+		void destroyNode(void* _node, size_t _height)noexcept;
+
+		// Takes '_other's tree and leaves it empty; this map must be empty
+		void steal(BTreeMap& _other)noexcept;
+
+		iterator iteratorAt(const Detail::BTreeLink* _node, size_t _index)const noexcept;
+
+	private:
+
+		Detail::BTreeLink mHeader;
+
+		void* mRoot = nullptr;
+
+		// Internal levels above the leaves; 0 when the root is a leaf
+		size_t mHeight = 0;
+
+		size_t mSize = 0;
+
+		Comparator mComparator;
+
+		Allocator mAllocator;
+
+	};
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	class BTreeMap<Key, Vty, Comparator, Allocator>::Iterator final
+	{
+	public:
+
+		using iterator_category	= std::bidirectional_iterator_tag;
+		using value_type		= typename BTreeMap::value_type;
+		using difference_type	= std::ptrdiff_t;
+		using reference			= std::conditional_t<IsConst, const value_type&, value_type&>;
+		using pointer			= std::conditional_t<IsConst, const value_type*, value_type*>;
+
+		Iterator()noexcept = default;
+
+		// iterator converts to const_iterator
+		template<bool OtherConst> requires(IsConst && !OtherConst)
+		Iterator(const Iterator<OtherConst>& _other)noexcept;
+
+		reference operator*()const noexcept;
+
+		pointer operator->()const noexcept;
+
+		Iterator& operator++()noexcept;
+
+		Iterator operator++(int)noexcept;
+
+		Iterator& operator--()noexcept;
+
+		Iterator operator--(int)noexcept;
+
+		template<bool OtherConst>
+		bool operator==(const Iterator<OtherConst>& _other)const noexcept;
+
+	private:
+
+		friend class BTreeMap;
+
+		template<bool OtherConst>
+		friend class Iterator;
+
+		Iterator(Detail::BTreeLink* _node, size_t _index)noexcept;
+
+	private:
+
+		Detail::BTreeLink* mNode = nullptr;
+
+		size_t mIndex = 0;
+
+	};
+}
+
+namespace Iris
+{
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::Iterator(Detail::BTreeLink* _node, size_t _index) noexcept
+		: mNode(_node)
+		, mIndex(_index)
+	{}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	template<bool OtherConst> requires(IsConst && !OtherConst)
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::Iterator(const Iterator<OtherConst>& _other) noexcept
+		: mNode(_other.mNode)
+		, mIndex(_other.mIndex)
+	{}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::template Iterator<IsConst>::reference BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::operator*() const noexcept
+	{
+		return static_cast<Leaf*>(mNode)->values()[mIndex];
+	}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::template Iterator<IsConst>::pointer BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::operator->() const noexcept
+	{
+		return static_cast<Leaf*>(mNode)->values() + mIndex;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::template Iterator<IsConst>& BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::operator++() noexcept
+	{
+		if (++mIndex == static_cast<Leaf*>(mNode)->count)
+		{
+			mNode = mNode->next;
+			mIndex = 0;
+		}
+
+		return *this;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::template Iterator<IsConst> BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::operator++(int) noexcept
+	{
+		auto result = *this;
+		++*this;
+		return result;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::template Iterator<IsConst>& BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::operator--() noexcept
+	{
+		if (mIndex == 0)
+		{
+			mNode = mNode->prev;
+			mIndex = static_cast<Leaf*>(mNode)->count;
+		}
+
+		--mIndex;
+		return *this;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::template Iterator<IsConst> BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::operator--(int) noexcept
+	{
+		auto result = *this;
+		--*this;
+		return result;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<bool IsConst>
+	template<bool OtherConst>
+	inline bool BTreeMap<Key, Vty, Comparator, Allocator>::Iterator<IsConst>::operator==(const Iterator<OtherConst>& _other) const noexcept
+	{
+		return mNode == _other.mNode && mIndex == _other.mIndex;
+	}
+}
+
+namespace Iris
+{
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::BTreeMap() noexcept
+		: mHeader{ &mHeader, &mHeader }
+		, mComparator()
+		, mAllocator()
+	{}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::BTreeMap(const Comparator& _comparator, const Allocator& _alloc)
+		: mHeader{ &mHeader, &mHeader }
+		, mComparator(_comparator)
+		, mAllocator(_alloc)
+	{}
+
+	BTREEMAP_TEMPLATE
+	template<class InputIterator>
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::BTreeMap(InputIterator _first, InputIterator _last, const Comparator& _comparator, const Allocator& _alloc)
+		: BTreeMap(_comparator, _alloc)
+	{
+		insertRange(_first, _last);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::BTreeMap(std::initializer_list<value_type> _iniList, const Comparator& _comparator, const Allocator& _alloc)
+		: BTreeMap(_iniList.begin(), _iniList.end(), _comparator, _alloc)
+	{}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::BTreeMap(const BTreeMap& _other)
+		: BTreeMap(_other.mComparator, std::allocator_traits<Allocator>::select_on_container_copy_construction(_other.mAllocator))
+	{
+		loadSorted(_other.begin(), _other.end());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::BTreeMap(BTreeMap&& _other) noexcept
+		: mHeader{ &mHeader, &mHeader }
+		, mComparator(std::move(_other.mComparator))
+		, mAllocator(std::move(_other.mAllocator))
+	{
+		steal(_other);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>::~BTreeMap()
+	{
+		clear();
+	}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>& BTreeMap<Key, Vty, Comparator, Allocator>::operator=(const BTreeMap& _other)
+	{
+		if (this != &_other)
+		{
+			BTreeMap copy(_other);
+			swap(copy);
+		}
+
+		return *this;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>& BTreeMap<Key, Vty, Comparator, Allocator>::operator=(BTreeMap&& _other) noexcept
+	{
+		if (this != &_other)
+		{
+			clear();
+			mComparator = std::move(_other.mComparator);
+			mAllocator = std::move(_other.mAllocator);
+			steal(_other);
+		}
+
+		return *this;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline BTreeMap<Key, Vty, Comparator, Allocator>& BTreeMap<Key, Vty, Comparator, Allocator>::operator=(std::initializer_list<value_type> _iniList)
+	{
+		clear();
+		insertRange(_iniList.begin(), _iniList.end());
+		return *this;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline Vty& BTreeMap<Key, Vty, Comparator, Allocator>::operator[](const Key& _key)
+	{
+		return emplaceWith(_key, std::piecewise_construct, std::forward_as_tuple(_key), std::tuple<>{}).first->second;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline Vty& BTreeMap<Key, Vty, Comparator, Allocator>::operator[](Key&& _key)
+	{
+		return emplaceWith(_key, std::piecewise_construct, std::forward_as_tuple(std::move(_key)), std::tuple<>{}).first->second;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class... Args>
+	inline std::pair<typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator, bool> BTreeMap<Key, Vty, Comparator, Allocator>::emplace(Args&&... _args)
+	{
+		value_type value(std::forward<Args>(_args)...);
+		return emplaceWith(value.first, std::move(value));
+	}
+
+	BTREEMAP_TEMPLATE
+	inline std::pair<typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator, bool> BTreeMap<Key, Vty, Comparator, Allocator>::insert(const value_type& _value)
+	{
+		return emplaceWith(_value.first, _value);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline std::pair<typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator, bool> BTreeMap<Key, Vty, Comparator, Allocator>::insert(value_type&& _value)
+	{
+		return emplaceWith(_value.first, std::move(_value));
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class InputIterator>
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::insert(InputIterator _first, InputIterator _last)
+	{
+		if (mSize == 0)
+		{
+			insertRange(_first, _last);
+			return;
+		}
+
+		for (; _first != _last; ++_first)
+		{
+			emplace(*_first);
+		}
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::insert(std::initializer_list<value_type> _iniList)
+	{
+		insert(_iniList.begin(), _iniList.end());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::begin() noexcept
+	{
+		return iteratorAt(mHeader.next, 0);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::begin() const noexcept
+	{
+		return iteratorAt(mHeader.next, 0);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::end() noexcept
+	{
+		return iteratorAt(&mHeader, 0);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::end() const noexcept
+	{
+		return iteratorAt(&mHeader, 0);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::cend() const noexcept
+	{
+		return end();
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::reverse_iterator BTreeMap<Key, Vty, Comparator, Allocator>::rbegin() noexcept
+	{
+		return reverse_iterator(end());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_reverse_iterator BTreeMap<Key, Vty, Comparator, Allocator>::rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::reverse_iterator BTreeMap<Key, Vty, Comparator, Allocator>::rend() noexcept
+	{
+		return reverse_iterator(begin());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_reverse_iterator BTreeMap<Key, Vty, Comparator, Allocator>::rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_reverse_iterator BTreeMap<Key, Vty, Comparator, Allocator>::crbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_reverse_iterator BTreeMap<Key, Vty, Comparator, Allocator>::crend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	BTREEMAP_TEMPLATE
+	inline Vty& BTreeMap<Key, Vty, Comparator, Allocator>::at(const Key& _key)
+	{
+		const auto it = findOf(_key);
+
+		if (it == end())
+			throw Error::OutOfRange{ "BTreeMap::at(const Key&)" };
+
+		return it->second;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline const Vty& BTreeMap<Key, Vty, Comparator, Allocator>::at(const Key& _key) const
+	{
+		const auto it = findOf(_key);
+
+		if (it == end())
+			throw Error::OutOfRange{ "BTreeMap::at(const Key&)const" };
+
+		return it->second;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::find(const Key& _key)
+	{
+		return findOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::find(const Key& _key) const
+	{
+		return findOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline bool BTreeMap<Key, Vty, Comparator, Allocator>::contains(const Key& _key) const
+	{
+		return findOf(_key) != end();
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::size_type BTreeMap<Key, Vty, Comparator, Allocator>::count(const Key& _key) const
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::lowerBound(const Key& _key)
+	{
+		return lowerBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::lowerBound(const Key& _key) const
+	{
+		return lowerBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::upperBound(const Key& _key)
+	{
+		return upperBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::upperBound(const Key& _key) const
+	{
+		return upperBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline Vty& BTreeMap<Key, Vty, Comparator, Allocator>::at(const K& _key) requires(Concept::Transparent<Comparator>)
+	{
+		const auto it = findOf(_key);
+
+		if (it == end())
+			throw Error::OutOfRange{ "BTreeMap::at(const K&)" };
+
+		return it->second;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline const Vty& BTreeMap<Key, Vty, Comparator, Allocator>::at(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		const auto it = findOf(_key);
+
+		if (it == end())
+			throw Error::OutOfRange{ "BTreeMap::at(const K&)const" };
+
+		return it->second;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::find(const K& _key) requires(Concept::Transparent<Comparator>)
+	{
+		return findOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::find(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return findOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline bool BTreeMap<Key, Vty, Comparator, Allocator>::contains(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return findOf(_key) != end();
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::size_type BTreeMap<Key, Vty, Comparator, Allocator>::count(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::lowerBound(const K& _key) requires(Concept::Transparent<Comparator>)
+	{
+		return lowerBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::lowerBound(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return lowerBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::upperBound(const K& _key) requires(Concept::Transparent<Comparator>)
+	{
+		return upperBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::const_iterator BTreeMap<Key, Vty, Comparator, Allocator>::upperBound(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return upperBoundOf(_key);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::size_type BTreeMap<Key, Vty, Comparator, Allocator>::erase(const Key& _key)
+	{
+		if (mRoot == nullptr)
+			return 0;
+
+		Path path;
+		auto* leaf = findLeaf(_key, path);
+		const auto index = lowerIndex(leaf, _key);
+
+		if (index == leaf->count || mComparator(_key, leaf->values()[index].first))
+			return 0;
+
+		eraseAt(leaf, index, path);
+		return 1;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::erase(const_iterator _where)
+	{
+		// Only the path is needed; the leaf and index are already known
+		Path path;
+		findLeaf(_where->first, path);
+
+		return eraseAt(static_cast<Leaf*>(_where.mNode), _where.mIndex, path);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::swap(BTreeMap& _other) noexcept
+	{
+		BTreeMap temp(std::move(_other));
+		_other = std::move(*this);
+		*this = std::move(temp);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::clear() noexcept
+	{
+		if (mRoot != nullptr)
+		{
+			destroyNode(mRoot, mHeight);
+		}
+
+		mHeader = Detail::BTreeLink{ &mHeader, &mHeader };
+		mRoot = nullptr;
+		mHeight = 0;
+		mSize = 0;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::size_type BTreeMap<Key, Vty, Comparator, Allocator>::size() const noexcept
+	{
+		return mSize;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline bool BTreeMap<Key, Vty, Comparator, Allocator>::empty() const noexcept
+	{
+		return mSize == 0;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline const Key& BTreeMap<Key, Vty, Comparator, Allocator>::KeyOf(const value_type& value) noexcept
+	{
+		return value.first;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline const Key& BTreeMap<Key, Vty, Comparator, Allocator>::Identity(const Key& key) noexcept
+	{
+		return key;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline size_t BTreeMap<Key, Vty, Comparator, Allocator>::childIndex(const Internal* _node, const K& _key) const
+	{
+		const auto* keys = _node->keys();
+		return static_cast<size_t>(Detail::FlatUpperBound(keys, _node->count, _key, mComparator, Identity) - keys);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline size_t BTreeMap<Key, Vty, Comparator, Allocator>::lowerIndex(const Leaf* _leaf, const K& _key) const
+	{
+		const auto* values = _leaf->values();
+		return static_cast<size_t>(Detail::FlatLowerBound(values, _leaf->count, _key, mComparator, KeyOf) - values);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline size_t BTreeMap<Key, Vty, Comparator, Allocator>::upperIndex(const Leaf* _leaf, const K& _key) const
+	{
+		const auto* values = _leaf->values();
+		return static_cast<size_t>(Detail::FlatUpperBound(values, _leaf->count, _key, mComparator, KeyOf) - values);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::Leaf* BTreeMap<Key, Vty, Comparator, Allocator>::findLeaf(const K& _key) const
+	{
+		auto* node = mRoot;
+
+		for (auto level = mHeight; level > 0; --level)
+		{
+			const auto* internal = static_cast<const Internal*>(node);
+			node = internal->children[childIndex(internal, _key)];
+		}
+
+		return static_cast<Leaf*>(node);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::Leaf* BTreeMap<Key, Vty, Comparator, Allocator>::findLeaf(const K& _key, Path& _path) const
+	{
+		auto* node = mRoot;
+
+		for (auto level = mHeight; level > 0; --level)
+		{
+			auto* internal = static_cast<Internal*>(node);
+			const auto index = childIndex(internal, _key);
+
+			_path.nodes[level - 1] = internal;
+			_path.indices[level - 1] = index;
+			node = internal->children[index];
+		}
+
+		return static_cast<Leaf*>(node);
+	}
+
+	// A leaf holds every key in its range, so a bound past its last element is the first element of the next leaf
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::lowerBoundOf(const K& _key) const
+	{
+		if (mRoot == nullptr)
+			return iteratorAt(&mHeader, 0);
+
+		const auto* leaf = findLeaf(_key);
+		const auto index = lowerIndex(leaf, _key);
+
+		return (index == leaf->count) ? iteratorAt(leaf->next, 0) : iteratorAt(leaf, index);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::upperBoundOf(const K& _key) const
+	{
+		if (mRoot == nullptr)
+			return iteratorAt(&mHeader, 0);
+
+		const auto* leaf = findLeaf(_key);
+		const auto index = upperIndex(leaf, _key);
+
+		return (index == leaf->count) ? iteratorAt(leaf->next, 0) : iteratorAt(leaf, index);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K>
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::findOf(const K& _key) const
+	{
+		if (mRoot == nullptr)
+			return iteratorAt(&mHeader, 0);
+
+		const auto* leaf = findLeaf(_key);
+		const auto index = lowerIndex(leaf, _key);
+
+		if (index == leaf->count || mComparator(_key, leaf->values()[index].first))
+			return iteratorAt(&mHeader, 0);
+
+		return iteratorAt(leaf, index);
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class K, class... Args>
+	inline std::pair<typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator, bool> BTreeMap<Key, Vty, Comparator, Allocator>::emplaceWith(const K& _key, Args&&... _args)
+	{
+		if (mRoot == nullptr)
+		{
+			auto* leaf = allocateLeaf();
+			linkLeafAfter(&mHeader, leaf);
+			mRoot = leaf;
+		}
+
+		Path path;
+		auto* leaf = findLeaf(_key, path);
+		const auto index = lowerIndex(leaf, _key);
+		auto* values = leaf->values();
+
+		if (index != leaf->count && !mComparator(_key, values[index].first))
+			return { iteratorAt(leaf, index), false };
+
+		// Built before anything moves, so a throwing constructor leaves the tree untouched
+		value_type value(std::forward<Args>(_args)...);
+
+		for (auto i = leaf->count; i > index; --i)
+		{
+			::new (static_cast<void*>(values + i)) value_type(std::move(values[i - 1]));
+			values[i - 1].~value_type();
+		}
+
+		::new (static_cast<void*>(values + index)) value_type(std::move(value));
+		++leaf->count;
+		++mSize;
+
+		if (leaf->count <= LeafCapacity)
+			return { iteratorAt(leaf, index), true };
+
+		// Appending to the last leaf moves only the new element out, so in-order inserts leave full leaves behind
+		auto* right = allocateLeaf();
+		const auto keep = (leaf->next == &mHeader && index == LeafCapacity) ? LeafCapacity : (LeafCapacity + 1) / 2;
+		auto* rightValues = right->values();
+
+		for (auto i = keep; i < leaf->count; ++i)
+		{
+			::new (static_cast<void*>(rightValues + (i - keep))) value_type(std::move(values[i]));
+			values[i].~value_type();
+		}
+
+		right->count = leaf->count - keep;
+		leaf->count = keep;
+		linkLeafAfter(leaf, right);
+
+		const auto result = (index < keep) ? iteratorAt(leaf, index) : iteratorAt(right, index - keep);
+		insertIntoParents(path, rightValues[0].first, right);
+
+		return { result, true };
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::insertIntoParents(Path& _path, Key separator, void* child)
+	{
+		for (size_t level = 0; ; ++level)
+		{
+			if (level == mHeight)
+			{
+				auto* root = allocateInternal();
+				::new (static_cast<void*>(root->keys())) Key(std::move(separator));
+				root->children[0] = mRoot;
+				root->children[1] = child;
+				root->count = 1;
+
+				mRoot = root;
+				++mHeight;
+				return;
+			}
+
+			auto* node = _path.nodes[level];
+			const auto at = _path.indices[level];
+			auto* keys = node->keys();
+
+			for (auto i = node->count; i > at; --i)
+			{
+				::new (static_cast<void*>(keys + i)) Key(std::move(keys[i - 1]));
+				keys[i - 1].~Key();
+				node->children[i + 1] = node->children[i];
+			}
+
+			::new (static_cast<void*>(keys + at)) Key(std::move(separator));
+			node->children[at + 1] = child;
+
+			if (++node->count <= InternalCapacity)
+				return;
+
+			// The middle key moves up; the right half of the keys and children go to the new sibling
+			const auto middle = node->count / 2;
+			auto* right = allocateInternal();
+			auto* rightKeys = right->keys();
+
+			for (auto i = middle + 1; i < node->count; ++i)
+			{
+				::new (static_cast<void*>(rightKeys + (i - middle - 1))) Key(std::move(keys[i]));
+				keys[i].~Key();
+				right->children[i - middle - 1] = node->children[i];
+			}
+
+			right->children[node->count - middle - 1] = node->children[node->count];
+			right->count = node->count - middle - 1;
+
+			separator = std::move(keys[middle]);
+			keys[middle].~Key();
+			node->count = middle;
+			child = right;
+		}
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::eraseAt(Leaf* _leaf, size_t _index, Path& _path)
+	{
+		auto* values = _leaf->values();
+		values[_index].~value_type();
+
+		for (auto i = _index + 1; i < _leaf->count; ++i)
+		{
+			::new (static_cast<void*>(values + (i - 1))) value_type(std::move(values[i]));
+			values[i].~value_type();
+		}
+
+		--_leaf->count;
+		--mSize;
+
+		if (_leaf->count != 0)
+			return (_index < _leaf->count) ? iteratorAt(_leaf, _index) : iteratorAt(_leaf->next, 0);
+
+		const auto next = iteratorAt(_leaf->next, 0);
+		unlinkLeaf(_leaf);
+		freeLeaf(_leaf);
+
+		// Remove the empty child from its parent, and the parent too when that was its only child
+		size_t level = 0;
+
+		for (; level < mHeight; ++level)
+		{
+			auto* node = _path.nodes[level];
+			const auto at = _path.indices[level];
+
+			if (node->count == 0)
+			{
+				freeInternal(node);
+				continue;
+			}
+
+			// Dropping the separator on the child's left keeps every remaining key inside its child's range
+			auto* keys = node->keys();
+			const auto removedKey = (at == 0) ? 0 : at - 1;
+			keys[removedKey].~Key();
+
+			for (auto i = removedKey + 1; i < node->count; ++i)
+			{
+				::new (static_cast<void*>(keys + (i - 1))) Key(std::move(keys[i]));
+				keys[i].~Key();
+			}
+
+			for (auto i = at + 1; i <= node->count; ++i)
+			{
+				node->children[i - 1] = node->children[i];
+			}
+
+			--node->count;
+			break;
+		}
+
+		if (level == mHeight)
+		{
+			mRoot = nullptr;
+			mHeight = 0;
+			return next;
+		}
+
+		while (mHeight > 0 && static_cast<Internal*>(mRoot)->count == 0)
+		{
+			auto* root = static_cast<Internal*>(mRoot);
+			mRoot = root->children[0];
+			freeInternal(root);
+			--mHeight;
+		}
+
+		return next;
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class ForwardIterator>
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::loadSorted(ForwardIterator _first, ForwardIterator _last)
+	{
+		const auto count = static_cast<size_t>(std::distance(_first, _last));
+
+		if (count == 0)
+			return;
+
+		// Spread evenly, so every leaf is full or one short
+		const auto leafCount = (count + LeafCapacity - 1) / LeafCapacity;
+		Array<void*> level;
+		Array<const Key*> firstKeys;
+		level.reserve(leafCount);
+		firstKeys.reserve(leafCount);
+
+		for (size_t l = 0; l < leafCount; ++l)
+		{
+			auto* leaf = allocateLeaf();
+			linkLeafAfter(mHeader.prev, leaf);
+
+			const auto leafSize = count / leafCount + (l < count % leafCount ? 1 : 0);
+			auto* values = leaf->values();
+
+			for (; leaf->count < leafSize; ++leaf->count, ++_first)
+			{
+				::new (static_cast<void*>(values + leaf->count)) value_type(*_first);
+				++mSize;
+			}
+
+			level.addLast(leaf);
+			firstKeys.addLast(&values[0].first);
+		}
+
+		for (; level.size() > 1; ++mHeight)
+		{
+			const auto nodeCount = (level.size() + InternalCapacity) / (InternalCapacity + 1);
+			Array<void*> parents;
+			Array<const Key*> parentKeys;
+			parents.reserve(nodeCount);
+			parentKeys.reserve(nodeCount);
+
+			for (size_t n = 0, child = 0; n < nodeCount; ++n)
+			{
+				const auto childCount = level.size() / nodeCount + (n < level.size() % nodeCount ? 1 : 0);
+				auto* node = allocateInternal();
+				node->children[0] = level[child];
+				node->count = 0;
+
+				for (size_t c = 1; c < childCount; ++c, ++node->count)
+				{
+					::new (static_cast<void*>(node->keys() + (c - 1))) Key(*firstKeys[child + c]);
+					node->children[c] = level[child + c];
+				}
+
+				parents.addLast(node);
+				parentKeys.addLast(firstKeys[child]);
+				child += childCount;
+			}
+
+			level = std::move(parents);
+			firstKeys = std::move(parentKeys);
+		}
+
+		mRoot = level[0];
+	}
+
+	BTREEMAP_TEMPLATE
+	template<class InputIterator>
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::insertRange(InputIterator _first, InputIterator _last)
+	{
+		const auto notLess = [&](const auto& a, const auto& b) { return !mComparator(a.first, b.first); };
+
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+		{
+			// Already sorted and unique, e.g. copied from another ordered map: no staging copy
+			if (std::adjacent_find(_first, _last, notLess) == _last)
+			{
+				loadSorted(_first, _last);
+				return;
+			}
+		}
+
+		Array<value_type> sorted;
+		Detail::FlatInsertRange(sorted, _first, _last, mComparator, KeyOf);
+		loadSorted(std::make_move_iterator(sorted.begin()), std::make_move_iterator(sorted.end()));
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::Leaf* BTreeMap<Key, Vty, Comparator, Allocator>::allocateLeaf()
+	{
+		LeafAllocator allocator(mAllocator);
+		auto* leaf = ::new (static_cast<void*>(std::allocator_traits<LeafAllocator>::allocate(allocator, 1))) Leaf;
+		leaf->count = 0;
+		return leaf;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::Internal* BTreeMap<Key, Vty, Comparator, Allocator>::allocateInternal()
+	{
+		InternalAllocator allocator(mAllocator);
+		auto* node = ::new (static_cast<void*>(std::allocator_traits<InternalAllocator>::allocate(allocator, 1))) Internal;
+		node->count = 0;
+		return node;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::linkLeafAfter(Detail::BTreeLink* _position, Leaf* _leaf) noexcept
+	{
+		_leaf->prev = _position;
+		_leaf->next = _position->next;
+		_position->next->prev = _leaf;
+		_position->next = _leaf;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::unlinkLeaf(Leaf* _leaf) noexcept
+	{
+		_leaf->prev->next = _leaf->next;
+		_leaf->next->prev = _leaf->prev;
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::freeLeaf(Leaf* _leaf) noexcept
+	{
+		LeafAllocator allocator(mAllocator);
+		std::allocator_traits<LeafAllocator>::deallocate(allocator, _leaf, 1);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::freeInternal(Internal* _node) noexcept
+	{
+		InternalAllocator allocator(mAllocator);
+		std::allocator_traits<InternalAllocator>::deallocate(allocator, _node, 1);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::destroyNode(void* _node, size_t _height) noexcept
+	{
+		if (_height == 0)
+		{
+			auto* leaf = static_cast<Leaf*>(_node);
+			std::destroy_n(leaf->values(), leaf->count);
+			freeLeaf(leaf);
+			return;
+		}
+
+		auto* node = static_cast<Internal*>(_node);
+
+		for (size_t i = 0; i <= node->count; ++i)
+		{
+			destroyNode(node->children[i], _height - 1);
+		}
+
+		std::destroy_n(node->keys(), node->count);
+		freeInternal(node);
+	}
+
+	BTREEMAP_TEMPLATE
+	inline void BTreeMap<Key, Vty, Comparator, Allocator>::steal(BTreeMap& _other) noexcept
+	{
+		if (_other.mRoot == nullptr)
+			return;
+
+		mHeader = _other.mHeader;
+		mHeader.next->prev = &mHeader;
+		mHeader.prev->next = &mHeader;
+		mRoot = std::exchange(_other.mRoot, nullptr);
+		mHeight = std::exchange(_other.mHeight, 0);
+		mSize = std::exchange(_other.mSize, 0);
+		_other.mHeader = Detail::BTreeLink{ &_other.mHeader, &_other.mHeader };
+	}
+
+	BTREEMAP_TEMPLATE
+	inline typename BTreeMap<Key, Vty, Comparator, Allocator>::iterator BTreeMap<Key, Vty, Comparator, Allocator>::iteratorAt(const Detail::BTreeLink* _node, size_t _index) const noexcept
+	{
+		return iterator{ const_cast<Detail::BTreeLink*>(_node), _index };
+	}
+}
\ No newline at end of file
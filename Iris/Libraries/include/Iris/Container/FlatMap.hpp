@@ -0,0 +1,459 @@
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include <Iris/Container/FlatSet.hpp>
+
+namespace Iris
+{
+	#define DECLARE_FLATMAP_TEMPLATE template<class Key, class Vty, class Comparator = std::less<Key>, class Allocator = std::allocator<std::pair<Key,Vty>>>
+	#define FLATMAP_TEMPLATE template<class Key, class Vty, class Comparator, class Allocator>
+
+	// Sorted key-value pairs in one Array, with the API of SortedMap. Lookups are a branch-free binary search over
+	// contiguous memory instead of a pointer chase through tree nodes, so tables built once and read often should
+	// prefer it; insert and erase shift the elements after the position, so build in bulk with the range constructor
+	// or insert(first, last) where possible.
+	// Elements are std::pair<Key, Vty> because they move while sorting; keys must not be modified through iterators.
+	// Inserting and erasing invalidate iterators at and after the position, and all of them when the Array reallocates.
+	DECLARE_FLATMAP_TEMPLATE
+	class FlatMap
+	{
+	public:
+
+		using base_type = Array<std::pair<Key, Vty>, Allocator>;
+
+		using key_type			= Key;
+		using mapped_type		= Vty;
+		using key_compare		= Comparator;
+
+		using value_type		= std::pair<Key, Vty>;
+		using allocator_type	= Allocator;
+		using size_type			= typename base_type::size_type;
+		using difference_type	= typename base_type::difference_type;
+		using pointer			= typename base_type::pointer;
+		using const_pointer		= typename base_type::const_pointer;
+		using reference			= typename base_type::reference;
+		using const_reference	= typename base_type::const_reference;
+		using iterator					= typename base_type::iterator;
+		using const_iterator			= typename base_type::const_iterator;
+		using reverse_iterator			= typename base_type::reverse_iterator;
+		using const_reverse_iterator	= typename base_type::const_reverse_iterator;
+
+		FlatMap() = default;
+
+		explicit FlatMap(const Comparator& _comparator);
+
+		// Sorts and deduplicates once, in O(n log n); the first of equivalent keys wins
+		template<class InputIterator>
+		FlatMap(InputIterator _first, InputIterator _last, const Comparator& _comparator = Comparator{});
+
+		FlatMap(std::initializer_list<value_type> _iniList, const Comparator& _comparator = Comparator{});
+
+		FlatMap(const FlatMap&) = default;
+
+		FlatMap(FlatMap&&) = default;
+
+		FlatMap& operator=(const FlatMap&) = default;
+
+		FlatMap& operator=(FlatMap&&) = default;
+
+		FlatMap& operator=(std::initializer_list<value_type> _iniList);
+
+		Vty& operator[](const Key& _key);
+
+		Vty& operator[](Key&& _key);
+
+		template<class... Args>
+		std::pair<iterator, bool> emplace(Args&&... _args);
+
+		std::pair<iterator, bool> insert(const value_type& _value);
+
+		std::pair<iterator, bool> insert(value_type&& _value);
+
+		template<class InputIterator>
+		void insert(InputIterator _first, InputIterator _last);
+
+		void insert(std::initializer_list<value_type> _iniList);
+
+		iterator begin()noexcept;
+
+		const_iterator begin()const noexcept;
+
+		iterator end()noexcept;
+
+		const_iterator end()const noexcept;
+
+		const_iterator cbegin()const noexcept;
+
+		const_iterator cend()const noexcept;
+
+		/// @throw Error::OutOfRange when the key is absent
+		Vty& at(const Key& _key);
+
+		/// @throw Error::OutOfRange when the key is absent
+		const Vty& at(const Key& _key)const;
+
+		iterator find(const Key& _key);
+
+		const_iterator find(const Key& _key)const;
+
+		bool contains(const Key& _key)const;
+
+		size_type count(const Key& _key)const;
+
+		// Lookups by any type a transparent comparator accepts, e.g. String::view_type for String keys
+		template<class K>
+		Vty& at(const K& _key) requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		const Vty& at(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		iterator find(const K& _key) requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		const_iterator find(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		bool contains(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		size_type count(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		/// @return The number of erased elements, 0 or 1
+		size_type erase(const Key& _key);
+
+		/// @return The iterator following the erased element
+		iterator erase(const_iterator _where);
+
+		void reserve(size_type _count);
+
+		void swap(FlatMap& _other)noexcept;
+
+		void clear()noexcept;
+
+		size_type size()const noexcept;
+
+		bool empty()const noexcept;
+
+	private:
+
+		template<class K>
+		size_t lowerBound(const K& _key)const;
+
+		// size() when the key is absent
+		template<class K>
+		size_t findIndex(const K& _key)const;
+
+		// Emplaces value_type from '_args' at the lower bound of '_key' when '_key' is absent
+		template<class K, class... Args>
+		std::pair<iterator, bool> emplaceWith(const K& _key, Args&&... _args);
+
+		static const Key& KeyOf(const value_type& value) noexcept;
+
+	private:
+
+		base_type mValues;
+
+		Comparator mComparator;
+
+	};
+}
+
+namespace Iris
+{
+	FLATMAP_TEMPLATE
+	inline FlatMap<Key, Vty, Comparator, Allocator>::FlatMap(const Comparator& _comparator)
+		: mValues()
+		, mComparator(_comparator)
+	{}
+
+	FLATMAP_TEMPLATE
+	template<class InputIterator>
+	inline FlatMap<Key, Vty, Comparator, Allocator>::FlatMap(InputIterator _first, InputIterator _last, const Comparator& _comparator)
+		: mValues()
+		, mComparator(_comparator)
+	{
+		insert(_first, _last);
+	}
+
+	FLATMAP_TEMPLATE
+	inline FlatMap<Key, Vty, Comparator, Allocator>::FlatMap(std::initializer_list<value_type> _iniList, const Comparator& _comparator)
+		: FlatMap(_iniList.begin(), _iniList.end(), _comparator)
+	{}
+
+	FLATMAP_TEMPLATE
+	inline FlatMap<Key, Vty, Comparator, Allocator>& FlatMap<Key, Vty, Comparator, Allocator>::operator=(std::initializer_list<value_type> _iniList)
+	{
+		mValues.removeAll();
+		insert(_iniList.begin(), _iniList.end());
+		return *this;
+	}
+
+	FLATMAP_TEMPLATE
+	inline Vty& FlatMap<Key, Vty, Comparator, Allocator>::operator[](const Key& _key)
+	{
+		return emplaceWith(_key, std::piecewise_construct, std::forward_as_tuple(_key), std::tuple<>{}).first->second;
+	}
+
+	FLATMAP_TEMPLATE
+	inline Vty& FlatMap<Key, Vty, Comparator, Allocator>::operator[](Key&& _key)
+	{
+		return emplaceWith(_key, std::piecewise_construct, std::forward_as_tuple(std::move(_key)), std::tuple<>{}).first->second;
+	}
+
+	FLATMAP_TEMPLATE
+	template<class... Args>
+	inline std::pair<typename FlatMap<Key, Vty, Comparator, Allocator>::iterator, bool> FlatMap<Key, Vty, Comparator, Allocator>::emplace(Args&&... _args)
+	{
+		value_type value(std::forward<Args>(_args)...);
+		return emplaceWith(value.first, std::move(value));
+	}
+
+	FLATMAP_TEMPLATE
+	inline std::pair<typename FlatMap<Key, Vty, Comparator, Allocator>::iterator, bool> FlatMap<Key, Vty, Comparator, Allocator>::insert(const value_type& _value)
+	{
+		return emplaceWith(_value.first, _value);
+	}
+
+	FLATMAP_TEMPLATE
+	inline std::pair<typename FlatMap<Key, Vty, Comparator, Allocator>::iterator, bool> FlatMap<Key, Vty, Comparator, Allocator>::insert(value_type&& _value)
+	{
+		return emplaceWith(_value.first, std::move(_value));
+	}
+
+	FLATMAP_TEMPLATE
+	template<class InputIterator>
+	inline void FlatMap<Key, Vty, Comparator, Allocator>::insert(InputIterator _first, InputIterator _last)
+	{
+		Detail::FlatInsertRange(mValues, _first, _last, mComparator, KeyOf);
+	}
+
+	FLATMAP_TEMPLATE
+	inline void FlatMap<Key, Vty, Comparator, Allocator>::insert(std::initializer_list<value_type> _iniList)
+	{
+		insert(_iniList.begin(), _iniList.end());
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::iterator FlatMap<Key, Vty, Comparator, Allocator>::begin() noexcept
+	{
+		return mValues.begin();
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::const_iterator FlatMap<Key, Vty, Comparator, Allocator>::begin() const noexcept
+	{
+		return mValues.begin();
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::iterator FlatMap<Key, Vty, Comparator, Allocator>::end() noexcept
+	{
+		return mValues.end();
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::const_iterator FlatMap<Key, Vty, Comparator, Allocator>::end() const noexcept
+	{
+		return mValues.end();
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::const_iterator FlatMap<Key, Vty, Comparator, Allocator>::cbegin() const noexcept
+	{
+		return mValues.cbegin();
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::const_iterator FlatMap<Key, Vty, Comparator, Allocator>::cend() const noexcept
+	{
+		return mValues.cend();
+	}
+
+	FLATMAP_TEMPLATE
+	inline Vty& FlatMap<Key, Vty, Comparator, Allocator>::at(const Key& _key)
+	{
+		const auto index = findIndex(_key);
+
+		if (index == mValues.size())
+			throw Error::OutOfRange{ "FlatMap::at(const Key&)" };
+
+		return mValues[index].second;
+	}
+
+	FLATMAP_TEMPLATE
+	inline const Vty& FlatMap<Key, Vty, Comparator, Allocator>::at(const Key& _key) const
+	{
+		const auto index = findIndex(_key);
+
+		if (index == mValues.size())
+			throw Error::OutOfRange{ "FlatMap::at(const Key&)const" };
+
+		return mValues[index].second;
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::iterator FlatMap<Key, Vty, Comparator, Allocator>::find(const Key& _key)
+	{
+		return mValues.begin() + findIndex(_key);
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::const_iterator FlatMap<Key, Vty, Comparator, Allocator>::find(const Key& _key) const
+	{
+		return mValues.begin() + findIndex(_key);
+	}
+
+	FLATMAP_TEMPLATE
+	inline bool FlatMap<Key, Vty, Comparator, Allocator>::contains(const Key& _key) const
+	{
+		return findIndex(_key) != mValues.size();
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::size_type FlatMap<Key, Vty, Comparator, Allocator>::count(const Key& _key) const
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline Vty& FlatMap<Key, Vty, Comparator, Allocator>::at(const K& _key) requires(Concept::Transparent<Comparator>)
+	{
+		const auto index = findIndex(_key);
+
+		if (index == mValues.size())
+			throw Error::OutOfRange{ "FlatMap::at(const K&)" };
+
+		return mValues[index].second;
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline const Vty& FlatMap<Key, Vty, Comparator, Allocator>::at(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		const auto index = findIndex(_key);
+
+		if (index == mValues.size())
+			throw Error::OutOfRange{ "FlatMap::at(const K&)const" };
+
+		return mValues[index].second;
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::iterator FlatMap<Key, Vty, Comparator, Allocator>::find(const K& _key) requires(Concept::Transparent<Comparator>)
+	{
+		return mValues.begin() + findIndex(_key);
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::const_iterator FlatMap<Key, Vty, Comparator, Allocator>::find(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return mValues.begin() + findIndex(_key);
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline bool FlatMap<Key, Vty, Comparator, Allocator>::contains(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return findIndex(_key) != mValues.size();
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::size_type FlatMap<Key, Vty, Comparator, Allocator>::count(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::size_type FlatMap<Key, Vty, Comparator, Allocator>::erase(const Key& _key)
+	{
+		const auto index = findIndex(_key);
+
+		if (index == mValues.size())
+			return 0;
+
+		mValues.remove(mValues.begin() + index);
+		return 1;
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::iterator FlatMap<Key, Vty, Comparator, Allocator>::erase(const_iterator _where)
+	{
+		const auto index = mValues.indexOf(_where);
+		mValues.remove(mValues.begin() + index);
+		return mValues.begin() + index;
+	}
+
+	FLATMAP_TEMPLATE
+	inline void FlatMap<Key, Vty, Comparator, Allocator>::reserve(size_type _count)
+	{
+		mValues.reserve(_count);
+	}
+
+	FLATMAP_TEMPLATE
+	inline void FlatMap<Key, Vty, Comparator, Allocator>::swap(FlatMap& _other) noexcept
+	{
+		using std::swap;
+		mValues.swap(_other.mValues);
+		swap(mComparator, _other.mComparator);
+	}
+
+	FLATMAP_TEMPLATE
+	inline void FlatMap<Key, Vty, Comparator, Allocator>::clear() noexcept
+	{
+		mValues.removeAll();
+	}
+
+	FLATMAP_TEMPLATE
+	inline typename FlatMap<Key, Vty, Comparator, Allocator>::size_type FlatMap<Key, Vty, Comparator, Allocator>::size() const noexcept
+	{
+		return mValues.size();
+	}
+
+	FLATMAP_TEMPLATE
+	inline bool FlatMap<Key, Vty, Comparator, Allocator>::empty() const noexcept
+	{
+		return mValues.size() == 0;
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline size_t FlatMap<Key, Vty, Comparator, Allocator>::lowerBound(const K& _key) const
+	{
+		const auto* first = mValues.data();
+		return static_cast<size_t>(Detail::FlatLowerBound(first, mValues.size(), _key, mComparator, KeyOf) - first);
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K>
+	inline size_t FlatMap<Key, Vty, Comparator, Allocator>::findIndex(const K& _key) const
+	{
+		const auto index = lowerBound(_key);
+		return (index == mValues.size() || mComparator(_key, mValues[index].first)) ? mValues.size() : index;
+	}
+
+	FLATMAP_TEMPLATE
+	template<class K, class... Args>
+	inline std::pair<typename FlatMap<Key, Vty, Comparator, Allocator>::iterator, bool> FlatMap<Key, Vty, Comparator, Allocator>::emplaceWith(const K& _key, Args&&... _args)
+	{
+		const auto index = lowerBound(_key);
+
+		if (index != mValues.size() && !mComparator(_key, mValues[index].first))
+			return { mValues.begin() + index, false };
+
+		mValues.emplace(mValues.begin() + index, std::forward<Args>(_args)...);
+		return { mValues.begin() + index, true };
+	}
+
+	FLATMAP_TEMPLATE
+	inline const Key& FlatMap<Key, Vty, Comparator, Allocator>::KeyOf(const value_type& value) noexcept
+	{
+		return value.first;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,414 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+
+#include <Iris/Container/Array.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#include <xmmintrin.h>
+#endif
+
+namespace Iris::Detail
+{
+	// Lower bound without a data-dependent branch: the loop runs ceil(log2(count)) times and each step is a conditional move,
+	// so random lookups pay no mispredictions. 'projection' maps an element to its key
+	template<class Type, class K, class Comparator, class Projection>
+	inline const Type* FlatLowerBound(const Type* first, size_t count, const K& key, const Comparator& comparator, Projection projection)
+	{
+		while (count > 1)
+		{
+			const auto half = count / 2;
+
+#if defined(IRIS_SIMD_X86)
+			// Both candidates for the next probe, so tables larger than the cache overlap their misses
+			const auto next = (count - half) / 2;
+			_mm_prefetch(reinterpret_cast<const char*>(first + next), _MM_HINT_T0);
+			_mm_prefetch(reinterpret_cast<const char*>(first + half + next), _MM_HINT_T0);
+#endif
+
+			first = comparator(projection(first[half - 1]), key) ? first + half : first;
+			count -= half;
+		}
+
+		return (count == 1 && comparator(projection(*first), key)) ? first + 1 : first;
+	}
+
+	// First element whose key 'key' compares less than; same shape as FlatLowerBound
+	template<class Type, class K, class Comparator, class Projection>
+	inline const Type* FlatUpperBound(const Type* first, size_t count, const K& key, const Comparator& comparator, Projection projection)
+	{
+		while (count > 1)
+		{
+			const auto half = count / 2;
+			first = comparator(key, projection(first[half - 1])) ? first : first + half;
+			count -= half;
+		}
+
+		return (count == 1 && !comparator(key, projection(*first))) ? first + 1 : first;
+	}
+
+	// Appends [first, last), sorts only the new elements, merges them in and drops duplicates. Elements already present
+	// win over equivalent new ones and earlier new ones over later ones, as with repeated insert
+	template<class Type, class Allocator, class InputIterator, class Comparator, class Projection>
+	inline void FlatInsertRange(Array<Type, Allocator>& values, InputIterator first, InputIterator last, Comparator comparator, Projection projection)
+	{
+		const auto less = [&](const Type& a, const Type& b) { return comparator(projection(a), projection(b)); };
+		const auto oldSize = values.size();
+
+		values.addLast(first, last);
+
+		const auto middle = values.begin() + oldSize;
+		std::stable_sort(middle, values.end(), less);
+		std::inplace_merge(values.begin(), middle, values.end(), less);
+
+		// Sorted, so neighbours are equivalent exactly when the first is not less than the second
+		const auto unique = std::unique(values.begin(), values.end(), [&](const Type& a, const Type& b) { return !less(a, b); });
+		values.removeRange(unique, values.end());
+	}
+}
+
+namespace Iris
+{
+	#define DECLARE_FLATSET_TEMPLATE template<class Key, class Comparator = std::less<Key>, class Allocator = std::allocator<Key>>
+	#define FLATSET_TEMPLATE template<class Key, class Comparator, class Allocator>
+
+	// Sorted set of unique keys in one Array. Lookups are a branch-free binary search over contiguous memory, which
+	// beats a node-based tree on tables built once and read often; insert and erase shift the elements after the
+	// position, so build in bulk with the range constructor or insert(first, last) where possible.
+	// Inserting and erasing invalidate iterators at and after the position, and all of them when the Array reallocates.
+	DECLARE_FLATSET_TEMPLATE
+	class FlatSet
+	{
+	public:
+
+		using base_type = Array<Key, Allocator>;
+
+		using key_type			= Key;
+		using value_type		= Key;
+		using key_compare		= Comparator;
+		using value_compare		= Comparator;
+		using allocator_type	= Allocator;
+		using size_type			= typename base_type::size_type;
+		using difference_type	= typename base_type::difference_type;
+		using pointer			= typename base_type::pointer;
+		using const_pointer		= typename base_type::const_pointer;
+		using reference			= typename base_type::reference;
+		using const_reference	= typename base_type::const_reference;
+
+		// Keys are never modified in place, so both iterators are constant
+		using iterator					= typename base_type::const_iterator;
+		using const_iterator			= typename base_type::const_iterator;
+		using reverse_iterator			= typename base_type::const_reverse_iterator;
+		using const_reverse_iterator	= typename base_type::const_reverse_iterator;
+
+		FlatSet() = default;
+
+		explicit FlatSet(const Comparator& _comparator);
+
+		// Sorts and deduplicates once, in O(n log n)
+		template<class InputIterator>
+		FlatSet(InputIterator _first, InputIterator _last, const Comparator& _comparator = Comparator{});
+
+		FlatSet(std::initializer_list<Key> _iniList, const Comparator& _comparator = Comparator{});
+
+		FlatSet(const FlatSet&) = default;
+
+		FlatSet(FlatSet&&) = default;
+
+		FlatSet& operator=(const FlatSet&) = default;
+
+		FlatSet& operator=(FlatSet&&) = default;
+
+		FlatSet& operator=(std::initializer_list<Key> _iniList);
+
+		template<class... Args>
+		std::pair<iterator, bool> emplace(Args&&... _args);
+
+		std::pair<iterator, bool> insert(const Key& _key);
+
+		std::pair<iterator, bool> insert(Key&& _key);
+
+		template<class InputIterator>
+		void insert(InputIterator _first, InputIterator _last);
+
+		void insert(std::initializer_list<Key> _iniList);
+
+		const_iterator begin()const noexcept;
+
+		const_iterator end()const noexcept;
+
+		const_iterator cbegin()const noexcept;
+
+		const_iterator cend()const noexcept;
+
+		const_iterator find(const Key& _key)const;
+
+		bool contains(const Key& _key)const;
+
+		size_type count(const Key& _key)const;
+
+		// Lookups by any type a transparent comparator accepts, e.g. String::view_type for String keys
+		template<class K>
+		const_iterator find(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		bool contains(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		template<class K>
+		size_type count(const K& _key)const requires(Concept::Transparent<Comparator>);
+
+		/// @return The number of erased elements, 0 or 1
+		size_type erase(const Key& _key);
+
+		/// @return The iterator following the erased element
+		iterator erase(const_iterator _where);
+
+		void reserve(size_type _count);
+
+		void swap(FlatSet& _other)noexcept;
+
+		void clear()noexcept;
+
+		size_type size()const noexcept;
+
+		bool empty()const noexcept;
+
+		// The sorted keys
+		const Key* data()const noexcept;
+
+	private:
+
+		template<class K>
+		size_t lowerBound(const K& _key)const;
+
+		// size() when the key is absent
+		template<class K>
+		size_t findIndex(const K& _key)const;
+
+		template<class K>
+		std::pair<iterator, bool> insertKey(K&& _key);
+
+	private:
+
+		base_type mKeys;
+
+		Comparator mComparator;
+
+	};
+}
+
+namespace Iris
+{
+	FLATSET_TEMPLATE
+	inline FlatSet<Key, Comparator, Allocator>::FlatSet(const Comparator& _comparator)
+		: mKeys()
+		, mComparator(_comparator)
+	{}
+
+	FLATSET_TEMPLATE
+	template<class InputIterator>
+	inline FlatSet<Key, Comparator, Allocator>::FlatSet(InputIterator _first, InputIterator _last, const Comparator& _comparator)
+		: mKeys()
+		, mComparator(_comparator)
+	{
+		insert(_first, _last);
+	}
+
+	FLATSET_TEMPLATE
+	inline FlatSet<Key, Comparator, Allocator>::FlatSet(std::initializer_list<Key> _iniList, const Comparator& _comparator)
+		: FlatSet(_iniList.begin(), _iniList.end(), _comparator)
+	{}
+
+	FLATSET_TEMPLATE
+	inline FlatSet<Key, Comparator, Allocator>& FlatSet<Key, Comparator, Allocator>::operator=(std::initializer_list<Key> _iniList)
+	{
+		mKeys.removeAll();
+		insert(_iniList.begin(), _iniList.end());
+		return *this;
+	}
+
+	FLATSET_TEMPLATE
+	template<class... Args>
+	inline std::pair<typename FlatSet<Key, Comparator, Allocator>::iterator, bool> FlatSet<Key, Comparator, Allocator>::emplace(Args&&... _args)
+	{
+		return insertKey(Key(std::forward<Args>(_args)...));
+	}
+
+	FLATSET_TEMPLATE
+	inline std::pair<typename FlatSet<Key, Comparator, Allocator>::iterator, bool> FlatSet<Key, Comparator, Allocator>::insert(const Key& _key)
+	{
+		return insertKey(_key);
+	}
+
+	FLATSET_TEMPLATE
+	inline std::pair<typename FlatSet<Key, Comparator, Allocator>::iterator, bool> FlatSet<Key, Comparator, Allocator>::insert(Key&& _key)
+	{
+		return insertKey(std::move(_key));
+	}
+
+	FLATSET_TEMPLATE
+	template<class InputIterator>
+	inline void FlatSet<Key, Comparator, Allocator>::insert(InputIterator _first, InputIterator _last)
+	{
+		Detail::FlatInsertRange(mKeys, _first, _last, mComparator, [](const Key& key) -> const Key& { return key; });
+	}
+
+	FLATSET_TEMPLATE
+	inline void FlatSet<Key, Comparator, Allocator>::insert(std::initializer_list<Key> _iniList)
+	{
+		insert(_iniList.begin(), _iniList.end());
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::const_iterator FlatSet<Key, Comparator, Allocator>::begin() const noexcept
+	{
+		return mKeys.begin();
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::const_iterator FlatSet<Key, Comparator, Allocator>::end() const noexcept
+	{
+		return mKeys.end();
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::const_iterator FlatSet<Key, Comparator, Allocator>::cbegin() const noexcept
+	{
+		return mKeys.cbegin();
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::const_iterator FlatSet<Key, Comparator, Allocator>::cend() const noexcept
+	{
+		return mKeys.cend();
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::const_iterator FlatSet<Key, Comparator, Allocator>::find(const Key& _key) const
+	{
+		return mKeys.begin() + findIndex(_key);
+	}
+
+	FLATSET_TEMPLATE
+	inline bool FlatSet<Key, Comparator, Allocator>::contains(const Key& _key) const
+	{
+		return findIndex(_key) != mKeys.size();
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::size_type FlatSet<Key, Comparator, Allocator>::count(const Key& _key) const
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	FLATSET_TEMPLATE
+	template<class K>
+	inline typename FlatSet<Key, Comparator, Allocator>::const_iterator FlatSet<Key, Comparator, Allocator>::find(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return mKeys.begin() + findIndex(_key);
+	}
+
+	FLATSET_TEMPLATE
+	template<class K>
+	inline bool FlatSet<Key, Comparator, Allocator>::contains(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return findIndex(_key) != mKeys.size();
+	}
+
+	FLATSET_TEMPLATE
+	template<class K>
+	inline typename FlatSet<Key, Comparator, Allocator>::size_type FlatSet<Key, Comparator, Allocator>::count(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::size_type FlatSet<Key, Comparator, Allocator>::erase(const Key& _key)
+	{
+		const auto index = findIndex(_key);
+
+		if (index == mKeys.size())
+			return 0;
+
+		mKeys.remove(mKeys.begin() + index);
+		return 1;
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::iterator FlatSet<Key, Comparator, Allocator>::erase(const_iterator _where)
+	{
+		const auto index = mKeys.indexOf(_where);
+		mKeys.remove(mKeys.begin() + index);
+		return mKeys.begin() + index;
+	}
+
+	FLATSET_TEMPLATE
+	inline void FlatSet<Key, Comparator, Allocator>::reserve(size_type _count)
+	{
+		mKeys.reserve(_count);
+	}
+
+	FLATSET_TEMPLATE
+	inline void FlatSet<Key, Comparator, Allocator>::swap(FlatSet& _other) noexcept
+	{
+		using std::swap;
+		mKeys.swap(_other.mKeys);
+		swap(mComparator, _other.mComparator);
+	}
+
+	FLATSET_TEMPLATE
+	inline void FlatSet<Key, Comparator, Allocator>::clear() noexcept
+	{
+		mKeys.removeAll();
+	}
+
+	FLATSET_TEMPLATE
+	inline typename FlatSet<Key, Comparator, Allocator>::size_type FlatSet<Key, Comparator, Allocator>::size() const noexcept
+	{
+		return mKeys.size();
+	}
+
+	FLATSET_TEMPLATE
+	inline bool FlatSet<Key, Comparator, Allocator>::empty() const noexcept
+	{
+		return mKeys.size() == 0;
+	}
+
+	FLATSET_TEMPLATE
+	inline const Key* FlatSet<Key, Comparator, Allocator>::data() const noexcept
+	{
+		return mKeys.data();
+	}
+
+	FLATSET_TEMPLATE
+	template<class K>
+	inline size_t FlatSet<Key, Comparator, Allocator>::lowerBound(const K& _key) const
+	{
+		const auto* first = mKeys.data();
+		return static_cast<size_t>(Detail::FlatLowerBound(first, mKeys.size(), _key, mComparator, [](const Key& key) -> const Key& { return key; }) - first);
+	}
+
+	FLATSET_TEMPLATE
+	template<class K>
+	inline size_t FlatSet<Key, Comparator, Allocator>::findIndex(const K& _key) const
+	{
+		const auto index = lowerBound(_key);
+		return (index == mKeys.size() || mComparator(_key, mKeys[index])) ? mKeys.size() : index;
+	}
+
+	FLATSET_TEMPLATE
+	template<class K>
+	inline std::pair<typename FlatSet<Key, Comparator, Allocator>::iterator, bool> FlatSet<Key, Comparator, Allocator>::insertKey(K&& _key)
+	{
+		const auto index = lowerBound(_key);
+
+		if (index != mKeys.size() && !mComparator(_key, mKeys[index]))
+			return { mKeys.begin() + index, false };
+
+		mKeys.emplace(mKeys.begin() + index, std::forward<K>(_key));
+		return { mKeys.begin() + index, true };
+	}
+}
\ No newline at end of file
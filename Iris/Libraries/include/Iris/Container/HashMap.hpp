@@ -1,58 +1,1149 @@
 #pragma once
 
-#include <unordered_map>
+#include <bit>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <iterator>
+#include <initializer_list>
+
+#include <Iris/Common/Numeric.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#include <emmintrin.h>
+#endif
+
+namespace Iris::Detail
+{
+	// One control byte per slot: the low 7 bits of the hash when full, otherwise one of these negative markers
+	enum class HashControl : int8
+	{
+		Empty = -128,
+		Deleted = -2,
+		Sentinel = -1,
+	};
+
+	inline constexpr size_t HashGroupWidth = 16;
+
+	// Control bytes of a table with no slots: a lone sentinel ends iteration and the empty bytes end every probe
+	alignas(16) inline int8 HashEmptyGroup[HashGroupWidth] =
+	{
+		-1,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+	};
+
+	// Sixteen control bytes compared at once; bit i of each mask refers to byte i
+	class HashGroup final
+	{
+	public:
+
+		explicit HashGroup(const int8* _control)noexcept;
+
+		uint32 match(int8 _hash)const noexcept;
+
+		uint32 matchEmpty()const noexcept;
+
+		uint32 matchEmptyOrDeleted()const noexcept;
+
+	private:
+
+#if defined(IRIS_SIMD_X86)
+		__m128i mControl;
+#else
+		const int8* mControl;
+#endif
+
+	};
+
+	// std::hash is the identity for integers on some standard libraries; the multiply and fold spread every input bit
+	inline constexpr size_t MixHash(size_t hash) noexcept
+	{
+		auto mixed = static_cast<uint64>(hash) * 0x9E3779B97F4A7C15ull;
+		mixed ^= mixed >> 32;
+		return static_cast<size_t>(mixed);
+	}
+
+	// Capacities are 2^n - 1 so 'hash & capacity' is the probe start; 15 keeps at least one empty slot at 7/8 load
+	inline constexpr size_t NormalizeHashCapacity(size_t count) noexcept
+	{
+		return (count <= HashGroupWidth - 1) ? HashGroupWidth - 1 : std::bit_ceil(count + 1) - 1;
+	}
+
+	inline constexpr size_t HashCapacityToGrowth(size_t capacity) noexcept
+	{
+		return capacity - capacity / 8;
+	}
+
+	inline constexpr size_t HashGrowthToCapacity(size_t growth) noexcept
+	{
+		return NormalizeHashCapacity(growth + (growth + 6) / 7);
+	}
+}
 
 namespace Iris
 {
 	#define DECLARE_HASHMAP_TEMPLATE template<class Key, class Vty, class Hasher = std::hash<Key>, class Equaler = std::equal_to<Key>, class Allocator = std::allocator<std::pair<const Key,Vty>>>
 	#define HASHMAP_TEMPLATE template<class Key, class Vty, class Hasher, class Equaler, class Allocator>
 
+	// Open-addressing hash map in the style of Abseil's Swiss table. Values live in one flat slot array next to one
+	// control byte per slot holding 7 bits of the hash, and lookups compare 16 control bytes per SIMD instruction
+	// before touching any key. Inserting never allocates a node; it may rehash, which invalidates iterators and
+	// references. Erasing leaves a tombstone, so iterators other than the erased one stay valid. A rehash that throws
+	// leaves the map unchanged, except for a move-only value_type whose move may throw.
 	DECLARE_HASHMAP_TEMPLATE
-	class HashMap : protected std::unordered_map<Key, Vty, Hasher, Equaler, Allocator>
+	class HashMap
+	{
+	private:
+
+		template<bool IsConst>
+		class Iterator;
+
+	public:
+
+		using hasher			= Hasher;
+		using key_type			= Key;
+		using mapped_type		= Vty;
+		using key_equal			= Equaler;
+
+		using value_type		= std::pair<const Key, Vty>;
+		using allocator_type	= Allocator;
+		using size_type			= size_t;
+		using difference_type	= std::ptrdiff_t;
+		using pointer			= typename std::allocator_traits<Allocator>::pointer;
+		using const_pointer		= typename std::allocator_traits<Allocator>::const_pointer;
+		using reference			= value_type&;
+		using const_reference	= const value_type&;
+		using iterator			= Iterator<false>;
+		using const_iterator	= Iterator<true>;
+
+		HashMap()noexcept;
+
+		explicit HashMap(size_type _count, const Hasher& _hasher = Hasher{}, const Equaler& _equaler = Equaler{}, const Allocator& _alloc = Allocator{});
+
+		HashMap(std::initializer_list<value_type> _iniList, size_type _count = 0, const Hasher& _hasher = Hasher{}, const Equaler& _equaler = Equaler{}, const Allocator& _alloc = Allocator{});
+
+		template<class InputIterator>
+		HashMap(InputIterator _first, InputIterator _last, size_type _count = 0, const Hasher& _hasher = Hasher{}, const Equaler& _equaler = Equaler{}, const Allocator& _alloc = Allocator{});
+
+		HashMap(const HashMap& _other);
+
+		HashMap(HashMap&& _other)noexcept;
+
+		~HashMap();
+
+		HashMap& operator=(const HashMap& _other);
+
+		HashMap& operator=(HashMap&& _other)noexcept;
+
+		HashMap& operator=(std::initializer_list<value_type> _iniList);
+
+		Vty& operator[](const Key& _key);
+
+		Vty& operator[](Key&& _key);
+
+		template<class... Args>
+		std::pair<iterator, bool> emplace(Args&&... _args);
+
+		template<class... Args>
+		std::pair<iterator, bool> try_emplace(const Key& _key, Args&&... _args);
+
+		template<class... Args>
+		std::pair<iterator, bool> try_emplace(Key&& _key, Args&&... _args);
+
+		std::pair<iterator, bool> insert(const value_type& _value);
+
+		std::pair<iterator, bool> insert(value_type&& _value);
+
+		template<class InputIterator>
+		void insert(InputIterator _first, InputIterator _last);
+
+		void insert(std::initializer_list<value_type> _iniList);
+
+		iterator begin()noexcept;
+
+		const_iterator begin()const noexcept;
+
+		iterator end()noexcept;
+
+		const_iterator end()const noexcept;
+
+		const_iterator cbegin()const noexcept;
+
+		const_iterator cend()const noexcept;
+
+		/// @throw Error::OutOfRange when the key is absent
+		Vty& at(const Key& _key);
+
+		/// @throw Error::OutOfRange when the key is absent
+		const Vty& at(const Key& _key)const;
+
+		iterator find(const Key& _key);
+
+		const_iterator find(const Key& _key)const;
+
+		bool contains(const Key& _key)const;
+
+		size_type count(const Key& _key)const;
+
+		// Lookups by any type the hasher and equaler both accept, e.g. String::view_type or const char32_t* for String keys.
+		// Enabled when both declare is_transparent; no Key is constructed
+		template<class K>
+		Vty& at(const K& _key) requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>);
+
+		template<class K>
+		const Vty& at(const K& _key)const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>);
+
+		template<class K>
+		iterator find(const K& _key) requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>);
+
+		template<class K>
+		const_iterator find(const K& _key)const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>);
+
+		template<class K>
+		bool contains(const K& _key)const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>);
+
+		template<class K>
+		size_type count(const K& _key)const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>);
+
+		/// @return The number of erased elements, 0 or 1
+		size_type erase(const Key& _key);
+
+		/// @return The iterator following the erased element
+		iterator erase(const_iterator _where);
+
+		// Makes room for '_count' elements without rehashing
+		void reserve(size_type _count);
+
+		// Rebuilds the table for at least '_count' slots and at least size() elements, dropping tombstones; 0 shrinks to fit
+		void rehash(size_type _count);
+
+		void swap(HashMap& _other)noexcept;
+
+		void clear()noexcept;
+
+		size_type size()const noexcept;
+
+		// Slots in the table; size() stays below 7/8 of it
+		size_type capacity()const noexcept;
+
+		bool empty()const noexcept;
+
+	private:
+
+		using ControlAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<int8>;
+
+		using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+
+		template<class K>
+		size_t hashOf(const K& _key)const;
+
+		template<class K>
+		size_t findIndex(const K& _key, size_t _hash)const;
+
+		// First empty or deleted slot on the probe sequence of '_hash'
+		size_t findFreeIndex(size_t _hash)const noexcept;
+
+		// Constructs value_type from '_args' when '_key' is absent; '_key' is only read before construction
+		template<class K, class... Args>
+		std::pair<iterator, bool> emplaceWith(const K& _key, Args&&... _args);
+
+		void setControl(size_t _index, int8 _control)noexcept;
+
+		void eraseAt(size_t _index)noexcept;
+
+		void resize(size_t _capacity);
+
+		void destroySlots()noexcept;
+
+		void deallocate()noexcept;
+
+		iterator iteratorAt(size_t _index)noexcept;
+
+		const_iterator iteratorAt(size_t _index)const noexcept;
+
+	private:
+
+		int8* mControl = Detail::HashEmptyGroup;
+
+		value_type* mSlots = nullptr;
+
+		size_t mCapacity = 0;
+
+		size_t mSize = 0;
+
+		size_t mGrowthLeft = 0;
+
+		Hasher mHasher;
+
+		Equaler mEqualer;
+
+		Allocator mAllocator;
+
+	};
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	class HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator final
 	{
 	public:
 
-		using base_type = std::unordered_map<Key, Vty, Hasher, Equaler, Allocator>;
+		using iterator_category	= std::forward_iterator_tag;
+		using value_type		= typename HashMap::value_type;
+		using difference_type	= std::ptrdiff_t;
+		using reference			= std::conditional_t<IsConst, const value_type&, value_type&>;
+		using pointer			= std::conditional_t<IsConst, const value_type*, value_type*>;
+
+		Iterator()noexcept = default;
+
+		// iterator converts to const_iterator
+		template<bool OtherConst> requires(IsConst && !OtherConst)
+		Iterator(const Iterator<OtherConst>& _other)noexcept;
+
+		reference operator*()const noexcept;
+
+		pointer operator->()const noexcept;
+
+		Iterator& operator++()noexcept;
 
-        using typename base_type::hasher;
-        using typename base_type::key_type;
-        using typename base_type::mapped_type;
-        using typename base_type::key_equal;
+		Iterator operator++(int)noexcept;
 
-        using typename base_type::value_type;
-        using typename base_type::allocator_type;
-        using typename base_type::size_type;
-        using typename base_type::difference_type;
-        using typename base_type::pointer;
-        using typename base_type::const_pointer;
-        using typename base_type::reference;
-        using typename base_type::const_reference;
-        using typename base_type::iterator;
-        using typename base_type::const_iterator;
+		template<bool OtherConst>
+		bool operator==(const Iterator<OtherConst>& _other)const noexcept;
 
-        using typename base_type::local_iterator;
-        using typename base_type::const_local_iterator;
+	private:
 
-        using base_type::unordered_map;
-        using base_type::operator=;
-        using base_type::operator[];
+		friend class HashMap;
 
-        using base_type::emplace;
-        using base_type::insert;
+		template<bool OtherConst>
+		friend class Iterator;
 
-        using base_type::begin;
-        using base_type::end;
-        using base_type::cbegin;
-        using base_type::cend;
+		Iterator(const int8* _control, pointer _slot)noexcept;
 
-        using base_type::at;
+		// Moves to the next full slot or to the sentinel, 16 control bytes at a time
+		void skipEmptyOrDeleted()noexcept;
 
-        using base_type::swap;
-        using base_type::clear;
+	private:
 
-        using base_type::size;
+		const int8* mControl = nullptr;
 
-        using base_type::empty;
+		pointer mSlot = nullptr;
 
 	};
+}
+
+namespace Iris::Detail
+{
+#if defined(IRIS_SIMD_X86)
+	inline HashGroup::HashGroup(const int8* _control) noexcept
+		: mControl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_control)))
+	{}
+
+	inline uint32 HashGroup::match(int8 _hash) const noexcept
+	{
+		return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(mControl, _mm_set1_epi8(_hash))));
+	}
+
+	inline uint32 HashGroup::matchEmpty() const noexcept
+	{
+		return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(mControl, _mm_set1_epi8(static_cast<int8>(HashControl::Empty)))));
+	}
+
+	// Empty and deleted are the only markers below the sentinel
+	inline uint32 HashGroup::matchEmptyOrDeleted() const noexcept
+	{
+		return static_cast<uint32>(_mm_movemask_epi8(_mm_cmplt_epi8(mControl, _mm_set1_epi8(static_cast<int8>(HashControl::Sentinel)))));
+	}
+#else
+	inline HashGroup::HashGroup(const int8* _control) noexcept
+		: mControl(_control)
+	{}
+
+	inline uint32 HashGroup::match(int8 _hash) const noexcept
+	{
+		uint32 mask = 0;
+
+		for (size_t i = 0; i < HashGroupWidth; ++i)
+		{
+			mask |= static_cast<uint32>(mControl[i] == _hash) << i;
+		}
+
+		return mask;
+	}
+
+	inline uint32 HashGroup::matchEmpty() const noexcept
+	{
+		return match(static_cast<int8>(HashControl::Empty));
+	}
+
+	inline uint32 HashGroup::matchEmptyOrDeleted() const noexcept
+	{
+		uint32 mask = 0;
+
+		for (size_t i = 0; i < HashGroupWidth; ++i)
+		{
+			mask |= static_cast<uint32>(mControl[i] < static_cast<int8>(HashControl::Sentinel)) << i;
+		}
+
+		return mask;
+	}
+#endif
+}
+
+namespace Iris
+{
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::Iterator(const int8* _control, pointer _slot) noexcept
+		: mControl(_control)
+		, mSlot(_slot)
+	{}
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	template<bool OtherConst> requires(IsConst && !OtherConst)
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::Iterator(const Iterator<OtherConst>& _other) noexcept
+		: mControl(_other.mControl)
+		, mSlot(_other.mSlot)
+	{}
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::template Iterator<IsConst>::reference HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::operator*() const noexcept
+	{
+		return *mSlot;
+	}
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::template Iterator<IsConst>::pointer HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::operator->() const noexcept
+	{
+		return mSlot;
+	}
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::template Iterator<IsConst>& HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::operator++() noexcept
+	{
+		++mControl;
+		++mSlot;
+		skipEmptyOrDeleted();
+		return *this;
+	}
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::template Iterator<IsConst> HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::operator++(int) noexcept
+	{
+		auto result = *this;
+		++(*this);
+		return result;
+	}
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	template<bool OtherConst>
+	inline bool HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::operator==(const Iterator<OtherConst>& _other) const noexcept
+	{
+		return mControl == _other.mControl;
+	}
+
+	HASHMAP_TEMPLATE
+	template<bool IsConst>
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::Iterator<IsConst>::skipEmptyOrDeleted() noexcept
+	{
+		// Densely filled tables mostly land on a full slot or the sentinel straight away
+		if (*mControl >= static_cast<int8>(Detail::HashControl::Sentinel))
+			return;
+
+		while (true)
+		{
+			const auto shift = static_cast<size_t>(std::countr_one(Detail::HashGroup{ mControl }.matchEmptyOrDeleted()));
+
+			mControl += shift;
+			mSlot += shift;
+
+			if (shift < Detail::HashGroupWidth)
+				return;
+		}
+	}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::HashMap() noexcept
+		: mHasher()
+		, mEqualer()
+		, mAllocator()
+	{}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::HashMap(size_type _count, const Hasher& _hasher, const Equaler& _equaler, const Allocator& _alloc)
+		: mHasher(_hasher)
+		, mEqualer(_equaler)
+		, mAllocator(_alloc)
+	{
+		reserve(_count);
+	}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::HashMap(std::initializer_list<value_type> _iniList, size_type _count, const Hasher& _hasher, const Equaler& _equaler, const Allocator& _alloc)
+		: HashMap(_iniList.begin(), _iniList.end(), Max(_count, _iniList.size()), _hasher, _equaler, _alloc)
+	{}
+
+	HASHMAP_TEMPLATE
+	template<class InputIterator>
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::HashMap(InputIterator _first, InputIterator _last, size_type _count, const Hasher& _hasher, const Equaler& _equaler, const Allocator& _alloc)
+		: HashMap(_count, _hasher, _equaler, _alloc)
+	{
+		insert(_first, _last);
+	}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::HashMap(const HashMap& _other)
+		: HashMap(_other.mSize, _other.mHasher, _other.mEqualer, std::allocator_traits<Allocator>::select_on_container_copy_construction(_other.mAllocator))
+	{
+		insert(_other.begin(), _other.end());
+	}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::HashMap(HashMap&& _other) noexcept
+		: mControl(std::exchange(_other.mControl, Detail::HashEmptyGroup))
+		, mSlots(std::exchange(_other.mSlots, nullptr))
+		, mCapacity(std::exchange(_other.mCapacity, 0))
+		, mSize(std::exchange(_other.mSize, 0))
+		, mGrowthLeft(std::exchange(_other.mGrowthLeft, 0))
+		, mHasher(std::move(_other.mHasher))
+		, mEqualer(std::move(_other.mEqualer))
+		, mAllocator(std::move(_other.mAllocator))
+	{}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>::~HashMap()
+	{
+		destroySlots();
+		deallocate();
+	}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>& HashMap<Key, Vty, Hasher, Equaler, Allocator>::operator=(const HashMap& _other)
+	{
+		if (this != &_other)
+		{
+			HashMap copy{ _other };
+			swap(copy);
+		}
+
+		return *this;
+	}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>& HashMap<Key, Vty, Hasher, Equaler, Allocator>::operator=(HashMap&& _other) noexcept
+	{
+		if (this != &_other)
+		{
+			HashMap moved{ std::move(_other) };
+			swap(moved);
+		}
+
+		return *this;
+	}
+
+	HASHMAP_TEMPLATE
+	inline HashMap<Key, Vty, Hasher, Equaler, Allocator>& HashMap<Key, Vty, Hasher, Equaler, Allocator>::operator=(std::initializer_list<value_type> _iniList)
+	{
+		clear();
+		insert(_iniList);
+		return *this;
+	}
+
+	HASHMAP_TEMPLATE
+	inline Vty& HashMap<Key, Vty, Hasher, Equaler, Allocator>::operator[](const Key& _key)
+	{
+		return try_emplace(_key).first->second;
+	}
+
+	HASHMAP_TEMPLATE
+	inline Vty& HashMap<Key, Vty, Hasher, Equaler, Allocator>::operator[](Key&& _key)
+	{
+		return try_emplace(std::move(_key)).first->second;
+	}
+
+	HASHMAP_TEMPLATE
+	template<class... Args>
+	inline std::pair<typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator, bool> HashMap<Key, Vty, Hasher, Equaler, Allocator>::emplace(Args&&... _args)
+	{
+		// A key passed as is is looked up in place; anything else is built first to learn its key
+		if constexpr (sizeof...(Args) == 2)
+		{
+			const auto& key = std::get<0>(std::forward_as_tuple(_args...));
+
+			if constexpr (std::is_same_v<std::remove_cvref_t<decltype(key)>, Key>)
+				return emplaceWith(key, std::forward<Args>(_args)...);
+		}
+
+		value_type value(std::forward<Args>(_args)...);
+		return emplaceWith(value.first, std::move(value));
+	}
+
+	HASHMAP_TEMPLATE
+	template<class... Args>
+	inline std::pair<typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator, bool> HashMap<Key, Vty, Hasher, Equaler, Allocator>::try_emplace(const Key& _key, Args&&... _args)
+	{
+		return emplaceWith(_key, std::piecewise_construct, std::forward_as_tuple(_key), std::forward_as_tuple(std::forward<Args>(_args)...));
+	}
+
+	HASHMAP_TEMPLATE
+	template<class... Args>
+	inline std::pair<typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator, bool> HashMap<Key, Vty, Hasher, Equaler, Allocator>::try_emplace(Key&& _key, Args&&... _args)
+	{
+		return emplaceWith(_key, std::piecewise_construct, std::forward_as_tuple(std::move(_key)), std::forward_as_tuple(std::forward<Args>(_args)...));
+	}
+
+	HASHMAP_TEMPLATE
+	inline std::pair<typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator, bool> HashMap<Key, Vty, Hasher, Equaler, Allocator>::insert(const value_type& _value)
+	{
+		return emplaceWith(_value.first, _value);
+	}
+
+	HASHMAP_TEMPLATE
+	inline std::pair<typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator, bool> HashMap<Key, Vty, Hasher, Equaler, Allocator>::insert(value_type&& _value)
+	{
+		return emplaceWith(_value.first, std::move(_value));
+	}
+
+	HASHMAP_TEMPLATE
+	template<class InputIterator>
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::insert(InputIterator _first, InputIterator _last)
+	{
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+		{
+			reserve(mSize + static_cast<size_t>(std::distance(_first, _last)));
+		}
+
+		for (; _first != _last; ++_first)
+		{
+			insert(*_first);
+		}
+	}
+
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::insert(std::initializer_list<value_type> _iniList)
+	{
+		insert(_iniList.begin(), _iniList.end());
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::begin() noexcept
+	{
+		auto it = iteratorAt(0);
+		it.skipEmptyOrDeleted();
+		return it;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::const_iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::begin() const noexcept
+	{
+		auto it = iteratorAt(0);
+		it.skipEmptyOrDeleted();
+		return it;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::end() noexcept
+	{
+		return iteratorAt(mCapacity);
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::const_iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::end() const noexcept
+	{
+		return iteratorAt(mCapacity);
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::const_iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::const_iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::cend() const noexcept
+	{
+		return end();
+	}
+
+	HASHMAP_TEMPLATE
+	inline Vty& HashMap<Key, Vty, Hasher, Equaler, Allocator>::at(const Key& _key)
+	{
+		const auto index = findIndex(_key, hashOf(_key));
+
+		if (index == mCapacity)
+			throw Error::OutOfRange{ "HashMap::at(const Key&)" };
+
+		return mSlots[index].second;
+	}
+
+	HASHMAP_TEMPLATE
+	inline const Vty& HashMap<Key, Vty, Hasher, Equaler, Allocator>::at(const Key& _key) const
+	{
+		const auto index = findIndex(_key, hashOf(_key));
+
+		if (index == mCapacity)
+			throw Error::OutOfRange{ "HashMap::at(const Key&)const" };
+
+		return mSlots[index].second;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::find(const Key& _key)
+	{
+		return iteratorAt(findIndex(_key, hashOf(_key)));
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::const_iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::find(const Key& _key) const
+	{
+		return iteratorAt(findIndex(_key, hashOf(_key)));
+	}
+
+	HASHMAP_TEMPLATE
+	inline bool HashMap<Key, Vty, Hasher, Equaler, Allocator>::contains(const Key& _key) const
+	{
+		return findIndex(_key, hashOf(_key)) != mCapacity;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::size_type HashMap<Key, Vty, Hasher, Equaler, Allocator>::count(const Key& _key) const
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline Vty& HashMap<Key, Vty, Hasher, Equaler, Allocator>::at(const K& _key) requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>)
+	{
+		const auto index = findIndex(_key, hashOf(_key));
+
+		if (index == mCapacity)
+			throw Error::OutOfRange{ "HashMap::at(const K&)" };
+
+		return mSlots[index].second;
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline const Vty& HashMap<Key, Vty, Hasher, Equaler, Allocator>::at(const K& _key) const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>)
+	{
+		const auto index = findIndex(_key, hashOf(_key));
+
+		if (index == mCapacity)
+			throw Error::OutOfRange{ "HashMap::at(const K&)const" };
+
+		return mSlots[index].second;
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::find(const K& _key) requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>)
+	{
+		return iteratorAt(findIndex(_key, hashOf(_key)));
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::const_iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::find(const K& _key) const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>)
+	{
+		return iteratorAt(findIndex(_key, hashOf(_key)));
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline bool HashMap<Key, Vty, Hasher, Equaler, Allocator>::contains(const K& _key) const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>)
+	{
+		return findIndex(_key, hashOf(_key)) != mCapacity;
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::size_type HashMap<Key, Vty, Hasher, Equaler, Allocator>::count(const K& _key) const requires(Concept::Transparent<Hasher> && Concept::Transparent<Equaler>)
+	{
+		return contains(_key) ? 1 : 0;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::size_type HashMap<Key, Vty, Hasher, Equaler, Allocator>::erase(const Key& _key)
+	{
+		const auto index = findIndex(_key, hashOf(_key));
+
+		if (index == mCapacity)
+			return 0;
+
+		eraseAt(index);
+		return 1;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::erase(const_iterator _where)
+	{
+		const auto index = static_cast<size_t>(_where.mControl - mControl);
+		eraseAt(index);
+
+		auto next = iteratorAt(index);
+		++next;
+		return next;
+	}
+
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::reserve(size_type _count)
+	{
+		if (_count > mSize + mGrowthLeft)
+		{
+			resize(Detail::HashGrowthToCapacity(_count));
+		}
+	}
+
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::rehash(size_type _count)
+	{
+		if (_count == 0 && mSize == 0)
+		{
+			destroySlots();
+			deallocate();
+			return;
+		}
+
+		const auto capacity = Max(Detail::NormalizeHashCapacity(_count), Detail::HashGrowthToCapacity(mSize));
+
+		if (_count == 0 || capacity > mCapacity || mSize + mGrowthLeft < Detail::HashCapacityToGrowth(mCapacity))
+		{
+			resize(capacity);
+		}
+	}
+
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::swap(HashMap& _other) noexcept
+	{
+		std::swap(mControl, _other.mControl);
+		std::swap(mSlots, _other.mSlots);
+		std::swap(mCapacity, _other.mCapacity);
+		std::swap(mSize, _other.mSize);
+		std::swap(mGrowthLeft, _other.mGrowthLeft);
+		std::swap(mHasher, _other.mHasher);
+		std::swap(mEqualer, _other.mEqualer);
+		std::swap(mAllocator, _other.mAllocator);
+	}
+
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::clear() noexcept
+	{
+		destroySlots();
+
+		if (mCapacity == 0)
+			return;
+
+		for (size_t i = 0; i < mCapacity + Detail::HashGroupWidth; ++i)
+		{
+			mControl[i] = static_cast<int8>(Detail::HashControl::Empty);
+		}
+
+		mControl[mCapacity] = static_cast<int8>(Detail::HashControl::Sentinel);
+		mSize = 0;
+		mGrowthLeft = Detail::HashCapacityToGrowth(mCapacity);
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::size_type HashMap<Key, Vty, Hasher, Equaler, Allocator>::size() const noexcept
+	{
+		return mSize;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::size_type HashMap<Key, Vty, Hasher, Equaler, Allocator>::capacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	HASHMAP_TEMPLATE
+	inline bool HashMap<Key, Vty, Hasher, Equaler, Allocator>::empty() const noexcept
+	{
+		return mSize == 0;
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline size_t HashMap<Key, Vty, Hasher, Equaler, Allocator>::hashOf(const K& _key) const
+	{
+		return Detail::MixHash(mHasher(_key));
+	}
+
+	// Probes whole groups with a triangular stride, which visits every group once because the group count is a power of 2.
+	// Returns mCapacity when the key is absent.
+	HASHMAP_TEMPLATE
+	template<class K>
+	inline size_t HashMap<Key, Vty, Hasher, Equaler, Allocator>::findIndex(const K& _key, size_t _hash) const
+	{
+		const auto h2 = static_cast<int8>(_hash & 0x7F);
+		auto position = (_hash >> 7) & mCapacity;
+
+		for (size_t stride = Detail::HashGroupWidth; ; stride += Detail::HashGroupWidth)
+		{
+			const Detail::HashGroup group{ mControl + position };
+
+			for (auto mask = group.match(h2); mask != 0; mask &= mask - 1)
+			{
+				const auto index = (position + static_cast<size_t>(std::countr_zero(mask))) & mCapacity;
+
+				if (mEqualer(mSlots[index].first, _key))
+					return index;
+			}
+
+			if (group.matchEmpty() != 0)
+				return mCapacity;
+
+			position = (position + stride) & mCapacity;
+		}
+	}
+
+	HASHMAP_TEMPLATE
+	inline size_t HashMap<Key, Vty, Hasher, Equaler, Allocator>::findFreeIndex(size_t _hash) const noexcept
+	{
+		auto position = (_hash >> 7) & mCapacity;
+
+		for (size_t stride = Detail::HashGroupWidth; ; stride += Detail::HashGroupWidth)
+		{
+			const auto mask = Detail::HashGroup{ mControl + position }.matchEmptyOrDeleted();
+
+			if (mask != 0)
+				return (position + static_cast<size_t>(std::countr_zero(mask))) & mCapacity;
+
+			position = (position + stride) & mCapacity;
+		}
+	}
+
+	HASHMAP_TEMPLATE
+	template<class K, class... Args>
+	inline std::pair<typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator, bool> HashMap<Key, Vty, Hasher, Equaler, Allocator>::emplaceWith(const K& _key, Args&&... _args)
+	{
+		const auto hash = hashOf(_key);
+		const auto found = findIndex(_key, hash);
+
+		if (found != mCapacity)
+			return { iteratorAt(found),false };
+
+		auto index = findFreeIndex(hash);
+
+		// Reusing a tombstone costs no growth
+		if (mGrowthLeft == 0 && mControl[index] != static_cast<int8>(Detail::HashControl::Deleted))
+		{
+			// Mostly tombstones: rebuild at the same size. Otherwise double
+			if (mCapacity > Detail::HashGroupWidth && mSize * 32 <= mCapacity * 25)
+				resize(mCapacity);
+			else
+				resize(Detail::NormalizeHashCapacity(mCapacity * 2 + 1));
+
+			index = findFreeIndex(hash);
+		}
+
+		SlotAllocator slotAllocator{ mAllocator };
+		std::allocator_traits<SlotAllocator>::construct(slotAllocator, mSlots + index, std::forward<Args>(_args)...);
+
+		if (mControl[index] == static_cast<int8>(Detail::HashControl::Empty))
+			--mGrowthLeft;
+
+		setControl(index, static_cast<int8>(hash & 0x7F));
+		++mSize;
+
+		return { iteratorAt(index),true };
+	}
+
+	// The first 15 control bytes are mirrored after the sentinel so a group load near the end never wraps
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::setControl(size_t _index, int8 _control) noexcept
+	{
+		mControl[_index] = _control;
+		mControl[((_index - (Detail::HashGroupWidth - 1)) & mCapacity) + (Detail::HashGroupWidth - 1)] = _control;
+	}
+
+	// A slot can go back to empty unless some probe may have passed it while its window of 16 bytes was full
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::eraseAt(size_t _index) noexcept
+	{
+		SlotAllocator slotAllocator{ mAllocator };
+		std::allocator_traits<SlotAllocator>::destroy(slotAllocator, mSlots + _index);
+		--mSize;
+
+		const auto before = (_index - Detail::HashGroupWidth) & mCapacity;
+		const auto emptyAfter = Detail::HashGroup{ mControl + _index }.matchEmpty();
+		const auto emptyBefore = Detail::HashGroup{ mControl + before }.matchEmpty();
+
+		const bool wasNeverFull = (emptyBefore != 0) && (emptyAfter != 0)
+			&& (static_cast<size_t>(std::countr_zero(emptyAfter)) + static_cast<size_t>(std::countl_zero(emptyBefore << 16)) < Detail::HashGroupWidth);
+
+		if (wasNeverFull)
+		{
+			setControl(_index, static_cast<int8>(Detail::HashControl::Empty));
+			++mGrowthLeft;
+		}
+		else
+		{
+			setControl(_index, static_cast<int8>(Detail::HashControl::Deleted));
+		}
+	}
+
+	// The new table is complete before the old one is touched. Elements are moved only when value_type's move cannot
+	// throw and copied otherwise (the const key is copied either way), and a hasher that may throw runs over every key
+	// first, so a throwing copy or hash leaves the map as it was
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::resize(size_t _capacity)
+	{
+		using HashAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<size_t>;
+
+		constexpr bool NothrowHash = std::is_nothrow_invocable_v<const Hasher&, const Key&>;
+
+		ControlAllocator controlAllocator{ mAllocator };
+		SlotAllocator slotAllocator{ mAllocator };
+
+		auto* control = std::allocator_traits<ControlAllocator>::allocate(controlAllocator, _capacity + Detail::HashGroupWidth);
+		value_type* slots;
+
+		try
+		{
+			slots = std::allocator_traits<SlotAllocator>::allocate(slotAllocator, _capacity);
+		}
+		catch (...)
+		{
+			std::allocator_traits<ControlAllocator>::deallocate(controlAllocator, control, _capacity + Detail::HashGroupWidth);
+			throw;
+		}
+
+		for (size_t i = 0; i < _capacity + Detail::HashGroupWidth; ++i)
+		{
+			control[i] = static_cast<int8>((i == _capacity) ? Detail::HashControl::Sentinel : Detail::HashControl::Empty);
+		}
+
+		auto* oldControl = mControl;
+		auto* oldSlots = mSlots;
+		const auto oldCapacity = mCapacity;
+
+		mControl = control;
+		mSlots = slots;
+		mCapacity = _capacity;
+
+		try
+		{
+			std::vector<size_t, HashAllocator> hashes{ HashAllocator{ mAllocator } };
+
+			if constexpr (!NothrowHash)
+			{
+				hashes.reserve(mSize);
+
+				for (size_t i = 0; i < oldCapacity; ++i)
+				{
+					if (oldControl[i] >= 0)
+						hashes.push_back(hashOf(oldSlots[i].first));
+				}
+			}
+
+			for (size_t i = 0, n = 0; i < oldCapacity; ++i)
+			{
+				if (oldControl[i] >= 0)
+				{
+					size_t hash;
+
+					if constexpr (NothrowHash)
+						hash = hashOf(oldSlots[i].first);
+					else
+						hash = hashes[n++];
+
+					const auto index = findFreeIndex(hash);
+
+					std::allocator_traits<SlotAllocator>::construct(slotAllocator, slots + index, std::move_if_noexcept(oldSlots[i]));
+					setControl(index, static_cast<int8>(hash & 0x7F));
+				}
+			}
+		}
+		catch (...)
+		{
+			for (size_t i = 0; i < _capacity; ++i)
+			{
+				if (control[i] >= 0)
+					std::allocator_traits<SlotAllocator>::destroy(slotAllocator, slots + i);
+			}
+
+			mControl = oldControl;
+			mSlots = oldSlots;
+			mCapacity = oldCapacity;
+
+			std::allocator_traits<ControlAllocator>::deallocate(controlAllocator, control, _capacity + Detail::HashGroupWidth);
+			std::allocator_traits<SlotAllocator>::deallocate(slotAllocator, slots, _capacity);
+			throw;
+		}
+
+		mGrowthLeft = Detail::HashCapacityToGrowth(_capacity) - mSize;
+
+		if (oldCapacity != 0)
+		{
+			if constexpr (!std::is_trivially_destructible_v<value_type>)
+			{
+				for (size_t i = 0; i < oldCapacity; ++i)
+				{
+					if (oldControl[i] >= 0)
+						std::allocator_traits<SlotAllocator>::destroy(slotAllocator, oldSlots + i);
+				}
+			}
+
+			std::allocator_traits<ControlAllocator>::deallocate(controlAllocator, oldControl, oldCapacity + Detail::HashGroupWidth);
+			std::allocator_traits<SlotAllocator>::deallocate(slotAllocator, oldSlots, oldCapacity);
+		}
+	}
+
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::destroySlots() noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<value_type>)
+		{
+			SlotAllocator slotAllocator{ mAllocator };
+
+			for (size_t i = 0; i < mCapacity; ++i)
+			{
+				if (mControl[i] >= 0)
+				{
+					std::allocator_traits<SlotAllocator>::destroy(slotAllocator, mSlots + i);
+				}
+			}
+		}
+
+		mSize = 0;
+	}
+
+	HASHMAP_TEMPLATE
+	inline void HashMap<Key, Vty, Hasher, Equaler, Allocator>::deallocate() noexcept
+	{
+		if (mCapacity != 0)
+		{
+			ControlAllocator controlAllocator{ mAllocator };
+			SlotAllocator slotAllocator{ mAllocator };
+
+			std::allocator_traits<ControlAllocator>::deallocate(controlAllocator, mControl, mCapacity + Detail::HashGroupWidth);
+			std::allocator_traits<SlotAllocator>::deallocate(slotAllocator, mSlots, mCapacity);
+		}
+
+		mControl = Detail::HashEmptyGroup;
+		mSlots = nullptr;
+		mCapacity = 0;
+		mSize = 0;
+		mGrowthLeft = 0;
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::iteratorAt(size_t _index) noexcept
+	{
+		return iterator{ mControl + _index,mSlots + _index };
+	}
+
+	HASHMAP_TEMPLATE
+	inline typename HashMap<Key, Vty, Hasher, Equaler, Allocator>::const_iterator HashMap<Key, Vty, Hasher, Equaler, Allocator>::iteratorAt(size_t _index) const noexcept
+	{
+		return const_iterator{ mControl + _index,mSlots + _index };
+	}
 }
\ No newline at end of file
@@ -0,0 +1,1191 @@
+#pragma once
+
+#include <new>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+
+#include <Iris/Common/Numeric.hpp>
+
+namespace Iris
+{
+	// Array with room for N elements inside the object. Up to N elements never touch the allocator, which suits the
+	// many short per-object lists (components, contacts, tags); past N it moves everything to the heap and grows
+	// like Array. The API matches Array's, and iterators are plain pointers.
+	// Moving a SmallArray moves its elements one by one while they are inline, so iterators into the source do not
+	// carry over; any operation that grows or shrinks the storage invalidates iterators as with Array.
+	template<class Type, size_t N, class Allocator = std::allocator<Type>>
+	class SmallArray
+	{
+	public:
+
+		static_assert(N > 0, "SmallArray needs inline room for at least one element; use Array otherwise");
+
+		using value_type		= Type;
+		using allocator_type	= Allocator;
+		using pointer			= Type*;
+		using const_pointer		= const Type*;
+		using reference			= Type&;
+		using const_reference	= const Type&;
+		using size_type			= size_t;
+		using difference_type	= std::ptrdiff_t;
+
+		using iterator					= Type*;
+		using const_iterator			= const Type*;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+		static constexpr size_type InlineCapacity = N;
+
+		explicit SmallArray()noexcept;
+
+		explicit SmallArray(const Allocator& _alloc)noexcept;
+
+		explicit SmallArray(size_type _count, const Allocator& _alloc = Allocator{});
+
+		SmallArray(size_type _count, const Type& _val, const Allocator& _alloc = Allocator{});
+
+		SmallArray(std::initializer_list<Type> _iniList, const Allocator& _alloc = Allocator{});
+
+		template<class Iterator>
+		SmallArray(Iterator _first, Iterator _last, const Allocator& _alloc = Allocator{});
+
+		SmallArray(const SmallArray& _other);
+
+		SmallArray(SmallArray&& _other)noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+		~SmallArray();
+
+		SmallArray& operator=(std::initializer_list<Type> _iniList);
+
+		SmallArray& operator=(const SmallArray& _other);
+
+		SmallArray& operator=(SmallArray&& _other)noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+		reference operator[](size_type _idx)noexcept;
+
+		const_reference operator[](size_type _idx)const noexcept;
+
+		explicit operator bool()const noexcept;
+
+		template<class ...Args>
+		void emplace(const_iterator _where, Args&& ..._args);
+
+		template<class ...Args>
+		void emplaceFirst(Args&& ..._args);
+
+		template<class ...Args>
+		void emplaceLast(Args&& ..._args);
+
+		void addFirst(const Type& _val);
+
+		void addFirst(Type&& _val);
+
+		void addFirst(std::initializer_list<Type> _iniList);
+
+		template<class Iterator>
+		void addFirst(Iterator _first, Iterator _last);
+
+		void addLast(const Type& _val);
+
+		void addLast(Type&& _val);
+
+		void addLast(std::initializer_list<Type> _iniList);
+
+		template<class Iterator>
+		void addLast(Iterator _first, Iterator _last);
+
+		void insert(const_iterator _where, const Type& _val);
+
+		void insert(const_iterator _where, Type&& _val);
+
+		void insert(const_iterator _where, std::initializer_list<Type> _iniList);
+
+		template<class Iterator>
+		void insert(const_iterator _where, Iterator _first, Iterator _last);
+
+		void prepend(const SmallArray& _array);
+
+		void prepend(SmallArray&& _array);
+
+		void append(const SmallArray& _array);
+
+		void append(SmallArray&& _array);
+
+		// Removes every element equal to '_val'
+		void remove(const Type& _val);
+
+		void remove(const_iterator _where);
+
+		void removeFirst();
+
+		void removeLast();
+
+		void removeRange(const_iterator _first, const_iterator _last);
+
+		// Does nothing when '_index' is out of range
+		void removeAt(size_type _index);
+
+		template<class Fty>
+		void removeBy(Fty _function)requires(Concept::Predicate<Fty, const Type&>);
+
+		// Keeps the heap block, if any; shrinkToFit releases it
+		void removeAll()noexcept;
+
+		// Moves the elements back inline when they fit, otherwise trims the heap block to size()
+		void shrinkToFit()noexcept;
+
+		iterator find(const Type& _val);
+
+		const_iterator find(const Type& _val)const;
+
+		// end() when '_index' is out of range
+		iterator findAt(size_type _index);
+
+		const_iterator findAt(size_type _index)const;
+
+		template<class Fty>
+		iterator findBy(Fty _function)requires(Concept::Predicate<Fty, const Type&>);
+
+		template<class Fty>
+		const_iterator findBy(Fty _function)const requires(Concept::Predicate<Fty, const Type&>);
+
+		// size_type(UINT64_MAX) when '_where' is not an element of this array
+		size_type indexOf(const_iterator _where)const noexcept;
+
+		Type* data()noexcept;
+
+		const Type* data()const noexcept;
+
+		/// @throw Error::OutOfRange when '_index' is out of range
+		Type& at(size_type _index);
+
+		/// @throw Error::OutOfRange when '_index' is out of range
+		const Type& at(size_type _index)const;
+
+		Type& first();
+
+		const Type& first()const;
+
+		Type& last();
+
+		const Type& last()const;
+
+		size_type size()const noexcept;
+
+		size_type capacity()const noexcept;
+
+		// True while the elements live inside the object
+		bool isInline()const noexcept;
+
+		size_type count(const Type& _val)const;
+
+		template<class Fty>
+		size_type countBy(Fty _function)const requires(Concept::Predicate<Fty, const Type&>);
+
+		void swap(SmallArray& _other)noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+		void resize(size_type _size);
+
+		void resize(size_type _size, const Type& _val);
+
+		void reserve(size_type _capacity);
+
+		void sortBy();
+
+		template<class Comparator>
+		void sortBy(Comparator _comparator);
+
+		void stableSortBy();
+
+		template<class Comparator>
+		void stableSortBy(Comparator _comparator);
+
+		void heapSortBy();
+
+		template<class Comparator>
+		void heapSortBy(Comparator _comparator);
+
+		void heapify();
+
+		template<class Comparator>
+		void heapify(Comparator _comparator);
+
+		template<class Fty>
+		SmallArray map(Fty _function)const requires(Concept::PredicateWith<Type, Fty, const Type&>);
+
+		iterator begin()noexcept;
+
+		const_iterator begin()const noexcept;
+
+		iterator end()noexcept;
+
+		const_iterator end()const noexcept;
+
+		const_iterator cbegin()const noexcept;
+
+		const_iterator cend()const noexcept;
+
+		reverse_iterator rbegin()noexcept;
+
+		const_reverse_iterator rbegin()const noexcept;
+
+		reverse_iterator rend()noexcept;
+
+		const_reverse_iterator rend()const noexcept;
+
+		const_reverse_iterator crbegin()const noexcept;
+
+		const_reverse_iterator crend()const noexcept;
+
+		template<class Fty>
+		void forEach(Fty _function)requires(Concept::Invocable<Fty, Type&>);
+
+		template<class Fty>
+		void forEach(Fty _function)const requires(Concept::Invocable<Fty, const Type&>);
+
+		bool contains(const Type& _val)const;
+
+		template<class Fty>
+		bool contains(Fty _function)const requires(Concept::Predicate<Fty, const Type&>);
+
+		template<class Fty>
+		bool anyOf(Fty _function)const requires(Concept::Predicate<Fty, const Type&>);
+
+		template<class Fty>
+		bool allOf(Fty _function)const requires(Concept::Predicate<Fty, const Type&>);
+
+		template<class Fty>
+		bool noneOf(Fty _function)const requires(Concept::Predicate<Fty, const Type&>);
+
+		bool empty()const noexcept;
+
+		template<class T, size_t M, class A>
+		friend bool operator==(const SmallArray<T, M, A>& a, const SmallArray<T, M, A>& b);
+
+		template<class T, size_t M, class A>
+		friend bool operator!=(const SmallArray<T, M, A>& a, const SmallArray<T, M, A>& b);
+
+	private:
+
+		Type* inlineData()noexcept;
+
+		// Moves the elements into a block of exactly '_capacity' slots, or back inline when '_capacity' is N
+		void reallocate(size_type _capacity);
+
+		// Capacity for at least '_count' elements; doubles so repeated addLast stays amortized O(1)
+		size_type grownCapacity(size_type _count)const noexcept;
+
+		// Moves the elements into the uninitialized '_data', copying instead when the move may throw, so on an
+		// exception the elements built so far are destroyed and this array is left as it was
+		void relocateTo(Type* _data);
+
+		// Moves the elements out of '_other', or takes its heap block; '_other' ends up empty and inline.
+		// This array must be empty and inline
+		void takeFrom(SmallArray& _other)noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+		// Destroys the elements and releases the heap block
+		void release()noexcept;
+
+	private:
+
+		Type* mData;
+
+		size_type mSize = 0;
+
+		size_type mCapacity = N;
+
+		[[no_unique_address]] Allocator mAllocator;
+
+		alignas(Type) unsigned char mInline[sizeof(Type) * N];
+
+	};
+}
+
+namespace Iris
+{
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::SmallArray() noexcept
+		: mData(inlineData())
+		, mAllocator()
+	{}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::SmallArray(const Allocator& _alloc) noexcept
+		: mData(inlineData())
+		, mAllocator(_alloc)
+	{}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::SmallArray(size_type _count, const Allocator& _alloc)
+		: SmallArray(_alloc)
+	{
+		resize(_count);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::SmallArray(size_type _count, const Type& _val, const Allocator& _alloc)
+		: SmallArray(_alloc)
+	{
+		resize(_count, _val);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::SmallArray(std::initializer_list<Type> _iniList, const Allocator& _alloc)
+		: SmallArray(_alloc)
+	{
+		addLast(_iniList.begin(), _iniList.end());
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Iterator>
+	inline SmallArray<Type, N, Allocator>::SmallArray(Iterator _first, Iterator _last, const Allocator& _alloc)
+		: SmallArray(_alloc)
+	{
+		addLast(_first, _last);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::SmallArray(const SmallArray& _other)
+		: SmallArray(std::allocator_traits<Allocator>::select_on_container_copy_construction(_other.mAllocator))
+	{
+		addLast(_other.begin(), _other.end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::SmallArray(SmallArray&& _other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+		: mData(inlineData())
+		, mAllocator(_other.mAllocator)
+	{
+		takeFrom(_other);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::~SmallArray()
+	{
+		release();
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>& SmallArray<Type, N, Allocator>::operator=(std::initializer_list<Type> _iniList)
+	{
+		removeAll();
+		addLast(_iniList.begin(), _iniList.end());
+		return *this;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>& SmallArray<Type, N, Allocator>::operator=(const SmallArray& _other)
+	{
+		if (this != &_other)
+		{
+			removeAll();
+			addLast(_other.begin(), _other.end());
+		}
+
+		return *this;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>& SmallArray<Type, N, Allocator>::operator=(SmallArray&& _other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+	{
+		if (this != &_other)
+		{
+			release();
+			mAllocator = _other.mAllocator;
+			takeFrom(_other);
+		}
+
+		return *this;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::reference SmallArray<Type, N, Allocator>::operator[](size_type _idx) noexcept
+	{
+		return mData[_idx];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_reference SmallArray<Type, N, Allocator>::operator[](size_type _idx) const noexcept
+	{
+		return mData[_idx];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline SmallArray<Type, N, Allocator>::operator bool() const noexcept
+	{
+		return mSize != 0;
+	}
+
+	template<class Type, size_t N, class Allocator> template<class ...Args>
+	inline void SmallArray<Type, N, Allocator>::emplace(const_iterator _where, Args&& ..._args)
+	{
+		const auto index = static_cast<size_type>(_where - cbegin());
+		emplaceLast(std::forward<Args>(_args)...);
+		std::rotate(begin() + index, end() - 1, end());
+	}
+
+	template<class Type, size_t N, class Allocator> template<class ...Args>
+	inline void SmallArray<Type, N, Allocator>::emplaceFirst(Args&& ..._args)
+	{
+		emplace(cbegin(), std::forward<Args>(_args)...);
+	}
+
+	template<class Type, size_t N, class Allocator> template<class ...Args>
+	inline void SmallArray<Type, N, Allocator>::emplaceLast(Args&& ..._args)
+	{
+		if (mSize < mCapacity)
+		{
+			::new (static_cast<void*>(mData + mSize)) Type(std::forward<Args>(_args)...);
+			++mSize;
+			return;
+		}
+
+		// The new element is built in the new block before the old one goes away, so '_args' may refer into this array
+		const auto capacity = grownCapacity(mSize + 1);
+		auto* data = std::allocator_traits<Allocator>::allocate(mAllocator, capacity);
+
+		try
+		{
+			::new (static_cast<void*>(data + mSize)) Type(std::forward<Args>(_args)...);
+		}
+		catch (...)
+		{
+			std::allocator_traits<Allocator>::deallocate(mAllocator, data, capacity);
+			throw;
+		}
+
+		try
+		{
+			relocateTo(data);
+		}
+		catch (...)
+		{
+			std::destroy_at(data + mSize);
+			std::allocator_traits<Allocator>::deallocate(mAllocator, data, capacity);
+			throw;
+		}
+
+		const auto size = mSize + 1;
+
+		release();
+		mData = data;
+		mSize = size;
+		mCapacity = capacity;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::addFirst(const Type& _val)
+	{
+		emplace(cbegin(), _val);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::addFirst(Type&& _val)
+	{
+		emplace(cbegin(), std::move(_val));
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::addFirst(std::initializer_list<Type> _iniList)
+	{
+		insert(cbegin(), _iniList.begin(), _iniList.end());
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Iterator>
+	inline void SmallArray<Type, N, Allocator>::addFirst(Iterator _first, Iterator _last)
+	{
+		insert(cbegin(), _first, _last);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::addLast(const Type& _val)
+	{
+		emplaceLast(_val);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::addLast(Type&& _val)
+	{
+		emplaceLast(std::move(_val));
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::addLast(std::initializer_list<Type> _iniList)
+	{
+		addLast(_iniList.begin(), _iniList.end());
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Iterator>
+	inline void SmallArray<Type, N, Allocator>::addLast(Iterator _first, Iterator _last)
+	{
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>)
+		{
+			const auto count = static_cast<size_type>(std::distance(_first, _last));
+
+			if (mSize + count <= mCapacity)
+			{
+				std::uninitialized_copy(_first, _last, mData + mSize);
+				mSize += count;
+				return;
+			}
+
+			// Copied before the old elements move, so the range may come from this array
+			const auto capacity = grownCapacity(mSize + count);
+			auto* data = std::allocator_traits<Allocator>::allocate(mAllocator, capacity);
+
+			try
+			{
+				std::uninitialized_copy(_first, _last, data + mSize);
+			}
+			catch (...)
+			{
+				std::allocator_traits<Allocator>::deallocate(mAllocator, data, capacity);
+				throw;
+			}
+
+			try
+			{
+				relocateTo(data);
+			}
+			catch (...)
+			{
+				std::destroy_n(data + mSize, count);
+				std::allocator_traits<Allocator>::deallocate(mAllocator, data, capacity);
+				throw;
+			}
+
+			const auto size = mSize + count;
+
+			release();
+			mData = data;
+			mSize = size;
+			mCapacity = capacity;
+		}
+		else
+		{
+			for (; _first != _last; ++_first)
+			{
+				emplaceLast(*_first);
+			}
+		}
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::insert(const_iterator _where, const Type& _val)
+	{
+		emplace(_where, _val);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::insert(const_iterator _where, Type&& _val)
+	{
+		emplace(_where, std::move(_val));
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::insert(const_iterator _where, std::initializer_list<Type> _iniList)
+	{
+		insert(_where, _iniList.begin(), _iniList.end());
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Iterator>
+	inline void SmallArray<Type, N, Allocator>::insert(const_iterator _where, Iterator _first, Iterator _last)
+	{
+		const auto index = static_cast<size_type>(_where - cbegin());
+		const auto oldSize = mSize;
+
+		addLast(_first, _last);
+		std::rotate(begin() + index, begin() + oldSize, end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::prepend(const SmallArray& _array)
+	{
+		insert(cbegin(), _array.begin(), _array.end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::prepend(SmallArray&& _array)
+	{
+		insert(cbegin(), std::make_move_iterator(_array.begin()), std::make_move_iterator(_array.end()));
+		_array.removeAll();
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::append(const SmallArray& _array)
+	{
+		addLast(_array.begin(), _array.end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::append(SmallArray&& _array)
+	{
+		addLast(std::make_move_iterator(_array.begin()), std::make_move_iterator(_array.end()));
+		_array.removeAll();
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::remove(const Type& _val)
+	{
+		removeRange(std::remove(begin(), end(), _val), end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::remove(const_iterator _where)
+	{
+		removeRange(_where, _where + 1);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::removeFirst()
+	{
+		remove(cbegin());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::removeLast()
+	{
+		mData[--mSize].~Type();
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::removeRange(const_iterator _first, const_iterator _last)
+	{
+		auto* first = mData + (_first - cbegin());
+		auto* last = mData + (_last - cbegin());
+
+		if (first == last)
+			return;
+
+		auto* newEnd = std::move(last, end(), first);
+		std::destroy(newEnd, end());
+		mSize = static_cast<size_type>(newEnd - mData);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::removeAt(size_type _index)
+	{
+		if (_index < mSize)
+		{
+			remove(cbegin() + _index);
+		}
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Fty>
+	inline void SmallArray<Type, N, Allocator>::removeBy(Fty _function) requires(Concept::Predicate<Fty, const Type&>)
+	{
+		removeRange(std::remove_if(begin(), end(), _function), end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::removeAll() noexcept
+	{
+		std::destroy_n(mData, mSize);
+		mSize = 0;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::shrinkToFit() noexcept
+	{
+		if (mSize == mCapacity || isInline())
+			return;
+
+		try
+		{
+			reallocate(Max(mSize, N));
+		}
+		catch (...)
+		{
+			// Like std::vector::shrink_to_fit, only a request
+		}
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::iterator SmallArray<Type, N, Allocator>::find(const Type& _val)
+	{
+		return std::find(begin(), end(), _val);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_iterator SmallArray<Type, N, Allocator>::find(const Type& _val) const
+	{
+		return std::find(begin(), end(), _val);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::iterator SmallArray<Type, N, Allocator>::findAt(size_type _index)
+	{
+		return (_index < mSize) ? begin() + _index : end();
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_iterator SmallArray<Type, N, Allocator>::findAt(size_type _index) const
+	{
+		return (_index < mSize) ? begin() + _index : end();
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Fty>
+	inline typename SmallArray<Type, N, Allocator>::iterator SmallArray<Type, N, Allocator>::findBy(Fty _function) requires(Concept::Predicate<Fty, const Type&>)
+	{
+		return std::find_if(begin(), end(), _function);
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Fty>
+	inline typename SmallArray<Type, N, Allocator>::const_iterator SmallArray<Type, N, Allocator>::findBy(Fty _function) const requires(Concept::Predicate<Fty, const Type&>)
+	{
+		return std::find_if(begin(), end(), _function);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::size_type SmallArray<Type, N, Allocator>::indexOf(const_iterator _where) const noexcept
+	{
+		for (size_type i = 0; i < mSize; ++i)
+		{
+			if (mData + i == _where)
+				return i;
+		}
+
+		return size_type(UINT64_MAX);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline Type* SmallArray<Type, N, Allocator>::data() noexcept
+	{
+		return mData;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline const Type* SmallArray<Type, N, Allocator>::data() const noexcept
+	{
+		return mData;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline Type& SmallArray<Type, N, Allocator>::at(size_type _index)
+	{
+		if (_index >= mSize)
+			throw Error::OutOfRange{ "SmallArray::at(size_type)" };
+
+		return mData[_index];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline const Type& SmallArray<Type, N, Allocator>::at(size_type _index) const
+	{
+		if (_index >= mSize)
+			throw Error::OutOfRange{ "SmallArray::at(size_type)const" };
+
+		return mData[_index];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline Type& SmallArray<Type, N, Allocator>::first()
+	{
+		return mData[0];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline const Type& SmallArray<Type, N, Allocator>::first() const
+	{
+		return mData[0];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline Type& SmallArray<Type, N, Allocator>::last()
+	{
+		return mData[mSize - 1];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline const Type& SmallArray<Type, N, Allocator>::last() const
+	{
+		return mData[mSize - 1];
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::size_type SmallArray<Type, N, Allocator>::size() const noexcept
+	{
+		return mSize;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::size_type SmallArray<Type, N, Allocator>::capacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline bool SmallArray<Type, N, Allocator>::isInline() const noexcept
+	{
+		return mData == reinterpret_cast<const Type*>(mInline);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::size_type SmallArray<Type, N, Allocator>::count(const Type& _val) const
+	{
+		return static_cast<size_type>(std::count(begin(), end(), _val));
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Fty>
+	inline typename SmallArray<Type, N, Allocator>::size_type SmallArray<Type, N, Allocator>::countBy(Fty _function) const requires(Concept::Predicate<Fty, const Type&>)
+	{
+		return static_cast<size_type>(std::count_if(begin(), end(), _function));
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::swap(SmallArray& _other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+	{
+		if (this == &_other)
+			return;
+
+		if (!isInline() && !_other.isInline())
+		{
+			std::swap(mData, _other.mData);
+			std::swap(mSize, _other.mSize);
+			std::swap(mCapacity, _other.mCapacity);
+			std::swap(mAllocator, _other.mAllocator);
+			return;
+		}
+
+		SmallArray temp(std::move(_other));
+		_other = std::move(*this);
+		*this = std::move(temp);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::resize(size_type _size)
+	{
+		if (_size <= mSize)
+		{
+			removeRange(cbegin() + _size, cend());
+			return;
+		}
+
+		reserve(_size);
+		std::uninitialized_value_construct(mData + mSize, mData + _size);
+		mSize = _size;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::resize(size_type _size, const Type& _val)
+	{
+		if (_size <= mSize)
+		{
+			removeRange(cbegin() + _size, cend());
+			return;
+		}
+
+		// '_val' may be an element of this array
+		const Type value(_val);
+		reserve(_size);
+		std::uninitialized_fill(mData + mSize, mData + _size, value);
+		mSize = _size;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::reserve(size_type _capacity)
+	{
+		if (_capacity > mCapacity)
+		{
+			reallocate(_capacity);
+		}
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::sortBy()
+	{
+		std::sort(begin(), end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Comparator>
+	inline void SmallArray<Type, N, Allocator>::sortBy(Comparator _comparator)
+	{
+		std::sort(begin(), end(), _comparator);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::stableSortBy()
+	{
+		std::stable_sort(begin(), end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Comparator>
+	inline void SmallArray<Type, N, Allocator>::stableSortBy(Comparator _comparator)
+	{
+		std::stable_sort(begin(), end(), _comparator);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::heapSortBy()
+	{
+		std::sort_heap(begin(), end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Comparator>
+	inline void SmallArray<Type, N, Allocator>::heapSortBy(Comparator _comparator)
+	{
+		std::sort_heap(begin(), end(), _comparator);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::heapify()
+	{
+		std::make_heap(begin(), end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Comparator>
+	inline void SmallArray<Type, N, Allocator>::heapify(Comparator _comparator)
+	{
+		std::make_heap(begin(), end(), _comparator);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Fty>
+	inline SmallArray<Type, N, Allocator> SmallArray<Type, N, Allocator>::map(Fty _function) const requires(Concept::PredicateWith<Type, Fty, const Type&>)
+	{
+		SmallArray result(mAllocator);
+		result.reserve(mSize);
+
+		for (const auto& elem : *this)
+		{
+			result.emplaceLast(_function(elem));
+		}
+
+		return result;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::iterator SmallArray<Type, N, Allocator>::begin() noexcept
+	{
+		return mData;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_iterator SmallArray<Type, N, Allocator>::begin() const noexcept
+	{
+		return mData;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::iterator SmallArray<Type, N, Allocator>::end() noexcept
+	{
+		return mData + mSize;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_iterator SmallArray<Type, N, Allocator>::end() const noexcept
+	{
+		return mData + mSize;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_iterator SmallArray<Type, N, Allocator>::cbegin() const noexcept
+	{
+		return mData;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_iterator SmallArray<Type, N, Allocator>::cend() const noexcept
+	{
+		return mData + mSize;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::reverse_iterator SmallArray<Type, N, Allocator>::rbegin() noexcept
+	{
+		return reverse_iterator(end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_reverse_iterator SmallArray<Type, N, Allocator>::rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::reverse_iterator SmallArray<Type, N, Allocator>::rend() noexcept
+	{
+		return reverse_iterator(begin());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_reverse_iterator SmallArray<Type, N, Allocator>::rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_reverse_iterator SmallArray<Type, N, Allocator>::crbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::const_reverse_iterator SmallArray<Type, N, Allocator>::crend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Fty>
+	inline void SmallArray<Type, N, Allocator>::forEach(Fty _function) requires(Concept::Invocable<Fty, Type&>)
+	{
+		for (auto& elem : *this)
+			_function(elem);
+	}
+
+	template<class Type, size_t N, class Allocator> template<class Fty>
+	inline void SmallArray<Type, N, Allocator>::forEach(Fty _function) const requires(Concept::Invocable<Fty, const Type&>)
+	{
+		for (const auto& elem : *this)
+			_function(elem);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline bool SmallArray<Type, N, Allocator>::contains(const Type& _val) const
+	{
+		return std::find(begin(), end(), _val) != end();
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Fty>
+	inline bool SmallArray<Type, N, Allocator>::contains(Fty _function) const requires(Concept::Predicate<Fty, const Type&>)
+	{
+		return std::any_of(begin(), end(), _function);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Fty>
+	inline bool SmallArray<Type, N, Allocator>::anyOf(Fty _function) const requires(Concept::Predicate<Fty, const Type&>)
+	{
+		return std::any_of(begin(), end(), _function);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Fty>
+	inline bool SmallArray<Type, N, Allocator>::allOf(Fty _function) const requires(Concept::Predicate<Fty, const Type&>)
+	{
+		return std::all_of(begin(), end(), _function);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	template<class Fty>
+	inline bool SmallArray<Type, N, Allocator>::noneOf(Fty _function) const requires(Concept::Predicate<Fty, const Type&>)
+	{
+		return std::none_of(begin(), end(), _function);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline bool SmallArray<Type, N, Allocator>::empty() const noexcept
+	{
+		return mSize == 0;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline Type* SmallArray<Type, N, Allocator>::inlineData() noexcept
+	{
+		return reinterpret_cast<Type*>(mInline);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::reallocate(size_type _capacity)
+	{
+		auto* data = (_capacity == N) ? inlineData() : std::allocator_traits<Allocator>::allocate(mAllocator, _capacity);
+
+		try
+		{
+			relocateTo(data);
+		}
+		catch (...)
+		{
+			if (_capacity != N)
+			{
+				std::allocator_traits<Allocator>::deallocate(mAllocator, data, _capacity);
+			}
+
+			throw;
+		}
+
+		const auto size = mSize;
+
+		release();
+		mData = data;
+		mSize = size;
+		mCapacity = _capacity;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline typename SmallArray<Type, N, Allocator>::size_type SmallArray<Type, N, Allocator>::grownCapacity(size_type _count) const noexcept
+	{
+		return Max(mCapacity * 2, _count);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::relocateTo(Type* _data)
+	{
+		size_type i = 0;
+
+		try
+		{
+			for (; i < mSize; ++i)
+			{
+				::new (static_cast<void*>(_data + i)) Type(std::move_if_noexcept(mData[i]));
+			}
+		}
+		catch (...)
+		{
+			std::destroy_n(_data, i);
+			throw;
+		}
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::takeFrom(SmallArray& _other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+	{
+		if (_other.isInline())
+		{
+			std::uninitialized_move_n(_other.mData, _other.mSize, mData);
+			mSize = _other.mSize;
+			_other.removeAll();
+			return;
+		}
+
+		mData = std::exchange(_other.mData, _other.inlineData());
+		mSize = std::exchange(_other.mSize, 0);
+		mCapacity = std::exchange(_other.mCapacity, N);
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline void SmallArray<Type, N, Allocator>::release() noexcept
+	{
+		std::destroy_n(mData, mSize);
+
+		if (!isInline())
+		{
+			std::allocator_traits<Allocator>::deallocate(mAllocator, mData, mCapacity);
+		}
+
+		mData = inlineData();
+		mSize = 0;
+		mCapacity = N;
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline bool operator==(const SmallArray<Type, N, Allocator>& a, const SmallArray<Type, N, Allocator>& b)
+	{
+		return std::equal(a.begin(), a.end(), b.begin(), b.end());
+	}
+
+	template<class Type, size_t N, class Allocator>
+	inline bool operator!=(const SmallArray<Type, N, Allocator>& a, const SmallArray<Type, N, Allocator>& b)
+	{
+		return !(a == b);
+	}
+}
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include <map>
 
+#include <Iris/Common/Concepts.hpp>
+#include <Iris/Common/Exceptions.hpp>
+
 namespace Iris
 {
 #define DECLARE_SORTEDMAP_TEMPLATE template<class Key, class Vty, class Comparator = std::less<Key>, class Allocator = std::allocator<std::pair<const Key,Vty>>>
@@ -44,6 +47,17 @@ namespace Iris
         using base_type::cend;
 
         using base_type::at;
+        using base_type::find;
+        using base_type::contains;
+        using base_type::count;
+
+        // std::map::at has no heterogeneous overload; this one accepts whatever a transparent comparator does
+        // (e.g. String::view_type or const char32_t* for String keys) without constructing a Key
+        template<class K>
+        Vty& at(const K& _key) requires(Concept::Transparent<Comparator>);
+
+        template<class K>
+        const Vty& at(const K& _key)const requires(Concept::Transparent<Comparator>);
 
         using base_type::swap;
         using base_type::clear;
@@ -54,4 +68,27 @@ namespace Iris
 
 	};
 
+	SORTEDMAP_TEMPLATE
+	template<class K>
+	inline Vty& SortedMap<Key, Vty, Comparator, Allocator>::at(const K& _key) requires(Concept::Transparent<Comparator>)
+	{
+		const auto it = base_type::find(_key);
+
+		if (it == base_type::end())
+			throw Error::OutOfRange{ "SortedMap::at(const K&)" };
+
+		return it->second;
+	}
+
+	SORTEDMAP_TEMPLATE
+	template<class K>
+	inline const Vty& SortedMap<Key, Vty, Comparator, Allocator>::at(const K& _key) const requires(Concept::Transparent<Comparator>)
+	{
+		const auto it = base_type::find(_key);
+
+		if (it == base_type::end())
+			throw Error::OutOfRange{ "SortedMap::at(const K&)const" };
+
+		return it->second;
+	}
 }
\ No newline at end of file
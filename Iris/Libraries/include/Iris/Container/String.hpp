@@ -1,7 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <algorithm>
+#include <functional>
 
 #include <Iris/Common/Numeric.hpp>
 
@@ -76,6 +78,9 @@ namespace Iris
 
 		explicit operator bool()const noexcept;
 
+		// Implicit like std::u32string's, so views and raw strings can stand in for String in transparent lookups
+		operator view_type()const noexcept;
+
 		void addFirst(char_type _ch);
 
 		void addFirst(raw_type _raw);
@@ -358,6 +363,11 @@ namespace Iris
 		return !mString.empty();
 	}
 
+	inline String::operator view_type() const noexcept
+	{
+		return mString;
+	}
+
 	inline void String::addFirst(char_type _ch)
 	{
 		mString.insert(mString.cbegin(), _ch);
@@ -996,7 +1006,7 @@ namespace Iris
 
 	inline size_t String::GetRawLength(const String& string, raw_type raw) noexcept
 	{
-		auto i = 0ui64;
+		size_t i = 0;
 		const auto e = string.mString.max_size();
 
 		while (i < e)
@@ -1127,12 +1137,38 @@ namespace Iris
 	}
 }
 
+// The specializations below are transparent: String, String::view_type and const char32_t* all convert to a view,
+// so HashMap and SortedMap keyed by String find a view or a literal without building a String.
+// std::hash of a view equals std::hash of the std::u32string it views, so every key type hashes alike.
 template<>
 struct std::hash<Iris::String>
 {
-	size_t operator()(const Iris::String& _string) const
+	using is_transparent = void;
+
+	size_t operator()(Iris::String::view_type _string) const noexcept
+	{
+		return std::hash<Iris::String::view_type>{}(_string);
+	}
+};
+
+template<>
+struct std::equal_to<Iris::String>
+{
+	using is_transparent = void;
+
+	bool operator()(Iris::String::view_type _left, Iris::String::view_type _right) const noexcept
+	{
+		return _left == _right;
+	}
+};
+
+template<>
+struct std::less<Iris::String>
+{
+	using is_transparent = void;
+
+	bool operator()(Iris::String::view_type _left, Iris::String::view_type _right) const noexcept
 	{
-		using base_hasher = std::hash<Iris::String::base_type>;
-		return base_hasher{}(*_string);
+		return _left < _right;
 	}
 };
\ No newline at end of file
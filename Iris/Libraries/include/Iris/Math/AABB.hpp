@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Iris/Math/Vector3.hpp>
+
+namespace Iris
+{
+	struct AABB final
+	{
+		constexpr AABB()noexcept;
+
+		constexpr AABB(const Vector3& _min, const Vector3& _max)noexcept;
+
+		constexpr Vector3 center()const noexcept;
+
+		constexpr Vector3 extents()const noexcept;
+
+		constexpr Vector3 size()const noexcept;
+
+		constexpr bool contains(const Vector3& _point)const noexcept;
+
+		constexpr bool intersects(const AABB& _other)const noexcept;
+
+		constexpr AABB merge(const AABB& _other)const noexcept;
+
+		constexpr AABB merge(const Vector3& _point)const noexcept;
+
+		static constexpr AABB FromCenterExtents(const Vector3& center, const Vector3& extents)noexcept;
+
+		Vector3 min;
+
+		Vector3 max;
+	};
+}
+
+namespace Iris
+{
+	inline constexpr bool operator==(const AABB& left, const AABB& right) noexcept
+	{
+		return (left.min == right.min) && (left.max == right.max);
+	}
+
+	inline constexpr bool operator!=(const AABB& left, const AABB& right) noexcept
+	{
+		return !(left == right);
+	}
+}
+
+namespace Iris
+{
+	inline constexpr AABB::AABB() noexcept
+		: min(), max()
+	{}
+
+	inline constexpr AABB::AABB(const Vector3& _min, const Vector3& _max) noexcept
+		: min(_min), max(_max)
+	{}
+
+	inline constexpr Vector3 AABB::center() const noexcept
+	{
+		return (min + max) * 0.5f;
+	}
+
+	inline constexpr Vector3 AABB::extents() const noexcept
+	{
+		return (max - min) * 0.5f;
+	}
+
+	inline constexpr Vector3 AABB::size() const noexcept
+	{
+		return max - min;
+	}
+
+	inline constexpr bool AABB::contains(const Vector3& _point) const noexcept
+	{
+		return (min.x <= _point.x) && (_point.x <= max.x)
+			&& (min.y <= _point.y) && (_point.y <= max.y)
+			&& (min.z <= _point.z) && (_point.z <= max.z);
+	}
+
+	inline constexpr bool AABB::intersects(const AABB& _other) const noexcept
+	{
+		return (min.x <= _other.max.x) && (_other.min.x <= max.x)
+			&& (min.y <= _other.max.y) && (_other.min.y <= max.y)
+			&& (min.z <= _other.max.z) && (_other.min.z <= max.z);
+	}
+
+	inline constexpr AABB AABB::merge(const AABB& _other) const noexcept
+	{
+		return AABB
+		{
+			Vector3{ Min(min.x, _other.min.x),Min(min.y, _other.min.y),Min(min.z, _other.min.z) },
+			Vector3{ Max(max.x, _other.max.x),Max(max.y, _other.max.y),Max(max.z, _other.max.z) }
+		};
+	}
+
+	inline constexpr AABB AABB::merge(const Vector3& _point) const noexcept
+	{
+		return merge(AABB{ _point,_point });
+	}
+
+	inline constexpr AABB AABB::FromCenterExtents(const Vector3& center, const Vector3& extents) noexcept
+	{
+		return AABB{ center - extents,center + extents };
+	}
+}
\ No newline at end of file
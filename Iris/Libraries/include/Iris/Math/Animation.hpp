@@ -0,0 +1,121 @@
+#pragma once
+
+#include <span>
+
+#include <Iris/Math/Transform.hpp>
+#include <Iris/Container/Array.hpp>
+
+namespace Iris
+{
+	// Keyframed local transforms, one track per bone. Every channel of every track lives in one contiguous array
+	// (times, positions, rotations, scales), and a track is the range [first, first + count) of all four,
+	// so sampling a track touches a few adjacent cache lines instead of chasing per-key objects.
+	class AnimationClip final
+	{
+	public:
+
+		AnimationClip()noexcept = default;
+
+		// Appends a track and returns its index. Times must be non-negative and strictly increasing, with one
+		// position, rotation and scale per time. Throws Error::OutOfRange otherwise
+		size_t addTrack(std::span<const float32> _times, std::span<const Vector3> _positions, std::span<const Quaternion> _rotations, std::span<const Vector3> _scales);
+
+		// Stateless sampling with a binary search; see AnimationSampler for playback. Throws Error::OutOfRange for a bad track
+		Transform sample(size_t _track, float32 _time)const;
+
+		// Time of the last key over all tracks
+		float32 duration()const noexcept;
+
+		size_t trackCount()const noexcept;
+
+		size_t keyCount()const noexcept;
+
+	private:
+
+		friend class AnimationSampler;
+
+		struct Track final
+		{
+			uint32 first;
+
+			uint32 count;
+		};
+
+		// Index of the last key at or before '_time', or 0 when '_time' precedes the first key
+		uint32 findKey(const Track& _track, float32 _time)const noexcept;
+
+		Transform interpolate(const Track& _track, uint32 _key, float32 _time)const noexcept;
+
+	private:
+
+		Array<Track> mTracks;
+
+		Array<float32> mTimes;
+
+		Array<Vector3> mPositions;
+
+		Array<Quaternion> mRotations;
+
+		Array<Vector3> mScales;
+
+		float32 mDuration = 0.f;
+
+	};
+
+	// Playback state of one skeleton: a key cursor per track, so time moving forward costs O(1) per track and sample.
+	// Moving backward, as when a loop wraps, re-seeks the affected tracks with a binary search.
+	// The clip must outlive the sampler; nothing is allocated after construction unless the clip gains tracks.
+	class AnimationSampler final
+	{
+	public:
+
+		explicit AnimationSampler(const AnimationClip& _clip);
+
+		// Writes clip().trackCount() local transforms. Positions and scales are lerped, rotations nlerped.
+		// Throws Error::OutOfRange when '_pose' is too short
+		void sample(float32 _time, std::span<Transform> _pose);
+
+		void reset()noexcept;
+
+		const AnimationClip& clip()const noexcept;
+
+		// samplers[i].sample(times[i], poses[i]) over 'threadCount' threads; 0 threads uses every hardware thread.
+		// Poses are only written, never resized. Throws Error::OutOfRange before sampling anything when 'times' or
+		// 'poses' is shorter than 'samplers' or a pose holds fewer transforms than its clip has tracks
+		static void SampleBatch(std::span<AnimationSampler> samplers, std::span<const float32> times, std::span<Array<Transform>> poses, size_t threadCount = 1);
+
+	private:
+
+		void samplePose(float32 _time, Transform* _pose)noexcept;
+
+	private:
+
+		const AnimationClip* mClip;
+
+		Array<uint32> mCursors;
+
+	};
+}
+
+namespace Iris
+{
+	inline float32 AnimationClip::duration() const noexcept
+	{
+		return mDuration;
+	}
+
+	inline size_t AnimationClip::trackCount() const noexcept
+	{
+		return mTracks.size();
+	}
+
+	inline size_t AnimationClip::keyCount() const noexcept
+	{
+		return mTimes.size();
+	}
+
+	inline const AnimationClip& AnimationSampler::clip() const noexcept
+	{
+		return *mClip;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <span>
+#include <type_traits>
+
+#include <Iris/Math/AABB.hpp>
+#include <Iris/Math/Sphere.hpp>
+#include <Iris/Math/Ray.hpp>
+#include <Iris/Container/Array.hpp>
+
+namespace Iris
+{
+	// Bounding volume hierarchy over caller-owned primitives, identified by their index in the build span.
+	// Nodes are stored depth-first: the left child directly follows its parent.
+	class BVH final
+	{
+	public:
+
+		static constexpr uint32 InvalidIndex = 0xFFFFFFFFu;
+
+		static constexpr uint32 MaxLeafSize = 8;
+
+		// 32 bytes, two per cache line
+		struct Node final
+		{
+			AABB bounds;
+
+			// Leaf: first entry in primitives(). Interior: index of the right child
+			uint32 offset;
+
+			// 0 for interior nodes
+			uint32 count;
+
+			constexpr bool isLeaf()const noexcept;
+		};
+
+		struct Hit final
+		{
+			uint32 primitive = InvalidIndex;
+
+			float32 distance = std::numeric_limits<float32>::infinity();
+
+			explicit constexpr operator bool()const noexcept;
+		};
+
+		// Returns true and writes 'distance' when the ray hits the primitive within ray.maxDistance
+		using IntersectFunction = bool(*)(void* context, uint32 primitive, const Ray& ray, float32& distance);
+
+		BVH()noexcept = default;
+
+		// Binned SAH; subtrees above a size threshold are built on separate threads. 0 uses every hardware thread
+		void build(std::span<const AABB> _bounds, size_t _threadCount = 1);
+
+		// Recomputes node bounds bottom-up without changing the topology; throws Error::OutOfRange on a size mismatch
+		void refit(std::span<const AABB> _bounds);
+
+		void clear()noexcept;
+
+		template<class Fty>
+		Hit raycast(const Ray& _ray, Fty&& _intersect)const;
+
+		// Traces packets of 8 consecutive rays together when AVX2 is available, which pays off for coherent rays such as screen tiles.
+		// Throws Error::OutOfRange when _hits is shorter than _rays
+		template<class Fty>
+		void raycast(std::span<const Ray> _rays, std::span<Hit> _hits, Fty&& _intersect)const;
+
+		// Appends every primitive whose bounds touch the query volume
+		void overlap(const AABB& _box, Array<uint32>& _result)const;
+
+		void overlap(const Sphere& _sphere, Array<uint32>& _result)const;
+
+		AABB bounds()const noexcept;
+
+		std::span<const Node> nodes()const noexcept;
+
+		std::span<const uint32> primitives()const noexcept;
+
+		bool empty()const noexcept;
+
+	private:
+
+		Hit raycastSingle(const Ray& _ray, void* _context, IntersectFunction _intersect)const;
+
+		void raycastPacket(std::span<const Ray> _rays, std::span<Hit> _hits, void* _context, IntersectFunction _intersect)const;
+
+		template<class Fty>
+		static bool Invoke(void* context, uint32 primitive, const Ray& ray, float32& distance);
+
+	private:
+
+		Array<Node> mNodes;
+
+		Array<uint32> mPrimitives;
+
+		// Primitive bounds in mPrimitives order
+		Array<AABB> mBounds;
+
+	};
+}
+
+namespace Iris
+{
+	inline constexpr bool BVH::Node::isLeaf() const noexcept
+	{
+		return count != 0;
+	}
+
+	inline constexpr BVH::Hit::operator bool() const noexcept
+	{
+		return primitive != InvalidIndex;
+	}
+
+	template<class Fty>
+	inline bool BVH::Invoke(void* context, uint32 primitive, const Ray& ray, float32& distance)
+	{
+		return (*static_cast<std::remove_reference_t<Fty>*>(context))(primitive, ray, distance);
+	}
+
+	template<class Fty>
+	inline BVH::Hit BVH::raycast(const Ray& _ray, Fty&& _intersect) const
+	{
+		return raycastSingle(_ray, const_cast<void*>(static_cast<const void*>(&_intersect)), &Invoke<Fty>);
+	}
+
+	template<class Fty>
+	inline void BVH::raycast(std::span<const Ray> _rays, std::span<Hit> _hits, Fty&& _intersect) const
+	{
+		raycastPacket(_rays, _hits, const_cast<void*>(static_cast<const void*>(&_intersect)), &Invoke<Fty>);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <span>
+
+#include <Iris/Math/Matrix4x4.hpp>
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Container/Array.hpp>
+
+namespace Iris
+{
+	// Points are treated as (x, y, z, 1) and directions as (x, y, z, 0); w is not divided out.
+	// 'output' may be the same span as 'input'; throws Error::OutOfRange when it is shorter.
+
+	void TransformPoints(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output);
+
+	void TransformPoints(const Matrix4x4& matrix, const Array<Vector3>& input, std::span<Vector3> output);
+
+	void TransformPoints(const Matrix4x4& matrix, std::span<Vector3> points)noexcept;
+
+	void TransformDirections(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output);
+
+	void TransformDirections(const Matrix4x4& matrix, const Array<Vector3>& input, std::span<Vector3> output);
+
+	void TransformDirections(const Matrix4x4& matrix, std::span<Vector3> directions)noexcept;
+
+	// Non-temporal stores that bypass the cache; for outputs that will not be read back soon
+
+	void TransformPointsStream(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output);
+
+	void TransformDirectionsStream(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output);
+}
\ No newline at end of file
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Quaternion.hpp>
+#include <Iris/Math/Transform.hpp>
+
+namespace Iris
+{
+	// Rigid transform as real + dual * epsilon: 'real' is the rotation and 'dual' is 0.5 * translation * rotation.
+	// Blending unit dual quaternions and renormalizing avoids the volume loss of linear blend skinning.
+	struct DualQuaternion final
+	{
+		constexpr DualQuaternion()noexcept;
+
+		constexpr DualQuaternion(const Quaternion& _real, const Quaternion& _dual)noexcept;
+
+		constexpr DualQuaternion(const Quaternion& _rotation, const Vector3& _translation)noexcept;
+
+		constexpr float32 dot(const DualQuaternion& _other)const noexcept;
+
+		constexpr DualQuaternion conjugate()const noexcept;
+
+		// Unit inverse; the conjugate of a normalized dual quaternion
+		constexpr DualQuaternion inverse()const noexcept;
+
+		constexpr DualQuaternion normalize()const noexcept;
+
+		constexpr Quaternion rotation()const noexcept;
+
+		constexpr Vector3 translation()const noexcept;
+
+		constexpr Vector3 transformPoint(const Vector3& _point)const noexcept;
+
+		constexpr Vector3 transformDirection(const Vector3& _direction)const noexcept;
+
+		Transform toTransform()const noexcept;
+
+		Matrix4x4 toMatrix4x4()const noexcept;
+
+		static constexpr DualQuaternion Identity()noexcept;
+
+		// Scale is discarded
+		static constexpr DualQuaternion FromTransform(const Transform& transform)noexcept;
+
+		static DualQuaternion FromMatrix4x4(const Matrix4x4& matrix);
+
+		// Blends along the shortest arc and renormalizes (dual quaternion linear blending)
+		static constexpr DualQuaternion Blend(const DualQuaternion& from, const DualQuaternion& to, float32 t)noexcept;
+
+		Quaternion real;
+
+		Quaternion dual;
+	};
+}
+
+namespace Iris
+{
+	// Same order as Transform and Matrix4x4: 'left' is applied first
+	constexpr DualQuaternion operator*(const DualQuaternion& left, const DualQuaternion& right)noexcept;
+
+	constexpr DualQuaternion operator*(const DualQuaternion& left, float32 right)noexcept;
+
+	constexpr DualQuaternion operator+(const DualQuaternion& left, const DualQuaternion& right)noexcept;
+
+	constexpr DualQuaternion& operator*=(DualQuaternion& left, const DualQuaternion& right)noexcept;
+
+	constexpr DualQuaternion& operator*=(DualQuaternion& left, float32 right)noexcept;
+
+	constexpr DualQuaternion& operator+=(DualQuaternion& left, const DualQuaternion& right)noexcept;
+}
+
+namespace Iris
+{
+	inline constexpr DualQuaternion::DualQuaternion() noexcept
+		: real(Quaternion::Identity())
+		, dual(0.f, 0.f, 0.f, 0.f)
+	{}
+
+	inline constexpr DualQuaternion::DualQuaternion(const Quaternion& _real, const Quaternion& _dual) noexcept
+		: real(_real)
+		, dual(_dual)
+	{}
+
+	inline constexpr DualQuaternion::DualQuaternion(const Quaternion& _rotation, const Vector3& _translation) noexcept
+		: real(_rotation)
+		, dual(Quaternion{ 0.f,_translation } * _rotation * 0.5f)
+	{}
+
+	inline constexpr float32 DualQuaternion::dot(const DualQuaternion& _other) const noexcept
+	{
+		return real.dot(_other.real);
+	}
+
+	inline constexpr DualQuaternion DualQuaternion::conjugate() const noexcept
+	{
+		return DualQuaternion{ real.conjugate(),dual.conjugate() };
+	}
+
+	inline constexpr DualQuaternion DualQuaternion::inverse() const noexcept
+	{
+		return normalize().conjugate();
+	}
+
+	inline constexpr DualQuaternion DualQuaternion::normalize() const noexcept
+	{
+		const auto length = real.length();
+
+		if (length < Math::Epsilon)
+			return *this;
+
+		const auto inverseLength = 1.f / length;
+		return DualQuaternion{ real * inverseLength,dual * inverseLength };
+	}
+
+	inline constexpr Quaternion DualQuaternion::rotation() const noexcept
+	{
+		return real;
+	}
+
+	// 2 * dual * conjugate(real), expanded to its vector part
+	inline constexpr Vector3 DualQuaternion::translation() const noexcept
+	{
+		const Vector3 rv{ real.x,real.y,real.z };
+		const Vector3 dv{ dual.x,dual.y,dual.z };
+
+		return (dv * real.w - rv * dual.w + rv.cross(dv)) * 2.f;
+	}
+
+	inline constexpr Vector3 DualQuaternion::transformPoint(const Vector3& _point) const noexcept
+	{
+		return transformDirection(_point) + translation();
+	}
+
+	// v + w * t + q x t with t = 2 * (q x v)
+	inline constexpr Vector3 DualQuaternion::transformDirection(const Vector3& _direction) const noexcept
+	{
+		const Vector3 rv{ real.x,real.y,real.z };
+		const auto t = rv.cross(_direction) * 2.f;
+
+		return _direction + t * real.w + rv.cross(t);
+	}
+
+	inline Transform DualQuaternion::toTransform() const noexcept
+	{
+		return Transform{ translation(),real };
+	}
+
+	inline Matrix4x4 DualQuaternion::toMatrix4x4() const noexcept
+	{
+		return toTransform().toMatrix4x4();
+	}
+
+	inline constexpr DualQuaternion DualQuaternion::Identity() noexcept
+	{
+		return DualQuaternion{};
+	}
+
+	inline constexpr DualQuaternion DualQuaternion::FromTransform(const Transform& transform) noexcept
+	{
+		return DualQuaternion{ transform.rotation,transform.position };
+	}
+
+	inline DualQuaternion DualQuaternion::FromMatrix4x4(const Matrix4x4& matrix)
+	{
+		return FromTransform(Transform::FromMatrix4x4(matrix));
+	}
+
+	inline constexpr DualQuaternion DualQuaternion::Blend(const DualQuaternion& from, const DualQuaternion& to, float32 t) noexcept
+	{
+		const auto sign = (from.dot(to) < 0.f) ? -1.f : 1.f;
+
+		return (from * (1.f - t) + to * (t * sign)).normalize();
+	}
+
+	inline constexpr DualQuaternion operator*(const DualQuaternion& left, const DualQuaternion& right) noexcept
+	{
+		return DualQuaternion
+		{
+			right.real * left.real,
+			right.real * left.dual + right.dual * left.real
+		};
+	}
+
+	inline constexpr DualQuaternion operator*(const DualQuaternion& left, float32 right) noexcept
+	{
+		return DualQuaternion{ left.real * right,left.dual * right };
+	}
+
+	inline constexpr DualQuaternion operator+(const DualQuaternion& left, const DualQuaternion& right) noexcept
+	{
+		return DualQuaternion{ left.real + right.real,left.dual + right.dual };
+	}
+
+	inline constexpr DualQuaternion& operator*=(DualQuaternion& left, const DualQuaternion& right) noexcept
+	{
+		left = left * right;
+		return left;
+	}
+
+	inline constexpr DualQuaternion& operator*=(DualQuaternion& left, float32 right) noexcept
+	{
+		left = left * right;
+		return left;
+	}
+
+	inline constexpr DualQuaternion& operator+=(DualQuaternion& left, const DualQuaternion& right) noexcept
+	{
+		left = left + right;
+		return left;
+	}
+}
\ No newline at end of file
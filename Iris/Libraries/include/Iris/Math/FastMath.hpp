@@ -0,0 +1,229 @@
+#pragma once
+
+#include <Iris/Math/Math.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if !defined(IRIS_SIMD_X86)
+	#error FastMath requires SSE
+#endif
+
+#include <immintrin.h>
+
+// Lane-wise versions of the Math::Fast* approximations with the same error bounds.
+// The __m256 overloads need AVX2 and FMA; call them only after checking CPUFeature::Get()
+namespace Iris::Math
+{
+	__m128 FastSin(__m128 x)noexcept;
+
+	__m128 FastCos(__m128 x)noexcept;
+
+	void FastSinCos(__m128 x, __m128& sin, __m128& cos)noexcept;
+
+	__m128 FastAtan2(__m128 x, __m128 y)noexcept;
+
+	__m128 FastAcos(__m128 x)noexcept;
+
+	IRIS_TARGET_AVX2 __m256 FastSin(__m256 x)noexcept;
+
+	IRIS_TARGET_AVX2 __m256 FastCos(__m256 x)noexcept;
+
+	IRIS_TARGET_AVX2 void FastSinCos(__m256 x, __m256& sin, __m256& cos)noexcept;
+
+	IRIS_TARGET_AVX2 __m256 FastAtan2(__m256 x, __m256 y)noexcept;
+
+	IRIS_TARGET_AVX2 __m256 FastAcos(__m256 x)noexcept;
+}
+
+namespace Iris::Math::Detail
+{
+	inline __m128 Select(__m128 mask, __m128 a, __m128 b) noexcept
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	inline __m128i ReduceHalfPi(__m128 x, __m128& r) noexcept
+	{
+		const __m128i q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(TwoOverPi)));
+		const __m128 fq = _mm_cvtepi32_ps(q);
+		r = _mm_sub_ps(x, _mm_mul_ps(fq, _mm_set1_ps(HalfPi1)));
+		r = _mm_sub_ps(r, _mm_mul_ps(fq, _mm_set1_ps(HalfPi2)));
+		r = _mm_sub_ps(r, _mm_mul_ps(fq, _mm_set1_ps(HalfPi3)));
+		return q;
+	}
+
+	inline __m128 SinKernel(__m128 r) noexcept
+	{
+		const __m128 r2 = _mm_mul_ps(r, r);
+		__m128 p = _mm_add_ps(_mm_mul_ps(r2, _mm_set1_ps(SinCoef[2])), _mm_set1_ps(SinCoef[1]));
+		p = _mm_add_ps(_mm_mul_ps(r2, p), _mm_set1_ps(SinCoef[0]));
+		return _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), p));
+	}
+
+	inline __m128 CosKernel(__m128 r) noexcept
+	{
+		const __m128 r2 = _mm_mul_ps(r, r);
+		__m128 p = _mm_add_ps(_mm_mul_ps(r2, _mm_set1_ps(CosCoef[2])), _mm_set1_ps(CosCoef[1]));
+		p = _mm_add_ps(_mm_mul_ps(r2, p), _mm_set1_ps(CosCoef[0]));
+		return _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), p));
+	}
+
+	// Bit 0 of q picks the kernel and bit 1 flips the sign
+	inline __m128 QuadrantSelect(__m128i q, __m128 s, __m128 c) noexcept
+	{
+		const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		const __m128 sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+		return _mm_xor_ps(Select(swap, c, s), sign);
+	}
+
+	IRIS_TARGET_AVX2 inline __m256i ReduceHalfPi(__m256 x, __m256& r) noexcept
+	{
+		const __m256i q = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(TwoOverPi)));
+		const __m256 fq = _mm256_cvtepi32_ps(q);
+		r = _mm256_fnmadd_ps(fq, _mm256_set1_ps(HalfPi1), x);
+		r = _mm256_fnmadd_ps(fq, _mm256_set1_ps(HalfPi2), r);
+		r = _mm256_fnmadd_ps(fq, _mm256_set1_ps(HalfPi3), r);
+		return q;
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 SinKernel(__m256 r) noexcept
+	{
+		const __m256 r2 = _mm256_mul_ps(r, r);
+		__m256 p = _mm256_fmadd_ps(r2, _mm256_set1_ps(SinCoef[2]), _mm256_set1_ps(SinCoef[1]));
+		p = _mm256_fmadd_ps(r2, p, _mm256_set1_ps(SinCoef[0]));
+		return _mm256_fmadd_ps(_mm256_mul_ps(r, r2), p, r);
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 CosKernel(__m256 r) noexcept
+	{
+		const __m256 r2 = _mm256_mul_ps(r, r);
+		__m256 p = _mm256_fmadd_ps(r2, _mm256_set1_ps(CosCoef[2]), _mm256_set1_ps(CosCoef[1]));
+		p = _mm256_fmadd_ps(r2, p, _mm256_set1_ps(CosCoef[0]));
+		return _mm256_fmadd_ps(_mm256_mul_ps(r2, r2), p, _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), r2, _mm256_set1_ps(1.f)));
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 QuadrantSelect(__m256i q, __m256 s, __m256 c) noexcept
+	{
+		const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+		const __m256 sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+		return _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sign);
+	}
+}
+
+namespace Iris::Math
+{
+	inline __m128 FastSin(__m128 x) noexcept
+	{
+		__m128 r;
+		const __m128i q = Detail::ReduceHalfPi(x, r);
+		return Detail::QuadrantSelect(q, Detail::SinKernel(r), Detail::CosKernel(r));
+	}
+
+	inline __m128 FastCos(__m128 x) noexcept
+	{
+		__m128 r;
+		const __m128i q = Detail::ReduceHalfPi(x, r);
+		return Detail::QuadrantSelect(_mm_add_epi32(q, _mm_set1_epi32(1)), Detail::SinKernel(r), Detail::CosKernel(r));
+	}
+
+	inline void FastSinCos(__m128 x, __m128& sin, __m128& cos) noexcept
+	{
+		__m128 r;
+		const __m128i q = Detail::ReduceHalfPi(x, r);
+		const __m128 s = Detail::SinKernel(r);
+		const __m128 c = Detail::CosKernel(r);
+		sin = Detail::QuadrantSelect(q, s, c);
+		cos = Detail::QuadrantSelect(_mm_add_epi32(q, _mm_set1_epi32(1)), s, c);
+	}
+
+	inline __m128 FastAtan2(__m128 x, __m128 y) noexcept
+	{
+		const __m128 signMask = _mm_set1_ps(-0.f);
+		const __m128 ax = _mm_andnot_ps(signMask, x);
+		const __m128 ay = _mm_andnot_ps(signMask, y);
+		const __m128 maxValue = _mm_max_ps(_mm_max_ps(ax, ay), _mm_set1_ps(std::numeric_limits<float32>::min()));
+		const __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), maxValue);
+		const __m128 a2 = _mm_mul_ps(a, a);
+
+		__m128 p = _mm_set1_ps(Detail::AtanCoef[5]);
+
+		for (int i = 4; i >= 0; --i)
+			p = _mm_add_ps(_mm_mul_ps(p, a2), _mm_set1_ps(Detail::AtanCoef[i]));
+
+		__m128 result = _mm_mul_ps(a, p);
+		result = Detail::Select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(0.5f * Pi), result), result);
+		result = Detail::Select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(Pi), result), result);
+		return _mm_or_ps(result, _mm_and_ps(_mm_cmplt_ps(y, _mm_setzero_ps()), signMask));
+	}
+
+	inline __m128 FastAcos(__m128 x) noexcept
+	{
+		const __m128 one = _mm_set1_ps(1.f);
+		const __m128 ax = _mm_min_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), x), one);
+
+		__m128 p = _mm_set1_ps(Detail::AcosCoef[7]);
+
+		for (int i = 6; i >= 0; --i)
+			p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps(Detail::AcosCoef[i]));
+
+		const __m128 result = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(one, ax)), p);
+		return Detail::Select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(Pi), result), result);
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 FastSin(__m256 x) noexcept
+	{
+		__m256 r;
+		const __m256i q = Detail::ReduceHalfPi(x, r);
+		return Detail::QuadrantSelect(q, Detail::SinKernel(r), Detail::CosKernel(r));
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 FastCos(__m256 x) noexcept
+	{
+		__m256 r;
+		const __m256i q = Detail::ReduceHalfPi(x, r);
+		return Detail::QuadrantSelect(_mm256_add_epi32(q, _mm256_set1_epi32(1)), Detail::SinKernel(r), Detail::CosKernel(r));
+	}
+
+	IRIS_TARGET_AVX2 inline void FastSinCos(__m256 x, __m256& sin, __m256& cos) noexcept
+	{
+		__m256 r;
+		const __m256i q = Detail::ReduceHalfPi(x, r);
+		const __m256 s = Detail::SinKernel(r);
+		const __m256 c = Detail::CosKernel(r);
+		sin = Detail::QuadrantSelect(q, s, c);
+		cos = Detail::QuadrantSelect(_mm256_add_epi32(q, _mm256_set1_epi32(1)), s, c);
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 FastAtan2(__m256 x, __m256 y) noexcept
+	{
+		const __m256 signMask = _mm256_set1_ps(-0.f);
+		const __m256 ax = _mm256_andnot_ps(signMask, x);
+		const __m256 ay = _mm256_andnot_ps(signMask, y);
+		const __m256 maxValue = _mm256_max_ps(_mm256_max_ps(ax, ay), _mm256_set1_ps(std::numeric_limits<float32>::min()));
+		const __m256 a = _mm256_div_ps(_mm256_min_ps(ax, ay), maxValue);
+		const __m256 a2 = _mm256_mul_ps(a, a);
+
+		__m256 p = _mm256_set1_ps(Detail::AtanCoef[5]);
+
+		for (int i = 4; i >= 0; --i)
+			p = _mm256_fmadd_ps(p, a2, _mm256_set1_ps(Detail::AtanCoef[i]));
+
+		__m256 result = _mm256_mul_ps(a, p);
+		result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(0.5f * Pi), result), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+		result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(Pi), result), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+		return _mm256_or_ps(result, _mm256_and_ps(_mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_LT_OQ), signMask));
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 FastAcos(__m256 x) noexcept
+	{
+		const __m256 one = _mm256_set1_ps(1.f);
+		const __m256 ax = _mm256_min_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.f), x), one);
+
+		__m256 p = _mm256_set1_ps(Detail::AcosCoef[7]);
+
+		for (int i = 6; i >= 0; --i)
+			p = _mm256_fmadd_ps(p, ax, _mm256_set1_ps(Detail::AcosCoef[i]));
+
+		const __m256 result = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(one, ax)), p);
+		return _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(Pi), result), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <span>
+
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Matrix4x4.hpp>
+#include <Iris/Math/AABB.hpp>
+#include <Iris/Math/Sphere.hpp>
+
+namespace Iris
+{
+	// Points with normal.dot(p) + distance >= 0 are on the positive side
+	struct Plane final
+	{
+		constexpr Plane()noexcept;
+
+		constexpr Plane(const Vector3& _normal, float32 _distance)noexcept;
+
+		constexpr float32 signedDistance(const Vector3& _point)const noexcept;
+
+		constexpr Plane normalize()const noexcept;
+
+		Vector3 normal;
+
+		float32 distance;
+	};
+
+	struct Frustum final
+	{
+		static constexpr size_t Left = 0;
+		static constexpr size_t Right = 1;
+		static constexpr size_t Bottom = 2;
+		static constexpr size_t Top = 3;
+		static constexpr size_t Near = 4;
+		static constexpr size_t Far = 5;
+
+		constexpr bool contains(const Vector3& _point)const noexcept;
+
+		constexpr bool intersects(const AABB& _box)const noexcept;
+
+		constexpr bool intersects(const Sphere& _sphere)const noexcept;
+
+		// Bit (i % 64) of visibility[i / 64] is set when bounds[i] is at least partly inside.
+		// Returns the number of visible bounds; throws Error::OutOfRange when visibility is shorter than MaskWords
+		size_t cull(std::span<const AABB> _bounds, std::span<uint64> _visibility)const;
+
+		size_t cull(std::span<const Sphere> _bounds, std::span<uint64> _visibility)const;
+
+		// Splits the bounds across threads on 64-bound boundaries; 0 uses every hardware thread
+		size_t cullParallel(std::span<const AABB> _bounds, std::span<uint64> _visibility, size_t _threadCount = 0)const;
+
+		size_t cullParallel(std::span<const Sphere> _bounds, std::span<uint64> _visibility, size_t _threadCount = 0)const;
+
+		static constexpr size_t MaskWords(size_t count)noexcept;
+
+		// Expects D3D clip space (0 <= z <= w) and the row-vector convention used by Matrix4x4
+		static Frustum FromViewProjection(const Matrix4x4& viewProjection)noexcept;
+
+		// Inward-facing and normalized
+		Plane planes[6];
+	};
+}
+
+namespace Iris
+{
+	inline constexpr Plane::Plane() noexcept
+		: normal(), distance(0)
+	{}
+
+	inline constexpr Plane::Plane(const Vector3& _normal, float32 _distance) noexcept
+		: normal(_normal), distance(_distance)
+	{}
+
+	inline constexpr float32 Plane::signedDistance(const Vector3& _point) const noexcept
+	{
+		return normal.dot(_point) + distance;
+	}
+
+	inline constexpr Plane Plane::normalize() const noexcept
+	{
+		const auto length = normal.length();
+
+		if (length < Math::Epsilon)
+			return *this;
+
+		return Plane{ normal / length,distance / length };
+	}
+
+	inline constexpr bool Frustum::contains(const Vector3& _point) const noexcept
+	{
+		for (const auto& plane : planes)
+		{
+			if (plane.signedDistance(_point) < 0.f)
+				return false;
+		}
+
+		return true;
+	}
+
+	inline constexpr bool Frustum::intersects(const AABB& _box) const noexcept
+	{
+		const auto center = _box.center();
+		const auto extents = _box.extents();
+
+		for (const auto& plane : planes)
+		{
+			const auto radius = Math::Abs(plane.normal.x) * extents.x + Math::Abs(plane.normal.y) * extents.y + Math::Abs(plane.normal.z) * extents.z;
+
+			if (plane.signedDistance(center) + radius < 0.f)
+				return false;
+		}
+
+		return true;
+	}
+
+	inline constexpr bool Frustum::intersects(const Sphere& _sphere) const noexcept
+	{
+		for (const auto& plane : planes)
+		{
+			if (plane.signedDistance(_sphere.center) + _sphere.radius < 0.f)
+				return false;
+		}
+
+		return true;
+	}
+
+	inline constexpr size_t Frustum::MaskWords(size_t count) noexcept
+	{
+		return (count + 63) / 64;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,638 @@
+#pragma once
+
+#include <span>
+#include <utility>
+#include <concepts>
+#include <type_traits>
+
+#include <Iris/Math/Vector2.hpp>
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Quaternion.hpp>
+#include <Iris/Container/Array.hpp>
+
+#if defined(_MSC_VER)
+	#define IRIS_LAZY_INLINE __forceinline
+#elif defined(__GNUC__)
+	#define IRIS_LAZY_INLINE [[gnu::always_inline]] inline
+#else
+	#define IRIS_LAZY_INLINE inline
+#endif
+
+// Opt-in lazy arithmetic: wrapping an operand with Lazy::Each (an array) or Lazy::Value (a single value) makes the
+// operators return expression nodes instead of results, and Lazy::Evaluate runs the whole tree once per element.
+//
+//   Lazy::Evaluate(Lazy::Each(a) + Lazy::Each(b) * s - Lazy::Cross(Lazy::Each(c), d), output);
+//
+// computes every output[i] in one pass with no intermediate arrays. Nodes hold array pointers and values by copy, so
+// an expression may outlive the temporaries it was built from but not the arrays it reads.
+//
+// Trees made only of +, -, negation, component and scalar products, Dot and Cross are evaluated one float component
+// at a time with every node force-inlined, so unoptimized builds run them without constructing a Vector3 or calling
+// an operator (MSVC honours __forceinline from /Ob1 up). Division, Normalize, Rotate and quaternion products need
+// whole values and go through the eager operators.
+namespace Iris::Lazy
+{
+	// size() of an expression without array operands: it matches any length
+	inline constexpr size_t Broadcast = static_cast<size_t>(-1);
+
+	template<class Type>
+	class ArrayOperand final
+	{
+	public:
+
+		using value_type = Type;
+
+		static constexpr bool Componentwise = true;
+
+		explicit constexpr ArrayOperand(std::span<const Type> _values)noexcept;
+
+		constexpr const Type& operator[](size_t _index)const noexcept;
+
+		template<size_t Component>
+		float32 component(size_t _index)const noexcept;
+
+		constexpr size_t size()const noexcept;
+
+	private:
+
+		// A raw pointer rather than the span, whose operator[] is a call in unoptimized builds
+		const Type* mValues;
+
+		size_t mSize;
+
+	};
+
+	template<class Type>
+	class ValueOperand final
+	{
+	public:
+
+		using value_type = Type;
+
+		static constexpr bool Componentwise = true;
+
+		explicit constexpr ValueOperand(const Type& _value)noexcept;
+
+		constexpr const Type& operator[](size_t _index)const noexcept;
+
+		template<size_t Component>
+		float32 component(size_t _index)const noexcept;
+
+		constexpr size_t size()const noexcept;
+
+	private:
+
+		Type mValue;
+
+	};
+
+	template<class Operation, class Operand>
+	class UnaryExpression final
+	{
+	public:
+
+		using value_type = decltype(Operation::Apply(std::declval<typename Operand::value_type>()));
+
+		static constexpr bool Componentwise = Operand::Componentwise && Operation::template IsComponentwise<typename Operand::value_type>;
+
+		explicit constexpr UnaryExpression(const Operand& _operand)noexcept;
+
+		constexpr value_type operator[](size_t _index)const;
+
+		// One component of element '_index'; scalar results ignore 'Component'. Only valid when Componentwise
+		template<size_t Component>
+		float32 component(size_t _index)const noexcept;
+
+		constexpr size_t size()const noexcept;
+
+	private:
+
+		Operand mOperand;
+
+	};
+
+	template<class Operation, class Left, class Right>
+	class BinaryExpression final
+	{
+	public:
+
+		using value_type = decltype(Operation::Apply(std::declval<typename Left::value_type>(), std::declval<typename Right::value_type>()));
+
+		static constexpr bool Componentwise = Left::Componentwise && Right::Componentwise
+			&& Operation::template IsComponentwise<typename Left::value_type, typename Right::value_type>;
+
+		// Throws Error::OutOfRange when both sides are arrays of different lengths
+		constexpr BinaryExpression(const Left& _left, const Right& _right);
+
+		constexpr value_type operator[](size_t _index)const;
+
+		template<size_t Component>
+		float32 component(size_t _index)const noexcept;
+
+		constexpr size_t size()const noexcept;
+
+	private:
+
+		Left mLeft;
+
+		Right mRight;
+
+		size_t mSize;
+
+	};
+}
+
+namespace Iris::Lazy::Detail
+{
+	template<class Type>
+	struct IsNode : std::false_type {};
+
+	template<class Type>
+	struct IsNode<ArrayOperand<Type>> : std::true_type {};
+
+	template<class Type>
+	struct IsNode<ValueOperand<Type>> : std::true_type {};
+
+	template<class Operation, class Operand>
+	struct IsNode<UnaryExpression<Operation, Operand>> : std::true_type {};
+
+	template<class Operation, class Left, class Right>
+	struct IsNode<BinaryExpression<Operation, Left, Right>> : std::true_type {};
+}
+
+namespace Iris::Lazy
+{
+	template<class Type>
+	concept Node = Detail::IsNode<std::remove_cvref_t<Type>>::value;
+
+	// Plain values that combine with nodes; they are broadcast to every element
+	template<class Type>
+	concept PlainValue = std::same_as<std::remove_cvref_t<Type>, float32> || std::same_as<std::remove_cvref_t<Type>, Vector2>
+		|| std::same_as<std::remove_cvref_t<Type>, Vector3> || std::same_as<std::remove_cvref_t<Type>, Quaternion>;
+
+	template<class Type>
+	concept Operand = Node<Type> || PlainValue<Type>;
+
+	template<class Left, class Right>
+	concept Operands = Operand<Left> && Operand<Right> && (Node<Left> || Node<Right>);
+}
+
+namespace Iris::Lazy::Detail
+{
+	template<class Type>
+	inline constexpr auto ToNode(const Type& operand) noexcept
+	{
+		if constexpr (Node<Type>)
+			return operand;
+		else
+			return ValueOperand<Type>{ operand };
+	}
+
+	template<class Type>
+	using NodeOf = decltype(ToNode(std::declval<Type>()));
+
+	template<class Type>
+	inline constexpr size_t ComponentCount = sizeof(Type) / sizeof(float32);
+
+	// Component access that also serves scalars, which have one value for every component
+	template<size_t Component, class Type>
+	IRIS_LAZY_INLINE float32 ComponentOf(const Type& value) noexcept
+	{
+		if constexpr (std::same_as<Type, float32>)
+			return value;
+		else
+			return value.data[Component];
+	}
+
+	struct Negate final
+	{
+		template<class Type>
+		static constexpr bool IsComponentwise = true;
+
+		template<class Type>
+		static constexpr auto Apply(const Type& value) { return -value; }
+
+		template<size_t Component, class Operand>
+		IRIS_LAZY_INLINE static float32 Evaluate(const Operand& operand, size_t index) noexcept
+		{
+			return -operand.template component<Component>(index);
+		}
+	};
+
+	struct Normalize final
+	{
+		template<class Type>
+		static constexpr bool IsComponentwise = false;
+
+		template<class Type>
+		static constexpr auto Apply(const Type& value) { return value.normalize(); }
+	};
+
+	struct Add final
+	{
+		template<class Left, class Right>
+		static constexpr bool IsComponentwise = true;
+
+		template<class Left, class Right>
+		static constexpr auto Apply(const Left& left, const Right& right) { return left + right; }
+
+		template<size_t Component, class Left, class Right>
+		IRIS_LAZY_INLINE static float32 Evaluate(const Left& left, const Right& right, size_t index) noexcept
+		{
+			return left.template component<Component>(index) + right.template component<Component>(index);
+		}
+	};
+
+	struct Subtract final
+	{
+		template<class Left, class Right>
+		static constexpr bool IsComponentwise = true;
+
+		template<class Left, class Right>
+		static constexpr auto Apply(const Left& left, const Right& right) { return left - right; }
+
+		template<size_t Component, class Left, class Right>
+		IRIS_LAZY_INLINE static float32 Evaluate(const Left& left, const Right& right, size_t index) noexcept
+		{
+			return left.template component<Component>(index) - right.template component<Component>(index);
+		}
+	};
+
+	// The math types only define vector * scalar, so scalar * vector is swapped. The quaternion product mixes components
+	struct Multiply final
+	{
+		template<class Left, class Right>
+		static constexpr bool IsComponentwise = !(std::same_as<Left, Quaternion> && std::same_as<Right, Quaternion>);
+
+		template<class Left, class Right>
+		static constexpr auto Apply(const Left& left, const Right& right)
+		{
+			if constexpr (std::same_as<Left, float32> && !std::same_as<Right, float32>)
+				return right * left;
+			else
+				return left * right;
+		}
+
+		template<size_t Component, class Left, class Right>
+		IRIS_LAZY_INLINE static float32 Evaluate(const Left& left, const Right& right, size_t index) noexcept
+		{
+			if constexpr (std::same_as<typename Left::value_type, float32> && !std::same_as<typename Right::value_type, float32>)
+				return right.template component<Component>(index) * left.template component<Component>(index);
+			else
+				return left.template component<Component>(index) * right.template component<Component>(index);
+		}
+	};
+
+	// Kept whole so a zero divisor throws as the eager operators do
+	struct Divide final
+	{
+		template<class Left, class Right>
+		static constexpr bool IsComponentwise = false;
+
+		template<class Left, class Right>
+		static constexpr auto Apply(const Left& left, const Right& right) { return left / right; }
+	};
+
+	struct Dot final
+	{
+		template<class Left, class Right>
+		static constexpr bool IsComponentwise = true;
+
+		template<class Left, class Right>
+		static constexpr auto Apply(const Left& left, const Right& right) { return left.dot(right); }
+
+		// Summed in the same order as the member dot functions
+		template<size_t Component, class Left, class Right>
+		IRIS_LAZY_INLINE static float32 Evaluate(const Left& left, const Right& right, size_t index) noexcept
+		{
+			return [&]<size_t First, size_t... Rest>(std::index_sequence<First, Rest...>)
+			{
+				auto sum = left.template component<First>(index) * right.template component<First>(index);
+				((sum += left.template component<Rest>(index) * right.template component<Rest>(index)), ...);
+				return sum;
+			}(std::make_index_sequence<ComponentCount<typename Left::value_type>>{});
+		}
+	};
+
+	struct Cross final
+	{
+		template<class Left, class Right>
+		static constexpr bool IsComponentwise = std::same_as<Left, Vector3> && std::same_as<Right, Vector3>;
+
+		template<class Left, class Right>
+		static constexpr auto Apply(const Left& left, const Right& right) { return left.cross(right); }
+
+		template<size_t Component, class Left, class Right>
+		IRIS_LAZY_INLINE static float32 Evaluate(const Left& left, const Right& right, size_t index) noexcept
+		{
+			constexpr size_t Next = (Component + 1) % 3;
+			constexpr size_t Last = (Component + 2) % 3;
+
+			return left.template component<Next>(index) * right.template component<Last>(index) - left.template component<Last>(index) * right.template component<Next>(index);
+		}
+	};
+
+	struct Rotate final
+	{
+		template<class Left, class Right>
+		static constexpr bool IsComponentwise = false;
+
+		static Vector3 Apply(const Vector3& vector, const Quaternion& rotation) noexcept { return vector.rotate(rotation); }
+	};
+
+	template<class Operation, class Type>
+	inline constexpr auto MakeUnary(const Type& operand) noexcept
+	{
+		return UnaryExpression<Operation, NodeOf<Type>>{ ToNode(operand) };
+	}
+
+	template<class Operation, class Left, class Right>
+	inline constexpr auto MakeBinary(const Left& left, const Right& right)
+	{
+		return BinaryExpression<Operation, NodeOf<Left>, NodeOf<Right>>{ ToNode(left), ToNode(right) };
+	}
+}
+
+namespace Iris::Lazy
+{
+	template<class Type>
+	constexpr ArrayOperand<Type> Each(std::span<const Type> values)noexcept;
+
+	template<class Type>
+	constexpr ArrayOperand<Type> Each(std::span<Type> values)noexcept;
+
+	template<class Type>
+	ArrayOperand<Type> Each(const Array<Type>& values)noexcept;
+
+	template<class Type>
+	constexpr ValueOperand<Type> Value(const Type& value)noexcept;
+
+	template<Node Type>
+	constexpr auto operator-(const Type& operand)noexcept;
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	constexpr auto operator+(const Left& left, const Right& right);
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	constexpr auto operator-(const Left& left, const Right& right);
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	constexpr auto operator*(const Left& left, const Right& right);
+
+	// Division by zero throws Error::ZeroDivisionException from Evaluate, as the eager operators do
+	template<class Left, class Right> requires Operands<Left, Right>
+	constexpr auto operator/(const Left& left, const Right& right);
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	constexpr auto Dot(const Left& left, const Right& right);
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	constexpr auto Cross(const Left& left, const Right& right);
+
+	template<Node Type>
+	constexpr auto Normalize(const Type& operand)noexcept;
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	auto Rotate(const Left& vector, const Right& rotation);
+
+	// output[i] = expression[i] for every element; a broadcast expression fills all of 'output'.
+	// Each element reads only element i of the arrays, so 'output' may be one of them.
+	// Throws Error::OutOfRange when 'output' is shorter than the expression
+	template<Node Expression>
+	constexpr void Evaluate(const Expression& expression, std::span<typename Expression::value_type> output);
+
+	// Element 0, which is the only result of an expression over values. Throws Error::OutOfRange for an empty expression
+	template<Node Expression>
+	constexpr typename Expression::value_type Evaluate(const Expression& expression);
+}
+
+namespace Iris::Lazy
+{
+	template<class Type>
+	inline constexpr ArrayOperand<Type>::ArrayOperand(std::span<const Type> _values) noexcept
+		: mValues(_values.data())
+		, mSize(_values.size())
+	{}
+
+	template<class Type>
+	IRIS_LAZY_INLINE constexpr const Type& ArrayOperand<Type>::operator[](size_t _index) const noexcept
+	{
+		return mValues[_index];
+	}
+
+	template<class Type>
+	template<size_t Component>
+	IRIS_LAZY_INLINE float32 ArrayOperand<Type>::component(size_t _index) const noexcept
+	{
+		return Detail::ComponentOf<Component>(mValues[_index]);
+	}
+
+	template<class Type>
+	inline constexpr size_t ArrayOperand<Type>::size() const noexcept
+	{
+		return mSize;
+	}
+
+	template<class Type>
+	inline constexpr ValueOperand<Type>::ValueOperand(const Type& _value) noexcept
+		: mValue(_value)
+	{}
+
+	template<class Type>
+	IRIS_LAZY_INLINE constexpr const Type& ValueOperand<Type>::operator[](size_t) const noexcept
+	{
+		return mValue;
+	}
+
+	template<class Type>
+	template<size_t Component>
+	IRIS_LAZY_INLINE float32 ValueOperand<Type>::component(size_t) const noexcept
+	{
+		return Detail::ComponentOf<Component>(mValue);
+	}
+
+	template<class Type>
+	inline constexpr size_t ValueOperand<Type>::size() const noexcept
+	{
+		return Broadcast;
+	}
+
+	template<class Operation, class Operand>
+	inline constexpr UnaryExpression<Operation, Operand>::UnaryExpression(const Operand& _operand) noexcept
+		: mOperand(_operand)
+	{}
+
+	template<class Operation, class Operand>
+	IRIS_LAZY_INLINE constexpr typename UnaryExpression<Operation, Operand>::value_type UnaryExpression<Operation, Operand>::operator[](size_t _index) const
+	{
+		return Operation::Apply(mOperand[_index]);
+	}
+
+	template<class Operation, class Operand>
+	template<size_t Component>
+	IRIS_LAZY_INLINE float32 UnaryExpression<Operation, Operand>::component(size_t _index) const noexcept
+	{
+		return Operation::template Evaluate<Component>(mOperand, _index);
+	}
+
+	template<class Operation, class Operand>
+	inline constexpr size_t UnaryExpression<Operation, Operand>::size() const noexcept
+	{
+		return mOperand.size();
+	}
+
+	template<class Operation, class Left, class Right>
+	inline constexpr BinaryExpression<Operation, Left, Right>::BinaryExpression(const Left& _left, const Right& _right)
+		: mLeft(_left)
+		, mRight(_right)
+		, mSize(Min(_left.size(), _right.size()))
+	{
+		if (_left.size() != Broadcast && _right.size() != Broadcast && _left.size() != _right.size())
+			throw Error::OutOfRange{ "Lazy::BinaryExpression::BinaryExpression(const Left&,const Right&)" };
+	}
+
+	template<class Operation, class Left, class Right>
+	IRIS_LAZY_INLINE constexpr typename BinaryExpression<Operation, Left, Right>::value_type BinaryExpression<Operation, Left, Right>::operator[](size_t _index) const
+	{
+		return Operation::Apply(mLeft[_index], mRight[_index]);
+	}
+
+	template<class Operation, class Left, class Right>
+	template<size_t Component>
+	IRIS_LAZY_INLINE float32 BinaryExpression<Operation, Left, Right>::component(size_t _index) const noexcept
+	{
+		return Operation::template Evaluate<Component>(mLeft, mRight, _index);
+	}
+
+	template<class Operation, class Left, class Right>
+	inline constexpr size_t BinaryExpression<Operation, Left, Right>::size() const noexcept
+	{
+		return mSize;
+	}
+
+	template<class Type>
+	inline constexpr ArrayOperand<Type> Each(std::span<const Type> values) noexcept
+	{
+		return ArrayOperand<Type>{ values };
+	}
+
+	template<class Type>
+	inline constexpr ArrayOperand<Type> Each(std::span<Type> values) noexcept
+	{
+		return ArrayOperand<Type>{ values };
+	}
+
+	template<class Type>
+	inline ArrayOperand<Type> Each(const Array<Type>& values) noexcept
+	{
+		return ArrayOperand<Type>{ std::span<const Type>{ values.data(), values.size() } };
+	}
+
+	template<class Type>
+	inline constexpr ValueOperand<Type> Value(const Type& value) noexcept
+	{
+		return ValueOperand<Type>{ value };
+	}
+
+	template<Node Type>
+	inline constexpr auto operator-(const Type& operand) noexcept
+	{
+		return Detail::MakeUnary<Detail::Negate>(operand);
+	}
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	inline constexpr auto operator+(const Left& left, const Right& right)
+	{
+		return Detail::MakeBinary<Detail::Add>(left, right);
+	}
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	inline constexpr auto operator-(const Left& left, const Right& right)
+	{
+		return Detail::MakeBinary<Detail::Subtract>(left, right);
+	}
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	inline constexpr auto operator*(const Left& left, const Right& right)
+	{
+		return Detail::MakeBinary<Detail::Multiply>(left, right);
+	}
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	inline constexpr auto operator/(const Left& left, const Right& right)
+	{
+		return Detail::MakeBinary<Detail::Divide>(left, right);
+	}
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	inline constexpr auto Dot(const Left& left, const Right& right)
+	{
+		return Detail::MakeBinary<Detail::Dot>(left, right);
+	}
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	inline constexpr auto Cross(const Left& left, const Right& right)
+	{
+		return Detail::MakeBinary<Detail::Cross>(left, right);
+	}
+
+	template<Node Type>
+	inline constexpr auto Normalize(const Type& operand) noexcept
+	{
+		return Detail::MakeUnary<Detail::Normalize>(operand);
+	}
+
+	template<class Left, class Right> requires Operands<Left, Right>
+	inline auto Rotate(const Left& vector, const Right& rotation)
+	{
+		return Detail::MakeBinary<Detail::Rotate>(vector, rotation);
+	}
+
+	template<Node Expression>
+	inline constexpr void Evaluate(const Expression& expression, std::span<typename Expression::value_type> output)
+	{
+		const auto size = expression.size();
+		const auto count = (size == Broadcast) ? output.size() : size;
+
+		if (output.size() < count)
+			throw Error::OutOfRange{ "Lazy::Evaluate(const Expression&,span<value_type>)" };
+
+		using Result = typename Expression::value_type;
+
+		if constexpr (Expression::Componentwise)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				[&]<size_t... Components>(std::index_sequence<Components...>)
+				{
+					auto* results = output.data();
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						// All components are computed before any store, so loads shared between them are not
+						// repeated for fear that the output aliases an operand
+						const float32 values[] = { expression.template component<Components>(i)... };
+						auto* components = reinterpret_cast<float32*>(results + i);
+						((components[Components] = values[Components]), ...);
+					}
+				}(std::make_index_sequence<Detail::ComponentCount<Result>>{});
+
+				return;
+			}
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			output[i] = expression[i];
+		}
+	}
+
+	template<Node Expression>
+	inline constexpr typename Expression::value_type Evaluate(const Expression& expression)
+	{
+		if (expression.size() == 0)
+			throw Error::OutOfRange{ "Lazy::Evaluate(const Expression&)" };
+
+		return expression[0];
+	}
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 #endif
 
 #include <cmath>
+#include <type_traits>
 
 #include <Iris/Common/Numeric.hpp>
 
@@ -17,6 +18,78 @@ namespace Iris::Math
 	static constexpr float32 ToDegree = 180.f / Pi;
 
 	static constexpr float32 Epsilon = std::numeric_limits<float32>::epsilon();
+}
+
+namespace Iris::Math::Detail
+{
+	// Compile-time fallbacks for Sqrt/Sin/Cos, evaluated in double and rounded once to float32
+	inline constexpr double ConstexprSqrt(double x)
+	{
+		if (x != x || x < 0.0)
+			return std::numeric_limits<double>::quiet_NaN();
+
+		if (x == 0.0 || x == std::numeric_limits<double>::infinity())
+			return x;
+
+		// Newton's method from above decreases monotonically until it converges
+		auto r = (x > 1.0) ? x : 1.0;
+
+		while (true)
+		{
+			const auto next = 0.5 * (r + x / r);
+
+			if (next >= r)
+				return r;
+
+			r = next;
+		}
+	}
+
+	// Reduces to [-pi, pi]; |x| must fit in int64
+	inline constexpr double ConstexprReduceTwoPi(double x)
+	{
+		constexpr double TwoPi = 6.283185307179586476925;
+		const auto k = static_cast<int64>(x / TwoPi + (x < 0.0 ? -0.5 : 0.5));
+		return x - static_cast<double>(k) * TwoPi;
+	}
+
+	inline constexpr double ConstexprSin(double x)
+	{
+		const auto r = ConstexprReduceTwoPi(x);
+		const auto r2 = r * r;
+
+		auto term = r;
+		auto sum = r;
+
+		for (int n = 1; n < 30; ++n)
+		{
+			term *= -r2 / static_cast<double>((2 * n) * (2 * n + 1));
+			sum += term;
+		}
+
+		return sum;
+	}
+
+	inline constexpr double ConstexprCos(double x)
+	{
+		const auto r = ConstexprReduceTwoPi(x);
+		const auto r2 = r * r;
+
+		auto term = 1.0;
+		auto sum = 1.0;
+
+		for (int n = 1; n < 30; ++n)
+		{
+			term *= -r2 / static_cast<double>((2 * n - 1) * (2 * n));
+			sum += term;
+		}
+
+		return sum;
+	}
+}
+
+namespace Iris::Math
+{
 
 	template<class T>
 	inline constexpr float32 Square(T x)
@@ -25,57 +98,209 @@ namespace Iris::Math
 	}
 
 	template<class T>
-	inline float32 Sqrt(T x)
+	inline constexpr float32 Abs(T x)
 	{
-		return std::sqrtf(x);
+		return x < 0 ? -x : x;
 	}
 
 	template<class T>
-	inline float32 Sin(T x)
+	inline constexpr float32 Sqrt(T x)
 	{
-		return std::sinf(x);
+		if (std::is_constant_evaluated())
+			return static_cast<float32>(Detail::ConstexprSqrt(static_cast<double>(x)));
+
+		return std::sqrt(x);
 	}
 
 	template<class T>
-	inline float32 Cos(T x)
+	inline constexpr float32 Sin(T x)
 	{
-		return std::cosf(x);
+		if (std::is_constant_evaluated())
+			return static_cast<float32>(Detail::ConstexprSin(static_cast<double>(x)));
+
+		return std::sin(x);
 	}
 
 	template<class T>
-	inline float32 Tan(T x)
+	inline constexpr float32 Cos(T x)
 	{
-		return std::tanf(x);
+		if (std::is_constant_evaluated())
+			return static_cast<float32>(Detail::ConstexprCos(static_cast<double>(x)));
+
+		return std::cos(x);
+	}
+
+	template<class T>
+	inline constexpr float32 Tan(T x)
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<float32>(Detail::ConstexprSin(static_cast<double>(x)) / Detail::ConstexprCos(static_cast<double>(x)));
+
+		return std::tan(x);
 	}
 
 	template<class T>
 	inline float32 ArcSin(T x)
 	{
-		return std::asinf(x);
+		return std::asin(x);
 	}
 
 	template<class T>
 	inline float32 ArcCos(T x)
 	{
-		return std::acosf(x);
+		return std::acos(x);
 	}
 
 	template<class T>
 	inline float32 ArcTan(T x)
 	{
-		return std::atanf(x);
+		return std::atan(x);
 	}
 
 	template<class T>
 	inline float32 ArcTan2(T x, T y)
 	{
-		return std::atan2f(y, x);
+		return std::atan2(y, x);
+	}
+}
+
+namespace Iris::Math::Detail
+{
+	// Three-part Cody-Waite split of pi/2; the first two parts multiply exactly by quadrants below 2^13
+	static constexpr float32 TwoOverPi = 0.636619772367581343f;
+	static constexpr float32 HalfPi1 = 1.5703125f;
+	static constexpr float32 HalfPi2 = 4.837512969970703125e-4f;
+	static constexpr float32 HalfPi3 = 7.54978995489188216e-8f;
+
+	// Minimax coefficients on [-pi/4, pi/4]
+	static constexpr float32 SinCoef[3] = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+	static constexpr float32 CosCoef[3] = { 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+
+	// Minimax atan on [0, 1]
+	static constexpr float32 AtanCoef[6] = { 0.99997726f, -0.33262347f, 0.19354346f, -0.11643287f, 0.05265332f, -0.01172120f };
+
+	// Abramowitz and Stegun 4.4.46, acos(x) = sqrt(1 - x) * P(x) on [0, 1]
+	static constexpr float32 AcosCoef[8] = { 1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f, 0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f };
+
+	inline float32 SinKernel(float32 r)
+	{
+		const auto r2 = r * r;
+		return r + r * r2 * (SinCoef[0] + r2 * (SinCoef[1] + r2 * SinCoef[2]));
+	}
+
+	inline float32 CosKernel(float32 r)
+	{
+		const auto r2 = r * r;
+		return 1.f - 0.5f * r2 + r2 * r2 * (CosCoef[0] + r2 * (CosCoef[1] + r2 * CosCoef[2]));
+	}
+
+	inline int32 ReduceHalfPi(float32 x, float32& r)
+	{
+		const auto q = static_cast<int32>(x * TwoOverPi + (x < 0.f ? -0.5f : 0.5f));
+		const auto fq = static_cast<float32>(q);
+		r = ((x - fq * HalfPi1) - fq * HalfPi2) - fq * HalfPi3;
+		return q;
+	}
+}
+
+namespace Iris::Math
+{
+	// Polynomial approximations for hot loops; SIMD overloads live in FastMath.hpp
+	// FastSin/FastCos/FastSinCos: abs error <= 1e-7 for |x| <= 8192
+	// FastAtan2: abs error <= 2e-6 rad, same argument order as ArcTan2
+	// FastAcos: abs error <= 5e-7 rad, input clamped to [-1, 1]
+
+	inline void FastSinCos(float32 x, float32& sin, float32& cos)
+	{
+		float32 r;
+		const auto q = Detail::ReduceHalfPi(x, r);
+		const auto s = Detail::SinKernel(r);
+		const auto c = Detail::CosKernel(r);
+
+		switch (q & 3)
+		{
+		case 0: sin = s; cos = c; break;
+		case 1: sin = c; cos = -s; break;
+		case 2: sin = -s; cos = -c; break;
+		default: sin = -c; cos = s; break;
+		}
+	}
+
+	inline float32 FastSin(float32 x)
+	{
+		float32 r;
+		const auto q = Detail::ReduceHalfPi(x, r);
+		const auto value = (q & 1) ? Detail::CosKernel(r) : Detail::SinKernel(r);
+		return (q & 2) ? -value : value;
+	}
+
+	inline float32 FastCos(float32 x)
+	{
+		float32 r;
+		const auto q = Detail::ReduceHalfPi(x, r);
+		const auto value = (q & 1) ? Detail::SinKernel(r) : Detail::CosKernel(r);
+		return ((q + 1) & 2) ? -value : value;
+	}
+
+	inline float32 FastAtan2(float32 x, float32 y)
+	{
+		const auto ax = Abs(x);
+		const auto ay = Abs(y);
+		const auto maxValue = ax > ay ? ax : ay;
+
+		if (maxValue == 0.f)
+			return 0.f;
+
+		const auto a = (ax > ay ? ay : ax) / maxValue;
+		const auto a2 = a * a;
+
+		const auto& c = Detail::AtanCoef;
+		auto result = a * (c[0] + a2 * (c[1] + a2 * (c[2] + a2 * (c[3] + a2 * (c[4] + a2 * c[5])))));
+
+		if (ay > ax)
+			result = 0.5f * Pi - result;
+
+		if (x < 0.f)
+			result = Pi - result;
+
+		return (y < 0.f) ? -result : result;
+	}
+
+	inline float32 FastAcos(float32 x)
+	{
+		const auto ax = Abs(x) < 1.f ? Abs(x) : 1.f;
+
+		const auto& c = Detail::AcosCoef;
+		const auto p = c[0] + ax * (c[1] + ax * (c[2] + ax * (c[3] + ax * (c[4] + ax * (c[5] + ax * (c[6] + ax * c[7]))))));
+		const auto result = std::sqrt(1.f - ax) * p;
+
+		return (x < 0.f) ? Pi - result : result;
+	}
+
+	// One range reduction shared by both results. Within the FastSinCos range the error stays below 1e-7, about one
+	// float ulp near 1; NaN, infinities and larger angles fall back to Sin and Cos
+	template<class T>
+	inline constexpr void SinCos(T x, float32& sin, float32& cos)
+	{
+		if (!std::is_constant_evaluated())
+		{
+			const auto angle = static_cast<float32>(x);
+
+			if (Abs(angle) <= 8192.f)
+			{
+				FastSinCos(angle, sin, cos);
+				return;
+			}
+		}
+
+		sin = Sin(x);
+		cos = Cos(x);
 	}
 }
 
 namespace Iris::MathLiterals
 {
-	inline constexpr float32 operator"" _rad(size_t n) noexcept
+	inline constexpr float32 operator"" _rad(unsigned long long n) noexcept
 	{
 		return static_cast<float32>(Math::ToRadian * n);
 	}
@@ -85,7 +310,7 @@ namespace Iris::MathLiterals
 		return static_cast<float32>(Math::ToRadian * n);
 	}
 
-	inline constexpr float32 operator"" _deg(size_t n) noexcept
+	inline constexpr float32 operator"" _deg(unsigned long long n) noexcept
 	{
 		return static_cast<float32>(Math::ToDegree * n);
 	}
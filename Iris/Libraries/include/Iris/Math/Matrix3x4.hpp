@@ -0,0 +1,166 @@
+#pragma once
+
+#include <Iris/Math/Math.hpp>
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Matrix4x4.hpp>
+
+namespace Iris
+{
+	// Affine transform in 48 bytes. Row i holds column i of the equivalent row-vector Matrix4x4,
+	// so (m03, m13, m23) is the translation and the implicit fourth row is (0, 0, 0, 1)
+	struct alignas(16) Matrix3x4 final
+	{
+		using value_type = float32;
+
+		constexpr Matrix3x4()noexcept;
+
+		template<Concept::Arithmetic T>
+		constexpr Matrix3x4(
+			T _00, T _01, T _02, T _03,
+			T _10, T _11, T _12, T _13,
+			T _20, T _21, T _22, T _23)noexcept;
+
+		constexpr value_type* operator[](size_t _index);
+
+		constexpr const value_type* operator[](size_t _index)const;
+
+		constexpr float32 determinant()const noexcept;
+
+		Matrix3x4 inverse()const;
+
+		Matrix3x4 inverseRigid()const noexcept;
+
+		constexpr Vector3 translation()const noexcept;
+
+		constexpr Vector3 transformPoint(const Vector3& _point)const noexcept;
+
+		constexpr Vector3 transformDirection(const Vector3& _direction)const noexcept;
+
+		constexpr Matrix4x4 toMatrix4x4()const noexcept;
+
+		static constexpr Matrix3x4 Identity()noexcept;
+
+		static Matrix3x4 FromMatrix4x4(const Matrix4x4& matrix)noexcept;
+
+		union
+		{
+			struct
+			{
+				value_type m0[4];
+				value_type m1[4];
+				value_type m2[4];
+			};
+
+			struct
+			{
+				value_type m00, m01, m02, m03;
+				value_type m10, m11, m12, m13;
+				value_type m20, m21, m22, m23;
+			};
+
+			value_type m[3][4];
+
+			value_type data[12];
+		};
+	};
+}
+
+namespace Iris
+{
+	// Same order as Matrix4x4: 'left' is applied first
+	Matrix3x4 operator*(const Matrix3x4& left, const Matrix3x4& right)noexcept;
+
+	Matrix3x4& operator*=(Matrix3x4& left, const Matrix3x4& right)noexcept;
+}
+
+namespace Iris
+{
+	inline constexpr Matrix3x4::Matrix3x4() noexcept
+		: m0{ 1,0,0,0 }
+		, m1{ 0,1,0,0 }
+		, m2{ 0,0,1,0 }
+	{}
+
+	template<Concept::Arithmetic T>
+	inline constexpr Matrix3x4::Matrix3x4(
+		T _00, T _01, T _02, T _03,
+		T _10, T _11, T _12, T _13,
+		T _20, T _21, T _22, T _23) noexcept
+		: m0{ static_cast<value_type>(_00),static_cast<value_type>(_01),static_cast<value_type>(_02),static_cast<value_type>(_03) }
+		, m1{ static_cast<value_type>(_10),static_cast<value_type>(_11),static_cast<value_type>(_12),static_cast<value_type>(_13) }
+		, m2{ static_cast<value_type>(_20),static_cast<value_type>(_21),static_cast<value_type>(_22),static_cast<value_type>(_23) }
+	{}
+
+	inline constexpr typename Matrix3x4::value_type* Matrix3x4::operator[](size_t _index)
+	{
+		if (_index < 3)
+		{
+			return m[_index];
+		}
+
+		throw Error::OutOfRange{ "Matrix3x4::operator[](size_t)" };
+	}
+
+	inline constexpr const typename Matrix3x4::value_type* Matrix3x4::operator[](size_t _index) const
+	{
+		if (_index < 3)
+		{
+			return m[_index];
+		}
+
+		throw Error::OutOfRange{ "Matrix3x4::operator[](size_t)const" };
+	}
+
+	inline constexpr float32 Matrix3x4::determinant() const noexcept
+	{
+		return m0[0] * (m1[1] * m2[2] - m1[2] * m2[1])
+			- m0[1] * (m1[0] * m2[2] - m1[2] * m2[0])
+			+ m0[2] * (m1[0] * m2[1] - m1[1] * m2[0]);
+	}
+
+	inline constexpr Vector3 Matrix3x4::translation() const noexcept
+	{
+		return Vector3{ m0[3],m1[3],m2[3] };
+	}
+
+	inline constexpr Vector3 Matrix3x4::transformPoint(const Vector3& _point) const noexcept
+	{
+		return Vector3
+		{
+			m0[0] * _point.x + m0[1] * _point.y + m0[2] * _point.z + m0[3],
+			m1[0] * _point.x + m1[1] * _point.y + m1[2] * _point.z + m1[3],
+			m2[0] * _point.x + m2[1] * _point.y + m2[2] * _point.z + m2[3]
+		};
+	}
+
+	inline constexpr Vector3 Matrix3x4::transformDirection(const Vector3& _direction) const noexcept
+	{
+		return Vector3
+		{
+			m0[0] * _direction.x + m0[1] * _direction.y + m0[2] * _direction.z,
+			m1[0] * _direction.x + m1[1] * _direction.y + m1[2] * _direction.z,
+			m2[0] * _direction.x + m2[1] * _direction.y + m2[2] * _direction.z
+		};
+	}
+
+	inline constexpr Matrix4x4 Matrix3x4::toMatrix4x4() const noexcept
+	{
+		return Matrix4x4
+		{
+			m0[0],m1[0],m2[0],0.f,
+			m0[1],m1[1],m2[1],0.f,
+			m0[2],m1[2],m2[2],0.f,
+			m0[3],m1[3],m2[3],1.f
+		};
+	}
+
+	inline constexpr Matrix3x4 Matrix3x4::Identity() noexcept
+	{
+		return Matrix3x4
+		{
+			1,0,0,0,
+			0,1,0,0,
+			0,0,1,0
+		};
+	}
+}
\ No newline at end of file
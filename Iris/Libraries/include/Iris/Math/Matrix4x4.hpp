@@ -1,11 +1,10 @@
 #pragma once
 
 #include <Iris/Math/Math.hpp>
+#include <Iris/Math/Vector3.hpp>
 
 namespace Iris
 {
-	struct Vector3;
-
 	struct alignas(16) Matrix4x4 final
 	{
 		using value_type = float32;
@@ -31,21 +30,29 @@ namespace Iris
 
 		Matrix4x4 inverse()const;
 
+		Matrix4x4 inverseChecked()const;
+
+		Matrix4x4 inverseAffine()const;
+
+		Matrix4x4 inverseRigid()const noexcept;
+
+		constexpr bool isAffine()const noexcept;
+
 		static constexpr Matrix4x4 Identity()noexcept;
 
-		static Matrix4x4 Translate(const Vector3& vector)noexcept;
+		static constexpr Matrix4x4 Translate(const Vector3& vector)noexcept;
 
-		static Matrix4x4 RotateX(float32 radian);
+		static constexpr Matrix4x4 RotateX(float32 radian);
 
-		static Matrix4x4 RotateY(float32 radian);
+		static constexpr Matrix4x4 RotateY(float32 radian);
 
-		static Matrix4x4 RotateZ(float32 radian);
+		static constexpr Matrix4x4 RotateZ(float32 radian);
 
-		static Matrix4x4 Scaling(const Vector3& vector)noexcept;
+		static constexpr Matrix4x4 Scaling(const Vector3& vector)noexcept;
 
-		static Matrix4x4 Scaling(float32 scale)noexcept;
+		static constexpr Matrix4x4 Scaling(float32 scale)noexcept;
 
-		static Matrix4x4 FromAxisAngle(const Vector3& axis, float32 radian);
+		static constexpr Matrix4x4 FromAxisAngle(const Vector3& axis, float32 radian);
 
 		union
 		{
@@ -124,6 +131,12 @@ namespace Iris
 		throw Error::OutOfRange{ "Matrix4x4::operator[](size_t)const" };
 	}
 
+	inline constexpr bool Matrix4x4::isAffine() const noexcept
+	{
+		// Through m0..m3, the member the constructors initialize, so this stays a constant expression
+		return m0[3] == 0 && m1[3] == 0 && m2[3] == 0 && m3[3] == 1;
+	}
+
 	inline constexpr Matrix4x4 Matrix4x4::Identity() noexcept
 	{
 		return Matrix4x4
@@ -134,4 +147,106 @@ namespace Iris
 			0,0,0,1
 		};
 	}
+
+	inline constexpr Matrix4x4 Matrix4x4::Translate(const Vector3& vector) noexcept
+	{
+		return Matrix4x4
+		{
+			1.f,0.f,0.f,0.f,
+			0.f,1.f,0.f,0.f,
+			0.f,0.f,1.f,0.f,
+			vector.x,vector.y,vector.z,1.f
+		};
+	}
+
+	inline constexpr Matrix4x4 Matrix4x4::RotateX(float32 radian)
+	{
+		float32 sin = 0.f, cos = 0.f;
+		Math::SinCos(radian, sin, cos);
+
+		return Matrix4x4
+		{
+			1.f,0.f,0.f,0.f,
+			0.f,cos,sin,0.f,
+			0.f,-sin,cos,0.f,
+			0.f,0.f,0.f,1.f
+		};
+	}
+
+	inline constexpr Matrix4x4 Matrix4x4::RotateY(float32 radian)
+	{
+		float32 sin = 0.f, cos = 0.f;
+		Math::SinCos(radian, sin, cos);
+
+		return Matrix4x4
+		{
+			cos,0.f,-sin,0.f,
+			0.f,1.f,0.f,0.f,
+			sin,0.f,cos,0.f,
+			0.f,0.f,0.f,1.f
+		};
+	}
+
+	inline constexpr Matrix4x4 Matrix4x4::RotateZ(float32 radian)
+	{
+		float32 sin = 0.f, cos = 0.f;
+		Math::SinCos(radian, sin, cos);
+
+		return Matrix4x4
+		{
+			cos,sin,0.f,0.f,
+			-sin,cos,0.f,0.f,
+			0.f,0.f,1.f,0.f,
+			0.f,0.f,0.f,1.f
+		};
+	}
+
+	inline constexpr Matrix4x4 Matrix4x4::Scaling(const Vector3& vector) noexcept
+	{
+		return Matrix4x4
+		{
+			vector.x,0.f,0.f,0.f,
+			0.f,vector.y,0.f,0.f,
+			0.f,0.f,vector.z,0.f,
+			0.f,0.f,0.f,1.f
+		};
+	}
+
+	inline constexpr Matrix4x4 Matrix4x4::Scaling(float32 scale) noexcept
+	{
+		return Matrix4x4
+		{
+			scale,0.f,0.f,0.f,
+			0.f,scale,0.f,0.f,
+			0.f,0.f,scale,0.f,
+			0.f,0.f,0.f,1.f
+		};
+	}
+
+	inline constexpr Matrix4x4 Matrix4x4::FromAxisAngle(const Vector3& axis, float32 radian)
+	{
+		float32 sin = 0.f, cos = 0.f;
+		Math::SinCos(radian, sin, cos);
+
+		const auto t = 1.f - cos;
+
+		const auto x = axis.x;
+		const auto y = axis.y;
+		const auto z = axis.z;
+
+		const auto xx = x * x;
+		const auto yy = y * y;
+		const auto zz = z * z;
+		const auto xy = x * y;
+		const auto xz = x * z;
+		const auto yz = y * z;
+
+		return Matrix4x4
+		{
+			t * xx + cos,t * xy + sin * z,t * xz - sin * y,0.f,
+			t * xy - sin * z,t * yy + cos,t * yz + sin * x,0.f,
+			t * xz + sin * y,t * yz - sin * x,t * zz + cos,0.f,
+			0.f,0.f,0.f,1.f
+		};
+	}
 }
\ No newline at end of file
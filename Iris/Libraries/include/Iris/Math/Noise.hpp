@@ -0,0 +1,69 @@
+#pragma once
+
+#include <span>
+
+#include <Iris/Math/Vector2.hpp>
+#include <Iris/Math/Vector3.hpp>
+
+namespace Iris
+{
+	enum class NoiseType : uint8
+	{
+		Perlin,
+		Simplex,
+	};
+
+	// Fractal Brownian motion: each of the 'octaves' layers has 'lacunarity' times the frequency and 'gain' times the amplitude
+	// of the previous one and its own seed. The sum is divided by the total amplitude, so it keeps the [-1, 1] range.
+	// An octave count of 0 is treated as 1.
+	struct NoiseSettings final
+	{
+		NoiseType type = NoiseType::Simplex;
+
+		uint32 seed = 0;
+
+		uint32 octaves = 1;
+
+		float32 frequency = 1.f;
+
+		float32 lacunarity = 2.f;
+
+		float32 gain = 0.5f;
+	};
+
+	// Gradient noise in [-1, 1] with lattice gradients hashed from the cell coordinates, so no permutation tables are shared.
+	// Perlin noise is 0 on integer points; simplex noise is cheaper in 3D and 4D and has no axis-aligned artifacts.
+	// The 4D overloads take 'w' as the fourth coordinate, typically time. These use seed 0; Fbm takes other seeds.
+	float32 Perlin(const Vector2& point)noexcept;
+
+	float32 Perlin(const Vector3& point)noexcept;
+
+	float32 Perlin(const Vector3& point, float32 w)noexcept;
+
+	float32 Simplex(const Vector2& point)noexcept;
+
+	float32 Simplex(const Vector3& point)noexcept;
+
+	float32 Simplex(const Vector3& point, float32 w)noexcept;
+
+	float32 Fbm(const Vector2& point, const NoiseSettings& settings)noexcept;
+
+	float32 Fbm(const Vector3& point, const NoiseSettings& settings)noexcept;
+
+	float32 Fbm(const Vector3& point, float32 w, const NoiseSettings& settings)noexcept;
+
+	// Batch forms evaluate 4 or 8 points per SIMD lane set and match the single-point functions to within float rounding.
+	// Throws Error::OutOfRange when 'values' is shorter than 'points'.
+	void Fbm(std::span<const Vector2> points, std::span<float32> values, const NoiseSettings& settings);
+
+	void Fbm(std::span<const Vector3> points, std::span<float32> values, const NoiseSettings& settings);
+
+	void Fbm(std::span<const Vector3> points, float32 w, std::span<float32> values, const NoiseSettings& settings);
+
+	// Samples origin + (x, y) * spacing into row-major 'values' (x fastest), splitting rows over 'threadCount' threads.
+	// 0 threads uses every hardware thread. Throws Error::OutOfRange when 'values' holds fewer than width * height samples.
+	void FillNoiseGrid(const Vector2& origin, const Vector2& spacing, size_t width, size_t height, std::span<float32> values, const NoiseSettings& settings, size_t threadCount = 1);
+
+	// As above with depth slices of width * height samples
+	void FillNoiseGrid(const Vector3& origin, const Vector3& spacing, size_t width, size_t height, size_t depth, std::span<float32> values, const NoiseSettings& settings, size_t threadCount = 1);
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <array>
+#include <span>
+
+#include <Iris/Math/Vector2.hpp>
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Quaternion.hpp>
+
+namespace Iris
+{
+	// Smallest-three quaternion: the largest component is dropped and rebuilt from the unit-length constraint.
+	// The input is normalized and sign-flipped so the dropped component is positive; the other three lie in [-1/sqrt2, 1/sqrt2].
+	// Bits 30-31 hold the dropped index (w, x, y, z order), the remaining three take 10 bits each.
+	// Components differ from Quaternion::normalize by less than 2e-3 (6e-5 for the 48-bit form).
+	struct PackedQuaternion32 final
+	{
+		uint32 bits = 0;
+
+		constexpr PackedQuaternion32()noexcept = default;
+
+		explicit constexpr PackedQuaternion32(const Quaternion& _quaternion)noexcept;
+
+		constexpr Quaternion toQuaternion()const noexcept;
+	};
+
+	// As PackedQuaternion32 with 15 bits per component; the index is split over the top bits of words 0 and 1
+	struct PackedQuaternion48 final
+	{
+		uint16 bits[3] = {};
+
+		constexpr PackedQuaternion48()noexcept = default;
+
+		explicit constexpr PackedQuaternion48(const Quaternion& _quaternion)noexcept;
+
+		constexpr Quaternion toQuaternion()const noexcept;
+	};
+}
+
+namespace Iris
+{
+	// Bulk conversions between float32 and the packed types in Numeric.hpp, bit-identical to the scalar constructors.
+	// unorm1010102 reads and writes x, y, z, w quadruples. Throws Error::OutOfRange when 'destination' is too short.
+
+	void Pack(std::span<const float32> source, std::span<float16> destination);
+
+	void Pack(std::span<const float32> source, std::span<unorm8> destination);
+
+	void Pack(std::span<const float32> source, std::span<snorm16> destination);
+
+	void Pack(std::span<const float32> source, std::span<unorm1010102> destination);
+
+	void Unpack(std::span<const float16> source, std::span<float32> destination);
+
+	void Unpack(std::span<const unorm8> source, std::span<float32> destination);
+
+	void Unpack(std::span<const snorm16> source, std::span<float32> destination);
+
+	void Unpack(std::span<const unorm1010102> source, std::span<float32> destination);
+
+	void Pack(std::span<const Quaternion> source, std::span<PackedQuaternion32> destination);
+
+	void Pack(std::span<const Quaternion> source, std::span<PackedQuaternion48> destination);
+
+	void Unpack(std::span<const PackedQuaternion32> source, std::span<Quaternion> destination);
+
+	void Unpack(std::span<const PackedQuaternion48> source, std::span<Quaternion> destination);
+
+	// Quaternions are stored w, x, y, z and renormalized on unpack
+
+	constexpr std::array<float16, 2> PackHalf(const Vector2& vector)noexcept;
+
+	constexpr std::array<float16, 3> PackHalf(const Vector3& vector)noexcept;
+
+	constexpr std::array<float16, 4> PackHalf(const Quaternion& quaternion)noexcept;
+
+	constexpr Vector2 UnpackHalf(const std::array<float16, 2>& packed)noexcept;
+
+	constexpr Vector3 UnpackHalf(const std::array<float16, 3>& packed)noexcept;
+
+	constexpr Quaternion UnpackHalf(const std::array<float16, 4>& packed)noexcept;
+
+	constexpr std::array<snorm16, 2> PackSnorm16(const Vector2& vector)noexcept;
+
+	constexpr std::array<snorm16, 3> PackSnorm16(const Vector3& vector)noexcept;
+
+	constexpr std::array<snorm16, 4> PackSnorm16(const Quaternion& quaternion)noexcept;
+
+	constexpr Vector2 UnpackSnorm16(const std::array<snorm16, 2>& packed)noexcept;
+
+	constexpr Vector3 UnpackSnorm16(const std::array<snorm16, 3>& packed)noexcept;
+
+	constexpr Quaternion UnpackSnorm16(const std::array<snorm16, 4>& packed)noexcept;
+
+	// Maps a unit normal from [-1, 1] into the 10-bit channels; 'w' keeps two spare bits such as a tangent sign.
+	// The unpacked normal is not renormalized.
+	constexpr unorm1010102 PackNormal(const Vector3& normal, float32 w = 1.f)noexcept;
+
+	constexpr Vector3 UnpackNormal(unorm1010102 packed)noexcept;
+}
+
+namespace Iris::Detail
+{
+	// Maps [-1/sqrt2, 1/sqrt2] onto [-0.5, 0.5] and back
+	inline constexpr float32 SmallestThreeScale = 0.707106781f;
+
+	inline constexpr float32 SmallestThreeInverseScale = 1.41421356f;
+
+	struct SmallestThree
+	{
+		uint32 index;
+
+		float32 a, b, c;
+	};
+
+	inline constexpr SmallestThree SplitSmallestThree(const Quaternion& quaternion) noexcept
+	{
+		const auto q = quaternion.normalize();
+		const float32 components[4] = { q.w,q.x,q.y,q.z };
+
+		uint32 index = 0;
+		auto largest = Math::Abs(components[0]);
+
+		for (uint32 i = 1; i < 4; ++i)
+		{
+			if (Math::Abs(components[i]) > largest)
+			{
+				largest = Math::Abs(components[i]);
+				index = i;
+			}
+		}
+
+		// q and -q are the same rotation, so the dropped component can always be made positive
+		const auto sign = (components[index] < 0.f) ? -1.f : 1.f;
+
+		return SmallestThree
+		{
+			index,
+			components[index == 0 ? 1 : 0] * sign,
+			components[index <= 1 ? 2 : 1] * sign,
+			components[index <= 2 ? 3 : 2] * sign
+		};
+	}
+
+	inline constexpr Quaternion JoinSmallestThree(uint32 index, float32 a, float32 b, float32 c) noexcept
+	{
+		const auto sum = a * a + b * b + c * c;
+		const auto largest = Math::Sqrt(sum < 1.f ? 1.f - sum : 0.f);
+
+		switch (index)
+		{
+		case 0:
+			return Quaternion{ largest,a,b,c };
+		case 1:
+			return Quaternion{ a,largest,b,c };
+		case 2:
+			return Quaternion{ a,b,largest,c };
+		default:
+			return Quaternion{ a,b,c,largest };
+		}
+	}
+
+	inline constexpr uint32 QuantizeSmallestThree(float32 value, float32 scale) noexcept
+	{
+		return static_cast<uint32>(QuantizeUnorm(value * SmallestThreeScale + 0.5f, scale));
+	}
+
+	inline constexpr float32 DequantizeSmallestThree(uint32 value, float32 inverseScale) noexcept
+	{
+		return (static_cast<float32>(value) * inverseScale - 0.5f) * SmallestThreeInverseScale;
+	}
+}
+
+namespace Iris
+{
+	inline constexpr PackedQuaternion32::PackedQuaternion32(const Quaternion& _quaternion) noexcept
+	{
+		const auto split = Detail::SplitSmallestThree(_quaternion);
+
+		bits = (split.index << 30)
+			| (Detail::QuantizeSmallestThree(split.a, 1023.f) << 20)
+			| (Detail::QuantizeSmallestThree(split.b, 1023.f) << 10)
+			| Detail::QuantizeSmallestThree(split.c, 1023.f);
+	}
+
+	inline constexpr Quaternion PackedQuaternion32::toQuaternion() const noexcept
+	{
+		return Detail::JoinSmallestThree(bits >> 30,
+			Detail::DequantizeSmallestThree((bits >> 20) & 0x3FFu, 1.f / 1023.f),
+			Detail::DequantizeSmallestThree((bits >> 10) & 0x3FFu, 1.f / 1023.f),
+			Detail::DequantizeSmallestThree(bits & 0x3FFu, 1.f / 1023.f));
+	}
+
+	inline constexpr PackedQuaternion48::PackedQuaternion48(const Quaternion& _quaternion) noexcept
+	{
+		const auto split = Detail::SplitSmallestThree(_quaternion);
+
+		bits[0] = static_cast<uint16>(Detail::QuantizeSmallestThree(split.a, 32767.f) | ((split.index & 1u) << 15));
+		bits[1] = static_cast<uint16>(Detail::QuantizeSmallestThree(split.b, 32767.f) | ((split.index >> 1) << 15));
+		bits[2] = static_cast<uint16>(Detail::QuantizeSmallestThree(split.c, 32767.f));
+	}
+
+	inline constexpr Quaternion PackedQuaternion48::toQuaternion() const noexcept
+	{
+		const auto index = static_cast<uint32>((bits[0] >> 15) | ((bits[1] >> 15) << 1));
+
+		return Detail::JoinSmallestThree(index,
+			Detail::DequantizeSmallestThree(bits[0] & 0x7FFFu, 1.f / 32767.f),
+			Detail::DequantizeSmallestThree(bits[1] & 0x7FFFu, 1.f / 32767.f),
+			Detail::DequantizeSmallestThree(bits[2] & 0x7FFFu, 1.f / 32767.f));
+	}
+
+	inline constexpr std::array<float16, 2> PackHalf(const Vector2& vector) noexcept
+	{
+		return { float16{ vector.x },float16{ vector.y } };
+	}
+
+	inline constexpr std::array<float16, 3> PackHalf(const Vector3& vector) noexcept
+	{
+		return { float16{ vector.x },float16{ vector.y },float16{ vector.z } };
+	}
+
+	inline constexpr std::array<float16, 4> PackHalf(const Quaternion& quaternion) noexcept
+	{
+		return { float16{ quaternion.w },float16{ quaternion.x },float16{ quaternion.y },float16{ quaternion.z } };
+	}
+
+	inline constexpr Vector2 UnpackHalf(const std::array<float16, 2>& packed) noexcept
+	{
+		return Vector2{ static_cast<float32>(packed[0]),static_cast<float32>(packed[1]) };
+	}
+
+	inline constexpr Vector3 UnpackHalf(const std::array<float16, 3>& packed) noexcept
+	{
+		return Vector3{ static_cast<float32>(packed[0]),static_cast<float32>(packed[1]),static_cast<float32>(packed[2]) };
+	}
+
+	inline constexpr Quaternion UnpackHalf(const std::array<float16, 4>& packed) noexcept
+	{
+		return Quaternion{ static_cast<float32>(packed[0]),static_cast<float32>(packed[1]),static_cast<float32>(packed[2]),static_cast<float32>(packed[3]) }.normalize();
+	}
+
+	inline constexpr std::array<snorm16, 2> PackSnorm16(const Vector2& vector) noexcept
+	{
+		return { snorm16{ vector.x },snorm16{ vector.y } };
+	}
+
+	inline constexpr std::array<snorm16, 3> PackSnorm16(const Vector3& vector) noexcept
+	{
+		return { snorm16{ vector.x },snorm16{ vector.y },snorm16{ vector.z } };
+	}
+
+	inline constexpr std::array<snorm16, 4> PackSnorm16(const Quaternion& quaternion) noexcept
+	{
+		return { snorm16{ quaternion.w },snorm16{ quaternion.x },snorm16{ quaternion.y },snorm16{ quaternion.z } };
+	}
+
+	inline constexpr Vector2 UnpackSnorm16(const std::array<snorm16, 2>& packed) noexcept
+	{
+		return Vector2{ static_cast<float32>(packed[0]),static_cast<float32>(packed[1]) };
+	}
+
+	inline constexpr Vector3 UnpackSnorm16(const std::array<snorm16, 3>& packed) noexcept
+	{
+		return Vector3{ static_cast<float32>(packed[0]),static_cast<float32>(packed[1]),static_cast<float32>(packed[2]) };
+	}
+
+	inline constexpr Quaternion UnpackSnorm16(const std::array<snorm16, 4>& packed) noexcept
+	{
+		return Quaternion{ static_cast<float32>(packed[0]),static_cast<float32>(packed[1]),static_cast<float32>(packed[2]),static_cast<float32>(packed[3]) }.normalize();
+	}
+
+	inline constexpr unorm1010102 PackNormal(const Vector3& normal, float32 w) noexcept
+	{
+		return unorm1010102{ normal.x * 0.5f + 0.5f,normal.y * 0.5f + 0.5f,normal.z * 0.5f + 0.5f,w };
+	}
+
+	inline constexpr Vector3 UnpackNormal(unorm1010102 packed) noexcept
+	{
+		return Vector3{ packed.x() * 2.f - 1.f,packed.y() * 2.f - 1.f,packed.z() * 2.f - 1.f };
+	}
+}
\ No newline at end of file
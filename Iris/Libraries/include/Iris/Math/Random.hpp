@@ -0,0 +1,303 @@
+#pragma once
+
+#include <bit>
+#include <span>
+
+#include <Iris/Math/Vector2.hpp>
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Quaternion.hpp>
+
+namespace Iris
+{
+	// xoshiro256++ (Blackman and Vigna): 256-bit state, period 2^256 - 1; satisfies UniformRandomBitGenerator.
+	// The fill functions run eight independent lanes seeded from this generator, so results depend only on its state.
+	class Xoshiro256 final
+	{
+	public:
+
+		using result_type = uint64;
+
+		static constexpr uint64 DefaultSeed = 0x853C49E6748FEA9Bull;
+
+		// The seed is expanded with SplitMix64, so any value including 0 is valid
+		explicit constexpr Xoshiro256(uint64 _seed = DefaultSeed)noexcept;
+
+		constexpr uint64 operator()()noexcept;
+
+		// [0, 1) with 24 bits of precision
+		constexpr float32 nextFloat()noexcept;
+
+		constexpr float32 range(float32 _min, float32 _max)noexcept;
+
+		// [0, bound) without modulo bias; 0 when 'bound' is 0
+		constexpr uint32 bounded(uint32 _bound)noexcept;
+
+		// Advances by 2^128 steps; successive jumps give non-overlapping streams for parallel work
+		constexpr void jump()noexcept;
+
+		// Advances by 2^192 steps
+		constexpr void longJump()noexcept;
+
+		void fill(std::span<uint32> _values)noexcept;
+
+		void fill(std::span<float32> _values, float32 _min = 0.f, float32 _max = 1.f)noexcept;
+
+		void fillOnCircle(std::span<Vector2> _values)noexcept;
+
+		void fillInsideCircle(std::span<Vector2> _values)noexcept;
+
+		void fillOnSphere(std::span<Vector3> _values)noexcept;
+
+		void fillInsideSphere(std::span<Vector3> _values)noexcept;
+
+		// Uniformly distributed unit quaternions (Shoemake)
+		void fillRotations(std::span<Quaternion> _values)noexcept;
+
+		static constexpr uint64 min()noexcept;
+
+		static constexpr uint64 max()noexcept;
+
+		// One generator per thread; each new thread takes the next jump() of a clock-seeded master stream
+		static Xoshiro256& ThreadLocal()noexcept;
+
+	private:
+
+		constexpr void applyJump(const uint64(&_polynomial)[4])noexcept;
+
+	private:
+
+		uint64 mState[4];
+
+	};
+
+	// PCG32 (O'Neill), XSH-RR output over a 64-bit LCG: 16 bytes of state and 2^63 selectable streams
+	class PCG32 final
+	{
+	public:
+
+		using result_type = uint32;
+
+		static constexpr uint64 DefaultSeed = 0x853C49E6748FEA9Bull;
+
+		static constexpr uint64 DefaultStream = 0xDA3E39CB94B95BDBull;
+
+		explicit constexpr PCG32(uint64 _seed = DefaultSeed, uint64 _stream = DefaultStream)noexcept;
+
+		constexpr uint32 operator()()noexcept;
+
+		constexpr float32 nextFloat()noexcept;
+
+		constexpr float32 range(float32 _min, float32 _max)noexcept;
+
+		constexpr uint32 bounded(uint32 _bound)noexcept;
+
+		// Jumps ahead (or back, as a two's complement 'delta') in O(log delta)
+		constexpr void advance(uint64 _delta)noexcept;
+
+		static constexpr uint32 min()noexcept;
+
+		static constexpr uint32 max()noexcept;
+
+	private:
+
+		uint64 mState;
+
+		uint64 mIncrement;
+
+	};
+}
+
+namespace Iris::Detail
+{
+	inline constexpr uint64 SplitMix64(uint64& state) noexcept
+	{
+		auto z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	inline constexpr float32 UnitFloat(uint32 bits) noexcept
+	{
+		return static_cast<float32>(bits >> 8) * (1.f / 16777216.f);
+	}
+
+	// Lemire's multiply-shift with rejection of the biased low range
+	template<class Generator>
+	inline constexpr uint32 Bounded(Generator& generator, uint32 bound, uint32 (*next)(Generator&)) noexcept
+	{
+		auto product = static_cast<uint64>(next(generator)) * bound;
+		auto low = static_cast<uint32>(product);
+
+		if (low < bound)
+		{
+			const auto threshold = static_cast<uint32>(0u - bound) % bound;
+
+			while (low < threshold)
+			{
+				product = static_cast<uint64>(next(generator)) * bound;
+				low = static_cast<uint32>(product);
+			}
+		}
+
+		return static_cast<uint32>(product >> 32);
+	}
+}
+
+namespace Iris
+{
+	inline constexpr Xoshiro256::Xoshiro256(uint64 _seed) noexcept
+		: mState{}
+	{
+		for (auto& word : mState)
+		{
+			word = Detail::SplitMix64(_seed);
+		}
+	}
+
+	inline constexpr uint64 Xoshiro256::operator()() noexcept
+	{
+		const auto result = std::rotl(mState[0] + mState[3], 23) + mState[0];
+		const auto t = mState[1] << 17;
+
+		mState[2] ^= mState[0];
+		mState[3] ^= mState[1];
+		mState[1] ^= mState[2];
+		mState[0] ^= mState[3];
+		mState[2] ^= t;
+		mState[3] = std::rotl(mState[3], 45);
+
+		return result;
+	}
+
+	inline constexpr float32 Xoshiro256::nextFloat() noexcept
+	{
+		return Detail::UnitFloat(static_cast<uint32>((*this)() >> 32));
+	}
+
+	inline constexpr float32 Xoshiro256::range(float32 _min, float32 _max) noexcept
+	{
+		return _min + (_max - _min) * nextFloat();
+	}
+
+	inline constexpr uint32 Xoshiro256::bounded(uint32 _bound) noexcept
+	{
+		return Detail::Bounded<Xoshiro256>(*this, _bound, [](Xoshiro256& generator) { return static_cast<uint32>(generator() >> 32); });
+	}
+
+	inline constexpr void Xoshiro256::jump() noexcept
+	{
+		constexpr uint64 Jump[] = { 0x180EC6D33CFD0ABAull,0xD5A61266F0C9392Cull,0xA9582618E03FC9AAull,0x39ABDC4529B1661Cull };
+		applyJump(Jump);
+	}
+
+	inline constexpr void Xoshiro256::longJump() noexcept
+	{
+		constexpr uint64 LongJump[] = { 0x76E15D3EFEFDCBBFull,0xC5004E441C522FB3ull,0x77710069854EE241ull,0x39109BB02ACBE635ull };
+		applyJump(LongJump);
+	}
+
+	// XOR of the states at the set bits of the jump polynomial
+	inline constexpr void Xoshiro256::applyJump(const uint64(&_polynomial)[4]) noexcept
+	{
+		uint64 state[4] = {};
+
+		for (const auto word : _polynomial)
+		{
+			for (int32 bit = 0; bit < 64; ++bit)
+			{
+				if (word & (1ull << bit))
+				{
+					for (size_t i = 0; i < 4; ++i)
+					{
+						state[i] ^= mState[i];
+					}
+				}
+
+				(*this)();
+			}
+		}
+
+		for (size_t i = 0; i < 4; ++i)
+		{
+			mState[i] = state[i];
+		}
+	}
+
+	inline constexpr uint64 Xoshiro256::min() noexcept
+	{
+		return 0;
+	}
+
+	inline constexpr uint64 Xoshiro256::max() noexcept
+	{
+		return ~0ull;
+	}
+
+	inline constexpr PCG32::PCG32(uint64 _seed, uint64 _stream) noexcept
+		: mState(0)
+		, mIncrement((_stream << 1) | 1u)
+	{
+		(*this)();
+		mState += _seed;
+		(*this)();
+	}
+
+	inline constexpr uint32 PCG32::operator()() noexcept
+	{
+		const auto old = mState;
+		mState = old * 6364136223846793005ull + mIncrement;
+
+		const auto xorShifted = static_cast<uint32>(((old >> 18) ^ old) >> 27);
+		return std::rotr(xorShifted, static_cast<int32>(old >> 59));
+	}
+
+	inline constexpr float32 PCG32::nextFloat() noexcept
+	{
+		return Detail::UnitFloat((*this)());
+	}
+
+	inline constexpr float32 PCG32::range(float32 _min, float32 _max) noexcept
+	{
+		return _min + (_max - _min) * nextFloat();
+	}
+
+	inline constexpr uint32 PCG32::bounded(uint32 _bound) noexcept
+	{
+		return Detail::Bounded<PCG32>(*this, _bound, [](PCG32& generator) { return generator(); });
+	}
+
+	// Composes the LCG step with itself by repeated squaring (Brown, "Random number generation with arbitrary strides")
+	inline constexpr void PCG32::advance(uint64 _delta) noexcept
+	{
+		uint64 multiplier = 6364136223846793005ull;
+		uint64 increment = mIncrement;
+		uint64 accumulatedMultiplier = 1;
+		uint64 accumulatedIncrement = 0;
+
+		while (_delta > 0)
+		{
+			if (_delta & 1)
+			{
+				accumulatedMultiplier *= multiplier;
+				accumulatedIncrement = accumulatedIncrement * multiplier + increment;
+			}
+
+			increment = (multiplier + 1) * increment;
+			multiplier *= multiplier;
+			_delta >>= 1;
+		}
+
+		mState = accumulatedMultiplier * mState + accumulatedIncrement;
+	}
+
+	inline constexpr uint32 PCG32::min() noexcept
+	{
+		return 0;
+	}
+
+	inline constexpr uint32 PCG32::max() noexcept
+	{
+		return ~0u;
+	}
+}
\ No newline at end of file
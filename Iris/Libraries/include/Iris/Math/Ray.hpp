@@ -0,0 +1,106 @@
+#pragma once
+
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/AABB.hpp>
+
+namespace Iris
+{
+	struct Ray final
+	{
+		constexpr Ray()noexcept;
+
+		constexpr Ray(const Vector3& _origin, const Vector3& _direction, float32 _maxDistance = std::numeric_limits<float32>::infinity())noexcept;
+
+		constexpr Vector3 at(float32 _distance)const noexcept;
+
+		// Slab test; '_distance' receives the entry distance, clamped to 0 when the origin is inside
+		bool intersects(const AABB& _box, float32& _distance)const noexcept;
+
+		// Moller-Trumbore, both faces; '_distance' is only written on a hit
+		bool intersects(const Vector3& _a, const Vector3& _b, const Vector3& _c, float32& _distance)const noexcept;
+
+		Vector3 origin;
+
+		Vector3 direction;
+
+		float32 maxDistance;
+	};
+}
+
+namespace Iris
+{
+	inline constexpr Ray::Ray() noexcept
+		: origin(), direction(Vector3::Forward()), maxDistance(std::numeric_limits<float32>::infinity())
+	{}
+
+	inline constexpr Ray::Ray(const Vector3& _origin, const Vector3& _direction, float32 _maxDistance) noexcept
+		: origin(_origin), direction(_direction), maxDistance(_maxDistance)
+	{}
+
+	inline constexpr Vector3 Ray::at(float32 _distance) const noexcept
+	{
+		return origin + direction * _distance;
+	}
+
+	inline bool Ray::intersects(const AABB& _box, float32& _distance) const noexcept
+	{
+		auto tMin = 0.f;
+		auto tMax = maxDistance;
+
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			const auto invDir = 1.f / direction.data[axis];
+			auto t0 = (_box.min.data[axis] - origin.data[axis]) * invDir;
+			auto t1 = (_box.max.data[axis] - origin.data[axis]) * invDir;
+
+			if (invDir < 0.f)
+			{
+				const auto t = t0;
+				t0 = t1;
+				t1 = t;
+			}
+
+			// Written so that NaN from 0 * inf keeps the previous bound
+			tMin = t0 > tMin ? t0 : tMin;
+			tMax = t1 < tMax ? t1 : tMax;
+
+			if (tMax < tMin)
+				return false;
+		}
+
+		_distance = tMin;
+		return true;
+	}
+
+	inline bool Ray::intersects(const Vector3& _a, const Vector3& _b, const Vector3& _c, float32& _distance) const noexcept
+	{
+		const auto edge1 = _b - _a;
+		const auto edge2 = _c - _a;
+		const auto p = direction.cross(edge2);
+		const auto det = edge1.dot(p);
+
+		if (Math::Abs(det) < 1e-12f)
+			return false;
+
+		const auto invDet = 1.f / det;
+		const auto s = origin - _a;
+		const auto u = s.dot(p) * invDet;
+
+		if (u < 0.f || u > 1.f)
+			return false;
+
+		const auto q = s.cross(edge1);
+		const auto v = direction.dot(q) * invDet;
+
+		if (v < 0.f || u + v > 1.f)
+			return false;
+
+		const auto t = edge2.dot(q) * invDet;
+
+		if (t < 0.f || t > maxDistance)
+			return false;
+
+		_distance = t;
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <span>
+
+#include <Iris/Math/Matrix4x4.hpp>
+#include <Iris/Math/DualQuaternion.hpp>
+
+namespace Iris
+{
+	// Structure-of-arrays vertex streams with one entry per vertex in every span.
+	// Leave all three normal spans empty to skin positions only.
+	struct SkinningInput final
+	{
+		std::span<const float32> positionX, positionY, positionZ;
+
+		std::span<const float32> normalX, normalY, normalZ;
+
+		std::span<const std::array<uint16, 4>> bones;
+
+		// Expected to sum to 1; unused influences carry weight 0
+		std::span<const std::array<float32, 4>> weights;
+	};
+
+	struct SkinningOutput final
+	{
+		std::span<float32> positionX, positionY, positionZ;
+
+		std::span<float32> normalX, normalY, normalZ;
+	};
+
+	// Linear blend skinning with affine Matrix4x4 palettes (row vectors, translation in row 3).
+	// Normals go through the blended upper 3x3 and are renormalized.
+	// Throws Error::OutOfRange when a stream or output span is too short or a bone index is outside the palette.
+	// 0 threads uses every hardware thread.
+	void SkinLinear(std::span<const Matrix4x4> palette, const SkinningInput& input, const SkinningOutput& output, size_t threadCount = 1);
+
+	// Dual quaternion blend skinning; each vertex blends its influences on the hemisphere of the first one.
+	// Same error handling and threading as SkinLinear.
+	void SkinDualQuaternion(std::span<const DualQuaternion> palette, const SkinningInput& input, const SkinningOutput& output, size_t threadCount = 1);
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/AABB.hpp>
+
+namespace Iris
+{
+	struct Sphere final
+	{
+		constexpr Sphere()noexcept;
+
+		constexpr Sphere(const Vector3& _center, float32 _radius)noexcept;
+
+		constexpr bool contains(const Vector3& _point)const noexcept;
+
+		constexpr bool intersects(const Sphere& _other)const noexcept;
+
+		constexpr bool intersects(const AABB& _box)const noexcept;
+
+		static constexpr Sphere FromAABB(const AABB& box)noexcept;
+
+		Vector3 center;
+
+		float32 radius;
+	};
+}
+
+namespace Iris
+{
+	inline constexpr bool operator==(const Sphere& left, const Sphere& right) noexcept
+	{
+		return (left.center == right.center) && (left.radius == right.radius);
+	}
+
+	inline constexpr bool operator!=(const Sphere& left, const Sphere& right) noexcept
+	{
+		return !(left == right);
+	}
+}
+
+namespace Iris
+{
+	inline constexpr Sphere::Sphere() noexcept
+		: center(), radius(0)
+	{}
+
+	inline constexpr Sphere::Sphere(const Vector3& _center, float32 _radius) noexcept
+		: center(_center), radius(_radius)
+	{}
+
+	inline constexpr bool Sphere::contains(const Vector3& _point) const noexcept
+	{
+		return center.distanceSq(_point) <= Math::Square(radius);
+	}
+
+	inline constexpr bool Sphere::intersects(const Sphere& _other) const noexcept
+	{
+		return center.distanceSq(_other.center) <= Math::Square(radius + _other.radius);
+	}
+
+	inline constexpr bool Sphere::intersects(const AABB& _box) const noexcept
+	{
+		const Vector3 closest
+		{
+			Clamp(center.x, _box.min.x, _box.max.x),
+			Clamp(center.y, _box.min.y, _box.max.y),
+			Clamp(center.z, _box.min.z, _box.max.z)
+		};
+
+		return center.distanceSq(closest) <= Math::Square(radius);
+	}
+
+	inline constexpr Sphere Sphere::FromAABB(const AABB& box) noexcept
+	{
+		return Sphere{ box.center(),box.extents().length() };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <span>
+
+#include <Iris/Math/Vector2.hpp>
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Container/Array.hpp>
+
+namespace Iris
+{
+	// Cubic a + b t + c t^2 + d t^3 over t in [0, 1], where Type is float32, Vector2 or Vector3.
+	// The named constructors convert control points to this power basis once, so evaluation is Horner's rule per component.
+	template<class Type>
+	struct CubicCurve final
+	{
+		constexpr Type evaluate(float32 _t)const noexcept;
+
+		constexpr Type derivative(float32 _t)const noexcept;
+
+		constexpr Type secondDerivative(float32 _t)const noexcept;
+
+		static constexpr CubicCurve Bezier(const Type& p0, const Type& p1, const Type& p2, const Type& p3)noexcept;
+
+		// Hermite from end points and end tangents
+		static constexpr CubicCurve Hermite(const Type& p0, const Type& m0, const Type& p1, const Type& m1)noexcept;
+
+		// Uniform Catmull-Rom segment from p1 to p2
+		static constexpr CubicCurve CatmullRom(const Type& p0, const Type& p1, const Type& p2, const Type& p3)noexcept;
+
+		// a, b, c, d
+		Type coefficients[4];
+	};
+
+	// Piecewise cubic over s in [0, segmentCount()]: segment i covers [i, i + 1]. Parameters outside the range are clamped.
+	template<class Type>
+	class CubicSpline final
+	{
+	public:
+
+		CubicSpline()noexcept = default;
+
+		explicit CubicSpline(std::span<const CubicCurve<Type>> _segments);
+
+		Type evaluate(float32 _s)const noexcept;
+
+		Type derivative(float32 _s)const noexcept;
+
+		float32 domain()const noexcept;
+
+		size_t segmentCount()const noexcept;
+
+		std::span<const CubicCurve<Type>> segments()const noexcept;
+
+		bool empty()const noexcept;
+
+		// Passes through every point; the end tangents mirror the neighbouring chords. Throws Error::OutOfRange for fewer than 2 points
+		static CubicSpline CatmullRom(std::span<const Type> points);
+
+		// One tangent per point. Throws Error::OutOfRange for fewer than 2 points or a tangent count that differs
+		static CubicSpline Hermite(std::span<const Type> points, std::span<const Type> tangents);
+
+		// 3n + 1 control points for n segments that share their end points. Throws Error::OutOfRange for any other count
+		static CubicSpline Bezier(std::span<const Type> points);
+
+	private:
+
+		const CubicCurve<Type>& locate(float32& _s)const noexcept;
+
+	private:
+
+		Array<CubicCurve<Type>> mSegments;
+
+	};
+
+	// Maps distance along a curve to its parameter in O(1): the inverse of the arc length is tabulated at evenly spaced distances
+	// and interpolated linearly. Lengths are chord sums over 'resolution' parameter steps, so raise it for tightly bent curves.
+	class ArcLengthTable final
+	{
+	public:
+
+		ArcLengthTable()noexcept = default;
+
+		template<class Type>
+		explicit ArcLengthTable(const CubicCurve<Type>& _curve, size_t _resolution = 256);
+
+		template<class Type>
+		explicit ArcLengthTable(const CubicSpline<Type>& _spline, size_t _resolution = 256);
+
+		float32 length()const noexcept;
+
+		// Parameter in [0, domain] at '_distance' along the curve, clamped to [0, length()]
+		float32 parameter(float32 _distance)const noexcept;
+
+	private:
+
+		template<class Fty>
+		void sample(Fty _evaluate, float32 _domain, size_t _resolution);
+
+		// '_lengths' holds the cumulative length at uniform parameter steps over [0, _domain]
+		void build(std::span<const float32> _lengths, float32 _domain);
+
+	private:
+
+		// Parameter at distance i / mInverseStep
+		Array<float32> mParameters;
+
+		float32 mLength = 0.f;
+
+		float32 mInverseStep = 0.f;
+
+	};
+
+	// SIMD batch evaluation of one curve at many parameters. Throws Error::OutOfRange when 'results' is shorter than 'parameters'
+	void Evaluate(const CubicCurve<float32>& curve, std::span<const float32> parameters, std::span<float32> results);
+
+	void Evaluate(const CubicCurve<Vector2>& curve, std::span<const float32> parameters, std::span<Vector2> results);
+
+	void Evaluate(const CubicCurve<Vector3>& curve, std::span<const float32> parameters, std::span<Vector3> results);
+
+	// results[i] = curves[i].evaluate(parameters[i]), four curves per SIMD step.
+	// Throws Error::OutOfRange when 'parameters' or 'results' is shorter than 'curves'
+	void Evaluate(std::span<const CubicCurve<float32>> curves, std::span<const float32> parameters, std::span<float32> results);
+
+	void Evaluate(std::span<const CubicCurve<Vector2>> curves, std::span<const float32> parameters, std::span<Vector2> results);
+
+	void Evaluate(std::span<const CubicCurve<Vector3>> curves, std::span<const float32> parameters, std::span<Vector3> results);
+
+	// Batch CubicSpline::evaluate. Throws Error::OutOfRange when 'results' is shorter than 'parameters' or the spline is empty
+	void Evaluate(const CubicSpline<float32>& spline, std::span<const float32> parameters, std::span<float32> results);
+
+	void Evaluate(const CubicSpline<Vector2>& spline, std::span<const float32> parameters, std::span<Vector2> results);
+
+	void Evaluate(const CubicSpline<Vector3>& spline, std::span<const float32> parameters, std::span<Vector3> results);
+}
+
+namespace Iris::Detail
+{
+	inline constexpr float32 CurveDistance(float32 from, float32 to) noexcept
+	{
+		return (to < from) ? from - to : to - from;
+	}
+
+	inline float32 CurveDistance(const Vector2& from, const Vector2& to) noexcept
+	{
+		return from.distance(to);
+	}
+
+	inline float32 CurveDistance(const Vector3& from, const Vector3& to) noexcept
+	{
+		return from.distance(to);
+	}
+}
+
+namespace Iris
+{
+	template<class Type>
+	inline constexpr Type CubicCurve<Type>::evaluate(float32 _t) const noexcept
+	{
+		return coefficients[0] + (coefficients[1] + (coefficients[2] + coefficients[3] * _t) * _t) * _t;
+	}
+
+	template<class Type>
+	inline constexpr Type CubicCurve<Type>::derivative(float32 _t) const noexcept
+	{
+		return coefficients[1] + (coefficients[2] * 2.f + coefficients[3] * (3.f * _t)) * _t;
+	}
+
+	template<class Type>
+	inline constexpr Type CubicCurve<Type>::secondDerivative(float32 _t) const noexcept
+	{
+		return coefficients[2] * 2.f + coefficients[3] * (6.f * _t);
+	}
+
+	template<class Type>
+	inline constexpr CubicCurve<Type> CubicCurve<Type>::Bezier(const Type& p0, const Type& p1, const Type& p2, const Type& p3) noexcept
+	{
+		return CubicCurve
+		{
+			p0,
+			(p1 - p0) * 3.f,
+			(p0 - p1 * 2.f + p2) * 3.f,
+			p3 - p0 + (p1 - p2) * 3.f
+		};
+	}
+
+	template<class Type>
+	inline constexpr CubicCurve<Type> CubicCurve<Type>::Hermite(const Type& p0, const Type& m0, const Type& p1, const Type& m1) noexcept
+	{
+		return CubicCurve
+		{
+			p0,
+			m0,
+			(p1 - p0) * 3.f - m0 * 2.f - m1,
+			(p0 - p1) * 2.f + m0 + m1
+		};
+	}
+
+	template<class Type>
+	inline constexpr CubicCurve<Type> CubicCurve<Type>::CatmullRom(const Type& p0, const Type& p1, const Type& p2, const Type& p3) noexcept
+	{
+		return Hermite(p1, (p2 - p0) * 0.5f, p2, (p3 - p1) * 0.5f);
+	}
+
+	template<class Type>
+	inline CubicSpline<Type>::CubicSpline(std::span<const CubicCurve<Type>> _segments)
+		: mSegments(_segments.begin(), _segments.end())
+	{}
+
+	template<class Type>
+	inline Type CubicSpline<Type>::evaluate(float32 _s) const noexcept
+	{
+		if (mSegments.size() == 0)
+			return Type{};
+
+		return locate(_s).evaluate(_s);
+	}
+
+	template<class Type>
+	inline Type CubicSpline<Type>::derivative(float32 _s) const noexcept
+	{
+		if (mSegments.size() == 0)
+			return Type{};
+
+		return locate(_s).derivative(_s);
+	}
+
+	template<class Type>
+	inline float32 CubicSpline<Type>::domain() const noexcept
+	{
+		return static_cast<float32>(mSegments.size());
+	}
+
+	template<class Type>
+	inline size_t CubicSpline<Type>::segmentCount() const noexcept
+	{
+		return mSegments.size();
+	}
+
+	template<class Type>
+	inline std::span<const CubicCurve<Type>> CubicSpline<Type>::segments() const noexcept
+	{
+		return std::span<const CubicCurve<Type>>{ mSegments.data(), mSegments.size() };
+	}
+
+	template<class Type>
+	inline bool CubicSpline<Type>::empty() const noexcept
+	{
+		return mSegments.size() == 0;
+	}
+
+	template<class Type>
+	inline CubicSpline<Type> CubicSpline<Type>::CatmullRom(std::span<const Type> points)
+	{
+		const auto count = points.size();
+
+		if (count < 2)
+			throw Error::OutOfRange{ "CubicSpline::CatmullRom(span<const Type>)" };
+
+		CubicSpline spline;
+		spline.mSegments.reserve(count - 1);
+
+		for (size_t i = 0; i + 1 < count; ++i)
+		{
+			const auto& p1 = points[i];
+			const auto& p2 = points[i + 1];
+			const auto p0 = (i > 0) ? points[i - 1] : p1 * 2.f - p2;
+			const auto p3 = (i + 2 < count) ? points[i + 2] : p2 * 2.f - p1;
+
+			spline.mSegments.addLast(CubicCurve<Type>::CatmullRom(p0, p1, p2, p3));
+		}
+
+		return spline;
+	}
+
+	template<class Type>
+	inline CubicSpline<Type> CubicSpline<Type>::Hermite(std::span<const Type> points, std::span<const Type> tangents)
+	{
+		if (points.size() < 2 || tangents.size() != points.size())
+			throw Error::OutOfRange{ "CubicSpline::Hermite(span<const Type>,span<const Type>)" };
+
+		CubicSpline spline;
+		spline.mSegments.reserve(points.size() - 1);
+
+		for (size_t i = 0; i + 1 < points.size(); ++i)
+		{
+			spline.mSegments.addLast(CubicCurve<Type>::Hermite(points[i], tangents[i], points[i + 1], tangents[i + 1]));
+		}
+
+		return spline;
+	}
+
+	template<class Type>
+	inline CubicSpline<Type> CubicSpline<Type>::Bezier(std::span<const Type> points)
+	{
+		if (points.size() < 4 || (points.size() - 1) % 3 != 0)
+			throw Error::OutOfRange{ "CubicSpline::Bezier(span<const Type>)" };
+
+		CubicSpline spline;
+		spline.mSegments.reserve((points.size() - 1) / 3);
+
+		for (size_t i = 0; i + 3 < points.size(); i += 3)
+		{
+			spline.mSegments.addLast(CubicCurve<Type>::Bezier(points[i], points[i + 1], points[i + 2], points[i + 3]));
+		}
+
+		return spline;
+	}
+
+	// Clamps '_s' to the domain and rewrites it as the local parameter of the returned segment
+	template<class Type>
+	inline const CubicCurve<Type>& CubicSpline<Type>::locate(float32& _s) const noexcept
+	{
+		const auto last = mSegments.size() - 1;
+		const auto s = Clamp(_s, 0.f, domain());
+		const auto index = Min(static_cast<size_t>(s), last);
+
+		_s = s - static_cast<float32>(index);
+		return mSegments[index];
+	}
+
+	template<class Type>
+	inline ArcLengthTable::ArcLengthTable(const CubicCurve<Type>& _curve, size_t _resolution)
+	{
+		sample([&](float32 t) { return _curve.evaluate(t); }, 1.f, _resolution);
+	}
+
+	template<class Type>
+	inline ArcLengthTable::ArcLengthTable(const CubicSpline<Type>& _spline, size_t _resolution)
+	{
+		if (!_spline.empty())
+			sample([&](float32 s) { return _spline.evaluate(s); }, _spline.domain(), _resolution);
+	}
+
+	inline float32 ArcLengthTable::length() const noexcept
+	{
+		return mLength;
+	}
+
+	inline float32 ArcLengthTable::parameter(float32 _distance) const noexcept
+	{
+		if (mParameters.size() < 2)
+			return 0.f;
+
+		const auto last = mParameters.size() - 1;
+		const auto position = Clamp(_distance * mInverseStep, 0.f, static_cast<float32>(last));
+		const auto index = Min(static_cast<size_t>(position), last - 1);
+		const auto t = position - static_cast<float32>(index);
+
+		return mParameters[index] + (mParameters[index + 1] - mParameters[index]) * t;
+	}
+
+	template<class Fty>
+	inline void ArcLengthTable::sample(Fty _evaluate, float32 _domain, size_t _resolution)
+	{
+		_resolution = Max<size_t>(_resolution, 1);
+
+		Array<float32> lengths(_resolution + 1);
+		auto previous = _evaluate(0.f);
+		float32 length = 0.f;
+
+		lengths[0] = 0.f;
+
+		for (size_t i = 1; i <= _resolution; ++i)
+		{
+			const auto point = _evaluate(_domain * static_cast<float32>(i) / static_cast<float32>(_resolution));
+			length += Detail::CurveDistance(previous, point);
+			lengths[i] = length;
+			previous = point;
+		}
+
+		build(std::span<const float32>{ lengths.data(), lengths.size() }, _domain);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Math/Quaternion.hpp>
+#include <Iris/Math/Matrix3x4.hpp>
+
+namespace Iris
+{
+	// Scale, then rotate, then translate; 'rotation' is expected to be unit length.
+	// Composition and inverse are exact for uniform scale; non-uniform scale under rotation drops the shear.
+	struct Transform final
+	{
+		constexpr Transform()noexcept;
+
+		constexpr Transform(const Vector3& _position, const Quaternion& _rotation, const Vector3& _scale = Vector3::One())noexcept;
+
+		Transform inverse()const noexcept;
+
+		Vector3 transformPoint(const Vector3& _point)const noexcept;
+
+		Vector3 transformDirection(const Vector3& _direction)const noexcept;
+
+		Matrix3x4 toMatrix3x4()const noexcept;
+
+		Matrix4x4 toMatrix4x4()const noexcept;
+
+		static constexpr Transform Identity()noexcept;
+
+		static Transform FromMatrix3x4(const Matrix3x4& matrix);
+
+		static Transform FromMatrix4x4(const Matrix4x4& matrix);
+
+		Vector3 position;
+
+		Quaternion rotation;
+
+		Vector3 scale;
+	};
+}
+
+namespace Iris
+{
+	// Same order as Matrix4x4: 'left' is applied first, so child * parent gives the world transform
+	Transform operator*(const Transform& left, const Transform& right)noexcept;
+
+	Transform& operator*=(Transform& left, const Transform& right)noexcept;
+}
+
+namespace Iris
+{
+	inline constexpr Transform::Transform() noexcept
+		: position(Vector3::Zero())
+		, rotation(Quaternion::Identity())
+		, scale(Vector3::One())
+	{}
+
+	inline constexpr Transform::Transform(const Vector3& _position, const Quaternion& _rotation, const Vector3& _scale) noexcept
+		: position(_position)
+		, rotation(_rotation)
+		, scale(_scale)
+	{}
+
+	inline constexpr Transform Transform::Identity() noexcept
+	{
+		return Transform{};
+	}
+
+	inline Matrix4x4 Transform::toMatrix4x4() const noexcept
+	{
+		return toMatrix3x4().toMatrix4x4();
+	}
+
+	inline Transform Transform::FromMatrix4x4(const Matrix4x4& matrix)
+	{
+		return FromMatrix3x4(Matrix3x4::FromMatrix4x4(matrix));
+	}
+}
\ No newline at end of file
@@ -36,11 +36,11 @@ namespace Iris
 
 		constexpr float32 lengthSq()const noexcept;
 
-		float32 length()const noexcept;
+		constexpr float32 length()const noexcept;
 
 		constexpr float32 distanceSq(const Vector3& _other)const noexcept;
 
-		float32 distance(const Vector3& _other)const noexcept;
+		constexpr float32 distance(const Vector3& _other)const noexcept;
 
 		constexpr float32 dot(const Vector3& _other)const noexcept;
 
@@ -48,9 +48,9 @@ namespace Iris
 
 		constexpr Vector3 inverse()const noexcept;
 
-		Vector3 normalize()const noexcept;
+		constexpr Vector3 normalize()const noexcept;
 
-		Vector3 normalize(float32 _threshold)const noexcept;
+		constexpr Vector3 normalize(float32 _threshold)const noexcept;
 
 		Vector3 rotate(const Quaternion& _quaternion)const noexcept;
 
@@ -282,7 +282,7 @@ namespace Iris
 		return (x * x) + (y * y) + (z * z);
 	}
 
-	inline float32 Vector3::length() const noexcept
+	inline constexpr float32 Vector3::length() const noexcept
 	{
 		return Math::Sqrt(lengthSq());
 	}
@@ -292,7 +292,7 @@ namespace Iris
 		return Math::Square(_other.x - x) + Math::Square(_other.y - y) + Math::Square(_other.z - z);
 	}
 
-	inline float32 Vector3::distance(const Vector3& _other) const noexcept
+	inline constexpr float32 Vector3::distance(const Vector3& _other) const noexcept
 	{
 		return Math::Sqrt(distanceSq(_other));
 	}
@@ -317,7 +317,7 @@ namespace Iris
 		return Vector3{ -x,-y,-z };
 	}
 
-	inline Vector3 Vector3::normalize() const noexcept
+	inline constexpr Vector3 Vector3::normalize() const noexcept
 	{
 		const auto myLength = length();
 
@@ -327,7 +327,7 @@ namespace Iris
 		return (*this) / myLength;
 	}
 
-	inline Vector3 Vector3::normalize(float32 _threshold) const noexcept
+	inline constexpr Vector3 Vector3::normalize(float32 _threshold) const noexcept
 	{
 		const auto myLength = length();
 
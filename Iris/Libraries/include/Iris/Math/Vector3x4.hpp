@@ -0,0 +1,478 @@
+#pragma once
+
+#include <Iris/Math/Vector3.hpp>
+#include <Iris/Container/Array.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if !defined(IRIS_SIMD_X86)
+	#error Vector3x4 requires SSE
+#endif
+
+#include <immintrin.h>
+
+namespace Iris
+{
+	struct Mask4 final
+	{
+		__m128 value;
+
+		uint32 bits()const noexcept;
+
+		bool any()const noexcept;
+
+		bool all()const noexcept;
+
+		bool none()const noexcept;
+	};
+
+	// Four Vector3 in SoA form, lane i holds (x[i], y[i], z[i])
+	struct alignas(16) Vector3x4 final
+	{
+		using value_type = __m128;
+
+		static constexpr size_t Width = 4;
+
+		Vector3x4()noexcept;
+
+		Vector3x4(__m128 _x, __m128 _y, __m128 _z)noexcept;
+
+		explicit Vector3x4(const Vector3& _vector)noexcept;
+
+		Vector3x4(const Vector3& _v0, const Vector3& _v1, const Vector3& _v2, const Vector3& _v3)noexcept;
+
+		Vector3x4 operator-()const noexcept;
+
+		__m128 lengthSq()const noexcept;
+
+		__m128 length()const noexcept;
+
+		__m128 distanceSq(const Vector3x4& _other)const noexcept;
+
+		__m128 distance(const Vector3x4& _other)const noexcept;
+
+		__m128 dot(const Vector3x4& _other)const noexcept;
+
+		Vector3x4 cross(const Vector3x4& _other)const noexcept;
+
+		Vector3x4 inverse()const noexcept;
+
+		Vector3x4 normalize()const noexcept;
+
+		Vector3x4 normalize(float32 _threshold)const noexcept;
+
+		Mask4 isZero()const noexcept;
+
+		Mask4 hasZero()const noexcept;
+
+		Vector3 get(size_t _lane)const noexcept;
+
+		void set(size_t _lane, const Vector3& _vector)noexcept;
+
+		void store(Vector3* _dst)const noexcept;
+
+		void store(Vector3* _dst, size_t _count)const noexcept;
+
+		static Vector3x4 Zero()noexcept;
+
+		static Vector3x4 Load(const Vector3* _src)noexcept;
+
+		static Vector3x4 Load(const Vector3* _src, size_t _count)noexcept;
+
+		static Vector3x4 Lerp(const Vector3x4& from, const Vector3x4& to, float32 t)noexcept;
+
+		static Vector3x4 Select(Mask4 mask, const Vector3x4& ifTrue, const Vector3x4& ifFalse)noexcept;
+
+		static Array<Vector3x4> Pack(const Array<Vector3>& vectors);
+
+		static Array<Vector3> Unpack(const Array<Vector3x4>& packets, size_t count);
+
+		__m128 x;
+		__m128 y;
+		__m128 z;
+	};
+}
+
+namespace Iris
+{
+	inline Mask4 operator&(Mask4 left, Mask4 right) noexcept
+	{
+		return Mask4{ _mm_and_ps(left.value, right.value) };
+	}
+
+	inline Mask4 operator|(Mask4 left, Mask4 right) noexcept
+	{
+		return Mask4{ _mm_or_ps(left.value, right.value) };
+	}
+
+	inline Mask4 operator!(Mask4 mask) noexcept
+	{
+		return Mask4{ _mm_xor_ps(mask.value, _mm_castsi128_ps(_mm_set1_epi32(-1))) };
+	}
+
+	inline Vector3x4 operator+(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Vector3x4{ _mm_add_ps(left.x, right.x), _mm_add_ps(left.y, right.y), _mm_add_ps(left.z, right.z) };
+	}
+
+	inline Vector3x4 operator+(const Vector3x4& left, float32 right) noexcept
+	{
+		const __m128 s = _mm_set1_ps(right);
+		return Vector3x4{ _mm_add_ps(left.x, s), _mm_add_ps(left.y, s), _mm_add_ps(left.z, s) };
+	}
+
+	inline Vector3x4 operator-(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Vector3x4{ _mm_sub_ps(left.x, right.x), _mm_sub_ps(left.y, right.y), _mm_sub_ps(left.z, right.z) };
+	}
+
+	inline Vector3x4 operator-(const Vector3x4& left, float32 right) noexcept
+	{
+		const __m128 s = _mm_set1_ps(right);
+		return Vector3x4{ _mm_sub_ps(left.x, s), _mm_sub_ps(left.y, s), _mm_sub_ps(left.z, s) };
+	}
+
+	inline Vector3x4 operator*(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Vector3x4{ _mm_mul_ps(left.x, right.x), _mm_mul_ps(left.y, right.y), _mm_mul_ps(left.z, right.z) };
+	}
+
+	inline Vector3x4 operator*(const Vector3x4& left, __m128 right) noexcept
+	{
+		return Vector3x4{ _mm_mul_ps(left.x, right), _mm_mul_ps(left.y, right), _mm_mul_ps(left.z, right) };
+	}
+
+	inline Vector3x4 operator*(const Vector3x4& left, float32 right) noexcept
+	{
+		return left * _mm_set1_ps(right);
+	}
+
+	inline Vector3x4 operator/(const Vector3x4& left, const Vector3x4& right)
+	{
+		if (right.hasZero().any())
+			throw Error::ZeroDivisionException{ "operator/(Vector3x4,Vector3x4)" };
+		return Vector3x4{ _mm_div_ps(left.x, right.x), _mm_div_ps(left.y, right.y), _mm_div_ps(left.z, right.z) };
+	}
+
+	inline Vector3x4 operator/(const Vector3x4& left, float32 right)
+	{
+		if (right == 0.f)
+			throw Error::ZeroDivisionException{ "operator/(Vector3x4,float32)" };
+		return left * (1.f / right);
+	}
+
+	inline Vector3x4& operator+=(Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return left = left + right;
+	}
+
+	inline Vector3x4& operator+=(Vector3x4& left, float32 right) noexcept
+	{
+		return left = left + right;
+	}
+
+	inline Vector3x4& operator-=(Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return left = left - right;
+	}
+
+	inline Vector3x4& operator-=(Vector3x4& left, float32 right) noexcept
+	{
+		return left = left - right;
+	}
+
+	inline Vector3x4& operator*=(Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return left = left * right;
+	}
+
+	inline Vector3x4& operator*=(Vector3x4& left, float32 right) noexcept
+	{
+		return left = left * right;
+	}
+
+	inline Vector3x4& operator/=(Vector3x4& left, const Vector3x4& right)
+	{
+		return left = left / right;
+	}
+
+	inline Vector3x4& operator/=(Vector3x4& left, float32 right)
+	{
+		return left = left / right;
+	}
+
+	inline Mask4 operator==(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Mask4{ _mm_and_ps(_mm_and_ps(_mm_cmpeq_ps(left.x, right.x), _mm_cmpeq_ps(left.y, right.y)), _mm_cmpeq_ps(left.z, right.z)) };
+	}
+
+	inline Mask4 operator!=(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Mask4{ _mm_or_ps(_mm_or_ps(_mm_cmpneq_ps(left.x, right.x), _mm_cmpneq_ps(left.y, right.y)), _mm_cmpneq_ps(left.z, right.z)) };
+	}
+
+	inline Mask4 operator<(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Mask4{ _mm_cmplt_ps(left.lengthSq(), right.lengthSq()) };
+	}
+
+	inline Mask4 operator>(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Mask4{ _mm_cmpgt_ps(left.lengthSq(), right.lengthSq()) };
+	}
+
+	inline Mask4 operator<=(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Mask4{ _mm_cmple_ps(left.lengthSq(), right.lengthSq()) };
+	}
+
+	inline Mask4 operator>=(const Vector3x4& left, const Vector3x4& right) noexcept
+	{
+		return Mask4{ _mm_cmpge_ps(left.lengthSq(), right.lengthSq()) };
+	}
+}
+
+namespace Iris
+{
+	inline uint32 Mask4::bits() const noexcept
+	{
+		return static_cast<uint32>(_mm_movemask_ps(value));
+	}
+
+	inline bool Mask4::any() const noexcept
+	{
+		return bits() != 0;
+	}
+
+	inline bool Mask4::all() const noexcept
+	{
+		return bits() == 0xF;
+	}
+
+	inline bool Mask4::none() const noexcept
+	{
+		return bits() == 0;
+	}
+
+	inline Vector3x4::Vector3x4() noexcept
+		: x(_mm_setzero_ps()), y(_mm_setzero_ps()), z(_mm_setzero_ps())
+	{}
+
+	inline Vector3x4::Vector3x4(__m128 _x, __m128 _y, __m128 _z) noexcept
+		: x(_x), y(_y), z(_z)
+	{}
+
+	inline Vector3x4::Vector3x4(const Vector3& _vector) noexcept
+		: x(_mm_set1_ps(_vector.x)), y(_mm_set1_ps(_vector.y)), z(_mm_set1_ps(_vector.z))
+	{}
+
+	inline Vector3x4::Vector3x4(const Vector3& _v0, const Vector3& _v1, const Vector3& _v2, const Vector3& _v3) noexcept
+		: x(_mm_setr_ps(_v0.x, _v1.x, _v2.x, _v3.x))
+		, y(_mm_setr_ps(_v0.y, _v1.y, _v2.y, _v3.y))
+		, z(_mm_setr_ps(_v0.z, _v1.z, _v2.z, _v3.z))
+	{}
+
+	inline Vector3x4 Vector3x4::operator-() const noexcept
+	{
+		const __m128 sign = _mm_set1_ps(-0.f);
+		return Vector3x4{ _mm_xor_ps(x, sign), _mm_xor_ps(y, sign), _mm_xor_ps(z, sign) };
+	}
+
+	inline __m128 Vector3x4::lengthSq() const noexcept
+	{
+		return dot(*this);
+	}
+
+	inline __m128 Vector3x4::length() const noexcept
+	{
+		return _mm_sqrt_ps(lengthSq());
+	}
+
+	inline __m128 Vector3x4::distanceSq(const Vector3x4& _other) const noexcept
+	{
+		return (_other - *this).lengthSq();
+	}
+
+	inline __m128 Vector3x4::distance(const Vector3x4& _other) const noexcept
+	{
+		return _mm_sqrt_ps(distanceSq(_other));
+	}
+
+	inline __m128 Vector3x4::dot(const Vector3x4& _other) const noexcept
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _other.x), _mm_mul_ps(y, _other.y)), _mm_mul_ps(z, _other.z));
+	}
+
+	inline Vector3x4 Vector3x4::cross(const Vector3x4& _other) const noexcept
+	{
+		return Vector3x4
+		{
+			_mm_sub_ps(_mm_mul_ps(y, _other.z), _mm_mul_ps(z, _other.y)),
+			_mm_sub_ps(_mm_mul_ps(z, _other.x), _mm_mul_ps(x, _other.z)),
+			_mm_sub_ps(_mm_mul_ps(x, _other.y), _mm_mul_ps(y, _other.x))
+		};
+	}
+
+	inline Vector3x4 Vector3x4::inverse() const noexcept
+	{
+		return -(*this);
+	}
+
+	inline Vector3x4 Vector3x4::normalize() const noexcept
+	{
+		return normalize(Math::Epsilon);
+	}
+
+	// Lanes shorter than the threshold are returned unchanged, as Vector3::normalize does
+	inline Vector3x4 Vector3x4::normalize(float32 _threshold) const noexcept
+	{
+		const __m128 len = length();
+		const Mask4 keep{ _mm_cmplt_ps(len, _mm_set1_ps(_threshold)) };
+		const __m128 invLen = _mm_div_ps(_mm_set1_ps(1.f), len);
+		return Select(keep, *this, (*this) * invLen);
+	}
+
+	inline Mask4 Vector3x4::isZero() const noexcept
+	{
+		return (*this) == Vector3x4{};
+	}
+
+	inline Mask4 Vector3x4::hasZero() const noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		return Mask4{ _mm_or_ps(_mm_or_ps(_mm_cmpeq_ps(x, zero), _mm_cmpeq_ps(y, zero)), _mm_cmpeq_ps(z, zero)) };
+	}
+
+	inline Vector3 Vector3x4::get(size_t _lane) const noexcept
+	{
+		alignas(16) float32 lx[4], ly[4], lz[4];
+		_mm_store_ps(lx, x);
+		_mm_store_ps(ly, y);
+		_mm_store_ps(lz, z);
+		return Vector3{ lx[_lane], ly[_lane], lz[_lane] };
+	}
+
+	inline void Vector3x4::set(size_t _lane, const Vector3& _vector) noexcept
+	{
+		alignas(16) float32 lx[4], ly[4], lz[4];
+		_mm_store_ps(lx, x);
+		_mm_store_ps(ly, y);
+		_mm_store_ps(lz, z);
+		lx[_lane] = _vector.x;
+		ly[_lane] = _vector.y;
+		lz[_lane] = _vector.z;
+		x = _mm_load_ps(lx);
+		y = _mm_load_ps(ly);
+		z = _mm_load_ps(lz);
+	}
+
+	inline void Vector3x4::store(Vector3* _dst) const noexcept
+	{
+		const __m128 rxy = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 ryz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+		const __m128 rzx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+		float32* out = _dst->data;
+		_mm_storeu_ps(out + 0, _mm_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(out + 4, _mm_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0)));
+		_mm_storeu_ps(out + 8, _mm_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1)));
+	}
+
+	inline void Vector3x4::store(Vector3* _dst, size_t _count) const noexcept
+	{
+		if (_count >= Width)
+		{
+			store(_dst);
+			return;
+		}
+
+		for (size_t i = 0; i < _count; ++i)
+		{
+			_dst[i] = get(i);
+		}
+	}
+
+	inline Vector3x4 Vector3x4::Zero() noexcept
+	{
+		return Vector3x4{};
+	}
+
+	// The lane order of Load and store is shuffled consistently, so a round trip is exact
+	inline Vector3x4 Vector3x4::Load(const Vector3* _src) noexcept
+	{
+		const float32* in = _src->data;
+
+		const __m128 v0 = _mm_loadu_ps(in + 0);
+		const __m128 v1 = _mm_loadu_ps(in + 4);
+		const __m128 v2 = _mm_loadu_ps(in + 8);
+
+		const __m128 xy = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));
+		const __m128 yz = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 0, 2, 1));
+
+		return Vector3x4
+		{
+			_mm_shuffle_ps(v0, xy, _MM_SHUFFLE(2, 0, 3, 0)),
+			_mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)),
+			_mm_shuffle_ps(yz, v2, _MM_SHUFFLE(3, 0, 3, 1))
+		};
+	}
+
+	inline Vector3x4 Vector3x4::Load(const Vector3* _src, size_t _count) noexcept
+	{
+		if (_count >= Width)
+			return Load(_src);
+
+		Vector3x4 result{};
+
+		for (size_t i = 0; i < _count; ++i)
+		{
+			result.set(i, _src[i]);
+		}
+
+		return result;
+	}
+
+	inline Vector3x4 Vector3x4::Lerp(const Vector3x4& from, const Vector3x4& to, float32 t) noexcept
+	{
+		return from + ((to - from) * t);
+	}
+
+	inline Vector3x4 Vector3x4::Select(Mask4 mask, const Vector3x4& ifTrue, const Vector3x4& ifFalse) noexcept
+	{
+		return Vector3x4
+		{
+			_mm_or_ps(_mm_and_ps(mask.value, ifTrue.x), _mm_andnot_ps(mask.value, ifFalse.x)),
+			_mm_or_ps(_mm_and_ps(mask.value, ifTrue.y), _mm_andnot_ps(mask.value, ifFalse.y)),
+			_mm_or_ps(_mm_and_ps(mask.value, ifTrue.z), _mm_andnot_ps(mask.value, ifFalse.z))
+		};
+	}
+
+	// The last packet is zero-padded when the size is not a multiple of Width
+	inline Array<Vector3x4> Vector3x4::Pack(const Array<Vector3>& vectors)
+	{
+		const size_t count = vectors.size();
+
+		Array<Vector3x4> packets;
+		packets.reserve((count + Width - 1) / Width);
+
+		for (size_t i = 0; i < count; i += Width)
+		{
+			packets.addLast(Load(vectors.data() + i, count - i));
+		}
+
+		return packets;
+	}
+
+	inline Array<Vector3> Vector3x4::Unpack(const Array<Vector3x4>& packets, size_t count)
+	{
+		count = Min(count, packets.size() * Width);
+
+		Array<Vector3> vectors(count);
+
+		for (size_t i = 0; i < count; i += Width)
+		{
+			packets[i / Width].store(vectors.data() + i, count - i);
+		}
+
+		return vectors;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,485 @@
+#pragma once
+
+#include <Iris/Math/Vector3x4.hpp>
+#include <Iris/Container/Array.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if !defined(IRIS_SIMD_X86)
+	#error Vector3x8 requires AVX
+#endif
+
+// Every function here is IRIS_TARGET_AVX2, so no -mavx is needed: use Vector3x8 only inside IRIS_TARGET_AVX2 functions,
+// after checking CPUFeature::Get().avx2 and .fma, and keep it out of the signatures of untargeted functions
+
+#include <immintrin.h>
+
+namespace Iris
+{
+	struct Mask8 final
+	{
+		__m256 value;
+
+		IRIS_TARGET_AVX2 uint32 bits()const noexcept;
+
+		IRIS_TARGET_AVX2 bool any()const noexcept;
+
+		IRIS_TARGET_AVX2 bool all()const noexcept;
+
+		IRIS_TARGET_AVX2 bool none()const noexcept;
+	};
+
+	// Eight Vector3 in SoA form, lane i holds (x[i], y[i], z[i])
+	struct alignas(32) Vector3x8 final
+	{
+		using value_type = __m256;
+
+		static constexpr size_t Width = 8;
+
+		IRIS_TARGET_AVX2 Vector3x8()noexcept;
+
+		IRIS_TARGET_AVX2 Vector3x8(__m256 _x, __m256 _y, __m256 _z)noexcept;
+
+		IRIS_TARGET_AVX2 explicit Vector3x8(const Vector3& _vector)noexcept;
+
+		IRIS_TARGET_AVX2 Vector3x8(const Vector3x4& _low, const Vector3x4& _high)noexcept;
+
+		IRIS_TARGET_AVX2 Vector3x8 operator-()const noexcept;
+
+		IRIS_TARGET_AVX2 __m256 lengthSq()const noexcept;
+
+		IRIS_TARGET_AVX2 __m256 length()const noexcept;
+
+		IRIS_TARGET_AVX2 __m256 distanceSq(const Vector3x8& _other)const noexcept;
+
+		IRIS_TARGET_AVX2 __m256 distance(const Vector3x8& _other)const noexcept;
+
+		IRIS_TARGET_AVX2 __m256 dot(const Vector3x8& _other)const noexcept;
+
+		IRIS_TARGET_AVX2 Vector3x8 cross(const Vector3x8& _other)const noexcept;
+
+		IRIS_TARGET_AVX2 Vector3x8 inverse()const noexcept;
+
+		IRIS_TARGET_AVX2 Vector3x8 normalize()const noexcept;
+
+		IRIS_TARGET_AVX2 Vector3x8 normalize(float32 _threshold)const noexcept;
+
+		IRIS_TARGET_AVX2 Mask8 isZero()const noexcept;
+
+		IRIS_TARGET_AVX2 Mask8 hasZero()const noexcept;
+
+		IRIS_TARGET_AVX2 Vector3 get(size_t _lane)const noexcept;
+
+		IRIS_TARGET_AVX2 void set(size_t _lane, const Vector3& _vector)noexcept;
+
+		IRIS_TARGET_AVX2 void store(Vector3* _dst)const noexcept;
+
+		IRIS_TARGET_AVX2 void store(Vector3* _dst, size_t _count)const noexcept;
+
+		IRIS_TARGET_AVX2 static Vector3x8 Zero()noexcept;
+
+		IRIS_TARGET_AVX2 static Vector3x8 Load(const Vector3* _src)noexcept;
+
+		IRIS_TARGET_AVX2 static Vector3x8 Load(const Vector3* _src, size_t _count)noexcept;
+
+		IRIS_TARGET_AVX2 static Vector3x8 Lerp(const Vector3x8& from, const Vector3x8& to, float32 t)noexcept;
+
+		IRIS_TARGET_AVX2 static Vector3x8 Select(Mask8 mask, const Vector3x8& ifTrue, const Vector3x8& ifFalse)noexcept;
+
+		IRIS_TARGET_AVX2 static Array<Vector3x8> Pack(const Array<Vector3>& vectors);
+
+		IRIS_TARGET_AVX2 static Array<Vector3> Unpack(const Array<Vector3x8>& packets, size_t count);
+
+		__m256 x;
+		__m256 y;
+		__m256 z;
+	};
+}
+
+namespace Iris
+{
+	IRIS_TARGET_AVX2 inline Mask8 operator&(Mask8 left, Mask8 right) noexcept
+	{
+		return Mask8{ _mm256_and_ps(left.value, right.value) };
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator|(Mask8 left, Mask8 right) noexcept
+	{
+		return Mask8{ _mm256_or_ps(left.value, right.value) };
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator!(Mask8 mask) noexcept
+	{
+		return Mask8{ _mm256_xor_ps(mask.value, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator+(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Vector3x8{ _mm256_add_ps(left.x, right.x), _mm256_add_ps(left.y, right.y), _mm256_add_ps(left.z, right.z) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator+(const Vector3x8& left, float32 right) noexcept
+	{
+		const __m256 s = _mm256_set1_ps(right);
+		return Vector3x8{ _mm256_add_ps(left.x, s), _mm256_add_ps(left.y, s), _mm256_add_ps(left.z, s) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator-(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Vector3x8{ _mm256_sub_ps(left.x, right.x), _mm256_sub_ps(left.y, right.y), _mm256_sub_ps(left.z, right.z) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator-(const Vector3x8& left, float32 right) noexcept
+	{
+		const __m256 s = _mm256_set1_ps(right);
+		return Vector3x8{ _mm256_sub_ps(left.x, s), _mm256_sub_ps(left.y, s), _mm256_sub_ps(left.z, s) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator*(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Vector3x8{ _mm256_mul_ps(left.x, right.x), _mm256_mul_ps(left.y, right.y), _mm256_mul_ps(left.z, right.z) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator*(const Vector3x8& left, __m256 right) noexcept
+	{
+		return Vector3x8{ _mm256_mul_ps(left.x, right), _mm256_mul_ps(left.y, right), _mm256_mul_ps(left.z, right) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator*(const Vector3x8& left, float32 right) noexcept
+	{
+		return left * _mm256_set1_ps(right);
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator/(const Vector3x8& left, const Vector3x8& right)
+	{
+		if (right.hasZero().any())
+			throw Error::ZeroDivisionException{ "operator/(Vector3x8,Vector3x8)" };
+		return Vector3x8{ _mm256_div_ps(left.x, right.x), _mm256_div_ps(left.y, right.y), _mm256_div_ps(left.z, right.z) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 operator/(const Vector3x8& left, float32 right)
+	{
+		if (right == 0.f)
+			throw Error::ZeroDivisionException{ "operator/(Vector3x8,float32)" };
+		return left * (1.f / right);
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator+=(Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return left = left + right;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator+=(Vector3x8& left, float32 right) noexcept
+	{
+		return left = left + right;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator-=(Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return left = left - right;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator-=(Vector3x8& left, float32 right) noexcept
+	{
+		return left = left - right;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator*=(Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return left = left * right;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator*=(Vector3x8& left, float32 right) noexcept
+	{
+		return left = left * right;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator/=(Vector3x8& left, const Vector3x8& right)
+	{
+		return left = left / right;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8& operator/=(Vector3x8& left, float32 right)
+	{
+		return left = left / right;
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator==(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Mask8{ _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(left.x, right.x, _CMP_EQ_OQ), _mm256_cmp_ps(left.y, right.y, _CMP_EQ_OQ)), _mm256_cmp_ps(left.z, right.z, _CMP_EQ_OQ)) };
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator!=(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Mask8{ _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(left.x, right.x, _CMP_NEQ_UQ), _mm256_cmp_ps(left.y, right.y, _CMP_NEQ_UQ)), _mm256_cmp_ps(left.z, right.z, _CMP_NEQ_UQ)) };
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator<(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Mask8{ _mm256_cmp_ps(left.lengthSq(), right.lengthSq(), _CMP_LT_OQ) };
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator>(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Mask8{ _mm256_cmp_ps(left.lengthSq(), right.lengthSq(), _CMP_GT_OQ) };
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator<=(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Mask8{ _mm256_cmp_ps(left.lengthSq(), right.lengthSq(), _CMP_LE_OQ) };
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 operator>=(const Vector3x8& left, const Vector3x8& right) noexcept
+	{
+		return Mask8{ _mm256_cmp_ps(left.lengthSq(), right.lengthSq(), _CMP_GE_OQ) };
+	}
+}
+
+namespace Iris
+{
+	IRIS_TARGET_AVX2 inline uint32 Mask8::bits() const noexcept
+	{
+		return static_cast<uint32>(_mm256_movemask_ps(value));
+	}
+
+	IRIS_TARGET_AVX2 inline bool Mask8::any() const noexcept
+	{
+		return bits() != 0;
+	}
+
+	IRIS_TARGET_AVX2 inline bool Mask8::all() const noexcept
+	{
+		return bits() == 0xFF;
+	}
+
+	IRIS_TARGET_AVX2 inline bool Mask8::none() const noexcept
+	{
+		return bits() == 0;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8::Vector3x8() noexcept
+		: x(_mm256_setzero_ps()), y(_mm256_setzero_ps()), z(_mm256_setzero_ps())
+	{}
+
+	IRIS_TARGET_AVX2 inline Vector3x8::Vector3x8(__m256 _x, __m256 _y, __m256 _z) noexcept
+		: x(_x), y(_y), z(_z)
+	{}
+
+	IRIS_TARGET_AVX2 inline Vector3x8::Vector3x8(const Vector3& _vector) noexcept
+		: x(_mm256_set1_ps(_vector.x)), y(_mm256_set1_ps(_vector.y)), z(_mm256_set1_ps(_vector.z))
+	{}
+
+	IRIS_TARGET_AVX2 inline Vector3x8::Vector3x8(const Vector3x4& _low, const Vector3x4& _high) noexcept
+		: x(_mm256_insertf128_ps(_mm256_castps128_ps256(_low.x), _high.x, 1))
+		, y(_mm256_insertf128_ps(_mm256_castps128_ps256(_low.y), _high.y, 1))
+		, z(_mm256_insertf128_ps(_mm256_castps128_ps256(_low.z), _high.z, 1))
+	{}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::operator-() const noexcept
+	{
+		const __m256 sign = _mm256_set1_ps(-0.f);
+		return Vector3x8{ _mm256_xor_ps(x, sign), _mm256_xor_ps(y, sign), _mm256_xor_ps(z, sign) };
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 Vector3x8::lengthSq() const noexcept
+	{
+		return dot(*this);
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 Vector3x8::length() const noexcept
+	{
+		return _mm256_sqrt_ps(lengthSq());
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 Vector3x8::distanceSq(const Vector3x8& _other) const noexcept
+	{
+		return (_other - *this).lengthSq();
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 Vector3x8::distance(const Vector3x8& _other) const noexcept
+	{
+		return _mm256_sqrt_ps(distanceSq(_other));
+	}
+
+	IRIS_TARGET_AVX2 inline __m256 Vector3x8::dot(const Vector3x8& _other) const noexcept
+	{
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, _other.x), _mm256_mul_ps(y, _other.y)), _mm256_mul_ps(z, _other.z));
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::cross(const Vector3x8& _other) const noexcept
+	{
+		return Vector3x8
+		{
+			_mm256_sub_ps(_mm256_mul_ps(y, _other.z), _mm256_mul_ps(z, _other.y)),
+			_mm256_sub_ps(_mm256_mul_ps(z, _other.x), _mm256_mul_ps(x, _other.z)),
+			_mm256_sub_ps(_mm256_mul_ps(x, _other.y), _mm256_mul_ps(y, _other.x))
+		};
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::inverse() const noexcept
+	{
+		return -(*this);
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::normalize() const noexcept
+	{
+		return normalize(Math::Epsilon);
+	}
+
+	// Lanes shorter than the threshold are returned unchanged, as Vector3::normalize does
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::normalize(float32 _threshold) const noexcept
+	{
+		const __m256 len = length();
+		const Mask8 keep{ _mm256_cmp_ps(len, _mm256_set1_ps(_threshold), _CMP_LT_OQ) };
+		const __m256 invLen = _mm256_div_ps(_mm256_set1_ps(1.f), len);
+		return Select(keep, *this, (*this) * invLen);
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 Vector3x8::isZero() const noexcept
+	{
+		return (*this) == Vector3x8{};
+	}
+
+	IRIS_TARGET_AVX2 inline Mask8 Vector3x8::hasZero() const noexcept
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		return Mask8{ _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(x, zero, _CMP_EQ_OQ), _mm256_cmp_ps(y, zero, _CMP_EQ_OQ)), _mm256_cmp_ps(z, zero, _CMP_EQ_OQ)) };
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3 Vector3x8::get(size_t _lane) const noexcept
+	{
+		alignas(32) float32 lx[8], ly[8], lz[8];
+		_mm256_store_ps(lx, x);
+		_mm256_store_ps(ly, y);
+		_mm256_store_ps(lz, z);
+		return Vector3{ lx[_lane], ly[_lane], lz[_lane] };
+	}
+
+	IRIS_TARGET_AVX2 inline void Vector3x8::set(size_t _lane, const Vector3& _vector) noexcept
+	{
+		alignas(32) float32 lx[8], ly[8], lz[8];
+		_mm256_store_ps(lx, x);
+		_mm256_store_ps(ly, y);
+		_mm256_store_ps(lz, z);
+		lx[_lane] = _vector.x;
+		ly[_lane] = _vector.y;
+		lz[_lane] = _vector.z;
+		x = _mm256_load_ps(lx);
+		y = _mm256_load_ps(ly);
+		z = _mm256_load_ps(lz);
+	}
+
+	IRIS_TARGET_AVX2 inline void Vector3x8::store(Vector3* _dst) const noexcept
+	{
+		const __m256 rxy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m256 ryz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+		const __m256 rzx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+		const __m256 r03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m256 r14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+		const __m256 r25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+		float32* out = _dst->data;
+		_mm256_storeu_ps(out + 0, _mm256_permute2f128_ps(r03, r14, 0x20));
+		_mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(r25, r03, 0x30));
+		_mm256_storeu_ps(out + 16, _mm256_permute2f128_ps(r14, r25, 0x31));
+	}
+
+	IRIS_TARGET_AVX2 inline void Vector3x8::store(Vector3* _dst, size_t _count) const noexcept
+	{
+		if (_count >= Width)
+		{
+			store(_dst);
+			return;
+		}
+
+		for (size_t i = 0; i < _count; ++i)
+		{
+			_dst[i] = get(i);
+		}
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::Zero() noexcept
+	{
+		return Vector3x8{};
+	}
+
+	// The lane order of Load and store is shuffled consistently, so a round trip is exact
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::Load(const Vector3* _src) noexcept
+	{
+		const float32* in = _src->data;
+
+		const __m256 v03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 0)), _mm_loadu_ps(in + 12), 1);
+		const __m256 v14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 4)), _mm_loadu_ps(in + 16), 1);
+		const __m256 v25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 8)), _mm_loadu_ps(in + 20), 1);
+
+		const __m256 xy = _mm256_shuffle_ps(v14, v25, _MM_SHUFFLE(2, 1, 3, 2));
+		const __m256 yz = _mm256_shuffle_ps(v03, v14, _MM_SHUFFLE(1, 0, 2, 1));
+
+		return Vector3x8
+		{
+			_mm256_shuffle_ps(v03, xy, _MM_SHUFFLE(2, 0, 3, 0)),
+			_mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)),
+			_mm256_shuffle_ps(yz, v25, _MM_SHUFFLE(3, 0, 3, 1))
+		};
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::Load(const Vector3* _src, size_t _count) noexcept
+	{
+		if (_count >= Width)
+			return Load(_src);
+
+		Vector3x8 result{};
+
+		for (size_t i = 0; i < _count; ++i)
+		{
+			result.set(i, _src[i]);
+		}
+
+		return result;
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::Lerp(const Vector3x8& from, const Vector3x8& to, float32 t) noexcept
+	{
+		return from + ((to - from) * t);
+	}
+
+	IRIS_TARGET_AVX2 inline Vector3x8 Vector3x8::Select(Mask8 mask, const Vector3x8& ifTrue, const Vector3x8& ifFalse) noexcept
+	{
+		return Vector3x8
+		{
+			_mm256_or_ps(_mm256_and_ps(mask.value, ifTrue.x), _mm256_andnot_ps(mask.value, ifFalse.x)),
+			_mm256_or_ps(_mm256_and_ps(mask.value, ifTrue.y), _mm256_andnot_ps(mask.value, ifFalse.y)),
+			_mm256_or_ps(_mm256_and_ps(mask.value, ifTrue.z), _mm256_andnot_ps(mask.value, ifFalse.z))
+		};
+	}
+
+	// The last packet is zero-padded when the size is not a multiple of Width
+	IRIS_TARGET_AVX2 inline Array<Vector3x8> Vector3x8::Pack(const Array<Vector3>& vectors)
+	{
+		const size_t count = vectors.size();
+
+		Array<Vector3x8> packets;
+		packets.reserve((count + Width - 1) / Width);
+
+		for (size_t i = 0; i < count; i += Width)
+		{
+			packets.addLast(Load(vectors.data() + i, count - i));
+		}
+
+		return packets;
+	}
+
+	IRIS_TARGET_AVX2 inline Array<Vector3> Vector3x8::Unpack(const Array<Vector3x8>& packets, size_t count)
+	{
+		count = Min(count, packets.size() * Width);
+
+		Array<Vector3> vectors(count);
+
+		for (size_t i = 0; i < count; i += Width)
+		{
+			packets[i / Width].store(vectors.data() + i, count - i);
+		}
+
+		return vectors;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+namespace Iris
+{
+	namespace
+	{
+#if defined(IRIS_SIMD_X86)
+		void CPUID(int info[4], int leaf, int subleaf) noexcept
+		{
+#if defined(_MSC_VER)
+			__cpuidex(info, leaf, subleaf);
+#else
+			unsigned int a = 0, b = 0, c = 0, d = 0;
+			__cpuid_count(leaf, subleaf, a, b, c, d);
+			info[0] = static_cast<int>(a);
+			info[1] = static_cast<int>(b);
+			info[2] = static_cast<int>(c);
+			info[3] = static_cast<int>(d);
+#endif
+		}
+
+		unsigned long long XGETBV() noexcept
+		{
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			unsigned int lo = 0, hi = 0;
+			__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+			return (static_cast<unsigned long long>(hi) << 32) | lo;
+#endif
+		}
+#endif
+
+		CPUFeature Detect() noexcept
+		{
+			CPUFeature feature{};
+
+#if defined(IRIS_SIMD_X86)
+			int info[4] = {};
+
+			CPUID(info, 0, 0);
+			const int maxLeaf = info[0];
+
+			if (maxLeaf < 1)
+				return feature;
+
+			CPUID(info, 1, 0);
+			feature.sse41 = (info[2] & (1 << 19)) != 0;
+
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool cpuAVX = (info[2] & (1 << 28)) != 0;
+			const bool cpuFMA = (info[2] & (1 << 12)) != 0;
+			const bool cpuF16C = (info[2] & (1 << 29)) != 0;
+
+			// OS must preserve XMM and YMM state across context switches
+			const bool osAVX = osxsave && ((XGETBV() & 0x6) == 0x6);
+
+			feature.avx = cpuAVX && osAVX;
+			feature.fma = cpuFMA && feature.avx;
+			feature.f16c = cpuF16C && feature.avx;
+
+			if (maxLeaf >= 7)
+			{
+				CPUID(info, 7, 0);
+				feature.avx2 = feature.avx && (info[1] & (1 << 5)) != 0;
+			}
+#endif
+
+			return feature;
+		}
+	}
+
+	const CPUFeature& CPUFeature::Get() noexcept
+	{
+		static const CPUFeature sFeature = Detect();
+		return sFeature;
+	}
+}
\ No newline at end of file
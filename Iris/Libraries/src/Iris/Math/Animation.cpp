@@ -0,0 +1,180 @@
+#include <Iris/Math/Animation.hpp>
+#include <Iris/Common/Parallel.hpp>
+
+#include <algorithm>
+#include <thread>
+
+namespace Iris
+{
+	namespace
+	{
+		// Nlerp on the shorter arc. Scales by one reciprocal square root instead of Quaternion::normalize's four checked divisions
+		inline Quaternion BlendRotation(const Quaternion& from, const Quaternion& to, float32 t) noexcept
+		{
+			const auto weight = (from.dot(to) < 0.f) ? -t : t;
+			const auto blended = from * (1.f - t) + to * weight;
+			const auto lengthSq = blended.lengthSq();
+
+			return (lengthSq > 0.f) ? blended * (1.f / Math::Sqrt(lengthSq)) : blended;
+		}
+
+		// Below this many tracks per thread the spawn cost outweighs the work
+		constexpr size_t MinTracksPerThread = 2048;
+	}
+
+	size_t AnimationClip::addTrack(std::span<const float32> _times, std::span<const Vector3> _positions, std::span<const Quaternion> _rotations, std::span<const Vector3> _scales)
+	{
+		const auto count = _times.size();
+
+		bool valid = (count != 0) && (_positions.size() == count) && (_rotations.size() == count) && (_scales.size() == count)
+			&& (_times[0] >= 0.f) && (mTimes.size() + count <= ~uint32{ 0 });
+
+		for (size_t i = 1; valid && i < count; ++i)
+		{
+			valid = _times[i - 1] < _times[i];
+		}
+
+		if (!valid)
+			throw Error::OutOfRange{ "AnimationClip::addTrack(span<const float32>,span<const Vector3>,span<const Quaternion>,span<const Vector3>)" };
+
+		mTracks.addLast(Track{ static_cast<uint32>(mTimes.size()),static_cast<uint32>(count) });
+		mTimes.addLast(_times.begin(), _times.end());
+		mPositions.addLast(_positions.begin(), _positions.end());
+		mRotations.addLast(_rotations.begin(), _rotations.end());
+		mScales.addLast(_scales.begin(), _scales.end());
+		mDuration = Max(mDuration, _times[count - 1]);
+
+		return mTracks.size() - 1;
+	}
+
+	Transform AnimationClip::sample(size_t _track, float32 _time) const
+	{
+		if (_track >= mTracks.size())
+			throw Error::OutOfRange{ "AnimationClip::sample(size_t,float32)" };
+
+		const auto& track = mTracks[_track];
+		return interpolate(track, findKey(track, _time), _time);
+	}
+
+	uint32 AnimationClip::findKey(const Track& _track, float32 _time) const noexcept
+	{
+		const auto* times = mTimes.data() + _track.first;
+		const auto* next = std::upper_bound(times, times + _track.count, _time);
+
+		return (next == times) ? 0 : static_cast<uint32>(next - times - 1);
+	}
+
+	Transform AnimationClip::interpolate(const Track& _track, uint32 _key, float32 _time) const noexcept
+	{
+		const auto index = _track.first + _key;
+		const auto* times = mTimes.data();
+
+		// Clamped before the first key and after the last one
+		if (_key + 1 >= _track.count || _time <= times[index])
+			return Transform{ mPositions[index],mRotations[index],mScales[index] };
+
+		const auto t = Min((_time - times[index]) / (times[index + 1] - times[index]), 1.f);
+
+		return Transform
+		{
+			Vector3::Lerp(mPositions[index], mPositions[index + 1], t),
+			BlendRotation(mRotations[index], mRotations[index + 1], t),
+			Vector3::Lerp(mScales[index], mScales[index + 1], t)
+		};
+	}
+
+	AnimationSampler::AnimationSampler(const AnimationClip& _clip)
+		: mClip(&_clip)
+		, mCursors(_clip.trackCount(), 0)
+	{}
+
+	void AnimationSampler::sample(float32 _time, std::span<Transform> _pose)
+	{
+		if (_pose.size() < mClip->trackCount())
+			throw Error::OutOfRange{ "AnimationSampler::sample(float32,span<Transform>)" };
+
+		mCursors.resize(mClip->trackCount(), 0);
+		samplePose(_time, _pose.data());
+	}
+
+	void AnimationSampler::reset() noexcept
+	{
+		for (auto& cursor : mCursors)
+		{
+			cursor = 0;
+		}
+	}
+
+	void AnimationSampler::samplePose(float32 _time, Transform* _pose) noexcept
+	{
+		const auto& clip = *mClip;
+		const auto* times = clip.mTimes.data();
+		const auto trackCount = clip.mTracks.size();
+
+		for (size_t i = 0; i < trackCount; ++i)
+		{
+			const auto& track = clip.mTracks[i];
+			auto key = mCursors[i];
+
+			// Forward playback advances by at most a key or two per frame; anything else seeks
+			if (key >= track.count || _time < times[track.first + key])
+			{
+				key = clip.findKey(track, _time);
+			}
+			else
+			{
+				while (key + 1 < track.count && times[track.first + key + 1] <= _time)
+				{
+					++key;
+				}
+			}
+
+			mCursors[i] = key;
+			_pose[i] = clip.interpolate(track, key, _time);
+		}
+	}
+
+	void AnimationSampler::SampleBatch(std::span<AnimationSampler> samplers, std::span<const float32> times, std::span<Array<Transform>> poses, size_t threadCount)
+	{
+		const auto count = samplers.size();
+
+		bool valid = (times.size() >= count) && (poses.size() >= count);
+		size_t tracks = 0;
+
+		for (size_t i = 0; valid && i < count; ++i)
+		{
+			const auto trackCount = samplers[i].mClip->trackCount();
+			valid = poses[i].size() >= trackCount;
+			tracks += trackCount;
+		}
+
+		if (!valid)
+			throw Error::OutOfRange{ "AnimationSampler::SampleBatch(span<AnimationSampler>,span<const float32>,span<Array<Transform>>,size_t)" };
+
+		// Only reallocates when a clip gained tracks since the last call, and never on a worker
+		for (size_t i = 0; i < count; ++i)
+		{
+			samplers[i].mCursors.resize(samplers[i].mClip->trackCount(), 0);
+		}
+
+		if (threadCount == 0)
+			threadCount = Max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		threadCount = Min(threadCount, Max<size_t>(Min(tracks / MinTracksPerThread, count), 1));
+
+		const auto perThread = (count + threadCount - 1) / threadCount;
+
+		const auto run = [&](size_t t)
+		{
+			const auto first = Min(t * perThread, count);
+			const auto last = Min(first + perThread, count);
+
+			for (size_t i = first; i < last; ++i)
+			{
+				samplers[i].samplePose(times[i], poses[i].data());
+			}
+		};
+
+		ParallelFor(threadCount, run);
+	}
+}
\ No newline at end of file
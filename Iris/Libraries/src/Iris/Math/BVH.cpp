@@ -0,0 +1,638 @@
+#include <Iris/Math/BVH.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+#include <Iris/Common/Parallel.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <thread>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	static_assert(sizeof(BVH::Node) == 32, "BVH::Node must stay 32 bytes");
+
+	namespace
+	{
+		constexpr size_t BinCount = 16;
+
+		// Beyond this depth splits fall back to the object median, which bounds the traversal stack
+		constexpr size_t MaxSAHDepth = 64;
+
+		constexpr size_t StackSize = 128;
+
+		constexpr size_t ParallelThreshold = 16384;
+
+		constexpr float32 Infinity = std::numeric_limits<float32>::infinity();
+
+		constexpr AABB EmptyBounds()noexcept
+		{
+			return AABB{ Vector3{ Infinity,Infinity,Infinity },Vector3{ -Infinity,-Infinity,-Infinity } };
+		}
+
+		constexpr float32 SurfaceArea(const AABB& box)noexcept
+		{
+			const auto d = box.size();
+			return 2.f * (d.x * d.y + d.y * d.z + d.z * d.x);
+		}
+
+		struct BuildNode
+		{
+			AABB bounds;
+			uint32 first = 0;
+			uint32 count = 0;
+			std::unique_ptr<BuildNode> left;
+			std::unique_ptr<BuildNode> right;
+		};
+
+		struct Builder
+		{
+			const AABB* bounds;
+			const Vector3* centroids;
+			uint32* indices;
+			size_t parallelDepth;
+		};
+
+		struct Bin
+		{
+			AABB bounds = EmptyBounds();
+			uint32 count = 0;
+		};
+
+		std::unique_ptr<BuildNode> BuildRecursive(const Builder& builder, uint32 first, uint32 count, size_t depth)
+		{
+			auto node = std::make_unique<BuildNode>();
+
+			auto bounds = EmptyBounds();
+			auto centroidBounds = EmptyBounds();
+
+			for (uint32 i = first; i < first + count; ++i)
+			{
+				bounds = bounds.merge(builder.bounds[builder.indices[i]]);
+				centroidBounds = centroidBounds.merge(builder.centroids[builder.indices[i]]);
+			}
+
+			node->bounds = bounds;
+			node->first = first;
+			node->count = count;
+
+			if (count <= 2)
+				return node;
+
+			auto bestCost = Infinity;
+			size_t bestAxis = 3;
+			size_t bestSplit = 0;
+
+			if (depth < MaxSAHDepth)
+			{
+				for (size_t axis = 0; axis < 3; ++axis)
+				{
+					const auto lo = centroidBounds.min.data[axis];
+					const auto extent = centroidBounds.max.data[axis] - lo;
+
+					if (!(extent > 0.f))
+						continue;
+
+					const auto scale = static_cast<float32>(BinCount) / extent;
+
+					Bin bins[BinCount];
+
+					for (uint32 i = first; i < first + count; ++i)
+					{
+						const auto index = builder.indices[i];
+						const auto b = Min(static_cast<size_t>((builder.centroids[index].data[axis] - lo) * scale), BinCount - 1);
+						bins[b].bounds = bins[b].bounds.merge(builder.bounds[index]);
+						++bins[b].count;
+					}
+
+					// rightCost[i] covers bins (i, BinCount)
+					float32 rightCost[BinCount];
+					auto accumulated = EmptyBounds();
+					uint32 accumulatedCount = 0;
+
+					for (size_t i = BinCount - 1; i > 0; --i)
+					{
+						accumulated = accumulated.merge(bins[i].bounds);
+						accumulatedCount += bins[i].count;
+						rightCost[i - 1] = accumulatedCount ? SurfaceArea(accumulated) * static_cast<float32>(accumulatedCount) : 0.f;
+					}
+
+					accumulated = EmptyBounds();
+					accumulatedCount = 0;
+
+					for (size_t i = 0; i + 1 < BinCount; ++i)
+					{
+						accumulated = accumulated.merge(bins[i].bounds);
+						accumulatedCount += bins[i].count;
+
+						if (accumulatedCount == 0 || accumulatedCount == count)
+							continue;
+
+						const auto cost = SurfaceArea(accumulated) * static_cast<float32>(accumulatedCount) + rightCost[i];
+
+						if (cost < bestCost)
+						{
+							bestCost = cost;
+							bestAxis = axis;
+							bestSplit = i;
+						}
+					}
+				}
+			}
+
+			uint32 leftCount = 0;
+
+			if (bestAxis < 3)
+			{
+				// Traversal cost of one box test against the leaf cost of 'count' primitive tests
+				const auto leafCost = static_cast<float32>(count);
+				const auto splitCost = 1.f + bestCost / SurfaceArea(bounds);
+
+				if (splitCost >= leafCost && count <= BVH::MaxLeafSize)
+					return node;
+
+				const auto lo = centroidBounds.min.data[bestAxis];
+				const auto scale = static_cast<float32>(BinCount) / (centroidBounds.max.data[bestAxis] - lo);
+
+				const auto middle = std::partition(builder.indices + first, builder.indices + first + count, [&](uint32 index)
+				{
+					return Min(static_cast<size_t>((builder.centroids[index].data[bestAxis] - lo) * scale), BinCount - 1) <= bestSplit;
+				});
+
+				leftCount = static_cast<uint32>(middle - (builder.indices + first));
+			}
+
+			if (leftCount == 0 || leftCount == count)
+			{
+				if (count <= BVH::MaxLeafSize)
+					return node;
+
+				// Object median along the widest centroid axis
+				const auto extent = centroidBounds.size();
+				const size_t axis = (extent.x > extent.y && extent.x > extent.z) ? 0 : (extent.y > extent.z) ? 1 : 2;
+
+				leftCount = count / 2;
+				std::nth_element(builder.indices + first, builder.indices + first + leftCount, builder.indices + first + count, [&](uint32 a, uint32 b)
+				{
+					return builder.centroids[a].data[axis] < builder.centroids[b].data[axis];
+				});
+			}
+
+			node->count = 0;
+
+			if (depth < builder.parallelDepth && count >= ParallelThreshold)
+			{
+				ParallelInvoke(
+					[&]() { node->left = BuildRecursive(builder, first, leftCount, depth + 1); },
+					[&]() { node->right = BuildRecursive(builder, first + leftCount, count - leftCount, depth + 1); });
+			}
+			else
+			{
+				node->left = BuildRecursive(builder, first, leftCount, depth + 1);
+				node->right = BuildRecursive(builder, first + leftCount, count - leftCount, depth + 1);
+			}
+
+			return node;
+		}
+
+		void Flatten(const BuildNode& node, Array<BVH::Node>& nodes)
+		{
+			const auto index = nodes.size();
+			nodes.addLast(BVH::Node{ node.bounds,node.first,node.count });
+
+			if (node.count != 0)
+				return;
+
+			Flatten(*node.left, nodes);
+			nodes[index].offset = static_cast<uint32>(nodes.size());
+			Flatten(*node.right, nodes);
+		}
+
+		struct RaySlab
+		{
+			Vector3 origin;
+			Vector3 invDir;
+		};
+
+		inline bool SlabTest(const AABB& box, const RaySlab& ray, float32 tMax, float32& tEntry) noexcept
+		{
+			auto tMin = 0.f;
+
+			for (size_t axis = 0; axis < 3; ++axis)
+			{
+				auto t0 = (box.min.data[axis] - ray.origin.data[axis]) * ray.invDir.data[axis];
+				auto t1 = (box.max.data[axis] - ray.origin.data[axis]) * ray.invDir.data[axis];
+
+				if (ray.invDir.data[axis] < 0.f)
+				{
+					const auto t = t0;
+					t0 = t1;
+					t1 = t;
+				}
+
+				tMin = t0 > tMin ? t0 : tMin;
+				tMax = t1 < tMax ? t1 : tMax;
+			}
+
+			tEntry = tMin;
+			return tMin <= tMax;
+		}
+
+#if defined(IRIS_SIMD_X86)
+		struct alignas(32) Packet8
+		{
+			float32 ox[8], oy[8], oz[8];
+			float32 ix[8], iy[8], iz[8];
+			float32 tMax[8];
+		};
+
+		// Returns the lanes whose ray enters the box before their current tMax
+		IRIS_TARGET_AVX2 inline uint32 PacketTest(const AABB& box, const Packet8& packet) noexcept
+		{
+			const __m256 ix = _mm256_load_ps(packet.ix);
+			const __m256 iy = _mm256_load_ps(packet.iy);
+			const __m256 iz = _mm256_load_ps(packet.iz);
+
+			const __m256 x0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(box.min.x), _mm256_load_ps(packet.ox)), ix);
+			const __m256 x1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(box.max.x), _mm256_load_ps(packet.ox)), ix);
+			const __m256 y0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(box.min.y), _mm256_load_ps(packet.oy)), iy);
+			const __m256 y1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(box.max.y), _mm256_load_ps(packet.oy)), iy);
+			const __m256 z0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(box.min.z), _mm256_load_ps(packet.oz)), iz);
+			const __m256 z1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(box.max.z), _mm256_load_ps(packet.oz)), iz);
+
+			__m256 tNear = _mm256_max_ps(_mm256_min_ps(x0, x1), _mm256_setzero_ps());
+			tNear = _mm256_max_ps(_mm256_min_ps(y0, y1), tNear);
+			tNear = _mm256_max_ps(_mm256_min_ps(z0, z1), tNear);
+
+			__m256 tFar = _mm256_min_ps(_mm256_max_ps(x0, x1), _mm256_load_ps(packet.tMax));
+			tFar = _mm256_min_ps(_mm256_max_ps(y0, y1), tFar);
+			tFar = _mm256_min_ps(_mm256_max_ps(z0, z1), tFar);
+
+			return static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ)));
+		}
+#endif
+
+		[[maybe_unused]] bool HasPacketKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+			return cpu.avx2 && cpu.fma;
+#else
+			return false;
+#endif
+		}
+	}
+
+	void BVH::build(std::span<const AABB> _bounds, size_t _threadCount)
+	{
+		clear();
+
+		if (_bounds.empty())
+			return;
+
+		if (_bounds.size() >= InvalidIndex)
+			throw Error::OutOfRange{ "BVH::build(span<const AABB>,size_t)" };
+
+		const auto count = static_cast<uint32>(_bounds.size());
+
+		Array<Vector3> centroids(count);
+		mPrimitives.resize(count);
+
+		for (uint32 i = 0; i < count; ++i)
+		{
+			centroids[i] = _bounds[i].center();
+			mPrimitives[i] = i;
+		}
+
+		if (_threadCount == 0)
+			_threadCount = Max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		// Each level below the root doubles the number of concurrent subtrees
+		const auto parallelDepth = static_cast<size_t>(std::bit_width(_threadCount - 1));
+
+		const Builder builder{ _bounds.data(),centroids.data(),mPrimitives.data(),parallelDepth };
+		const auto root = BuildRecursive(builder, 0, count, 0);
+
+		mNodes.reserve(2 * static_cast<size_t>(count));
+		Flatten(*root, mNodes);
+		mNodes.shrinkToFit();
+
+		mBounds.resize(count);
+
+		for (uint32 i = 0; i < count; ++i)
+		{
+			mBounds[i] = _bounds[mPrimitives[i]];
+		}
+	}
+
+	void BVH::refit(std::span<const AABB> _bounds)
+	{
+		if (_bounds.size() != mPrimitives.size())
+			throw Error::OutOfRange{ "BVH::refit(span<const AABB>)" };
+
+		for (size_t i = 0; i < mPrimitives.size(); ++i)
+		{
+			mBounds[i] = _bounds[mPrimitives[i]];
+		}
+
+		// Children always follow their parent, so a reverse sweep sees them first
+		for (size_t i = mNodes.size(); i-- > 0;)
+		{
+			auto& node = mNodes[i];
+
+			if (node.isLeaf())
+			{
+				auto bounds = EmptyBounds();
+
+				for (uint32 k = 0; k < node.count; ++k)
+				{
+					bounds = bounds.merge(mBounds[node.offset + k]);
+				}
+
+				node.bounds = bounds;
+			}
+			else
+			{
+				node.bounds = mNodes[i + 1].bounds.merge(mNodes[node.offset].bounds);
+			}
+		}
+	}
+
+	void BVH::clear() noexcept
+	{
+		mNodes.removeAll();
+		mPrimitives.removeAll();
+		mBounds.removeAll();
+	}
+
+	void BVH::overlap(const AABB& _box, Array<uint32>& _result) const
+	{
+		if (mNodes.size() == 0)
+			return;
+
+		uint32 stack[StackSize];
+		size_t top = 0;
+		stack[top++] = 0;
+
+		while (top > 0)
+		{
+			const auto& node = mNodes[stack[--top]];
+
+			if (!node.bounds.intersects(_box))
+				continue;
+
+			if (node.isLeaf())
+			{
+				for (uint32 k = node.offset; k < node.offset + node.count; ++k)
+				{
+					if (mBounds[k].intersects(_box))
+						_result.addLast(mPrimitives[k]);
+				}
+			}
+			else
+			{
+				stack[top++] = node.offset;
+				stack[top++] = static_cast<uint32>(&node - mNodes.data()) + 1;
+			}
+		}
+	}
+
+	void BVH::overlap(const Sphere& _sphere, Array<uint32>& _result) const
+	{
+		if (mNodes.size() == 0)
+			return;
+
+		uint32 stack[StackSize];
+		size_t top = 0;
+		stack[top++] = 0;
+
+		while (top > 0)
+		{
+			const auto& node = mNodes[stack[--top]];
+
+			if (!_sphere.intersects(node.bounds))
+				continue;
+
+			if (node.isLeaf())
+			{
+				for (uint32 k = node.offset; k < node.offset + node.count; ++k)
+				{
+					if (_sphere.intersects(mBounds[k]))
+						_result.addLast(mPrimitives[k]);
+				}
+			}
+			else
+			{
+				stack[top++] = node.offset;
+				stack[top++] = static_cast<uint32>(&node - mNodes.data()) + 1;
+			}
+		}
+	}
+
+	AABB BVH::bounds() const noexcept
+	{
+		return (mNodes.size() != 0) ? mNodes[0].bounds : AABB{};
+	}
+
+	std::span<const BVH::Node> BVH::nodes() const noexcept
+	{
+		return std::span<const Node>{ mNodes.data(),mNodes.size() };
+	}
+
+	std::span<const uint32> BVH::primitives() const noexcept
+	{
+		return std::span<const uint32>{ mPrimitives.data(),mPrimitives.size() };
+	}
+
+	bool BVH::empty() const noexcept
+	{
+		return mNodes.size() == 0;
+	}
+
+	BVH::Hit BVH::raycastSingle(const Ray& _ray, void* _context, IntersectFunction _intersect) const
+	{
+		Hit hit;
+
+		if (mNodes.size() == 0)
+			return hit;
+
+		const RaySlab slab{ _ray.origin,Vector3{ 1.f / _ray.direction.x,1.f / _ray.direction.y,1.f / _ray.direction.z } };
+		auto closest = _ray.maxDistance;
+
+		struct Entry
+		{
+			uint32 node;
+			float32 tEntry;
+		};
+
+		Entry stack[StackSize];
+		size_t top = 0;
+
+		float32 tRoot;
+
+		if (!SlabTest(mNodes[0].bounds, slab, closest, tRoot))
+			return hit;
+
+		stack[top++] = Entry{ 0,tRoot };
+
+		while (top > 0)
+		{
+			const auto entry = stack[--top];
+
+			if (entry.tEntry > closest)
+				continue;
+
+			const auto& node = mNodes[entry.node];
+
+			if (node.isLeaf())
+			{
+				for (uint32 k = node.offset; k < node.offset + node.count; ++k)
+				{
+					const Ray query{ _ray.origin,_ray.direction,closest };
+					float32 distance;
+
+					if (_intersect(_context, mPrimitives[k], query, distance) && distance <= closest)
+					{
+						closest = distance;
+						hit = Hit{ mPrimitives[k],distance };
+					}
+				}
+
+				continue;
+			}
+
+			const auto leftIndex = entry.node + 1;
+			const auto rightIndex = node.offset;
+
+			float32 tLeft, tRight;
+			const auto hitLeft = SlabTest(mNodes[leftIndex].bounds, slab, closest, tLeft);
+			const auto hitRight = SlabTest(mNodes[rightIndex].bounds, slab, closest, tRight);
+
+			// The nearer child is pushed last so it is popped first
+			if (hitLeft && hitRight)
+			{
+				if (tLeft <= tRight)
+				{
+					stack[top++] = Entry{ rightIndex,tRight };
+					stack[top++] = Entry{ leftIndex,tLeft };
+				}
+				else
+				{
+					stack[top++] = Entry{ leftIndex,tLeft };
+					stack[top++] = Entry{ rightIndex,tRight };
+				}
+			}
+			else if (hitLeft)
+			{
+				stack[top++] = Entry{ leftIndex,tLeft };
+			}
+			else if (hitRight)
+			{
+				stack[top++] = Entry{ rightIndex,tRight };
+			}
+		}
+
+		return hit;
+	}
+
+	void BVH::raycastPacket(std::span<const Ray> _rays, std::span<Hit> _hits, void* _context, IntersectFunction _intersect) const
+	{
+		if (_hits.size() < _rays.size())
+			throw Error::OutOfRange{ "BVH::raycast(span<const Ray>,span<Hit>,Fty)const" };
+
+		size_t first = 0;
+
+#if defined(IRIS_SIMD_X86)
+		static const bool packetKernel = HasPacketKernel();
+
+		if (packetKernel && mNodes.size() != 0)
+		{
+			for (; first + 8 <= _rays.size(); first += 8)
+			{
+				Packet8 packet;
+
+				for (size_t lane = 0; lane < 8; ++lane)
+				{
+					const auto& ray = _rays[first + lane];
+					packet.ox[lane] = ray.origin.x;
+					packet.oy[lane] = ray.origin.y;
+					packet.oz[lane] = ray.origin.z;
+					packet.ix[lane] = 1.f / ray.direction.x;
+					packet.iy[lane] = 1.f / ray.direction.y;
+					packet.iz[lane] = 1.f / ray.direction.z;
+					packet.tMax[lane] = ray.maxDistance;
+					_hits[first + lane] = Hit{};
+				}
+
+				uint32 stack[StackSize];
+				size_t top = 0;
+				stack[top++] = 0;
+
+				while (top > 0)
+				{
+					const auto nodeIndex = stack[--top];
+					const auto& node = mNodes[nodeIndex];
+
+					auto mask = PacketTest(node.bounds, packet);
+
+					if (mask == 0)
+						continue;
+
+					if (!node.isLeaf())
+					{
+						// Order children by the direction of the first active ray along their widest separation
+						const auto& left = mNodes[nodeIndex + 1].bounds;
+						const auto& right = mNodes[node.offset].bounds;
+						const auto separation = right.center() - left.center();
+						const size_t axis = (Math::Abs(separation.x) > Math::Abs(separation.y))
+							? (Math::Abs(separation.x) > Math::Abs(separation.z) ? 0 : 2)
+							: (Math::Abs(separation.y) > Math::Abs(separation.z) ? 1 : 2);
+
+						const auto lane = static_cast<size_t>(std::countr_zero(mask));
+						const auto direction = _rays[first + lane].direction.data[axis];
+
+						if ((direction >= 0.f) == (separation.data[axis] >= 0.f))
+						{
+							stack[top++] = node.offset;
+							stack[top++] = nodeIndex + 1;
+						}
+						else
+						{
+							stack[top++] = nodeIndex + 1;
+							stack[top++] = node.offset;
+						}
+
+						continue;
+					}
+
+					for (; mask != 0; mask &= mask - 1)
+					{
+						const auto lane = static_cast<size_t>(std::countr_zero(mask));
+						const auto& ray = _rays[first + lane];
+
+						for (uint32 k = node.offset; k < node.offset + node.count; ++k)
+						{
+							const Ray query{ ray.origin,ray.direction,packet.tMax[lane] };
+							float32 distance;
+
+							if (_intersect(_context, mPrimitives[k], query, distance) && distance <= packet.tMax[lane])
+							{
+								packet.tMax[lane] = distance;
+								_hits[first + lane] = Hit{ mPrimitives[k],distance };
+							}
+						}
+					}
+				}
+			}
+		}
+#endif
+
+		for (; first < _rays.size(); ++first)
+		{
+			_hits[first] = raycastSingle(_rays[first], _context, _intersect);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,262 @@
+#include <Iris/Math/BatchTransform.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#include <cstdint>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	static_assert(sizeof(Vector3) == sizeof(float32) * 3, "Vector3 must be tightly packed");
+
+	namespace
+	{
+		using TransformKernel = void(*)(const Matrix4x4&, const Vector3*, Vector3*, size_t, float32, bool)noexcept;
+
+		void TransformScalar(const Matrix4x4& m, const Vector3* src, Vector3* dst, size_t count, float32 w, bool) noexcept
+		{
+			const auto tx = m.m30 * w;
+			const auto ty = m.m31 * w;
+			const auto tz = m.m32 * w;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const auto [x, y, z] = src[i].data;
+
+				dst[i] = Vector3
+				{
+					x * m.m00 + y * m.m10 + z * m.m20 + tx,
+					x * m.m01 + y * m.m11 + z * m.m21 + ty,
+					x * m.m02 + y * m.m12 + z * m.m22 + tz
+				};
+			}
+		}
+
+#if defined(IRIS_SIMD_X86)
+		// Number of leading elements to skip so that 'dst' lands on a 16-byte boundary
+		size_t AlignmentHead(const Vector3* dst, size_t count) noexcept
+		{
+			size_t head = 0;
+
+			while (head < count && (reinterpret_cast<std::uintptr_t>(dst + head) & 15) != 0)
+			{
+				++head;
+			}
+
+			return head;
+		}
+
+		// Four packed Vector3 (three registers) are shuffled into x, y and z lanes and back
+		void TransformSSE(const Matrix4x4& m, const Vector3* src, Vector3* dst, size_t count, float32 w, bool stream) noexcept
+		{
+			size_t i = 0;
+
+			if (stream)
+			{
+				i = AlignmentHead(dst, count);
+				TransformScalar(m, src, dst, i, w, false);
+			}
+
+			const __m128 m00 = _mm_set1_ps(m.m00), m01 = _mm_set1_ps(m.m01), m02 = _mm_set1_ps(m.m02);
+			const __m128 m10 = _mm_set1_ps(m.m10), m11 = _mm_set1_ps(m.m11), m12 = _mm_set1_ps(m.m12);
+			const __m128 m20 = _mm_set1_ps(m.m20), m21 = _mm_set1_ps(m.m21), m22 = _mm_set1_ps(m.m22);
+			const __m128 tx = _mm_set1_ps(m.m30 * w), ty = _mm_set1_ps(m.m31 * w), tz = _mm_set1_ps(m.m32 * w);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32* in = src[i].data;
+				float32* out = dst[i].data;
+
+				const __m128 v0 = _mm_loadu_ps(in + 0);
+				const __m128 v1 = _mm_loadu_ps(in + 4);
+				const __m128 v2 = _mm_loadu_ps(in + 8);
+
+				const __m128 xy = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));
+				const __m128 yz = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 0, 2, 1));
+				const __m128 x = _mm_shuffle_ps(v0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+				const __m128 y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+				const __m128 z = _mm_shuffle_ps(yz, v2, _MM_SHUFFLE(3, 0, 3, 1));
+
+				const __m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_add_ps(_mm_mul_ps(z, m20), tx));
+				const __m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_add_ps(_mm_mul_ps(z, m21), ty));
+				const __m128 oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_add_ps(_mm_mul_ps(z, m22), tz));
+
+				const __m128 rxy = _mm_shuffle_ps(ox, oy, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m128 ryz = _mm_shuffle_ps(oy, oz, _MM_SHUFFLE(3, 1, 3, 1));
+				const __m128 rzx = _mm_shuffle_ps(oz, ox, _MM_SHUFFLE(3, 1, 2, 0));
+
+				const __m128 r0 = _mm_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m128 r1 = _mm_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+				const __m128 r2 = _mm_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+				if (stream)
+				{
+					_mm_stream_ps(out + 0, r0);
+					_mm_stream_ps(out + 4, r1);
+					_mm_stream_ps(out + 8, r2);
+				}
+				else
+				{
+					_mm_storeu_ps(out + 0, r0);
+					_mm_storeu_ps(out + 4, r1);
+					_mm_storeu_ps(out + 8, r2);
+				}
+			}
+
+			if (stream)
+			{
+				_mm_sfence();
+			}
+
+			TransformScalar(m, src + i, dst + i, count - i, w, false);
+		}
+
+		// Same layout trick as TransformSSE with points 0-3 in the low lane and 4-7 in the high lane
+		IRIS_TARGET_AVX2 void TransformAVX2(const Matrix4x4& m, const Vector3* src, Vector3* dst, size_t count, float32 w, bool stream) noexcept
+		{
+			size_t i = 0;
+
+			if (stream)
+			{
+				i = AlignmentHead(dst, count);
+				TransformScalar(m, src, dst, i, w, false);
+			}
+
+			const __m256 m00 = _mm256_set1_ps(m.m00), m01 = _mm256_set1_ps(m.m01), m02 = _mm256_set1_ps(m.m02);
+			const __m256 m10 = _mm256_set1_ps(m.m10), m11 = _mm256_set1_ps(m.m11), m12 = _mm256_set1_ps(m.m12);
+			const __m256 m20 = _mm256_set1_ps(m.m20), m21 = _mm256_set1_ps(m.m21), m22 = _mm256_set1_ps(m.m22);
+			const __m256 tx = _mm256_set1_ps(m.m30 * w), ty = _mm256_set1_ps(m.m31 * w), tz = _mm256_set1_ps(m.m32 * w);
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const float32* in = src[i].data;
+				float32* out = dst[i].data;
+
+				const __m256 v03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 0)), _mm_loadu_ps(in + 12), 1);
+				const __m256 v14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 4)), _mm_loadu_ps(in + 16), 1);
+				const __m256 v25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 8)), _mm_loadu_ps(in + 20), 1);
+
+				const __m256 xy = _mm256_shuffle_ps(v14, v25, _MM_SHUFFLE(2, 1, 3, 2));
+				const __m256 yz = _mm256_shuffle_ps(v03, v14, _MM_SHUFFLE(1, 0, 2, 1));
+				const __m256 x = _mm256_shuffle_ps(v03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+				const __m256 y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+				const __m256 z = _mm256_shuffle_ps(yz, v25, _MM_SHUFFLE(3, 0, 3, 1));
+
+				const __m256 ox = _mm256_fmadd_ps(x, m00, _mm256_fmadd_ps(y, m10, _mm256_fmadd_ps(z, m20, tx)));
+				const __m256 oy = _mm256_fmadd_ps(x, m01, _mm256_fmadd_ps(y, m11, _mm256_fmadd_ps(z, m21, ty)));
+				const __m256 oz = _mm256_fmadd_ps(x, m02, _mm256_fmadd_ps(y, m12, _mm256_fmadd_ps(z, m22, tz)));
+
+				const __m256 rxy = _mm256_shuffle_ps(ox, oy, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m256 ryz = _mm256_shuffle_ps(oy, oz, _MM_SHUFFLE(3, 1, 3, 1));
+				const __m256 rzx = _mm256_shuffle_ps(oz, ox, _MM_SHUFFLE(3, 1, 2, 0));
+
+				const __m256 r03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m256 r14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+				const __m256 r25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+				if (stream)
+				{
+					_mm_stream_ps(out + 0, _mm256_castps256_ps128(r03));
+					_mm_stream_ps(out + 4, _mm256_castps256_ps128(r14));
+					_mm_stream_ps(out + 8, _mm256_castps256_ps128(r25));
+					_mm_stream_ps(out + 12, _mm256_extractf128_ps(r03, 1));
+					_mm_stream_ps(out + 16, _mm256_extractf128_ps(r14, 1));
+					_mm_stream_ps(out + 20, _mm256_extractf128_ps(r25, 1));
+				}
+				else
+				{
+					_mm_storeu_ps(out + 0, _mm256_castps256_ps128(r03));
+					_mm_storeu_ps(out + 4, _mm256_castps256_ps128(r14));
+					_mm_storeu_ps(out + 8, _mm256_castps256_ps128(r25));
+					_mm_storeu_ps(out + 12, _mm256_extractf128_ps(r03, 1));
+					_mm_storeu_ps(out + 16, _mm256_extractf128_ps(r14, 1));
+					_mm_storeu_ps(out + 20, _mm256_extractf128_ps(r25, 1));
+				}
+			}
+
+			_mm256_zeroupper();
+
+			if (stream)
+			{
+				_mm_sfence();
+			}
+
+			TransformScalar(m, src + i, dst + i, count - i, w, false);
+		}
+#endif
+
+		TransformKernel SelectTransformKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			if (cpu.avx2 && cpu.fma)
+				return TransformAVX2;
+
+			return TransformSSE;
+#else
+			return TransformScalar;
+#endif
+		}
+
+		void Transform(const Matrix4x4& matrix, const Vector3* src, Vector3* dst, size_t count, float32 w, bool stream) noexcept
+		{
+			static const TransformKernel kernel = SelectTransformKernel();
+			kernel(matrix, src, dst, count, w, stream);
+		}
+	}
+
+	void TransformPoints(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output)
+	{
+		if (output.size() < input.size())
+			throw Error::OutOfRange{ "TransformPoints(Matrix4x4,span,span)" };
+
+		Transform(matrix, input.data(), output.data(), input.size(), 1.f, false);
+	}
+
+	void TransformPoints(const Matrix4x4& matrix, const Array<Vector3>& input, std::span<Vector3> output)
+	{
+		TransformPoints(matrix, std::span<const Vector3>{ input.data(), input.size() }, output);
+	}
+
+	void TransformPoints(const Matrix4x4& matrix, std::span<Vector3> points) noexcept
+	{
+		Transform(matrix, points.data(), points.data(), points.size(), 1.f, false);
+	}
+
+	void TransformDirections(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output)
+	{
+		if (output.size() < input.size())
+			throw Error::OutOfRange{ "TransformDirections(Matrix4x4,span,span)" };
+
+		Transform(matrix, input.data(), output.data(), input.size(), 0.f, false);
+	}
+
+	void TransformDirections(const Matrix4x4& matrix, const Array<Vector3>& input, std::span<Vector3> output)
+	{
+		TransformDirections(matrix, std::span<const Vector3>{ input.data(), input.size() }, output);
+	}
+
+	void TransformDirections(const Matrix4x4& matrix, std::span<Vector3> directions) noexcept
+	{
+		Transform(matrix, directions.data(), directions.data(), directions.size(), 0.f, false);
+	}
+
+	void TransformPointsStream(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output)
+	{
+		if (output.size() < input.size())
+			throw Error::OutOfRange{ "TransformPointsStream(Matrix4x4,span,span)" };
+
+		Transform(matrix, input.data(), output.data(), input.size(), 1.f, true);
+	}
+
+	void TransformDirectionsStream(const Matrix4x4& matrix, std::span<const Vector3> input, std::span<Vector3> output)
+	{
+		if (output.size() < input.size())
+			throw Error::OutOfRange{ "TransformDirectionsStream(Matrix4x4,span,span)" };
+
+		Transform(matrix, input.data(), output.data(), input.size(), 0.f, true);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,405 @@
+#include <Iris/Math/Frustum.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+#include <Iris/Common/Parallel.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	static_assert(sizeof(AABB) == sizeof(float32) * 6, "AABB must be tightly packed");
+	static_assert(sizeof(Sphere) == sizeof(float32) * 4, "Sphere must be tightly packed");
+
+	namespace
+	{
+		// Writes MaskWords(count) words; 'bounds' always starts on a 64-bound boundary
+		using AABBKernel = void(*)(const Frustum&, const AABB*, size_t, uint64*)noexcept;
+
+		using SphereKernel = void(*)(const Frustum&, const Sphere*, size_t, uint64*)noexcept;
+
+		template<class Bounds>
+		void CullScalar(const Frustum& frustum, const Bounds* bounds, size_t begin, size_t count, uint64* words) noexcept
+		{
+			for (size_t i = begin; i < count; ++i)
+			{
+				if (frustum.intersects(bounds[i]))
+					words[i / 64] |= uint64{ 1 } << (i % 64);
+			}
+		}
+
+		[[maybe_unused]] void CullAABBScalar(const Frustum& frustum, const AABB* bounds, size_t count, uint64* words) noexcept
+		{
+			std::fill_n(words, Frustum::MaskWords(count), uint64{ 0 });
+			CullScalar(frustum, bounds, 0, count, words);
+		}
+
+		[[maybe_unused]] void CullSphereScalar(const Frustum& frustum, const Sphere* bounds, size_t count, uint64* words) noexcept
+		{
+			std::fill_n(words, Frustum::MaskWords(count), uint64{ 0 });
+			CullScalar(frustum, bounds, 0, count, words);
+		}
+
+#if defined(IRIS_SIMD_X86)
+		// Each plane broadcast once: normal, |normal| and distance
+		struct PlaneLanes4
+		{
+			__m128 nx, ny, nz, ax, ay, az, d;
+		};
+
+		struct PlaneLanes8
+		{
+			__m256 nx, ny, nz, ax, ay, az, d;
+		};
+
+		void BroadcastPlanes(const Frustum& frustum, PlaneLanes4(&lanes)[6]) noexcept
+		{
+			for (size_t p = 0; p < 6; ++p)
+			{
+				const auto& plane = frustum.planes[p];
+				lanes[p] = PlaneLanes4
+				{
+					_mm_set1_ps(plane.normal.x), _mm_set1_ps(plane.normal.y), _mm_set1_ps(plane.normal.z),
+					_mm_set1_ps(Math::Abs(plane.normal.x)), _mm_set1_ps(Math::Abs(plane.normal.y)), _mm_set1_ps(Math::Abs(plane.normal.z)),
+					_mm_set1_ps(plane.distance)
+				};
+			}
+		}
+
+		void CullAABBSSE(const Frustum& frustum, const AABB* bounds, size_t count, uint64* words) noexcept
+		{
+			std::fill_n(words, Frustum::MaskWords(count), uint64{ 0 });
+
+			PlaneLanes4 lanes[6];
+			BroadcastPlanes(frustum, lanes);
+
+			const __m128 half = _mm_set1_ps(0.5f);
+
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32* base = bounds[i].min.data;
+
+				// (min.xyz, max.x) and (min.z, max.xyz) of four boxes, transposed to lanes
+				__m128 minX = _mm_loadu_ps(base + 0);
+				__m128 minY = _mm_loadu_ps(base + 6);
+				__m128 minZ = _mm_loadu_ps(base + 12);
+				__m128 maxX = _mm_loadu_ps(base + 18);
+				_MM_TRANSPOSE4_PS(minX, minY, minZ, maxX);
+
+				__m128 t0 = _mm_loadu_ps(base + 2);
+				__m128 t1 = _mm_loadu_ps(base + 8);
+				__m128 maxY = _mm_loadu_ps(base + 14);
+				__m128 maxZ = _mm_loadu_ps(base + 20);
+				_MM_TRANSPOSE4_PS(t0, t1, maxY, maxZ);
+
+				const __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+				const __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+				const __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+				const __m128 ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+				const __m128 ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+				const __m128 ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+				for (const auto& plane : lanes)
+				{
+					__m128 dist = _mm_add_ps(_mm_mul_ps(plane.nx, cx), plane.d);
+					dist = _mm_add_ps(dist, _mm_mul_ps(plane.ny, cy));
+					dist = _mm_add_ps(dist, _mm_mul_ps(plane.nz, cz));
+					dist = _mm_add_ps(dist, _mm_mul_ps(plane.ax, ex));
+					dist = _mm_add_ps(dist, _mm_mul_ps(plane.ay, ey));
+					dist = _mm_add_ps(dist, _mm_mul_ps(plane.az, ez));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, _mm_setzero_ps()));
+				}
+
+				words[i / 64] |= static_cast<uint64>(_mm_movemask_ps(inside)) << (i % 64);
+			}
+
+			CullScalar(frustum, bounds, i, count, words);
+		}
+
+		void CullSphereSSE(const Frustum& frustum, const Sphere* bounds, size_t count, uint64* words) noexcept
+		{
+			std::fill_n(words, Frustum::MaskWords(count), uint64{ 0 });
+
+			PlaneLanes4 lanes[6];
+			BroadcastPlanes(frustum, lanes);
+
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32* base = bounds[i].center.data;
+
+				__m128 cx = _mm_loadu_ps(base + 0);
+				__m128 cy = _mm_loadu_ps(base + 4);
+				__m128 cz = _mm_loadu_ps(base + 8);
+				__m128 r = _mm_loadu_ps(base + 12);
+				_MM_TRANSPOSE4_PS(cx, cy, cz, r);
+
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+				for (const auto& plane : lanes)
+				{
+					__m128 dist = _mm_add_ps(_mm_mul_ps(plane.nx, cx), _mm_add_ps(plane.d, r));
+					dist = _mm_add_ps(dist, _mm_mul_ps(plane.ny, cy));
+					dist = _mm_add_ps(dist, _mm_mul_ps(plane.nz, cz));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, _mm_setzero_ps()));
+				}
+
+				words[i / 64] |= static_cast<uint64>(_mm_movemask_ps(inside)) << (i % 64);
+			}
+
+			CullScalar(frustum, bounds, i, count, words);
+		}
+
+		IRIS_TARGET_AVX2 void BroadcastPlanes(const Frustum& frustum, PlaneLanes8(&lanes)[6]) noexcept
+		{
+			for (size_t p = 0; p < 6; ++p)
+			{
+				const auto& plane = frustum.planes[p];
+				lanes[p] = PlaneLanes8
+				{
+					_mm256_set1_ps(plane.normal.x), _mm256_set1_ps(plane.normal.y), _mm256_set1_ps(plane.normal.z),
+					_mm256_set1_ps(Math::Abs(plane.normal.x)), _mm256_set1_ps(Math::Abs(plane.normal.y)), _mm256_set1_ps(Math::Abs(plane.normal.z)),
+					_mm256_set1_ps(plane.distance)
+				};
+			}
+		}
+
+		// Bounds k and k + 4 share a register so the in-lane transpose keeps lane order
+		IRIS_TARGET_AVX2 inline __m256 Load2(const float32* low, const float32* high) noexcept
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+		}
+
+		IRIS_TARGET_AVX2 inline void Transpose(__m256& a, __m256& b, __m256& c, __m256& d) noexcept
+		{
+			const __m256 t0 = _mm256_unpacklo_ps(a, b);
+			const __m256 t1 = _mm256_unpacklo_ps(c, d);
+			const __m256 t2 = _mm256_unpackhi_ps(a, b);
+			const __m256 t3 = _mm256_unpackhi_ps(c, d);
+			a = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+			b = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+			c = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+			d = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+		}
+
+		IRIS_TARGET_AVX2 void CullAABBAVX2(const Frustum& frustum, const AABB* bounds, size_t count, uint64* words) noexcept
+		{
+			std::fill_n(words, Frustum::MaskWords(count), uint64{ 0 });
+
+			PlaneLanes8 lanes[6];
+			BroadcastPlanes(frustum, lanes);
+
+			const __m256 half = _mm256_set1_ps(0.5f);
+
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const float32* base = bounds[i].min.data;
+
+				__m256 minX = Load2(base + 0, base + 24);
+				__m256 minY = Load2(base + 6, base + 30);
+				__m256 minZ = Load2(base + 12, base + 36);
+				__m256 maxX = Load2(base + 18, base + 42);
+				Transpose(minX, minY, minZ, maxX);
+
+				__m256 t0 = Load2(base + 2, base + 26);
+				__m256 t1 = Load2(base + 8, base + 32);
+				__m256 maxY = Load2(base + 14, base + 38);
+				__m256 maxZ = Load2(base + 20, base + 44);
+				Transpose(t0, t1, maxY, maxZ);
+
+				const __m256 cx = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+				const __m256 cy = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+				const __m256 cz = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+				const __m256 ex = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+				const __m256 ey = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+				const __m256 ez = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+				__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+				for (const auto& plane : lanes)
+				{
+					__m256 dist = _mm256_fmadd_ps(plane.nx, cx, plane.d);
+					dist = _mm256_fmadd_ps(plane.ny, cy, dist);
+					dist = _mm256_fmadd_ps(plane.nz, cz, dist);
+					dist = _mm256_fmadd_ps(plane.ax, ex, dist);
+					dist = _mm256_fmadd_ps(plane.ay, ey, dist);
+					dist = _mm256_fmadd_ps(plane.az, ez, dist);
+					inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, _mm256_setzero_ps(), _CMP_GE_OQ));
+				}
+
+				words[i / 64] |= static_cast<uint64>(_mm256_movemask_ps(inside)) << (i % 64);
+			}
+
+			_mm256_zeroupper();
+
+			CullScalar(frustum, bounds, i, count, words);
+		}
+
+		IRIS_TARGET_AVX2 void CullSphereAVX2(const Frustum& frustum, const Sphere* bounds, size_t count, uint64* words) noexcept
+		{
+			std::fill_n(words, Frustum::MaskWords(count), uint64{ 0 });
+
+			PlaneLanes8 lanes[6];
+			BroadcastPlanes(frustum, lanes);
+
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const float32* base = bounds[i].center.data;
+
+				__m256 cx = Load2(base + 0, base + 16);
+				__m256 cy = Load2(base + 4, base + 20);
+				__m256 cz = Load2(base + 8, base + 24);
+				__m256 r = Load2(base + 12, base + 28);
+				Transpose(cx, cy, cz, r);
+
+				__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+				for (const auto& plane : lanes)
+				{
+					__m256 dist = _mm256_fmadd_ps(plane.nx, cx, _mm256_add_ps(plane.d, r));
+					dist = _mm256_fmadd_ps(plane.ny, cy, dist);
+					dist = _mm256_fmadd_ps(plane.nz, cz, dist);
+					inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, _mm256_setzero_ps(), _CMP_GE_OQ));
+				}
+
+				words[i / 64] |= static_cast<uint64>(_mm256_movemask_ps(inside)) << (i % 64);
+			}
+
+			_mm256_zeroupper();
+
+			CullScalar(frustum, bounds, i, count, words);
+		}
+#endif
+
+		AABBKernel SelectAABBKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			if (cpu.avx2 && cpu.fma)
+				return CullAABBAVX2;
+
+			return CullAABBSSE;
+#else
+			return CullAABBScalar;
+#endif
+		}
+
+		SphereKernel SelectSphereKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			if (cpu.avx2 && cpu.fma)
+				return CullSphereAVX2;
+
+			return CullSphereSSE;
+#else
+			return CullSphereScalar;
+#endif
+		}
+
+		size_t CountVisible(const uint64* words, size_t wordCount) noexcept
+		{
+			size_t visible = 0;
+
+			for (size_t w = 0; w < wordCount; ++w)
+			{
+				visible += static_cast<size_t>(std::popcount(words[w]));
+			}
+
+			return visible;
+		}
+
+		// Below this many bounds per thread the spawn cost outweighs the work
+		constexpr size_t MinBoundsPerThread = 16384;
+
+		template<class Bounds, class Kernel>
+		size_t CullRange(const Frustum& frustum, std::span<const Bounds> bounds, std::span<uint64> visibility, size_t threadCount, Kernel kernel, const char* name)
+		{
+			const auto wordCount = Frustum::MaskWords(bounds.size());
+
+			if (visibility.size() < wordCount)
+				throw Error::OutOfRange{ name };
+
+			if (threadCount == 0)
+				threadCount = Max<size_t>(std::thread::hardware_concurrency(), 1);
+
+			threadCount = Min(threadCount, Max<size_t>(bounds.size() / MinBoundsPerThread, 1));
+
+			const auto wordsPerThread = (wordCount + threadCount - 1) / threadCount;
+
+			const auto run = [&](size_t t)
+			{
+				const auto firstWord = Min(t * wordsPerThread, wordCount);
+				const auto lastWord = Min(firstWord + wordsPerThread, wordCount);
+				const auto first = firstWord * 64;
+				const auto last = Min(lastWord * 64, bounds.size());
+
+				if (first < last)
+					kernel(frustum, bounds.data() + first, last - first, visibility.data() + firstWord);
+			};
+
+			ParallelFor(threadCount, run);
+
+			return CountVisible(visibility.data(), wordCount);
+		}
+	}
+
+	size_t Frustum::cull(std::span<const AABB> _bounds, std::span<uint64> _visibility) const
+	{
+		static const AABBKernel kernel = SelectAABBKernel();
+		return CullRange(*this, _bounds, _visibility, 1, kernel, "Frustum::cull(span<const AABB>,span<uint64>)const");
+	}
+
+	size_t Frustum::cull(std::span<const Sphere> _bounds, std::span<uint64> _visibility) const
+	{
+		static const SphereKernel kernel = SelectSphereKernel();
+		return CullRange(*this, _bounds, _visibility, 1, kernel, "Frustum::cull(span<const Sphere>,span<uint64>)const");
+	}
+
+	size_t Frustum::cullParallel(std::span<const AABB> _bounds, std::span<uint64> _visibility, size_t _threadCount) const
+	{
+		static const AABBKernel kernel = SelectAABBKernel();
+		return CullRange(*this, _bounds, _visibility, _threadCount, kernel, "Frustum::cullParallel(span<const AABB>,span<uint64>,size_t)const");
+	}
+
+	size_t Frustum::cullParallel(std::span<const Sphere> _bounds, std::span<uint64> _visibility, size_t _threadCount) const
+	{
+		static const SphereKernel kernel = SelectSphereKernel();
+		return CullRange(*this, _bounds, _visibility, _threadCount, kernel, "Frustum::cullParallel(span<const Sphere>,span<uint64>,size_t)const");
+	}
+
+	Frustum Frustum::FromViewProjection(const Matrix4x4& viewProjection) noexcept
+	{
+		const auto& m = viewProjection;
+
+		// Clip-space coordinate j is the dot product with column j
+		const Plane c0{ Vector3{ m.m00,m.m10,m.m20 },m.m30 };
+		const Plane c1{ Vector3{ m.m01,m.m11,m.m21 },m.m31 };
+		const Plane c2{ Vector3{ m.m02,m.m12,m.m22 },m.m32 };
+		const Plane c3{ Vector3{ m.m03,m.m13,m.m23 },m.m33 };
+
+		Frustum result;
+		result.planes[Left] = Plane{ c3.normal + c0.normal,c3.distance + c0.distance }.normalize();
+		result.planes[Right] = Plane{ c3.normal - c0.normal,c3.distance - c0.distance }.normalize();
+		result.planes[Bottom] = Plane{ c3.normal + c1.normal,c3.distance + c1.distance }.normalize();
+		result.planes[Top] = Plane{ c3.normal - c1.normal,c3.distance - c1.distance }.normalize();
+		result.planes[Near] = c2.normalize();
+		result.planes[Far] = Plane{ c3.normal - c2.normal,c3.distance - c2.distance }.normalize();
+		return result;
+	}
+}
\ No newline at end of file
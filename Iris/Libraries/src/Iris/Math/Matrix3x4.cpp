@@ -0,0 +1,219 @@
+#include <Iris/Math/Matrix3x4.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	static_assert(sizeof(Matrix3x4) == sizeof(float32) * 12, "Matrix3x4 must be 48 bytes");
+
+	namespace
+	{
+		[[maybe_unused]] Matrix3x4 MultiplyScalar(const Matrix3x4& left, const Matrix3x4& right) noexcept
+		{
+			Matrix3x4 result;
+
+			for (size_t r = 0; r < 3; ++r)
+			{
+				for (size_t c = 0; c < 4; ++c)
+				{
+					result.m[r][c] = right.m[r][0] * left.m[0][c] + right.m[r][1] * left.m[1][c] + right.m[r][2] * left.m[2][c];
+				}
+
+				result.m[r][3] += right.m[r][3];
+			}
+
+			return result;
+		}
+
+		[[maybe_unused]] bool InverseScalar(const Matrix3x4& m, Matrix3x4& result, bool rigid) noexcept
+		{
+			// Rows of the inverse 3x3 are the columns (b x c, c x a, a x b) / det
+			const Vector3 a{ m.m00,m.m01,m.m02 };
+			const Vector3 b{ m.m10,m.m11,m.m12 };
+			const Vector3 c{ m.m20,m.m21,m.m22 };
+
+			Vector3 bc = rigid ? a : b.cross(c);
+			Vector3 ca = rigid ? b : c.cross(a);
+			Vector3 ab = rigid ? c : a.cross(b);
+
+			if (!rigid)
+			{
+				const auto det = a.dot(bc);
+
+				if (det == 0.f)
+					return false;
+
+				const auto invDet = 1.f / det;
+				bc *= invDet;
+				ca *= invDet;
+				ab *= invDet;
+			}
+
+			const auto t = m.translation();
+
+			for (size_t i = 0; i < 3; ++i)
+			{
+				result.m[i][0] = bc.data[i];
+				result.m[i][1] = ca.data[i];
+				result.m[i][2] = ab.data[i];
+				result.m[i][3] = -(bc.data[i] * t.x + ca.data[i] * t.y + ab.data[i] * t.z);
+			}
+
+			return true;
+		}
+
+#if defined(IRIS_SIMD_X86)
+		inline __m128 Cross(__m128 a, __m128 b) noexcept
+		{
+			const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+			return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+		}
+
+		Matrix3x4 MultiplySSE(const Matrix3x4& left, const Matrix3x4& right) noexcept
+		{
+			const __m128 l0 = _mm_load_ps(left.m0);
+			const __m128 l1 = _mm_load_ps(left.m1);
+			const __m128 l2 = _mm_load_ps(left.m2);
+			const __m128 wMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+
+			Matrix3x4 result;
+
+			for (size_t r = 0; r < 3; ++r)
+			{
+				const __m128 row = _mm_load_ps(right.m[r]);
+
+				__m128 acc = _mm_and_ps(row, wMask);
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), l0));
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), l1));
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), l2));
+
+				_mm_store_ps(result.m[r], acc);
+			}
+
+			return result;
+		}
+
+		bool InverseSSE(const Matrix3x4& m, Matrix3x4& result, bool rigid) noexcept
+		{
+			const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+			const __m128 r0 = _mm_load_ps(m.m0);
+			const __m128 r1 = _mm_load_ps(m.m1);
+			const __m128 r2 = _mm_load_ps(m.m2);
+
+			const __m128 a = _mm_and_ps(r0, xyzMask);
+			const __m128 b = _mm_and_ps(r1, xyzMask);
+			const __m128 c = _mm_and_ps(r2, xyzMask);
+
+			__m128 bc = rigid ? a : Cross(b, c);
+			__m128 ca = rigid ? b : Cross(c, a);
+			__m128 ab = rigid ? c : Cross(a, b);
+
+			if (!rigid)
+			{
+				const __m128 prod = _mm_mul_ps(a, bc);
+				const float32 det = _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(prod, _mm_shuffle_ps(prod, prod, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(prod, prod)));
+
+				if (det == 0.f)
+					return false;
+
+				const __m128 invDet = _mm_set1_ps(1.f / det);
+				bc = _mm_mul_ps(bc, invDet);
+				ca = _mm_mul_ps(ca, invDet);
+				ab = _mm_mul_ps(ab, invDet);
+			}
+
+			__m128 t = _mm_mul_ps(_mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3)), bc);
+			t = _mm_add_ps(t, _mm_mul_ps(_mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3)), ca));
+			t = _mm_add_ps(t, _mm_mul_ps(_mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3)), ab));
+			t = _mm_sub_ps(_mm_setzero_ps(), t);
+
+			_MM_TRANSPOSE4_PS(bc, ca, ab, t);
+
+			_mm_store_ps(result.m0, bc);
+			_mm_store_ps(result.m1, ca);
+			_mm_store_ps(result.m2, ab);
+
+			return true;
+		}
+#endif
+
+		inline Matrix3x4 MultiplyKernel(const Matrix3x4& left, const Matrix3x4& right) noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			return MultiplySSE(left, right);
+#else
+			return MultiplyScalar(left, right);
+#endif
+		}
+
+		inline bool InverseKernel(const Matrix3x4& m, Matrix3x4& result, bool rigid) noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			return InverseSSE(m, result, rigid);
+#else
+			return InverseScalar(m, result, rigid);
+#endif
+		}
+	}
+
+	Matrix3x4 Matrix3x4::inverse() const
+	{
+		Matrix3x4 result;
+
+		if (!InverseKernel(*this, result, false))
+		{
+			return Matrix3x4::Identity();
+		}
+
+		return result;
+	}
+
+	Matrix3x4 Matrix3x4::inverseRigid() const noexcept
+	{
+		Matrix3x4 result;
+		InverseKernel(*this, result, true);
+		return result;
+	}
+
+	Matrix3x4 Matrix3x4::FromMatrix4x4(const Matrix4x4& matrix) noexcept
+	{
+#if defined(IRIS_SIMD_X86)
+		__m128 r0 = _mm_load_ps(matrix.m0);
+		__m128 r1 = _mm_load_ps(matrix.m1);
+		__m128 r2 = _mm_load_ps(matrix.m2);
+		__m128 r3 = _mm_load_ps(matrix.m3);
+
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+		Matrix3x4 result;
+		_mm_store_ps(result.m0, r0);
+		_mm_store_ps(result.m1, r1);
+		_mm_store_ps(result.m2, r2);
+		return result;
+#else
+		return Matrix3x4
+		{
+			matrix.m00,matrix.m10,matrix.m20,matrix.m30,
+			matrix.m01,matrix.m11,matrix.m21,matrix.m31,
+			matrix.m02,matrix.m12,matrix.m22,matrix.m32
+		};
+#endif
+	}
+
+	Matrix3x4 operator*(const Matrix3x4& left, const Matrix3x4& right) noexcept
+	{
+		return MultiplyKernel(left, right);
+	}
+
+	Matrix3x4& operator*=(Matrix3x4& left, const Matrix3x4& right) noexcept
+	{
+		left = left * right;
+		return left;
+	}
+}
\ No newline at end of file
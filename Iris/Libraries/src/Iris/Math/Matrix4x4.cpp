@@ -1,263 +1,546 @@
 #include <Iris/Math/Matrix4x4.hpp>
 #include <Iris/Math/Vector3.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#include <cassert>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
 
 namespace Iris
 {
-	float32 Matrix4x4::determinant() const noexcept
+	namespace
 	{
-		
-		return m00 * m11 * m22 * m33 + m00 * m12 * m23 * m31 + m00 * m13 * m21 * m32
-			 + m01 * m10 * m23 * m32 + m01 * m12 * m20 * m33 + m01 * m13 * m22 * m30
-			 + m02 * m10 * m21 * m33 + m02 * m11 * m23 * m30 + m02 * m13 * m20 * m31
-			 + m03 * m10 * m22 * m31 + m03 * m11 * m20 * m32 + m03 * m12 * m21 * m30
-			 - m00 * m11 * m23 * m32 - m00 * m12 * m21 * m33 - m00 * m13 * m22 * m31
-			 - m01 * m10 * m22 * m33 - m01 * m12 * m23 * m30 - m01 * m13 * m20 * m32
-			 - m02 * m10 * m23 * m31 - m02 * m11 * m20 * m33 - m02 * m13 * m21 * m30
-			 - m03 * m10 * m21 * m32 - m03 * m11 * m22 * m30 - m03 * m12 * m20 * m31;
-	}
+		using MultiplyKernel = Matrix4x4(*)(const Matrix4x4&, const Matrix4x4&)noexcept;
 
-	Matrix4x4 Matrix4x4::adjoint() const
-	{
-		Matrix4x4 adjoint{};
-
-		adjoint.m[0][0] = m[1][1] * m[2][2] * m[3][3] + m[1][2] * m[2][3] * m[3][1] + m[1][3] * m[2][1] * m[3][2] - m[1][1] * m[2][3] * m[3][2] - m[1][2] * m[2][1] * m[3][3] - m[1][3] * m[2][2] * m[3][1];
-		adjoint.m[0][1] = m[0][1] * m[2][3] * m[3][2] + m[0][2] * m[2][1] * m[3][3] + m[0][3] * m[2][2] * m[3][1] - m[0][1] * m[2][2] * m[3][3] - m[0][2] * m[2][3] * m[3][1] - m[0][3] * m[2][1] * m[3][2];
-		adjoint.m[0][2] = m[0][1] * m[1][2] * m[3][3] + m[0][2] * m[1][3] * m[3][1] + m[0][3] * m[1][1] * m[3][2] - m[0][1] * m[1][3] * m[3][2] - m[0][2] * m[1][1] * m[3][3] - m[0][3] * m[1][2] * m[3][1];
-		adjoint.m[0][3] = m[0][1] * m[1][3] * m[2][2] + m[0][2] * m[1][1] * m[2][3] + m[0][3] * m[1][2] * m[2][1] - m[0][1] * m[1][2] * m[2][3] - m[0][2] * m[1][3] * m[2][1] - m[0][3] * m[1][1] * m[2][2];
-
-		adjoint.m[1][0] = m[1][0] * m[2][3] * m[3][2] + m[1][2] * m[2][0] * m[3][3] + m[1][3] * m[2][2] * m[3][0] - m[1][0] * m[2][2] * m[3][3] - m[1][2] * m[2][3] * m[3][0] - m[1][3] * m[2][0] * m[3][2];
-		adjoint.m[1][1] = m[0][0] * m[2][2] * m[3][3] + m[0][2] * m[2][3] * m[3][0] + m[0][1] * m[2][0] * m[3][2] - m[0][0] * m[2][3] * m[3][2] - m[0][2] * m[2][0] * m[3][3] - m[0][3] * m[2][2] * m[3][0];
-		adjoint.m[1][2] = m[0][0] * m[1][3] * m[3][2] + m[0][2] * m[1][0] * m[3][3] + m[0][3] * m[1][2] * m[3][0] - m[0][0] * m[1][2] * m[3][3] - m[0][2] * m[1][3] * m[3][0] - m[0][3] * m[1][0] * m[3][2];
-		adjoint.m[1][3] = m[0][0] * m[1][2] * m[2][3] + m[0][2] * m[1][3] * m[2][0] + m[0][3] * m[1][0] * m[2][2] - m[0][0] * m[1][3] * m[2][2] - m[0][2] * m[1][0] * m[2][3] - m[0][3] * m[1][2] * m[2][0];
-
-		adjoint.m[2][0] = m[1][0] * m[2][1] * m[3][3] + m[1][1] * m[2][3] * m[3][0] + m[1][3] * m[2][0] * m[3][1] - m[1][0] * m[2][3] * m[3][1] - m[1][1] * m[2][0] * m[3][3] - m[1][3] * m[2][1] * m[3][0];
-		adjoint.m[2][1] = m[0][0] * m[2][3] * m[3][1] + m[0][1] * m[2][0] * m[3][3] + m[0][3] * m[2][1] * m[3][0] - m[0][0] * m[2][1] * m[3][3] - m[0][1] * m[2][3] * m[3][0] - m[0][3] * m[2][0] * m[3][1];
-		adjoint.m[2][2] = m[0][0] * m[1][1] * m[3][3] + m[0][1] * m[1][3] * m[3][0] + m[0][3] * m[1][0] * m[3][1] - m[0][0] * m[1][3] * m[3][1] - m[0][1] * m[1][0] * m[3][3] - m[0][3] * m[1][1] * m[3][0];
-		adjoint.m[2][3] = m[0][0] * m[1][3] * m[2][1] + m[0][1] * m[1][0] * m[2][3] + m[0][3] * m[1][1] * m[2][0] - m[0][0] * m[1][1] * m[2][3] - m[0][1] * m[1][3] * m[2][0] - m[0][3] * m[1][0] * m[2][1];
-		
-		adjoint.m[3][0] = m[1][0] * m[2][2] * m[3][1] + m[1][1] * m[2][0] * m[3][2] + m[1][2] * m[2][1] * m[3][0] - m[1][0] * m[2][1] * m[3][2] - m[1][1] * m[2][2] * m[3][0] - m[1][2] * m[2][0] * m[3][1];
-		adjoint.m[3][1] = m[0][0] * m[2][1] * m[3][2] + m[0][1] * m[2][2] * m[3][0] + m[0][2] * m[2][0] * m[3][1] - m[0][0] * m[2][2] * m[3][1] - m[0][1] * m[2][0] * m[3][2] - m[0][2] * m[2][1] * m[3][0];
-		adjoint.m[3][2] = m[0][0] * m[1][2] * m[3][1] + m[0][1] * m[1][0] * m[3][2] + m[0][2] * m[1][1] * m[3][0] - m[0][0] * m[1][1] * m[3][2] - m[0][1] * m[1][2] * m[3][0] - m[0][2] * m[1][0] * m[3][1];
-		adjoint.m[3][3] = m[0][0] * m[1][1] * m[2][2] + m[0][1] * m[1][2] * m[2][0] + m[0][2] * m[1][0] * m[2][1] - m[0][0] * m[1][2] * m[2][1] - m[0][1] * m[1][0] * m[2][2] - m[0][2] * m[1][1] * m[2][0];
-
-		return adjoint;
-	}
+		using ScaleKernel = Matrix4x4(*)(const Matrix4x4&, float32)noexcept;
 
-	Matrix4x4 Matrix4x4::transpose() const noexcept
-	{
-		Matrix4x4 result;
+		[[maybe_unused]] Matrix4x4 MultiplyScalar(const Matrix4x4& left, const Matrix4x4& right) noexcept
+		{
+			Matrix4x4 result{};
 
-		result.m[0][1] = m[1][0];
-		result.m[0][2] = m[2][0];
-		result.m[0][3] = m[3][0];
+			result.m00 = left.m00 * right.m00 + left.m01 * right.m10 + left.m02 * right.m20 + left.m03 * right.m30;
+			result.m01 = left.m00 * right.m01 + left.m01 * right.m11 + left.m02 * right.m21 + left.m03 * right.m31;
+			result.m02 = left.m00 * right.m02 + left.m01 * right.m12 + left.m02 * right.m22 + left.m03 * right.m32;
+			result.m03 = left.m00 * right.m03 + left.m01 * right.m13 + left.m02 * right.m23 + left.m03 * right.m33;
 
-		result.m[1][0] = m[0][1];
-		result.m[1][2] = m[2][1];
-		result.m[1][3] = m[3][1];
+			result.m10 = left.m10 * right.m00 + left.m11 * right.m10 + left.m12 * right.m20 + left.m13 * right.m30;
+			result.m11 = left.m10 * right.m01 + left.m11 * right.m11 + left.m12 * right.m21 + left.m13 * right.m31;
+			result.m12 = left.m10 * right.m02 + left.m11 * right.m12 + left.m12 * right.m22 + left.m13 * right.m32;
+			result.m13 = left.m10 * right.m03 + left.m11 * right.m13 + left.m12 * right.m23 + left.m13 * right.m33;
 
-		result.m[2][0] = m[0][2];
-		result.m[2][1] = m[1][2];
-		result.m[2][3] = m[3][2];
+			result.m20 = left.m20 * right.m00 + left.m21 * right.m10 + left.m22 * right.m20 + left.m23 * right.m30;
+			result.m21 = left.m20 * right.m01 + left.m21 * right.m11 + left.m22 * right.m21 + left.m23 * right.m31;
+			result.m22 = left.m20 * right.m02 + left.m21 * right.m12 + left.m22 * right.m22 + left.m23 * right.m32;
+			result.m23 = left.m20 * right.m03 + left.m21 * right.m13 + left.m22 * right.m23 + left.m23 * right.m33;
 
-		result.m[3][0] = m[0][3];
-		result.m[3][1] = m[1][3];
-		result.m[3][2] = m[2][3];
+			result.m30 = left.m30 * right.m00 + left.m31 * right.m10 + left.m32 * right.m20 + left.m33 * right.m30;
+			result.m31 = left.m30 * right.m01 + left.m31 * right.m11 + left.m32 * right.m21 + left.m33 * right.m31;
+			result.m32 = left.m30 * right.m02 + left.m31 * right.m12 + left.m32 * right.m22 + left.m33 * right.m32;
+			result.m33 = left.m30 * right.m03 + left.m31 * right.m13 + left.m32 * right.m23 + left.m33 * right.m33;
 
-		return result;
-	}
+			return result;
+		}
 
-	Matrix4x4 Matrix4x4::inverse() const
-	{
-		const auto det = determinant();
+		[[maybe_unused]] Matrix4x4 ScaleScalar(const Matrix4x4& left, float32 right) noexcept
+		{
+			Matrix4x4 result;
+
+			for (size_t i = 0; i < 16; ++i)
+			{
+				result.data[i] = left.data[i] * right;
+			}
+
+			return result;
+		}
 
-		if (det == 0.f)
+		// Shares the twelve 2x2 sub-determinants of rows {0,1} and rows {2,3}
+		// between the determinant and every cofactor
+		Matrix4x4 AdjugateScalar(const Matrix4x4& m, float32& det) noexcept
 		{
-			return Matrix4x4::Identity();
+			const auto s0 = m.m00 * m.m11 - m.m10 * m.m01;
+			const auto s1 = m.m00 * m.m12 - m.m10 * m.m02;
+			const auto s2 = m.m00 * m.m13 - m.m10 * m.m03;
+			const auto s3 = m.m01 * m.m12 - m.m11 * m.m02;
+			const auto s4 = m.m01 * m.m13 - m.m11 * m.m03;
+			const auto s5 = m.m02 * m.m13 - m.m12 * m.m03;
+
+			const auto c0 = m.m20 * m.m31 - m.m30 * m.m21;
+			const auto c1 = m.m20 * m.m32 - m.m30 * m.m22;
+			const auto c2 = m.m20 * m.m33 - m.m30 * m.m23;
+			const auto c3 = m.m21 * m.m32 - m.m31 * m.m22;
+			const auto c4 = m.m21 * m.m33 - m.m31 * m.m23;
+			const auto c5 = m.m22 * m.m33 - m.m32 * m.m23;
+
+			det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+			return Matrix4x4
+			{
+				 m.m11 * c5 - m.m12 * c4 + m.m13 * c3,
+				-m.m01 * c5 + m.m02 * c4 - m.m03 * c3,
+				 m.m31 * s5 - m.m32 * s4 + m.m33 * s3,
+				-m.m21 * s5 + m.m22 * s4 - m.m23 * s3,
+
+				-m.m10 * c5 + m.m12 * c2 - m.m13 * c1,
+				 m.m00 * c5 - m.m02 * c2 + m.m03 * c1,
+				-m.m30 * s5 + m.m32 * s2 - m.m33 * s1,
+				 m.m20 * s5 - m.m22 * s2 + m.m23 * s1,
+
+				 m.m10 * c4 - m.m11 * c2 + m.m13 * c0,
+				-m.m00 * c4 + m.m01 * c2 - m.m03 * c0,
+				 m.m30 * s4 - m.m31 * s2 + m.m33 * s0,
+				-m.m20 * s4 + m.m21 * s2 - m.m23 * s0,
+
+				-m.m10 * c3 + m.m11 * c1 - m.m12 * c0,
+				 m.m00 * c3 - m.m01 * c1 + m.m02 * c0,
+				-m.m30 * s3 + m.m31 * s1 - m.m32 * s0,
+				 m.m20 * s3 - m.m21 * s1 + m.m22 * s0
+			};
 		}
 
-		const auto adj = adjoint();
+		[[maybe_unused]] bool InverseScalar(const Matrix4x4& m, Matrix4x4& result) noexcept
+		{
+			float32 det;
+			const auto adj = AdjugateScalar(m, det);
 
-		return adj * (1.f / det);
-	}
+			if (det == 0.f)
+				return false;
 
-	Matrix4x4 Matrix4x4::Translate(const Vector3& vector) noexcept
-	{
-		Matrix4x4 result{};
+			result = ScaleScalar(adj, 1.f / det);
+			return true;
+		}
 
-		result.m[3][0] = vector.x;
-		result.m[3][1] = vector.y;
-		result.m[3][2] = vector.z;
+		// The upper 3x3 is inverted and the translation row becomes -t * inverse(R)
+		[[maybe_unused]] bool InverseAffineScalar(const Matrix4x4& m, Matrix4x4& result, bool rigid) noexcept
+		{
+			Matrix4x4 rotation
+			{
+				m.m00, m.m10, m.m20, 0.f,
+				m.m01, m.m11, m.m21, 0.f,
+				m.m02, m.m12, m.m22, 0.f,
+				0.f, 0.f, 0.f, 1.f
+			};
+
+			if (!rigid)
+			{
+				const auto c00 = m.m11 * m.m22 - m.m12 * m.m21;
+				const auto c01 = m.m12 * m.m20 - m.m10 * m.m22;
+				const auto c02 = m.m10 * m.m21 - m.m11 * m.m20;
+
+				const auto det = m.m00 * c00 + m.m01 * c01 + m.m02 * c02;
+
+				if (det == 0.f)
+					return false;
+
+				const auto invDet = 1.f / det;
+
+				rotation.m00 = c00 * invDet;
+				rotation.m01 = (m.m02 * m.m21 - m.m01 * m.m22) * invDet;
+				rotation.m02 = (m.m01 * m.m12 - m.m02 * m.m11) * invDet;
+
+				rotation.m10 = c01 * invDet;
+				rotation.m11 = (m.m00 * m.m22 - m.m02 * m.m20) * invDet;
+				rotation.m12 = (m.m02 * m.m10 - m.m00 * m.m12) * invDet;
+
+				rotation.m20 = c02 * invDet;
+				rotation.m21 = (m.m01 * m.m20 - m.m00 * m.m21) * invDet;
+				rotation.m22 = (m.m00 * m.m11 - m.m01 * m.m10) * invDet;
+			}
+
+			rotation.m30 = -(m.m30 * rotation.m00 + m.m31 * rotation.m10 + m.m32 * rotation.m20);
+			rotation.m31 = -(m.m30 * rotation.m01 + m.m31 * rotation.m11 + m.m32 * rotation.m21);
+			rotation.m32 = -(m.m30 * rotation.m02 + m.m31 * rotation.m12 + m.m32 * rotation.m22);
+
+			result = rotation;
+			return true;
+		}
 
-		return result;
-	}
+		[[maybe_unused]] bool IsOrthonormal(const Matrix4x4& m, float32 tolerance) noexcept
+		{
+			const Vector3 x{ m.m00, m.m01, m.m02 };
+			const Vector3 y{ m.m10, m.m11, m.m12 };
+			const Vector3 z{ m.m20, m.m21, m.m22 };
+
+			return Math::Abs(x.lengthSq() - 1.f) <= tolerance
+				&& Math::Abs(y.lengthSq() - 1.f) <= tolerance
+				&& Math::Abs(z.lengthSq() - 1.f) <= tolerance
+				&& Math::Abs(x.dot(y)) <= tolerance
+				&& Math::Abs(y.dot(z)) <= tolerance
+				&& Math::Abs(z.dot(x)) <= tolerance;
+		}
 
-	Matrix4x4 Matrix4x4::RotateX(float32 radian)
-	{
-		const auto cos = Math::Cos(radian);
-		const auto sin = Math::Sin(radian);
+#if defined(IRIS_SIMD_X86)
+		Matrix4x4 MultiplySSE(const Matrix4x4& left, const Matrix4x4& right) noexcept
+		{
+			const __m128 r0 = _mm_load_ps(right.m0);
+			const __m128 r1 = _mm_load_ps(right.m1);
+			const __m128 r2 = _mm_load_ps(right.m2);
+			const __m128 r3 = _mm_load_ps(right.m3);
 
-		return Matrix4x4
+			Matrix4x4 result;
+
+			for (size_t i = 0; i < 4; ++i)
+			{
+				const __m128 row = _mm_load_ps(left.m[i]);
+
+				__m128 acc = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+
+				_mm_store_ps(result.m[i], acc);
+			}
+
+			return result;
+		}
+
+		Matrix4x4 ScaleSSE(const Matrix4x4& left, float32 right) noexcept
 		{
-			1.f,0.f,0.f,0.f,
-			0.f,cos,sin,0.f,
-			0.f,-sin,cos,0.f,
-			0.f,0.f,0.f,1.f
-		};
-	}
+			const __m128 s = _mm_set1_ps(right);
 
-	Matrix4x4 Matrix4x4::RotateY(float32 radian)
-	{
-		const auto cos = Math::Cos(radian);
-		const auto sin = Math::Sin(radian);
+			Matrix4x4 result;
 
-		return Matrix4x4
+			_mm_store_ps(result.m0, _mm_mul_ps(_mm_load_ps(left.m0), s));
+			_mm_store_ps(result.m1, _mm_mul_ps(_mm_load_ps(left.m1), s));
+			_mm_store_ps(result.m2, _mm_mul_ps(_mm_load_ps(left.m2), s));
+			_mm_store_ps(result.m3, _mm_mul_ps(_mm_load_ps(left.m3), s));
+
+			return result;
+		}
+
+		// 2x2 blocks are stored row-major in one register: (a00, a01, a10, a11)
+		inline __m128 Mat2Mul(__m128 a, __m128 b) noexcept
 		{
-			cos,0.f,-sin,0.f,
-			0.f,1.f,0.f,0.f,
-			sin,0.f,cos,0.f,
-			0.f,0.f,0.f,1.f
-		};
-	}
+			return _mm_add_ps(
+				_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+				_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
 
-	Matrix4x4 Matrix4x4::RotateZ(float32 radian)
-	{
-		const auto cos = Math::Cos(radian);
-		const auto sin = Math::Sin(radian);
+		// adj(a) * b
+		inline __m128 Mat2AdjMul(__m128 a, __m128 b) noexcept
+		{
+			return _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+				_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+		}
 
-		return Matrix4x4
+		// a * adj(b)
+		inline __m128 Mat2MulAdj(__m128 a, __m128 b) noexcept
 		{
-			cos,sin,0.f,0.f,
-			-sin,cos,0.f,0.f,
-			0.f,0.f,1.f,0.f,
-			0.f,0.f,0.f,1.f
-		};
+			return _mm_sub_ps(
+				_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+				_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
+
+		// Block-wise inverse of | A B |
+		//                      | C D | built on the 2x2 determinants |A|,|B|,|C|,|D|
+		bool InverseSSE(const Matrix4x4& m, Matrix4x4& result) noexcept
+		{
+			const __m128 row0 = _mm_load_ps(m.m0);
+			const __m128 row1 = _mm_load_ps(m.m1);
+			const __m128 row2 = _mm_load_ps(m.m2);
+			const __m128 row3 = _mm_load_ps(m.m3);
+
+			const __m128 A = _mm_movelh_ps(row0, row1);
+			const __m128 B = _mm_movehl_ps(row1, row0);
+			const __m128 C = _mm_movelh_ps(row2, row3);
+			const __m128 D = _mm_movehl_ps(row3, row2);
+
+			const __m128 detSub = _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+				_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+			const __m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+			const __m128 DC = Mat2AdjMul(D, C);
+			const __m128 AB = Mat2AdjMul(A, B);
+
+			__m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, DC));
+			__m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, AB));
+			__m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, AB));
+			__m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, DC));
+
+			// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+			__m128 tr = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+			tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+			tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			const __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+			if (_mm_cvtss_f32(detM) == 0.f)
+				return false;
+
+			const __m128 rcpDet = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM);
+
+			X = _mm_mul_ps(X, rcpDet);
+			Y = _mm_mul_ps(Y, rcpDet);
+			Z = _mm_mul_ps(Z, rcpDet);
+			W = _mm_mul_ps(W, rcpDet);
+
+			_mm_store_ps(result.m0, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_store_ps(result.m1, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+			_mm_store_ps(result.m2, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_store_ps(result.m3, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+
+			return true;
+		}
+
+		inline __m128 CrossSSE(__m128 a, __m128 b) noexcept
+		{
+			const __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+			return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+		}
+
+		// Rows of inverse(R) are the columns (r1 x r2, r2 x r0, r0 x r1) / |R|,
+		// and a rigid R only needs its transpose
+		bool InverseAffineSSE(const Matrix4x4& m, Matrix4x4& result, bool rigid) noexcept
+		{
+			const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+			__m128 r0 = _mm_and_ps(_mm_load_ps(m.m0), xyzMask);
+			__m128 r1 = _mm_and_ps(_mm_load_ps(m.m1), xyzMask);
+			__m128 r2 = _mm_and_ps(_mm_load_ps(m.m2), xyzMask);
+			__m128 r3 = _mm_setzero_ps();
+
+			if (!rigid)
+			{
+				const __m128 c0 = CrossSSE(r1, r2);
+				const __m128 c1 = CrossSSE(r2, r0);
+				const __m128 c2 = CrossSSE(r0, r1);
+
+				__m128 det = _mm_mul_ps(r0, c0);
+				det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
+				det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1, 0, 3, 2)));
+
+				if (_mm_cvtss_f32(det) == 0.f)
+					return false;
+
+				const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.f), det);
+
+				r0 = _mm_mul_ps(c0, invDet);
+				r1 = _mm_mul_ps(c1, invDet);
+				r2 = _mm_mul_ps(c2, invDet);
+			}
+
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			const __m128 t = _mm_load_ps(m.m3);
+
+			__m128 translation = _mm_mul_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+			translation = _mm_add_ps(translation, _mm_mul_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+			translation = _mm_add_ps(translation, _mm_mul_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+			translation = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), translation);
+
+			_mm_store_ps(result.m0, r0);
+			_mm_store_ps(result.m1, r1);
+			_mm_store_ps(result.m2, r2);
+			_mm_store_ps(result.m3, translation);
+
+			return true;
+		}
+
+		// Two rows per 256-bit register; in-lane shuffles broadcast each row's element
+		IRIS_TARGET_AVX2 Matrix4x4 MultiplyAVX2(const Matrix4x4& left, const Matrix4x4& right) noexcept
+		{
+			const __m256 r0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.m0));
+			const __m256 r1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.m1));
+			const __m256 r2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.m2));
+			const __m256 r3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.m3));
+
+			Matrix4x4 result;
+
+			for (size_t i = 0; i < 16; i += 8)
+			{
+				const __m256 rows = _mm256_loadu_ps(left.data + i);
+
+				__m256 acc = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+				acc = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), r1, acc);
+				acc = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), r2, acc);
+				acc = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), r3, acc);
+
+				_mm256_storeu_ps(result.data + i, acc);
+			}
+
+			_mm256_zeroupper();
+
+			return result;
+		}
+
+		IRIS_TARGET_AVX2 Matrix4x4 ScaleAVX2(const Matrix4x4& left, float32 right) noexcept
+		{
+			const __m256 s = _mm256_set1_ps(right);
+
+			Matrix4x4 result;
+
+			_mm256_storeu_ps(result.data + 0, _mm256_mul_ps(_mm256_loadu_ps(left.data + 0), s));
+			_mm256_storeu_ps(result.data + 8, _mm256_mul_ps(_mm256_loadu_ps(left.data + 8), s));
+
+			_mm256_zeroupper();
+
+			return result;
+		}
+#endif
+
+		inline bool InverseKernel(const Matrix4x4& m, Matrix4x4& result) noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			return InverseSSE(m, result);
+#else
+			return InverseScalar(m, result);
+#endif
+		}
+
+		inline bool InverseAffineKernel(const Matrix4x4& m, Matrix4x4& result, bool rigid) noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			return InverseAffineSSE(m, result, rigid);
+#else
+			return InverseAffineScalar(m, result, rigid);
+#endif
+		}
+
+		MultiplyKernel SelectMultiplyKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			if (cpu.avx2 && cpu.fma)
+				return MultiplyAVX2;
+
+			return MultiplySSE;
+#else
+			return MultiplyScalar;
+#endif
+		}
+
+		ScaleKernel SelectScaleKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			// Built with the AVX2 target, which also enables FMA, so the compiler may emit AVX2-only forms such as a
+			// register vbroadcastss as well as FMA instructions
+			if (cpu.avx2 && cpu.fma)
+				return ScaleAVX2;
+
+			return ScaleSSE;
+#else
+			return ScaleScalar;
+#endif
+		}
 	}
 
-	Matrix4x4 Matrix4x4::Scaling(const Vector3& vector) noexcept
+	float32 Matrix4x4::determinant() const noexcept
 	{
-		return Matrix4x4
-		{
-			vector.x,0.f,0.f,0.f,
-			0.f,vector.y,0.f,0.f,
-			0.f,0.f,vector.z,0.f,
-			0.f,0.f,0.f,1.f
-		};
+		const auto s0 = m00 * m11 - m10 * m01;
+		const auto s1 = m00 * m12 - m10 * m02;
+		const auto s2 = m00 * m13 - m10 * m03;
+		const auto s3 = m01 * m12 - m11 * m02;
+		const auto s4 = m01 * m13 - m11 * m03;
+		const auto s5 = m02 * m13 - m12 * m03;
+
+		const auto c0 = m20 * m31 - m30 * m21;
+		const auto c1 = m20 * m32 - m30 * m22;
+		const auto c2 = m20 * m33 - m30 * m23;
+		const auto c3 = m21 * m32 - m31 * m22;
+		const auto c4 = m21 * m33 - m31 * m23;
+		const auto c5 = m22 * m33 - m32 * m23;
+
+		return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	}
+
+	Matrix4x4 Matrix4x4::adjoint() const
+	{
+		float32 det;
+		return AdjugateScalar(*this, det);
 	}
 
-	Matrix4x4 Matrix4x4::Scaling(float32 scale) noexcept
+	Matrix4x4 Matrix4x4::transpose() const noexcept
 	{
 		return Matrix4x4
 		{
-			scale,0.f,0.f,0.f,
-			0.f,scale,0.f,0.f,
-			0.f,0.f,scale,0.f,
-			0.f,0.f,0.f,1.f
+			m00, m10, m20, m30,
+			m01, m11, m21, m31,
+			m02, m12, m22, m32,
+			m03, m13, m23, m33
 		};
 	}
 
-	Matrix4x4 Matrix4x4::FromAxisAngle(const Vector3& axis, float32 radian)
+	Matrix4x4 Matrix4x4::inverse() const
 	{
-		const auto cos = Math::Cos(radian);
-		const auto sin = Math::Sin(radian);
-
-		const auto t = 1.f - cos;
-
-		const auto [x, y, z] = axis.data;
-
-		const auto xx = x * x;
-		const auto yy = y * y;
-		const auto zz = z * z;
-		const auto xy = x * y;
-		const auto xz = x * z;
-		const auto yz = y * z;
+		Matrix4x4 result;
 
-		Matrix4x4 result{};
+		if (!InverseKernel(*this, result))
+		{
+			return Matrix4x4::Identity();
+		}
 
-		result.m00 = t * xx + cos;
-		result.m01 = t * xy + sin * z;
-		result.m02 = t * xz - sin * y;
+		return result;
+	}
 
-		result.m10 = t * xy - sin * z;
-		result.m11 = t * yy + cos;
-		result.m12 = t * yz + sin * x;
+	Matrix4x4 Matrix4x4::inverseChecked() const
+	{
+		Matrix4x4 result;
 
-		result.m20 = t * xz + sin * y;
-		result.m21 = t * yz - sin * x;
-		result.m22 = t * zz + cos;
+		if (!InverseKernel(*this, result))
+		{
+			throw Error::ZeroDivisionException{ "Matrix4x4::inverseChecked()const" };
+		}
 
 		return result;
 	}
 
-	Matrix4x4 operator*(const Matrix4x4& left, const Matrix4x4& right) noexcept
+	Matrix4x4 Matrix4x4::inverseAffine() const
 	{
-		Matrix4x4 result{};
-
-		result.m00 = left.m00 * right.m00 + left.m01 * right.m10 + left.m02 * right.m20 + left.m03 * right.m30;
-		result.m01 = left.m00 * right.m01 + left.m01 * right.m11 + left.m02 * right.m21 + left.m03 * right.m31;
-		result.m02 = left.m00 * right.m02 + left.m01 * right.m12 + left.m02 * right.m22 + left.m03 * right.m32;
-		result.m03 = left.m00 * right.m03 + left.m01 * right.m13 + left.m02 * right.m23 + left.m03 * right.m33;
+		assert(isAffine() && "Matrix4x4::inverseAffine() requires an affine matrix");
 
-		result.m10 = left.m10 * right.m00 + left.m11 * right.m10 + left.m12 * right.m20 + left.m13 * right.m30;
-		result.m11 = left.m10 * right.m01 + left.m11 * right.m11 + left.m12 * right.m21 + left.m13 * right.m31;
-		result.m12 = left.m10 * right.m02 + left.m11 * right.m12 + left.m12 * right.m22 + left.m13 * right.m32;
-		result.m13 = left.m10 * right.m03 + left.m11 * right.m13 + left.m12 * right.m23 + left.m13 * right.m33;
-
-		result.m20 = left.m20 * right.m00 + left.m21 * right.m10 + left.m22 * right.m20 + left.m23 * right.m30;
-		result.m21 = left.m20 * right.m01 + left.m21 * right.m11 + left.m22 * right.m21 + left.m23 * right.m31;
-		result.m22 = left.m20 * right.m02 + left.m21 * right.m12 + left.m22 * right.m22 + left.m23 * right.m32;
-		result.m23 = left.m20 * right.m03 + left.m21 * right.m13 + left.m22 * right.m23 + left.m23 * right.m33;
+		Matrix4x4 result;
 
-		result.m30 = left.m30 * right.m00 + left.m31 * right.m10 + left.m32 * right.m20 + left.m33 * right.m30;
-		result.m31 = left.m30 * right.m01 + left.m31 * right.m11 + left.m32 * right.m21 + left.m33 * right.m31;
-		result.m32 = left.m30 * right.m02 + left.m31 * right.m12 + left.m32 * right.m22 + left.m33 * right.m32;
-		result.m33 = left.m30 * right.m03 + left.m31 * right.m13 + left.m32 * right.m23 + left.m33 * right.m33;
+		if (!InverseAffineKernel(*this, result, false))
+		{
+			return Matrix4x4::Identity();
+		}
 
 		return result;
 	}
 
-	Matrix4x4 operator*(const Matrix4x4& left, float32 right) noexcept
+	Matrix4x4 Matrix4x4::inverseRigid() const noexcept
 	{
+		assert(isAffine() && "Matrix4x4::inverseRigid() requires an affine matrix");
+		assert(IsOrthonormal(*this, 1e-3f) && "Matrix4x4::inverseRigid() requires an orthonormal rotation");
+
 		Matrix4x4 result;
+		InverseAffineKernel(*this, result, true);
+		return result;
+	}
 
-		result.m00 = left.m00 * right; result.m01 = left.m01 * right; result.m02 = left.m02 * right; result.m03 = left.m03 * right;
-		result.m10 = left.m10 * right; result.m11 = left.m11 * right; result.m12 = left.m12 * right; result.m13 = left.m13 * right;
-		result.m20 = left.m20 * right; result.m21 = left.m21 * right; result.m22 = left.m22 * right; result.m23 = left.m23 * right;
-		result.m30 = left.m30 * right; result.m31 = left.m31 * right; result.m32 = left.m32 * right; result.m33 = left.m33 * right;
+	Matrix4x4 operator*(const Matrix4x4& left, const Matrix4x4& right) noexcept
+	{
+		static const MultiplyKernel kernel = SelectMultiplyKernel();
+		return kernel(left, right);
+	}
 
-		return result;
+	Matrix4x4 operator*(const Matrix4x4& left, float32 right) noexcept
+	{
+		static const ScaleKernel kernel = SelectScaleKernel();
+		return kernel(left, right);
 	}
 
 	Matrix4x4& operator*=(Matrix4x4& left, const Matrix4x4& right) noexcept
 	{
-		left.m00 = left.m00 * right.m00 + left.m01 * right.m10 + left.m02 * right.m20 + left.m03 * right.m30;
-		left.m01 = left.m00 * right.m01 + left.m01 * right.m11 + left.m02 * right.m21 + left.m03 * right.m31;
-		left.m02 = left.m00 * right.m02 + left.m01 * right.m12 + left.m02 * right.m22 + left.m03 * right.m32;
-		left.m03 = left.m00 * right.m03 + left.m01 * right.m13 + left.m02 * right.m23 + left.m03 * right.m33;
-
-		left.m10 = left.m10 * right.m00 + left.m11 * right.m10 + left.m12 * right.m20 + left.m13 * right.m30;
-		left.m11 = left.m10 * right.m01 + left.m11 * right.m11 + left.m12 * right.m21 + left.m13 * right.m31;
-		left.m12 = left.m10 * right.m02 + left.m11 * right.m12 + left.m12 * right.m22 + left.m13 * right.m32;
-		left.m13 = left.m10 * right.m03 + left.m11 * right.m13 + left.m12 * right.m23 + left.m13 * right.m33;
-
-		left.m20 = left.m20 * right.m00 + left.m21 * right.m10 + left.m22 * right.m20 + left.m23 * right.m30;
-		left.m21 = left.m20 * right.m01 + left.m21 * right.m11 + left.m22 * right.m21 + left.m23 * right.m31;
-		left.m22 = left.m20 * right.m02 + left.m21 * right.m12 + left.m22 * right.m22 + left.m23 * right.m32;
-		left.m23 = left.m20 * right.m03 + left.m21 * right.m13 + left.m22 * right.m23 + left.m23 * right.m33;
-
-		left.m30 = left.m30 * right.m00 + left.m31 * right.m10 + left.m32 * right.m20 + left.m33 * right.m30;
-		left.m31 = left.m30 * right.m01 + left.m31 * right.m11 + left.m32 * right.m21 + left.m33 * right.m31;
-		left.m32 = left.m30 * right.m02 + left.m31 * right.m12 + left.m32 * right.m22 + left.m33 * right.m32;
-		left.m33 = left.m30 * right.m03 + left.m31 * right.m13 + left.m32 * right.m23 + left.m33 * right.m33;
-
+		left = left * right;
 		return left;
 	}
 
 	Matrix4x4& operator*=(Matrix4x4& left, float32 right) noexcept
 	{
-		left.m00 *= right; left.m01 *= right; left.m02 *= right; left.m03 *= right;
-		left.m10 *= right; left.m11 *= right; left.m12 *= right; left.m13 *= right;
-		left.m20 *= right; left.m21 *= right; left.m22 *= right; left.m23 *= right;
-		left.m30 *= right; left.m31 *= right; left.m32 *= right; left.m33 *= right;
+		left = left * right;
 		return left;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,596 @@
+#include <Iris/Math/Noise.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+#include <Iris/Common/Parallel.hpp>
+
+#include <bit>
+#include <cmath>
+#include <thread>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+	// Pulls the whole lane chain into each AVX2 kernel, so optimized builds keep the Float8 values in registers
+	#define IRIS_NOISE_FLATTEN __attribute__((flatten))
+#else
+	#define IRIS_NOISE_FLATTEN
+#endif
+
+namespace Iris
+{
+	namespace
+	{
+		// Each noise function is written once against a lane type: float32 and uint32 for single points,
+		// Float4 and Int4 (SSE2) or Float8 and Int8 (AVX2) for batches. Masks are Int lanes of all ones or all zeros.
+		template<class Float>
+		struct Lane;
+
+		template<>
+		struct Lane<float32> final
+		{
+			using Int = uint32;
+
+			static constexpr size_t Width = 1;
+
+			static float32 Load(const float32* source) noexcept
+			{
+				return *source;
+			}
+
+			static void Store(float32* destination, float32 value) noexcept
+			{
+				*destination = value;
+			}
+		};
+
+		template<class Float>
+		using IntLane = typename Lane<Float>::Int;
+
+		inline float32 Floor(float32 x) noexcept
+		{
+			return std::floor(x);
+		}
+
+		inline uint32 ToInt(float32 x) noexcept
+		{
+			return static_cast<uint32>(static_cast<int32>(x));
+		}
+
+		inline float32 ClampPositive(float32 x) noexcept
+		{
+			return Max(x, 0.f);
+		}
+
+		inline uint32 Greater(float32 a, float32 b) noexcept
+		{
+			return (a > b) ? ~0u : 0u;
+		}
+
+		inline uint32 Greater(uint32 a, uint32 b) noexcept
+		{
+			return (static_cast<int32>(a) > static_cast<int32>(b)) ? ~0u : 0u;
+		}
+
+		inline uint32 Equal(uint32 a, uint32 b) noexcept
+		{
+			return (a == b) ? ~0u : 0u;
+		}
+
+		inline float32 Select(uint32 mask, float32 a, float32 b) noexcept
+		{
+			return mask ? a : b;
+		}
+
+		// Negates 'x' where bit 31 of 'sign' is set
+		inline float32 FlipSign(float32 x, uint32 sign) noexcept
+		{
+			return std::bit_cast<float32>(std::bit_cast<uint32>(x) ^ (sign & 0x80000000u));
+		}
+
+		template<int32 K>
+		inline uint32 ShiftLeft(uint32 x) noexcept
+		{
+			return x << K;
+		}
+
+		template<int32 K>
+		inline uint32 ShiftRight(uint32 x) noexcept
+		{
+			return x >> K;
+		}
+
+#if defined(IRIS_SIMD_X86)
+		struct Float4 final
+		{
+			Float4() noexcept = default;
+
+			Float4(__m128 _v) noexcept : v(_v) {}
+
+			Float4(float32 _value) noexcept : v(_mm_set1_ps(_value)) {}
+
+			__m128 v;
+		};
+
+		struct Int4 final
+		{
+			Int4() noexcept = default;
+
+			Int4(__m128i _v) noexcept : v(_v) {}
+
+			Int4(uint32 _value) noexcept : v(_mm_set1_epi32(static_cast<int32>(_value))) {}
+
+			__m128i v;
+		};
+
+		template<>
+		struct Lane<Float4> final
+		{
+			using Int = Int4;
+
+			static constexpr size_t Width = 4;
+
+			static Float4 Load(const float32* source) noexcept
+			{
+				return _mm_loadu_ps(source);
+			}
+
+			static void Store(float32* destination, Float4 value) noexcept
+			{
+				_mm_storeu_ps(destination, value.v);
+			}
+		};
+
+		inline Float4 operator+(Float4 a, Float4 b) noexcept { return _mm_add_ps(a.v, b.v); }
+
+		inline Float4 operator-(Float4 a, Float4 b) noexcept { return _mm_sub_ps(a.v, b.v); }
+
+		inline Float4 operator*(Float4 a, Float4 b) noexcept { return _mm_mul_ps(a.v, b.v); }
+
+		inline Int4 operator+(Int4 a, Int4 b) noexcept { return _mm_add_epi32(a.v, b.v); }
+
+		inline Int4 operator-(Int4 a, Int4 b) noexcept { return _mm_sub_epi32(a.v, b.v); }
+
+		inline Int4 operator&(Int4 a, Int4 b) noexcept { return _mm_and_si128(a.v, b.v); }
+
+		inline Int4 operator|(Int4 a, Int4 b) noexcept { return _mm_or_si128(a.v, b.v); }
+
+		inline Int4 operator^(Int4 a, Int4 b) noexcept { return _mm_xor_si128(a.v, b.v); }
+
+		inline Int4 operator~(Int4 a) noexcept { return _mm_xor_si128(a.v, _mm_set1_epi32(-1)); }
+
+		// SSE2 has no 32-bit low multiply; multiply the even and odd lanes as 64-bit products and interleave
+		inline Int4 operator*(Int4 a, Int4 b) noexcept
+		{
+			const __m128i even = _mm_mul_epu32(a.v, b.v);
+			const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a.v, 4), _mm_srli_si128(b.v, 4));
+			return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+		}
+
+		inline Float4 Floor(Float4 x) noexcept
+		{
+			const __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(x.v));
+			return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, x.v), _mm_set1_ps(1.f)));
+		}
+
+		inline Int4 ToInt(Float4 x) noexcept
+		{
+			return _mm_cvttps_epi32(x.v);
+		}
+
+		inline Float4 ClampPositive(Float4 x) noexcept
+		{
+			return _mm_max_ps(x.v, _mm_setzero_ps());
+		}
+
+		inline Int4 Greater(Float4 a, Float4 b) noexcept
+		{
+			return _mm_castps_si128(_mm_cmpgt_ps(a.v, b.v));
+		}
+
+		inline Int4 Greater(Int4 a, Int4 b) noexcept
+		{
+			return _mm_cmpgt_epi32(a.v, b.v);
+		}
+
+		inline Int4 Equal(Int4 a, Int4 b) noexcept
+		{
+			return _mm_cmpeq_epi32(a.v, b.v);
+		}
+
+		inline Float4 Select(Int4 mask, Float4 a, Float4 b) noexcept
+		{
+			const __m128 m = _mm_castsi128_ps(mask.v);
+			return _mm_or_ps(_mm_and_ps(m, a.v), _mm_andnot_ps(m, b.v));
+		}
+
+		inline Float4 FlipSign(Float4 x, Int4 sign) noexcept
+		{
+			return _mm_xor_ps(x.v, _mm_castsi128_ps(_mm_and_si128(sign.v, _mm_set1_epi32(static_cast<int32>(0x80000000u)))));
+		}
+
+		template<int32 K>
+		inline Int4 ShiftLeft(Int4 x) noexcept
+		{
+			return _mm_slli_epi32(x.v, K);
+		}
+
+		template<int32 K>
+		inline Int4 ShiftRight(Int4 x) noexcept
+		{
+			return _mm_srli_epi32(x.v, K);
+		}
+
+		struct Float8 final
+		{
+			Float8() noexcept = default;
+
+			IRIS_TARGET_AVX2 Float8(__m256 _v) noexcept : v(_v) {}
+
+			IRIS_TARGET_AVX2 Float8(float32 _value) noexcept : v(_mm256_set1_ps(_value)) {}
+
+			__m256 v;
+		};
+
+		struct Int8 final
+		{
+			Int8() noexcept = default;
+
+			IRIS_TARGET_AVX2 Int8(__m256i _v) noexcept : v(_v) {}
+
+			IRIS_TARGET_AVX2 Int8(uint32 _value) noexcept : v(_mm256_set1_epi32(static_cast<int32>(_value))) {}
+
+			__m256i v;
+		};
+
+		template<>
+		struct Lane<Float8> final
+		{
+			using Int = Int8;
+
+			static constexpr size_t Width = 8;
+
+			IRIS_TARGET_AVX2 static Float8 Load(const float32* source) noexcept
+			{
+				return _mm256_loadu_ps(source);
+			}
+
+			IRIS_TARGET_AVX2 static void Store(float32* destination, Float8 value) noexcept
+			{
+				_mm256_storeu_ps(destination, value.v);
+			}
+		};
+
+		IRIS_TARGET_AVX2 inline Float8 operator+(Float8 a, Float8 b) noexcept { return _mm256_add_ps(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Float8 operator-(Float8 a, Float8 b) noexcept { return _mm256_sub_ps(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Float8 operator*(Float8 a, Float8 b) noexcept { return _mm256_mul_ps(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Int8 operator+(Int8 a, Int8 b) noexcept { return _mm256_add_epi32(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Int8 operator-(Int8 a, Int8 b) noexcept { return _mm256_sub_epi32(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Int8 operator*(Int8 a, Int8 b) noexcept { return _mm256_mullo_epi32(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Int8 operator&(Int8 a, Int8 b) noexcept { return _mm256_and_si256(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Int8 operator|(Int8 a, Int8 b) noexcept { return _mm256_or_si256(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Int8 operator^(Int8 a, Int8 b) noexcept { return _mm256_xor_si256(a.v, b.v); }
+
+		IRIS_TARGET_AVX2 inline Int8 operator~(Int8 a) noexcept { return _mm256_xor_si256(a.v, _mm256_set1_epi32(-1)); }
+
+		IRIS_TARGET_AVX2 inline Float8 Floor(Float8 x) noexcept
+		{
+			return _mm256_floor_ps(x.v);
+		}
+
+		IRIS_TARGET_AVX2 inline Int8 ToInt(Float8 x) noexcept
+		{
+			return _mm256_cvttps_epi32(x.v);
+		}
+
+		IRIS_TARGET_AVX2 inline Float8 ClampPositive(Float8 x) noexcept
+		{
+			return _mm256_max_ps(x.v, _mm256_setzero_ps());
+		}
+
+		IRIS_TARGET_AVX2 inline Int8 Greater(Float8 a, Float8 b) noexcept
+		{
+			return _mm256_castps_si256(_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ));
+		}
+
+		IRIS_TARGET_AVX2 inline Int8 Greater(Int8 a, Int8 b) noexcept
+		{
+			return _mm256_cmpgt_epi32(a.v, b.v);
+		}
+
+		IRIS_TARGET_AVX2 inline Int8 Equal(Int8 a, Int8 b) noexcept
+		{
+			return _mm256_cmpeq_epi32(a.v, b.v);
+		}
+
+		IRIS_TARGET_AVX2 inline Float8 Select(Int8 mask, Float8 a, Float8 b) noexcept
+		{
+			return _mm256_blendv_ps(b.v, a.v, _mm256_castsi256_ps(mask.v));
+		}
+
+		IRIS_TARGET_AVX2 inline Float8 FlipSign(Float8 x, Int8 sign) noexcept
+		{
+			return _mm256_xor_ps(x.v, _mm256_castsi256_ps(_mm256_and_si256(sign.v, _mm256_set1_epi32(static_cast<int32>(0x80000000u)))));
+		}
+
+		template<int32 K>
+		IRIS_TARGET_AVX2 inline Int8 ShiftLeft(Int8 x) noexcept
+		{
+			return _mm256_slli_epi32(x.v, K);
+		}
+
+		template<int32 K>
+		IRIS_TARGET_AVX2 inline Int8 ShiftRight(Int8 x) noexcept
+		{
+			return _mm256_srli_epi32(x.v, K);
+		}
+#endif
+
+		// Per-axis multipliers for the lattice hash; corner hashes XOR the axis terms with the seed
+		constexpr uint32 HashPrimes[] = { 0x8DA6B343u,0xD8163841u,0xCB1AB31Fu,0x9E3779B1u };
+
+		// Per-octave seed offset
+		constexpr uint32 OctaveSeedStep = 0x27D4EB2Du;
+
+		// Reciprocals of the peak magnitudes found by local search from many starting points, slightly rounded down
+		constexpr float32 PerlinScale[] = { 0.f,0.f,1.f,0.995f,0.853f };
+
+		// (sqrt(n + 1) - 1) / n maps the simplex lattice onto the integer grid; (1 - 1 / sqrt(n + 1)) / n maps it back
+		constexpr float32 SimplexSkew[] = { 0.f,0.f,0.366025404f,0.333333333f,0.309016994f };
+
+		constexpr float32 SimplexUnskew[] = { 0.f,0.f,0.211324865f,0.166666667f,0.138196601f };
+
+		constexpr float32 SimplexScale[] = { 0.f,0.f,70.f,76.6f,62.5f };
+
+		// Points per block; coordinates are staged as one stream per axis
+		constexpr size_t BlockSize = 256;
+
+		// Widest lane count; blocks are zero-padded to a multiple of it
+		constexpr size_t MaxLaneWidth = 8;
+
+		using FbmKernel = void(*)(const NoiseSettings&, const float32*, float32*, size_t)noexcept;
+
+		// float32 and Float4 instantiations
+		namespace Portable
+		{
+#define IRIS_NOISE_LANE
+#include "NoiseLanes.hpp"
+#undef IRIS_NOISE_LANE
+		}
+
+#if defined(IRIS_SIMD_X86)
+		// Float8 instantiations, every function compiled for AVX2
+		namespace AVX2
+		{
+#define IRIS_NOISE_LANE IRIS_TARGET_AVX2
+#include "NoiseLanes.hpp"
+#undef IRIS_NOISE_LANE
+		}
+
+		template<size_t Dim>
+		IRIS_TARGET_AVX2 IRIS_NOISE_FLATTEN void FbmBlockAVX2(const NoiseSettings& settings, const float32* coordinates, float32* values, size_t count) noexcept
+		{
+			AVX2::FbmBlock<Dim, Float8>(settings, coordinates, values, count);
+			_mm256_zeroupper();
+		}
+#endif
+
+		template<size_t Dim>
+		FbmKernel SelectFbmKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			// The AVX2 kernels are built with FMA contraction enabled
+			if (cpu.avx2 && cpu.fma)
+				return FbmBlockAVX2<Dim>;
+
+			return Portable::FbmBlock<Dim, Float4>;
+#else
+			return Portable::FbmBlock<Dim, float32>;
+#endif
+		}
+
+		// Evaluates points [first, last) into 'values' (indexed from 0); 'point(i, p)' writes the coordinates of point i
+		template<size_t Dim, class PointSource>
+		void FbmRange(const NoiseSettings& settings, size_t first, size_t last, float32* values, PointSource point) noexcept
+		{
+			static const FbmKernel kernel = SelectFbmKernel<Dim>();
+
+			alignas(32) float32 coordinates[Dim * BlockSize];
+			alignas(32) float32 block[BlockSize];
+
+			for (size_t begin = first; begin < last; begin += BlockSize)
+			{
+				const auto count = Min(last - begin, BlockSize);
+				const auto padded = (count + MaxLaneWidth - 1) / MaxLaneWidth * MaxLaneWidth;
+
+				for (size_t i = 0; i < padded; ++i)
+				{
+					float32 p[Dim] = {};
+
+					if (i < count)
+						point(begin + i, p);
+
+					for (size_t d = 0; d < Dim; ++d)
+					{
+						coordinates[d * BlockSize + i] = p[d];
+					}
+				}
+
+				kernel(settings, coordinates, block, count);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					values[begin - first + i] = block[i];
+				}
+			}
+		}
+
+		// Below this many samples per thread the spawn cost outweighs the work
+		constexpr size_t MinSamplesPerThread = 16384;
+
+		// Runs 'row(r)' for every row in [0, rows) across the requested threads
+		template<class RowFunction>
+		void ForEachRow(size_t rows, size_t rowSize, size_t threadCount, RowFunction row)
+		{
+			if (threadCount == 0)
+				threadCount = Max<size_t>(std::thread::hardware_concurrency(), 1);
+
+			threadCount = Min(threadCount, Max<size_t>(rows * rowSize / MinSamplesPerThread, 1));
+			threadCount = Min(threadCount, Max<size_t>(rows, 1));
+
+			const auto perThread = (rows + threadCount - 1) / threadCount;
+
+			const auto run = [&](size_t t)
+			{
+				const auto first = Min(t * perThread, rows);
+				const auto last = Min(first + perThread, rows);
+
+				for (size_t r = first; r < last; ++r)
+				{
+					row(r);
+				}
+			};
+
+			ParallelFor(threadCount, run);
+		}
+	}
+
+	float32 Perlin(const Vector2& point) noexcept
+	{
+		const float32 p[] = { point.x,point.y };
+		return Portable::PerlinLanes(p, 0u);
+	}
+
+	float32 Perlin(const Vector3& point) noexcept
+	{
+		const float32 p[] = { point.x,point.y,point.z };
+		return Portable::PerlinLanes(p, 0u);
+	}
+
+	float32 Perlin(const Vector3& point, float32 w) noexcept
+	{
+		const float32 p[] = { point.x,point.y,point.z,w };
+		return Portable::PerlinLanes(p, 0u);
+	}
+
+	float32 Simplex(const Vector2& point) noexcept
+	{
+		const float32 p[] = { point.x,point.y };
+		return Portable::SimplexLanes(p, 0u);
+	}
+
+	float32 Simplex(const Vector3& point) noexcept
+	{
+		const float32 p[] = { point.x,point.y,point.z };
+		return Portable::SimplexLanes(p, 0u);
+	}
+
+	float32 Simplex(const Vector3& point, float32 w) noexcept
+	{
+		const float32 p[] = { point.x,point.y,point.z,w };
+		return Portable::SimplexLanes(p, 0u);
+	}
+
+	float32 Fbm(const Vector2& point, const NoiseSettings& settings) noexcept
+	{
+		const float32 p[] = { point.x,point.y };
+		return Portable::FbmLanes(settings, p);
+	}
+
+	float32 Fbm(const Vector3& point, const NoiseSettings& settings) noexcept
+	{
+		const float32 p[] = { point.x,point.y,point.z };
+		return Portable::FbmLanes(settings, p);
+	}
+
+	float32 Fbm(const Vector3& point, float32 w, const NoiseSettings& settings) noexcept
+	{
+		const float32 p[] = { point.x,point.y,point.z,w };
+		return Portable::FbmLanes(settings, p);
+	}
+
+	void Fbm(std::span<const Vector2> points, std::span<float32> values, const NoiseSettings& settings)
+	{
+		if (values.size() < points.size())
+			throw Error::OutOfRange{ "Fbm(span<const Vector2>,span<float32>,const NoiseSettings&)" };
+
+		FbmRange<2>(settings, 0, points.size(), values.data(), [&](size_t i, float32 (&p)[2])
+		{
+			p[0] = points[i].x;
+			p[1] = points[i].y;
+		});
+	}
+
+	void Fbm(std::span<const Vector3> points, std::span<float32> values, const NoiseSettings& settings)
+	{
+		if (values.size() < points.size())
+			throw Error::OutOfRange{ "Fbm(span<const Vector3>,span<float32>,const NoiseSettings&)" };
+
+		FbmRange<3>(settings, 0, points.size(), values.data(), [&](size_t i, float32 (&p)[3])
+		{
+			p[0] = points[i].x;
+			p[1] = points[i].y;
+			p[2] = points[i].z;
+		});
+	}
+
+	void Fbm(std::span<const Vector3> points, float32 w, std::span<float32> values, const NoiseSettings& settings)
+	{
+		if (values.size() < points.size())
+			throw Error::OutOfRange{ "Fbm(span<const Vector3>,float32,span<float32>,const NoiseSettings&)" };
+
+		FbmRange<4>(settings, 0, points.size(), values.data(), [&](size_t i, float32 (&p)[4])
+		{
+			p[0] = points[i].x;
+			p[1] = points[i].y;
+			p[2] = points[i].z;
+			p[3] = w;
+		});
+	}
+
+	void FillNoiseGrid(const Vector2& origin, const Vector2& spacing, size_t width, size_t height, std::span<float32> values, const NoiseSettings& settings, size_t threadCount)
+	{
+		if (values.size() < width * height)
+			throw Error::OutOfRange{ "FillNoiseGrid(const Vector2&,const Vector2&,size_t,size_t,span<float32>,const NoiseSettings&,size_t)" };
+
+		ForEachRow(height, width, threadCount, [&](size_t y)
+		{
+			const auto py = origin.y + spacing.y * static_cast<float32>(y);
+
+			FbmRange<2>(settings, 0, width, values.data() + y * width, [&](size_t x, float32 (&p)[2])
+			{
+				p[0] = origin.x + spacing.x * static_cast<float32>(x);
+				p[1] = py;
+			});
+		});
+	}
+
+	void FillNoiseGrid(const Vector3& origin, const Vector3& spacing, size_t width, size_t height, size_t depth, std::span<float32> values, const NoiseSettings& settings, size_t threadCount)
+	{
+		if (values.size() < width * height * depth)
+			throw Error::OutOfRange{ "FillNoiseGrid(const Vector3&,const Vector3&,size_t,size_t,size_t,span<float32>,const NoiseSettings&,size_t)" };
+
+		ForEachRow(height * depth, width, threadCount, [&](size_t row)
+		{
+			const auto py = origin.y + spacing.y * static_cast<float32>(row % height);
+			const auto pz = origin.z + spacing.z * static_cast<float32>(row / height);
+
+			FbmRange<3>(settings, 0, width, values.data() + row * width, [&](size_t x, float32 (&p)[3])
+			{
+				p[0] = origin.x + spacing.x * static_cast<float32>(x);
+				p[1] = py;
+				p[2] = pz;
+			});
+		});
+	}
+}
\ No newline at end of file
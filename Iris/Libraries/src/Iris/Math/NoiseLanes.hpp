@@ -0,0 +1,240 @@
+// Lane templates of Noise.cpp, written once against the lane types defined there. Noise.cpp includes this file
+// twice: into namespace Portable with IRIS_NOISE_LANE empty for float32 and Float4, and into namespace AVX2 with
+// IRIS_NOISE_LANE set to IRIS_TARGET_AVX2 for Float8, so an AVX value is never passed between functions compiled
+// for different instruction sets. No include guard on purpose.
+
+#if !defined(IRIS_NOISE_LANE)
+	#error "NoiseLanes.hpp is part of Noise.cpp; define IRIS_NOISE_LANE before including it"
+#endif
+
+// lowbias32 (Wellons)
+template<class Int>
+IRIS_NOISE_LANE inline Int Hash(Int h) noexcept
+{
+	h = h ^ ShiftRight<16>(h);
+	h = h * Int(0x7FEB352Du);
+	h = h ^ ShiftRight<15>(h);
+	h = h * Int(0x846CA68Bu);
+	return h ^ ShiftRight<16>(h);
+}
+
+// The four diagonals (+-1, +-1)
+template<class Float, class Int>
+IRIS_NOISE_LANE inline Float Gradient(Int h, const Float (&g)[2]) noexcept
+{
+	return FlipSign(g[0], ShiftLeft<31>(h)) + FlipSign(g[1], ShiftLeft<30>(h));
+}
+
+// Perlin's twelve cube edge directions, padded to sixteen
+template<class Float, class Int>
+IRIS_NOISE_LANE inline Float Gradient(Int h, const Float (&g)[3]) noexcept
+{
+	h = h & Int(15u);
+
+	const Float u = Select(Greater(Int(8u), h), g[0], g[1]);
+	const Float v = Select(Greater(Int(4u), h), g[1], Select(Equal(h, Int(12u)) | Equal(h, Int(14u)), g[0], g[2]));
+	return FlipSign(u, ShiftLeft<31>(h)) + FlipSign(v, ShiftLeft<30>(h));
+}
+
+// The 32 tesseract edge directions: three of x, y, z, w with independent signs
+template<class Float, class Int>
+IRIS_NOISE_LANE inline Float Gradient(Int h, const Float (&g)[4]) noexcept
+{
+	h = h & Int(31u);
+
+	const Float u = Select(Greater(Int(24u), h), g[0], g[1]);
+	const Float v = Select(Greater(Int(16u), h), g[1], g[2]);
+	const Float t = Select(Greater(Int(8u), h), g[2], g[3]);
+	return FlipSign(u, ShiftLeft<31>(h)) + FlipSign(v, ShiftLeft<30>(h)) + FlipSign(t, ShiftLeft<29>(h));
+}
+
+template<class Float>
+IRIS_NOISE_LANE inline Float Fade(Float t) noexcept
+{
+	return t * t * t * (t * (t * 6.f - 15.f) + 10.f);
+}
+
+template<class Float>
+IRIS_NOISE_LANE inline Float Lerp(Float a, Float b, Float t) noexcept
+{
+	return a + (b - a) * t;
+}
+
+template<size_t Dim, class Float>
+IRIS_NOISE_LANE inline Float PerlinLanes(const Float (&p)[Dim], IntLane<Float> seed) noexcept
+{
+	using Int = IntLane<Float>;
+
+	Int hash[Dim][2];
+	Float offset[Dim][2];
+	Float fade[Dim];
+
+	for (size_t d = 0; d < Dim; ++d)
+	{
+		const Float cell = Floor(p[d]);
+		hash[d][0] = ToInt(cell) * Int(HashPrimes[d]);
+		hash[d][1] = hash[d][0] + Int(HashPrimes[d]);
+		offset[d][0] = p[d] - cell;
+		offset[d][1] = offset[d][0] - 1.f;
+		fade[d] = Fade(offset[d][0]);
+	}
+
+	// Bit d of the corner index selects the lower or upper lattice point on axis d
+	Float n[1 << Dim];
+
+	for (size_t c = 0; c < (1 << Dim); ++c)
+	{
+		Int h = seed;
+		Float g[Dim];
+
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			h = h ^ hash[d][(c >> d) & 1];
+			g[d] = offset[d][(c >> d) & 1];
+		}
+
+		n[c] = Gradient(Hash(h), g);
+	}
+
+	// Collapse one axis per pass; neighbours along the lowest remaining axis are adjacent
+	for (size_t d = 0, size = (1 << Dim); d < Dim; ++d)
+	{
+		size >>= 1;
+
+		for (size_t c = 0; c < size; ++c)
+		{
+			n[c] = Lerp(n[c * 2], n[c * 2 + 1], fade[d]);
+		}
+	}
+
+	return n[0] * PerlinScale[Dim];
+}
+
+// Gustavson's simplex noise generalized over the dimension; corners are ordered by ranking the cell offsets.
+// A falloff radius of 0.5 keeps every kernel inside its simplex, so the field is continuous in all dimensions.
+template<size_t Dim, class Float>
+IRIS_NOISE_LANE inline Float SimplexLanes(const Float (&p)[Dim], IntLane<Float> seed) noexcept
+{
+	using Int = IntLane<Float>;
+
+	constexpr auto skew = SimplexSkew[Dim];
+	constexpr auto unskew = SimplexUnskew[Dim];
+
+	Float sum = p[0];
+
+	for (size_t d = 1; d < Dim; ++d)
+	{
+		sum = sum + p[d];
+	}
+
+	const Float s = sum * skew;
+
+	Float cell[Dim];
+	Float cellSum = 0.f;
+
+	for (size_t d = 0; d < Dim; ++d)
+	{
+		cell[d] = Floor(p[d] + s);
+		cellSum = cellSum + cell[d];
+	}
+
+	const Float t = cellSum * unskew;
+
+	Float x0[Dim];
+	Int hash[Dim];
+	Int rank[Dim];
+
+	for (size_t d = 0; d < Dim; ++d)
+	{
+		x0[d] = p[d] - cell[d] + t;
+		hash[d] = ToInt(cell[d]) * Int(HashPrimes[d]);
+		rank[d] = Int(0u);
+	}
+
+	// rank[d] counts the axes with a smaller offset; ties go to the lower axis
+	for (size_t a = 0; a < Dim; ++a)
+	{
+		for (size_t b = a + 1; b < Dim; ++b)
+		{
+			const Int aFirst = ~Greater(x0[b], x0[a]);
+			rank[a] = rank[a] - aFirst;
+			rank[b] = rank[b] - ~aFirst;
+		}
+	}
+
+	Float result = 0.f;
+
+	for (size_t k = 0; k <= Dim; ++k)
+	{
+		Int h = seed;
+		Float x[Dim];
+		Float falloff = 0.5f;
+
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			// Corner k steps along the k axes with the largest offsets
+			const Int step = Greater(rank[d], Int(static_cast<uint32>(Dim - 1 - k)));
+			const Float delta = Select(step, Float(1.f), Float(0.f));
+
+			x[d] = x0[d] - delta + unskew * static_cast<float32>(k);
+			h = h ^ (hash[d] + (step & Int(HashPrimes[d])));
+			falloff = falloff - x[d] * x[d];
+		}
+
+		falloff = ClampPositive(falloff);
+		falloff = falloff * falloff;
+		result = result + falloff * falloff * Gradient(Hash(h), x);
+	}
+
+	return result * SimplexScale[Dim];
+}
+
+template<size_t Dim, class Float>
+IRIS_NOISE_LANE inline Float FbmLanes(const NoiseSettings& settings, const Float (&p)[Dim]) noexcept
+{
+	using Int = IntLane<Float>;
+
+	const auto octaves = Max(settings.octaves, 1u);
+
+	Float sum = 0.f;
+	float32 amplitude = 1.f;
+	float32 totalAmplitude = 0.f;
+	float32 frequency = settings.frequency;
+
+	for (uint32 octave = 0; octave < octaves; ++octave)
+	{
+		Float q[Dim];
+
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			q[d] = p[d] * frequency;
+		}
+
+		const Int seed = Int(settings.seed + octave * OctaveSeedStep);
+		const Float value = (settings.type == NoiseType::Perlin) ? PerlinLanes(q, seed) : SimplexLanes(q, seed);
+
+		sum = sum + value * amplitude;
+		totalAmplitude += amplitude;
+		amplitude *= settings.gain;
+		frequency *= settings.lacunarity;
+	}
+
+	return sum * (1.f / totalAmplitude);
+}
+
+template<size_t Dim, class Float>
+IRIS_NOISE_LANE void FbmBlock(const NoiseSettings& settings, const float32* coordinates, float32* values, size_t count) noexcept
+{
+	for (size_t i = 0; i < count; i += Lane<Float>::Width)
+	{
+		Float p[Dim];
+
+		for (size_t d = 0; d < Dim; ++d)
+		{
+			p[d] = Lane<Float>::Load(coordinates + d * BlockSize + i);
+		}
+
+		Lane<Float>::Store(values + i, FbmLanes(settings, p));
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,627 @@
+#include <Iris/Math/Packing.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	namespace
+	{
+		using PackHalfKernel = void(*)(const float32*, float16*, size_t)noexcept;
+
+		using UnpackHalfKernel = void(*)(const float16*, float32*, size_t)noexcept;
+
+		void PackHalfScalar(const float32* src, float16* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = float16{ src[i] };
+			}
+		}
+
+		void UnpackHalfScalar(const float16* src, float32* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = static_cast<float32>(src[i]);
+			}
+		}
+
+		[[maybe_unused]] void PackUnorm8Scalar(const float32* src, unorm8* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = unorm8{ src[i] };
+			}
+		}
+
+		[[maybe_unused]] void UnpackUnorm8Scalar(const unorm8* src, float32* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = static_cast<float32>(src[i]);
+			}
+		}
+
+		[[maybe_unused]] void PackSnorm16Scalar(const float32* src, snorm16* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = snorm16{ src[i] };
+			}
+		}
+
+		[[maybe_unused]] void UnpackSnorm16Scalar(const snorm16* src, float32* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = static_cast<float32>(src[i]);
+			}
+		}
+
+		[[maybe_unused]] void PackUnorm1010102Scalar(const float32* src, unorm1010102* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float32* p = src + i * 4;
+				dst[i] = unorm1010102{ p[0],p[1],p[2],p[3] };
+			}
+		}
+
+		[[maybe_unused]] void UnpackUnorm1010102Scalar(const unorm1010102* src, float32* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				float32* p = dst + i * 4;
+				p[0] = src[i].x();
+				p[1] = src[i].y();
+				p[2] = src[i].z();
+				p[3] = src[i].w();
+			}
+		}
+
+		[[maybe_unused]] void PackQuaternion32Scalar(const Quaternion* src, PackedQuaternion32* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = PackedQuaternion32{ src[i] };
+			}
+		}
+
+		[[maybe_unused]] void PackQuaternion48Scalar(const Quaternion* src, PackedQuaternion48* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = PackedQuaternion48{ src[i] };
+			}
+		}
+
+		[[maybe_unused]] void UnpackQuaternion32Scalar(const PackedQuaternion32* src, Quaternion* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = src[i].toQuaternion();
+			}
+		}
+
+		[[maybe_unused]] void UnpackQuaternion48Scalar(const PackedQuaternion48* src, Quaternion* dst, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[i] = src[i].toQuaternion();
+			}
+		}
+
+#if defined(IRIS_SIMD_X86)
+		IRIS_TARGET_F16C void PackHalfF16C(const float32* src, float16* dst, size_t count) noexcept
+		{
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half);
+			}
+
+			_mm256_zeroupper();
+			PackHalfScalar(src + i, dst + i, count - i);
+		}
+
+		IRIS_TARGET_F16C void UnpackHalfF16C(const float16* src, float32* dst, size_t count) noexcept
+		{
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+			}
+
+			_mm256_zeroupper();
+			UnpackHalfScalar(src + i, dst + i, count - i);
+		}
+
+		// NaN becomes 0 (MAXPS returns its second operand for NaN) and the product rounds to nearest even
+		inline __m128i QuantizeUnormSSE(__m128 value, __m128 scale) noexcept
+		{
+			const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.f));
+			return _mm_cvtps_epi32(_mm_mul_ps(clamped, scale));
+		}
+
+		inline __m128i QuantizeSnormSSE(__m128 value, __m128 scale) noexcept
+		{
+			const __m128 ordered = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+			const __m128 clamped = _mm_min_ps(_mm_max_ps(ordered, _mm_set1_ps(-1.f)), _mm_set1_ps(1.f));
+			return _mm_cvtps_epi32(_mm_mul_ps(clamped, scale));
+		}
+
+		void PackUnorm8SSE(const float32* src, unorm8* dst, size_t count) noexcept
+		{
+			const __m128 scale = _mm_set1_ps(255.f);
+			size_t i = 0;
+
+			for (; i + 16 <= count; i += 16)
+			{
+				const __m128i lo = _mm_packs_epi32(QuantizeUnormSSE(_mm_loadu_ps(src + i), scale), QuantizeUnormSSE(_mm_loadu_ps(src + i + 4), scale));
+				const __m128i hi = _mm_packs_epi32(QuantizeUnormSSE(_mm_loadu_ps(src + i + 8), scale), QuantizeUnormSSE(_mm_loadu_ps(src + i + 12), scale));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+			}
+
+			PackUnorm8Scalar(src + i, dst + i, count - i);
+		}
+
+		void UnpackUnorm8SSE(const unorm8* src, float32* dst, size_t count) noexcept
+		{
+			const __m128i zero = _mm_setzero_si128();
+			const __m128 scale = _mm_set1_ps(1.f / 255.f);
+			size_t i = 0;
+
+			for (; i + 16 <= count; i += 16)
+			{
+				const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+				const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+
+				_mm_storeu_ps(dst + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+				_mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+				_mm_storeu_ps(dst + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+				_mm_storeu_ps(dst + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+			}
+
+			UnpackUnorm8Scalar(src + i, dst + i, count - i);
+		}
+
+		void PackSnorm16SSE(const float32* src, snorm16* dst, size_t count) noexcept
+		{
+			const __m128 scale = _mm_set1_ps(32767.f);
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i packed = _mm_packs_epi32(QuantizeSnormSSE(_mm_loadu_ps(src + i), scale), QuantizeSnormSSE(_mm_loadu_ps(src + i + 4), scale));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+			}
+
+			PackSnorm16Scalar(src + i, dst + i, count - i);
+		}
+
+		void UnpackSnorm16SSE(const snorm16* src, float32* dst, size_t count) noexcept
+		{
+			const __m128 scale = _mm_set1_ps(1.f / 32767.f);
+			const __m128 minusOne = _mm_set1_ps(-1.f);
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+				// Interleaving a word with itself and shifting right arithmetically sign-extends it
+				const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+				const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16);
+
+				_mm_storeu_ps(dst + i + 0, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), scale), minusOne));
+				_mm_storeu_ps(dst + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), scale), minusOne));
+			}
+
+			UnpackSnorm16Scalar(src + i, dst + i, count - i);
+		}
+
+		// Four quadruples are transposed into x, y, z and w lanes, quantized and merged into four words
+		void PackUnorm1010102SSE(const float32* src, unorm1010102* dst, size_t count) noexcept
+		{
+			const __m128 scaleXYZ = _mm_set1_ps(1023.f);
+			const __m128 scaleW = _mm_set1_ps(3.f);
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32* p = src + i * 4;
+
+				__m128 x = _mm_loadu_ps(p + 0);
+				__m128 y = _mm_loadu_ps(p + 4);
+				__m128 z = _mm_loadu_ps(p + 8);
+				__m128 w = _mm_loadu_ps(p + 12);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				__m128i bits = QuantizeUnormSSE(x, scaleXYZ);
+				bits = _mm_or_si128(bits, _mm_slli_epi32(QuantizeUnormSSE(y, scaleXYZ), 10));
+				bits = _mm_or_si128(bits, _mm_slli_epi32(QuantizeUnormSSE(z, scaleXYZ), 20));
+				bits = _mm_or_si128(bits, _mm_slli_epi32(QuantizeUnormSSE(w, scaleW), 30));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bits);
+			}
+
+			PackUnorm1010102Scalar(src + i * 4, dst + i, count - i);
+		}
+
+		void UnpackUnorm1010102SSE(const unorm1010102* src, float32* dst, size_t count) noexcept
+		{
+			const __m128i mask = _mm_set1_epi32(0x3FF);
+			const __m128 scaleXYZ = _mm_set1_ps(1.f / 1023.f);
+			const __m128 scaleW = _mm_set1_ps(1.f / 3.f);
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+				__m128 x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(bits, mask)), scaleXYZ);
+				__m128 y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(bits, 10), mask)), scaleXYZ);
+				__m128 z = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(bits, 20), mask)), scaleXYZ);
+				__m128 w = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 30)), scaleW);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				float32* p = dst + i * 4;
+				_mm_storeu_ps(p + 0, x);
+				_mm_storeu_ps(p + 4, y);
+				_mm_storeu_ps(p + 8, z);
+				_mm_storeu_ps(p + 12, w);
+			}
+
+			UnpackUnorm1010102Scalar(src + i, dst + i * 4, count - i);
+		}
+		inline __m128 Select(__m128 mask, __m128 a, __m128 b) noexcept
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+
+		struct SmallestThreeLanes
+		{
+			__m128i index;
+
+			__m128 a, b, c;
+		};
+
+		// Four quaternions at once, operation for operation the same as Detail::SplitSmallestThree
+		inline SmallestThreeLanes SplitSmallestThreeSSE(const Quaternion* src) noexcept
+		{
+			__m128 w = _mm_loadu_ps(src[0].data);
+			__m128 x = _mm_loadu_ps(src[1].data);
+			__m128 y = _mm_loadu_ps(src[2].data);
+			__m128 z = _mm_loadu_ps(src[3].data);
+			_MM_TRANSPOSE4_PS(w, x, y, z);
+
+			const __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(w, w), _mm_mul_ps(x, x)), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+			const __m128 length = _mm_sqrt_ps(lengthSq);
+			const __m128 divide = _mm_cmpnlt_ps(length, _mm_set1_ps(Math::Epsilon));
+
+			w = Select(divide, _mm_div_ps(w, length), w);
+			x = Select(divide, _mm_div_ps(x, length), x);
+			y = Select(divide, _mm_div_ps(y, length), y);
+			z = Select(divide, _mm_div_ps(z, length), z);
+
+			const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+			__m128 largest = _mm_and_ps(w, absMask);
+			__m128 value = w;
+			__m128 index = _mm_setzero_ps();
+
+			const __m128 candidates[3] = { x,y,z };
+
+			for (int32 i = 0; i < 3; ++i)
+			{
+				const __m128 magnitude = _mm_and_ps(candidates[i], absMask);
+				const __m128 greater = _mm_cmpgt_ps(magnitude, largest);
+				largest = _mm_max_ps(magnitude, largest);
+				value = Select(greater, candidates[i], value);
+				index = Select(greater, _mm_castsi128_ps(_mm_set1_epi32(i + 1)), index);
+			}
+
+			const __m128i indexBits = _mm_castps_si128(index);
+			const __m128 sign = _mm_and_ps(value, _mm_castsi128_ps(_mm_set1_epi32(static_cast<int32>(0x80000000u))));
+			const __m128 first = _mm_castsi128_ps(_mm_cmpeq_epi32(indexBits, _mm_setzero_si128()));
+			const __m128 belowTwo = _mm_castsi128_ps(_mm_cmplt_epi32(indexBits, _mm_set1_epi32(2)));
+			const __m128 belowThree = _mm_castsi128_ps(_mm_cmplt_epi32(indexBits, _mm_set1_epi32(3)));
+
+			return SmallestThreeLanes
+			{
+				indexBits,
+				_mm_xor_ps(Select(first, x, w), sign),
+				_mm_xor_ps(Select(belowTwo, y, x), sign),
+				_mm_xor_ps(Select(belowThree, z, y), sign)
+			};
+		}
+
+		inline __m128i QuantizeSmallestThreeSSE(__m128 value, __m128 scale) noexcept
+		{
+			const __m128 shifted = _mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(Detail::SmallestThreeScale)), _mm_set1_ps(0.5f));
+			return QuantizeUnormSSE(shifted, scale);
+		}
+
+		inline __m128 DequantizeSmallestThreeSSE(__m128i value, __m128 inverseScale) noexcept
+		{
+			const __m128 unit = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(value), inverseScale), _mm_set1_ps(0.5f));
+			return _mm_mul_ps(unit, _mm_set1_ps(Detail::SmallestThreeInverseScale));
+		}
+
+		inline void JoinSmallestThreeSSE(__m128i index, __m128 a, __m128 b, __m128 c, Quaternion* dst) noexcept
+		{
+			const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+			const __m128 largest = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.f), sum), _mm_setzero_ps()));
+
+			const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()));
+			const __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+			const __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+			const __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+			const __m128 belowTwo = _mm_or_ps(is0, is1);
+
+			__m128 w = Select(is0, largest, a);
+			__m128 x = Select(is0, a, Select(is1, largest, b));
+			__m128 y = Select(belowTwo, b, Select(is2, largest, c));
+			__m128 z = Select(is3, largest, c);
+			_MM_TRANSPOSE4_PS(w, x, y, z);
+
+			_mm_storeu_ps(dst[0].data, w);
+			_mm_storeu_ps(dst[1].data, x);
+			_mm_storeu_ps(dst[2].data, y);
+			_mm_storeu_ps(dst[3].data, z);
+		}
+
+		void PackQuaternion32SSE(const Quaternion* src, PackedQuaternion32* dst, size_t count) noexcept
+		{
+			const __m128 scale = _mm_set1_ps(1023.f);
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const auto split = SplitSmallestThreeSSE(src + i);
+
+				__m128i bits = _mm_slli_epi32(split.index, 30);
+				bits = _mm_or_si128(bits, _mm_slli_epi32(QuantizeSmallestThreeSSE(split.a, scale), 20));
+				bits = _mm_or_si128(bits, _mm_slli_epi32(QuantizeSmallestThreeSSE(split.b, scale), 10));
+				bits = _mm_or_si128(bits, QuantizeSmallestThreeSSE(split.c, scale));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bits);
+			}
+
+			PackQuaternion32Scalar(src + i, dst + i, count - i);
+		}
+
+		// Six-byte records do not map onto a register, so the three words are assembled per lane and stored scalar
+		void PackQuaternion48SSE(const Quaternion* src, PackedQuaternion48* dst, size_t count) noexcept
+		{
+			const __m128 scale = _mm_set1_ps(32767.f);
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const auto split = SplitSmallestThreeSSE(src + i);
+				const __m128i one = _mm_set1_epi32(1);
+
+				alignas(16) uint32 words[3][4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(words[0]), _mm_or_si128(QuantizeSmallestThreeSSE(split.a, scale), _mm_slli_epi32(_mm_and_si128(split.index, one), 15)));
+				_mm_store_si128(reinterpret_cast<__m128i*>(words[1]), _mm_or_si128(QuantizeSmallestThreeSSE(split.b, scale), _mm_slli_epi32(_mm_srli_epi32(split.index, 1), 15)));
+				_mm_store_si128(reinterpret_cast<__m128i*>(words[2]), QuantizeSmallestThreeSSE(split.c, scale));
+
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					dst[i + lane].bits[0] = static_cast<uint16>(words[0][lane]);
+					dst[i + lane].bits[1] = static_cast<uint16>(words[1][lane]);
+					dst[i + lane].bits[2] = static_cast<uint16>(words[2][lane]);
+				}
+			}
+
+			PackQuaternion48Scalar(src + i, dst + i, count - i);
+		}
+
+		void UnpackQuaternion32SSE(const PackedQuaternion32* src, Quaternion* dst, size_t count) noexcept
+		{
+			const __m128i mask = _mm_set1_epi32(0x3FF);
+			const __m128 inverseScale = _mm_set1_ps(1.f / 1023.f);
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+				const __m128 a = DequantizeSmallestThreeSSE(_mm_and_si128(_mm_srli_epi32(bits, 20), mask), inverseScale);
+				const __m128 b = DequantizeSmallestThreeSSE(_mm_and_si128(_mm_srli_epi32(bits, 10), mask), inverseScale);
+				const __m128 c = DequantizeSmallestThreeSSE(_mm_and_si128(bits, mask), inverseScale);
+
+				JoinSmallestThreeSSE(_mm_srli_epi32(bits, 30), a, b, c, dst + i);
+			}
+
+			UnpackQuaternion32Scalar(src + i, dst + i, count - i);
+		}
+
+		void UnpackQuaternion48SSE(const PackedQuaternion48* src, Quaternion* dst, size_t count) noexcept
+		{
+			const __m128i mask = _mm_set1_epi32(0x7FFF);
+			const __m128 inverseScale = _mm_set1_ps(1.f / 32767.f);
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const auto* p = src + i;
+
+				const __m128i a = _mm_setr_epi32(p[0].bits[0], p[1].bits[0], p[2].bits[0], p[3].bits[0]);
+				const __m128i b = _mm_setr_epi32(p[0].bits[1], p[1].bits[1], p[2].bits[1], p[3].bits[1]);
+				const __m128i c = _mm_setr_epi32(p[0].bits[2], p[1].bits[2], p[2].bits[2], p[3].bits[2]);
+				const __m128i index = _mm_or_si128(_mm_srli_epi32(a, 15), _mm_slli_epi32(_mm_srli_epi32(b, 15), 1));
+
+				JoinSmallestThreeSSE(index,
+					DequantizeSmallestThreeSSE(_mm_and_si128(a, mask), inverseScale),
+					DequantizeSmallestThreeSSE(_mm_and_si128(b, mask), inverseScale),
+					DequantizeSmallestThreeSSE(_mm_and_si128(c, mask), inverseScale),
+					dst + i);
+			}
+
+			UnpackQuaternion48Scalar(src + i, dst + i, count - i);
+		}
+#endif
+
+		PackHalfKernel SelectPackHalfKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			if (CPUFeature::Get().f16c)
+				return PackHalfF16C;
+#endif
+			return PackHalfScalar;
+		}
+
+		UnpackHalfKernel SelectUnpackHalfKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			if (CPUFeature::Get().f16c)
+				return UnpackHalfF16C;
+#endif
+			return UnpackHalfScalar;
+		}
+
+		template<class Source, class Destination>
+		void CheckCapacity(std::span<Source> source, std::span<Destination> destination, const char* name)
+		{
+			if (destination.size() < source.size())
+				throw Error::OutOfRange{ name };
+		}
+	}
+
+	void Pack(std::span<const float32> source, std::span<float16> destination)
+	{
+		CheckCapacity(source, destination, "Pack(span<const float32>,span<float16>)");
+
+		static const PackHalfKernel kernel = SelectPackHalfKernel();
+		kernel(source.data(), destination.data(), source.size());
+	}
+
+	void Pack(std::span<const float32> source, std::span<unorm8> destination)
+	{
+		CheckCapacity(source, destination, "Pack(span<const float32>,span<unorm8>)");
+
+#if defined(IRIS_SIMD_X86)
+		PackUnorm8SSE(source.data(), destination.data(), source.size());
+#else
+		PackUnorm8Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Pack(std::span<const float32> source, std::span<snorm16> destination)
+	{
+		CheckCapacity(source, destination, "Pack(span<const float32>,span<snorm16>)");
+
+#if defined(IRIS_SIMD_X86)
+		PackSnorm16SSE(source.data(), destination.data(), source.size());
+#else
+		PackSnorm16Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Pack(std::span<const float32> source, std::span<unorm1010102> destination)
+	{
+		if (source.size() % 4 != 0 || destination.size() < source.size() / 4)
+			throw Error::OutOfRange{ "Pack(span<const float32>,span<unorm1010102>)" };
+
+#if defined(IRIS_SIMD_X86)
+		PackUnorm1010102SSE(source.data(), destination.data(), source.size() / 4);
+#else
+		PackUnorm1010102Scalar(source.data(), destination.data(), source.size() / 4);
+#endif
+	}
+
+	void Unpack(std::span<const float16> source, std::span<float32> destination)
+	{
+		CheckCapacity(source, destination, "Unpack(span<const float16>,span<float32>)");
+
+		static const UnpackHalfKernel kernel = SelectUnpackHalfKernel();
+		kernel(source.data(), destination.data(), source.size());
+	}
+
+	void Unpack(std::span<const unorm8> source, std::span<float32> destination)
+	{
+		CheckCapacity(source, destination, "Unpack(span<const unorm8>,span<float32>)");
+
+#if defined(IRIS_SIMD_X86)
+		UnpackUnorm8SSE(source.data(), destination.data(), source.size());
+#else
+		UnpackUnorm8Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Unpack(std::span<const snorm16> source, std::span<float32> destination)
+	{
+		CheckCapacity(source, destination, "Unpack(span<const snorm16>,span<float32>)");
+
+#if defined(IRIS_SIMD_X86)
+		UnpackSnorm16SSE(source.data(), destination.data(), source.size());
+#else
+		UnpackSnorm16Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Unpack(std::span<const unorm1010102> source, std::span<float32> destination)
+	{
+		if (destination.size() / 4 < source.size())
+			throw Error::OutOfRange{ "Unpack(span<const unorm1010102>,span<float32>)" };
+
+#if defined(IRIS_SIMD_X86)
+		UnpackUnorm1010102SSE(source.data(), destination.data(), source.size());
+#else
+		UnpackUnorm1010102Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Pack(std::span<const Quaternion> source, std::span<PackedQuaternion32> destination)
+	{
+		CheckCapacity(source, destination, "Pack(span<const Quaternion>,span<PackedQuaternion32>)");
+
+#if defined(IRIS_SIMD_X86)
+		PackQuaternion32SSE(source.data(), destination.data(), source.size());
+#else
+		PackQuaternion32Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Pack(std::span<const Quaternion> source, std::span<PackedQuaternion48> destination)
+	{
+		CheckCapacity(source, destination, "Pack(span<const Quaternion>,span<PackedQuaternion48>)");
+
+#if defined(IRIS_SIMD_X86)
+		PackQuaternion48SSE(source.data(), destination.data(), source.size());
+#else
+		PackQuaternion48Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Unpack(std::span<const PackedQuaternion32> source, std::span<Quaternion> destination)
+	{
+		CheckCapacity(source, destination, "Unpack(span<const PackedQuaternion32>,span<Quaternion>)");
+
+#if defined(IRIS_SIMD_X86)
+		UnpackQuaternion32SSE(source.data(), destination.data(), source.size());
+#else
+		UnpackQuaternion32Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+
+	void Unpack(std::span<const PackedQuaternion48> source, std::span<Quaternion> destination)
+	{
+		CheckCapacity(source, destination, "Unpack(span<const PackedQuaternion48>,span<Quaternion>)");
+
+#if defined(IRIS_SIMD_X86)
+		UnpackQuaternion48SSE(source.data(), destination.data(), source.size());
+#else
+		UnpackQuaternion48Scalar(source.data(), destination.data(), source.size());
+#endif
+	}
+}
\ No newline at end of file
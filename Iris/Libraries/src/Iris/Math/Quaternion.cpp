@@ -1,12 +1,295 @@
 #include <Iris/Math/Quaternion.hpp>
 #include <Iris/Math/Vector3.hpp>
-#include <iris/Math/Matrix4x4.hpp>
+#include <Iris/Math/Matrix4x4.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
 
 namespace Iris
 {
-	Quaternion::Quaternion(value_type _w, const Vector3& _vector) noexcept
-		: w(_w), x(_vector.x), y(_vector.y), z(_vector.z)
-	{}
+	static_assert(sizeof(Quaternion) == sizeof(float32) * 4, "Quaternion must be tightly packed");
+
+	namespace
+	{
+		// D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP".
+		// sin(t*theta)/sin(theta) is expanded as a polynomial in (cos(theta) - 1);
+		// the last term is scaled by (1 + mu) to absorb the truncation error
+		constexpr float32 SlerpMu = 1.85298109240830f;
+
+		constexpr float32 SlerpU[8] =
+		{
+			1.f / (1 * 3), 1.f / (2 * 5), 1.f / (3 * 7), 1.f / (4 * 9),
+			1.f / (5 * 11), 1.f / (6 * 13), 1.f / (7 * 15), SlerpMu / (8 * 17)
+		};
+
+		constexpr float32 SlerpV[8] =
+		{
+			1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9,
+			5.f / 11, 6.f / 13, 7.f / 15, SlerpMu * 8 / 17
+		};
+
+		using BlendKernel = void(*)(const Quaternion*, const Quaternion*, const float32*, bool, Quaternion*, size_t, bool)noexcept;
+
+		Quaternion SlerpPolynomial(const Quaternion& from, const Quaternion& to, float32 t) noexcept
+		{
+			auto cosTheta = from.dot(to);
+			auto sign = 1.f;
+
+			if (cosTheta < 0.f)
+			{
+				cosTheta = -cosTheta;
+				sign = -1.f;
+			}
+
+			const auto xm1 = cosTheta - 1.f;
+			const auto d = 1.f - t;
+			const auto sqrT = t * t;
+			const auto sqrD = d * d;
+
+			auto cT = 1.f;
+			auto cD = 1.f;
+
+			for (int i = 7; i >= 0; --i)
+			{
+				cT = 1.f + (SlerpU[i] * sqrT - SlerpV[i]) * xm1 * cT;
+				cD = 1.f + (SlerpU[i] * sqrD - SlerpV[i]) * xm1 * cD;
+			}
+
+			return (from * (d * cD)) + (to * (sign * t * cT));
+		}
+
+		void BlendScalar(const Quaternion* from, const Quaternion* to, const float32* t, bool uniform, Quaternion* out, size_t count, bool spherical) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const auto ti = uniform ? t[0] : t[i];
+				out[i] = spherical ? SlerpPolynomial(from[i], to[i], ti) : Quaternion::Nlerp(from[i], to[i], ti);
+			}
+		}
+
+#if defined(IRIS_SIMD_X86)
+		// Lane i of w/x/y/z holds quaternion i; the same shuffle converts back
+		inline void Transpose(__m128& a, __m128& b, __m128& c, __m128& d) noexcept
+		{
+			_MM_TRANSPOSE4_PS(a, b, c, d);
+		}
+
+		void BlendSSE(const Quaternion* from, const Quaternion* to, const float32* t, bool uniform, Quaternion* out, size_t count, bool spherical) noexcept
+		{
+			const __m128 one = _mm_set1_ps(1.f);
+			const __m128 signMask = _mm_set1_ps(-0.f);
+
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 fw = _mm_loadu_ps(from[i + 0].data);
+				__m128 fx = _mm_loadu_ps(from[i + 1].data);
+				__m128 fy = _mm_loadu_ps(from[i + 2].data);
+				__m128 fz = _mm_loadu_ps(from[i + 3].data);
+				Transpose(fw, fx, fy, fz);
+
+				__m128 tw = _mm_loadu_ps(to[i + 0].data);
+				__m128 tx = _mm_loadu_ps(to[i + 1].data);
+				__m128 ty = _mm_loadu_ps(to[i + 2].data);
+				__m128 tz = _mm_loadu_ps(to[i + 3].data);
+				Transpose(tw, tx, ty, tz);
+
+				const __m128 vt = uniform ? _mm_set1_ps(t[0]) : _mm_loadu_ps(t + i);
+				const __m128 vd = _mm_sub_ps(one, vt);
+
+				__m128 cosTheta = _mm_add_ps(_mm_add_ps(_mm_mul_ps(fw, tw), _mm_mul_ps(fx, tx)), _mm_add_ps(_mm_mul_ps(fy, ty), _mm_mul_ps(fz, tz)));
+				const __m128 sign = _mm_and_ps(cosTheta, signMask);
+
+				__m128 wFrom = vd;
+				__m128 wTo = vt;
+
+				if (spherical)
+				{
+					cosTheta = _mm_xor_ps(cosTheta, sign);
+
+					const __m128 xm1 = _mm_sub_ps(cosTheta, one);
+					const __m128 sqrT = _mm_mul_ps(vt, vt);
+					const __m128 sqrD = _mm_mul_ps(vd, vd);
+
+					__m128 cT = one;
+					__m128 cD = one;
+
+					for (int k = 7; k >= 0; --k)
+					{
+						const __m128 u = _mm_set1_ps(SlerpU[k]);
+						const __m128 v = _mm_set1_ps(SlerpV[k]);
+						cT = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u, sqrT), v), xm1), cT));
+						cD = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u, sqrD), v), xm1), cD));
+					}
+
+					wFrom = _mm_mul_ps(vd, cD);
+					wTo = _mm_mul_ps(vt, cT);
+				}
+
+				wTo = _mm_xor_ps(wTo, sign);
+
+				__m128 rw = _mm_add_ps(_mm_mul_ps(fw, wFrom), _mm_mul_ps(tw, wTo));
+				__m128 rx = _mm_add_ps(_mm_mul_ps(fx, wFrom), _mm_mul_ps(tx, wTo));
+				__m128 ry = _mm_add_ps(_mm_mul_ps(fy, wFrom), _mm_mul_ps(ty, wTo));
+				__m128 rz = _mm_add_ps(_mm_mul_ps(fz, wFrom), _mm_mul_ps(tz, wTo));
+
+				if (!spherical)
+				{
+					const __m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rw, rw), _mm_mul_ps(rx, rx)), _mm_add_ps(_mm_mul_ps(ry, ry), _mm_mul_ps(rz, rz)));
+					const __m128 len = _mm_sqrt_ps(lenSq);
+					const __m128 valid = _mm_cmpge_ps(len, _mm_set1_ps(Math::Epsilon));
+					const __m128 scale = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(one, len)), _mm_andnot_ps(valid, one));
+					rw = _mm_mul_ps(rw, scale);
+					rx = _mm_mul_ps(rx, scale);
+					ry = _mm_mul_ps(ry, scale);
+					rz = _mm_mul_ps(rz, scale);
+				}
+
+				Transpose(rw, rx, ry, rz);
+				_mm_storeu_ps(out[i + 0].data, rw);
+				_mm_storeu_ps(out[i + 1].data, rx);
+				_mm_storeu_ps(out[i + 2].data, ry);
+				_mm_storeu_ps(out[i + 3].data, rz);
+			}
+
+			BlendScalar(from + i, to + i, uniform ? t : t + i, uniform, out + i, count - i, spherical);
+		}
+
+		// Quaternions 0-3 go to the low lane and 4-7 to the high lane before the in-lane transpose
+		IRIS_TARGET_AVX2 inline void Transpose(__m256& a, __m256& b, __m256& c, __m256& d) noexcept
+		{
+			const __m256 t0 = _mm256_unpacklo_ps(a, b);
+			const __m256 t1 = _mm256_unpacklo_ps(c, d);
+			const __m256 t2 = _mm256_unpackhi_ps(a, b);
+			const __m256 t3 = _mm256_unpackhi_ps(c, d);
+			a = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+			b = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+			c = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+			d = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+		}
+
+		IRIS_TARGET_AVX2 inline __m256 Load2(const Quaternion* low, const Quaternion* high) noexcept
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low->data)), _mm_loadu_ps(high->data), 1);
+		}
+
+		IRIS_TARGET_AVX2 inline void Store2(Quaternion* low, Quaternion* high, __m256 value) noexcept
+		{
+			_mm_storeu_ps(low->data, _mm256_castps256_ps128(value));
+			_mm_storeu_ps(high->data, _mm256_extractf128_ps(value, 1));
+		}
+
+		IRIS_TARGET_AVX2 void BlendAVX2(const Quaternion* from, const Quaternion* to, const float32* t, bool uniform, Quaternion* out, size_t count, bool spherical) noexcept
+		{
+			const __m256 one = _mm256_set1_ps(1.f);
+			const __m256 signMask = _mm256_set1_ps(-0.f);
+
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 fw = Load2(from + i + 0, from + i + 4);
+				__m256 fx = Load2(from + i + 1, from + i + 5);
+				__m256 fy = Load2(from + i + 2, from + i + 6);
+				__m256 fz = Load2(from + i + 3, from + i + 7);
+				Transpose(fw, fx, fy, fz);
+
+				__m256 tw = Load2(to + i + 0, to + i + 4);
+				__m256 tx = Load2(to + i + 1, to + i + 5);
+				__m256 ty = Load2(to + i + 2, to + i + 6);
+				__m256 tz = Load2(to + i + 3, to + i + 7);
+				Transpose(tw, tx, ty, tz);
+
+				const __m256 vt = uniform ? _mm256_set1_ps(t[0]) : _mm256_loadu_ps(t + i);
+				const __m256 vd = _mm256_sub_ps(one, vt);
+
+				__m256 cosTheta = _mm256_fmadd_ps(fw, tw, _mm256_fmadd_ps(fx, tx, _mm256_fmadd_ps(fy, ty, _mm256_mul_ps(fz, tz))));
+				const __m256 sign = _mm256_and_ps(cosTheta, signMask);
+
+				__m256 wFrom = vd;
+				__m256 wTo = vt;
+
+				if (spherical)
+				{
+					cosTheta = _mm256_xor_ps(cosTheta, sign);
+
+					const __m256 xm1 = _mm256_sub_ps(cosTheta, one);
+					const __m256 sqrT = _mm256_mul_ps(vt, vt);
+					const __m256 sqrD = _mm256_mul_ps(vd, vd);
+
+					__m256 cT = one;
+					__m256 cD = one;
+
+					for (int k = 7; k >= 0; --k)
+					{
+						const __m256 u = _mm256_set1_ps(SlerpU[k]);
+						const __m256 v = _mm256_set1_ps(SlerpV[k]);
+						cT = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_fmsub_ps(u, sqrT, v), xm1), cT, one);
+						cD = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_fmsub_ps(u, sqrD, v), xm1), cD, one);
+					}
+
+					wFrom = _mm256_mul_ps(vd, cD);
+					wTo = _mm256_mul_ps(vt, cT);
+				}
+
+				wTo = _mm256_xor_ps(wTo, sign);
+
+				__m256 rw = _mm256_fmadd_ps(fw, wFrom, _mm256_mul_ps(tw, wTo));
+				__m256 rx = _mm256_fmadd_ps(fx, wFrom, _mm256_mul_ps(tx, wTo));
+				__m256 ry = _mm256_fmadd_ps(fy, wFrom, _mm256_mul_ps(ty, wTo));
+				__m256 rz = _mm256_fmadd_ps(fz, wFrom, _mm256_mul_ps(tz, wTo));
+
+				if (!spherical)
+				{
+					const __m256 lenSq = _mm256_fmadd_ps(rw, rw, _mm256_fmadd_ps(rx, rx, _mm256_fmadd_ps(ry, ry, _mm256_mul_ps(rz, rz))));
+					const __m256 len = _mm256_sqrt_ps(lenSq);
+					const __m256 valid = _mm256_cmp_ps(len, _mm256_set1_ps(Math::Epsilon), _CMP_GE_OQ);
+					const __m256 scale = _mm256_blendv_ps(one, _mm256_div_ps(one, len), valid);
+					rw = _mm256_mul_ps(rw, scale);
+					rx = _mm256_mul_ps(rx, scale);
+					ry = _mm256_mul_ps(ry, scale);
+					rz = _mm256_mul_ps(rz, scale);
+				}
+
+				Transpose(rw, rx, ry, rz);
+				Store2(out + i + 0, out + i + 4, rw);
+				Store2(out + i + 1, out + i + 5, rx);
+				Store2(out + i + 2, out + i + 6, ry);
+				Store2(out + i + 3, out + i + 7, rz);
+			}
+
+			_mm256_zeroupper();
+
+			BlendScalar(from + i, to + i, uniform ? t : t + i, uniform, out + i, count - i, spherical);
+		}
+#endif
+
+		BlendKernel SelectBlendKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			if (cpu.avx2 && cpu.fma)
+				return BlendAVX2;
+
+			return BlendSSE;
+#else
+			return BlendScalar;
+#endif
+		}
+
+		void Blend(std::span<const Quaternion> from, std::span<const Quaternion> to, const float32* t, bool uniform, std::span<Quaternion> output, bool spherical, const char* name)
+		{
+			if (to.size() < from.size() || output.size() < from.size())
+				throw Error::OutOfRange{ name };
+
+			static const BlendKernel kernel = SelectBlendKernel();
+			kernel(from.data(), to.data(), t, uniform, output.data(), from.size(), spherical);
+		}
+	}
 
 	Quaternion Quaternion::Slerp(const Quaternion& from, const Quaternion& to, float32 t)
 	{
@@ -34,13 +317,6 @@ namespace Iris
 		return ((from * w1) + (oq * w2)).normalize();
 	}
 
-	Quaternion Quaternion::FromAxisAngle(const Vector3& axis, float32 radian) noexcept
-	{
-		const auto halfAngle = radian * 0.5f;
-		const auto sin = Math::Sin(halfAngle);
-		return Quaternion{ Math::Cos(halfAngle),axis * sin };
-	}
-
 	Quaternion Quaternion::FromMatrix4x4(const Matrix4x4& matrix)
 	{
 		const auto trace = matrix.m00 + matrix.m11 + matrix.m22;
@@ -51,15 +327,15 @@ namespace Iris
 		{
 			const auto s = 0.5f / Math::Sqrt(trace + 1.f);
 			result.w = 0.25f / s;
-			result.x = (matrix.m21 - matrix.m12) * s;
-			result.y = (matrix.m02 - matrix.m20) * s;
-			result.z = (matrix.m10 - matrix.m01) * s;
+			result.x = (matrix.m12 - matrix.m21) * s;
+			result.y = (matrix.m20 - matrix.m02) * s;
+			result.z = (matrix.m01 - matrix.m10) * s;
 		}
 		else
 		{
 			if (matrix.m00 > matrix.m11 && matrix.m00 > matrix.m22) {
 				const auto s = 2.f * Math::Sqrt(1.f + matrix.m00 - matrix.m11 - matrix.m22);
-				result.w = (matrix.m21 - matrix.m12) / s;
+				result.w = (matrix.m12 - matrix.m21) / s;
 				result.x = 0.25f * s;
 				result.y = (matrix.m01 + matrix.m10) / s;
 				result.z = (matrix.m02 + matrix.m20) / s;
@@ -67,7 +343,7 @@ namespace Iris
 			else if (matrix.m11 > matrix.m22)
 			{
 				const auto s = 2.f * Math::Sqrt(1.f + matrix.m11 - matrix.m00 - matrix.m22);
-				result.w = (matrix.m02 - matrix.m20) / s;
+				result.w = (matrix.m20 - matrix.m02) / s;
 				result.x = (matrix.m01 + matrix.m10) / s;
 				result.y = 0.25f * s;
 				result.z = (matrix.m12 + matrix.m21) / s;
@@ -75,7 +351,7 @@ namespace Iris
 			else 
 			{
 				const auto s = 2.f * Math::Sqrt(1.f + matrix.m22 - matrix.m00 - matrix.m11);
-				result.w = (matrix.m10 - matrix.m01) / s;
+				result.w = (matrix.m01 - matrix.m10) / s;
 				result.x = (matrix.m02 + matrix.m20) / s;
 				result.y = (matrix.m12 + matrix.m21) / s;
 				result.z = 0.25f * s;
@@ -84,4 +360,36 @@ namespace Iris
 
 		return result.normalize();
 	}
+
+	Quaternion Quaternion::Nlerp(const Quaternion& from, const Quaternion& to, float32 t) noexcept
+	{
+		const auto sign = (from.dot(to) < 0.f) ? -1.f : 1.f;
+		return Lerp(from, to * sign, t).normalize();
+	}
+
+	void Quaternion::SlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float32> t, std::span<Quaternion> output)
+	{
+		if (t.size() < from.size())
+			throw Error::OutOfRange{ "Quaternion::SlerpBatch(span,span,span,span)" };
+
+		Blend(from, to, t.data(), false, output, true, "Quaternion::SlerpBatch(span,span,span,span)");
+	}
+
+	void Quaternion::SlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float32 t, std::span<Quaternion> output)
+	{
+		Blend(from, to, &t, true, output, true, "Quaternion::SlerpBatch(span,span,float32,span)");
+	}
+
+	void Quaternion::NlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float32> t, std::span<Quaternion> output)
+	{
+		if (t.size() < from.size())
+			throw Error::OutOfRange{ "Quaternion::NlerpBatch(span,span,span,span)" };
+
+		Blend(from, to, t.data(), false, output, false, "Quaternion::NlerpBatch(span,span,span,span)");
+	}
+
+	void Quaternion::NlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float32 t, std::span<Quaternion> output)
+	{
+		Blend(from, to, &t, true, output, false, "Quaternion::NlerpBatch(span,span,float32,span)");
+	}
 }
\ No newline at end of file
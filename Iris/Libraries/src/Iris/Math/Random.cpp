@@ -0,0 +1,531 @@
+#include <Iris/Math/Random.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#include <chrono>
+#include <mutex>
+
+#if defined(IRIS_SIMD_X86)
+	#include <Iris/Math/FastMath.hpp>
+#endif
+
+namespace Iris
+{
+	namespace
+	{
+		// Eight xoshiro256++ generators advanced in lockstep; s[word][lane]
+		struct Lanes final
+		{
+			alignas(32) uint64 s[4][8];
+		};
+
+		// Output is lane-interleaved: step n writes lanes 0..7 as 16 uint32 (low word first)
+		using LaneKernel = void(*)(Lanes&, uint32*, size_t)noexcept;
+
+		// uint32 per chunk; also the granularity of the lane kernels (16) times 64
+		constexpr size_t ChunkSize = 1024;
+
+		// Below this many values the lane setup costs more than it saves
+		constexpr size_t MinLaneCount = 64;
+
+		Lanes SeedLanes(Xoshiro256& generator) noexcept
+		{
+			Lanes lanes;
+			auto seed = generator();
+
+			for (auto& word : lanes.s)
+			{
+				for (auto& lane : word)
+				{
+					lane = Detail::SplitMix64(seed);
+				}
+			}
+
+			return lanes;
+		}
+
+		[[maybe_unused]] void NextLanesScalar(Lanes& lanes, uint32* out, size_t count) noexcept
+		{
+			auto& s = lanes.s;
+
+			for (size_t i = 0; i < count; i += 16)
+			{
+				for (size_t lane = 0; lane < 8; ++lane)
+				{
+					const auto result = std::rotl(s[0][lane] + s[3][lane], 23) + s[0][lane];
+					const auto t = s[1][lane] << 17;
+
+					s[2][lane] ^= s[0][lane];
+					s[3][lane] ^= s[1][lane];
+					s[1][lane] ^= s[2][lane];
+					s[0][lane] ^= s[3][lane];
+					s[2][lane] ^= t;
+					s[3][lane] = std::rotl(s[3][lane], 45);
+
+					out[i + lane * 2] = static_cast<uint32>(result);
+					out[i + lane * 2 + 1] = static_cast<uint32>(result >> 32);
+				}
+			}
+		}
+
+#if defined(IRIS_SIMD_X86)
+		template<int32 K>
+		inline __m128i Rotl(__m128i x) noexcept
+		{
+			return _mm_or_si128(_mm_slli_epi64(x, K), _mm_srli_epi64(x, 64 - K));
+		}
+
+		void NextLanesSSE(Lanes& lanes, uint32* out, size_t count) noexcept
+		{
+			__m128i s[4][4];
+
+			for (size_t w = 0; w < 4; ++w)
+			{
+				for (size_t p = 0; p < 4; ++p)
+				{
+					s[w][p] = _mm_load_si128(reinterpret_cast<const __m128i*>(&lanes.s[w][p * 2]));
+				}
+			}
+
+			for (size_t i = 0; i < count; i += 16)
+			{
+				for (size_t p = 0; p < 4; ++p)
+				{
+					const __m128i result = _mm_add_epi64(Rotl<23>(_mm_add_epi64(s[0][p], s[3][p])), s[0][p]);
+					const __m128i t = _mm_slli_epi64(s[1][p], 17);
+
+					s[2][p] = _mm_xor_si128(s[2][p], s[0][p]);
+					s[3][p] = _mm_xor_si128(s[3][p], s[1][p]);
+					s[1][p] = _mm_xor_si128(s[1][p], s[2][p]);
+					s[0][p] = _mm_xor_si128(s[0][p], s[3][p]);
+					s[2][p] = _mm_xor_si128(s[2][p], t);
+					s[3][p] = Rotl<45>(s[3][p]);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + p * 4), result);
+				}
+			}
+
+			for (size_t w = 0; w < 4; ++w)
+			{
+				for (size_t p = 0; p < 4; ++p)
+				{
+					_mm_store_si128(reinterpret_cast<__m128i*>(&lanes.s[w][p * 2]), s[w][p]);
+				}
+			}
+		}
+
+		template<int32 K>
+		IRIS_TARGET_AVX2 inline __m256i Rotl(__m256i x) noexcept
+		{
+			return _mm256_or_si256(_mm256_slli_epi64(x, K), _mm256_srli_epi64(x, 64 - K));
+		}
+
+		IRIS_TARGET_AVX2 void NextLanesAVX2(Lanes& lanes, uint32* out, size_t count) noexcept
+		{
+			__m256i s[4][2];
+
+			for (size_t w = 0; w < 4; ++w)
+			{
+				for (size_t h = 0; h < 2; ++h)
+				{
+					s[w][h] = _mm256_load_si256(reinterpret_cast<const __m256i*>(&lanes.s[w][h * 4]));
+				}
+			}
+
+			for (size_t i = 0; i < count; i += 16)
+			{
+				for (size_t h = 0; h < 2; ++h)
+				{
+					const __m256i result = _mm256_add_epi64(Rotl<23>(_mm256_add_epi64(s[0][h], s[3][h])), s[0][h]);
+					const __m256i t = _mm256_slli_epi64(s[1][h], 17);
+
+					s[2][h] = _mm256_xor_si256(s[2][h], s[0][h]);
+					s[3][h] = _mm256_xor_si256(s[3][h], s[1][h]);
+					s[1][h] = _mm256_xor_si256(s[1][h], s[2][h]);
+					s[0][h] = _mm256_xor_si256(s[0][h], s[3][h]);
+					s[2][h] = _mm256_xor_si256(s[2][h], t);
+					s[3][h] = Rotl<45>(s[3][h]);
+
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + h * 8), result);
+				}
+			}
+
+			for (size_t w = 0; w < 4; ++w)
+			{
+				for (size_t h = 0; h < 2; ++h)
+				{
+					_mm256_store_si256(reinterpret_cast<__m256i*>(&lanes.s[w][h * 4]), s[w][h]);
+				}
+			}
+
+			_mm256_zeroupper();
+		}
+#endif
+
+		LaneKernel SelectLaneKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			// IRIS_TARGET_AVX2 also enables FMA, so the kernel needs both like every other AVX2 kernel
+			if (cpu.avx2 && cpu.fma)
+				return NextLanesAVX2;
+
+			return NextLanesSSE;
+#else
+			return NextLanesScalar;
+#endif
+		}
+
+		// 'count' must be a multiple of 16
+		void NextLanes(Lanes& lanes, uint32* out, size_t count) noexcept
+		{
+			static const LaneKernel kernel = SelectLaneKernel();
+			kernel(lanes, out, count);
+		}
+
+		constexpr size_t RoundUp(size_t value, size_t multiple) noexcept
+		{
+			return (value + multiple - 1) / multiple * multiple;
+		}
+
+		// Per-element mappings from 'Words' uniform [0, 1) values; the SSE versions map four elements per component register
+
+		struct OnCircle final
+		{
+			static constexpr size_t Words = 1;
+
+			static Vector2 Make(const float32* u) noexcept
+			{
+				float32 sin, cos;
+				Math::FastSinCos(u[0] * (2.f * Math::Pi), sin, cos);
+				return Vector2{ cos,sin };
+			}
+
+#if defined(IRIS_SIMD_X86)
+			static void Make(const __m128* u, __m128* out) noexcept
+			{
+				Math::FastSinCos(_mm_mul_ps(u[0], _mm_set1_ps(2.f * Math::Pi)), out[1], out[0]);
+			}
+#endif
+		};
+
+		// The larger of two uniforms has density 2r, which is what the area element of a disc needs
+		struct InsideCircle final
+		{
+			static constexpr size_t Words = 3;
+
+			static Vector2 Make(const float32* u) noexcept
+			{
+				return OnCircle::Make(u) * Max(u[1], u[2]);
+			}
+
+#if defined(IRIS_SIMD_X86)
+			static void Make(const __m128* u, __m128* out) noexcept
+			{
+				const __m128 radius = _mm_max_ps(u[1], u[2]);
+				OnCircle::Make(u, out);
+				out[0] = _mm_mul_ps(out[0], radius);
+				out[1] = _mm_mul_ps(out[1], radius);
+			}
+#endif
+		};
+
+		// Archimedes: z is uniform on [-1, 1] for a uniform point on the sphere
+		struct OnSphere final
+		{
+			static constexpr size_t Words = 2;
+
+			static Vector3 Make(const float32* u) noexcept
+			{
+				const auto z = u[0] * 2.f - 1.f;
+				const auto r = std::sqrt(Max(1.f - z * z, 0.f));
+
+				float32 sin, cos;
+				Math::FastSinCos(u[1] * (2.f * Math::Pi), sin, cos);
+				return Vector3{ r * cos,r * sin,z };
+			}
+
+#if defined(IRIS_SIMD_X86)
+			static void Make(const __m128* u, __m128* out) noexcept
+			{
+				const __m128 z = _mm_sub_ps(_mm_add_ps(u[0], u[0]), _mm_set1_ps(1.f));
+				const __m128 r = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(z, z)), _mm_setzero_ps()));
+
+				__m128 sin, cos;
+				Math::FastSinCos(_mm_mul_ps(u[1], _mm_set1_ps(2.f * Math::Pi)), sin, cos);
+				out[0] = _mm_mul_ps(r, cos);
+				out[1] = _mm_mul_ps(r, sin);
+				out[2] = z;
+			}
+#endif
+		};
+
+		// The largest of three uniforms has density 3r^2, matching the volume element of a ball
+		struct InsideSphere final
+		{
+			static constexpr size_t Words = 5;
+
+			static Vector3 Make(const float32* u) noexcept
+			{
+				return OnSphere::Make(u) * Max(Max(u[2], u[3]), u[4]);
+			}
+
+#if defined(IRIS_SIMD_X86)
+			static void Make(const __m128* u, __m128* out) noexcept
+			{
+				const __m128 radius = _mm_max_ps(_mm_max_ps(u[2], u[3]), u[4]);
+				OnSphere::Make(u, out);
+				out[0] = _mm_mul_ps(out[0], radius);
+				out[1] = _mm_mul_ps(out[1], radius);
+				out[2] = _mm_mul_ps(out[2], radius);
+			}
+#endif
+		};
+
+		// Shoemake, "Uniform random rotations" (Graphics Gems III)
+		struct Rotation final
+		{
+			static constexpr size_t Words = 3;
+
+			static Quaternion Make(const float32* u) noexcept
+			{
+				const auto r1 = std::sqrt(1.f - u[0]);
+				const auto r2 = std::sqrt(u[0]);
+
+				float32 sin1, cos1, sin2, cos2;
+				Math::FastSinCos(u[1] * (2.f * Math::Pi), sin1, cos1);
+				Math::FastSinCos(u[2] * (2.f * Math::Pi), sin2, cos2);
+				return Quaternion{ r2 * cos2,r1 * sin1,r1 * cos1,r2 * sin2 };
+			}
+
+#if defined(IRIS_SIMD_X86)
+			static void Make(const __m128* u, __m128* out) noexcept
+			{
+				const __m128 r1 = _mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.f), u[0]));
+				const __m128 r2 = _mm_sqrt_ps(u[0]);
+
+				__m128 sin1, cos1, sin2, cos2;
+				Math::FastSinCos(_mm_mul_ps(u[1], _mm_set1_ps(2.f * Math::Pi)), sin1, cos1);
+				Math::FastSinCos(_mm_mul_ps(u[2], _mm_set1_ps(2.f * Math::Pi)), sin2, cos2);
+				out[0] = _mm_mul_ps(r2, cos2);
+				out[1] = _mm_mul_ps(r1, sin1);
+				out[2] = _mm_mul_ps(r1, cos1);
+				out[3] = _mm_mul_ps(r2, sin2);
+			}
+#endif
+		};
+
+#if defined(IRIS_SIMD_X86)
+		inline __m128 UnitFloats(__m128i bits) noexcept
+		{
+			return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 8)), _mm_set1_ps(1.f / 16777216.f));
+		}
+#endif
+
+		// Each chunk lays its uniforms out as 'Words' separate streams, maps them to component streams, then interleaves
+		template<class Shape, class Value>
+		void FillShapes(Xoshiro256& generator, std::span<Value> values) noexcept
+		{
+			constexpr size_t Words = Shape::Words;
+			constexpr size_t Components = sizeof(Value) / sizeof(float32);
+			constexpr size_t Stride = ChunkSize / Max(Words, Components) / 4 * 4;
+
+			if (values.size() < MinLaneCount)
+			{
+				for (auto& value : values)
+				{
+					float32 u[Words];
+
+					for (auto& word : u)
+					{
+						word = generator.nextFloat();
+					}
+
+					value = Shape::Make(u);
+				}
+
+				return;
+			}
+
+			auto lanes = SeedLanes(generator);
+
+			alignas(32) uint32 bits[ChunkSize];
+			alignas(16) float32 components[ChunkSize];
+
+			for (size_t first = 0; first < values.size(); first += Stride)
+			{
+				const auto count = Min(values.size() - first, Stride);
+				const auto stride = RoundUp(count, 4);
+
+				NextLanes(lanes, bits, RoundUp(stride * Words, 16));
+
+#if defined(IRIS_SIMD_X86)
+				for (size_t i = 0; i < stride; i += 4)
+				{
+					__m128 u[Words];
+					__m128 out[Components];
+
+					for (size_t w = 0; w < Words; ++w)
+					{
+						u[w] = UnitFloats(_mm_load_si128(reinterpret_cast<const __m128i*>(bits + w * stride + i)));
+					}
+
+					Shape::Make(u, out);
+
+					for (size_t c = 0; c < Components; ++c)
+					{
+						_mm_store_ps(components + c * stride + i, out[c]);
+					}
+				}
+#else
+				for (size_t i = 0; i < count; ++i)
+				{
+					float32 u[Words];
+
+					for (size_t w = 0; w < Words; ++w)
+					{
+						u[w] = Detail::UnitFloat(bits[w * stride + i]);
+					}
+
+					const auto value = Shape::Make(u);
+
+					for (size_t c = 0; c < Components; ++c)
+					{
+						components[c * stride + i] = value.data[c];
+					}
+				}
+#endif
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					auto& value = values[first + i];
+
+					for (size_t c = 0; c < Components; ++c)
+					{
+						value.data[c] = components[c * stride + i];
+					}
+				}
+			}
+		}
+	}
+
+	void Xoshiro256::fill(std::span<uint32> _values) noexcept
+	{
+		if (_values.size() < MinLaneCount)
+		{
+			for (size_t i = 0; i < _values.size(); i += 2)
+			{
+				const auto bits = (*this)();
+				_values[i] = static_cast<uint32>(bits);
+
+				if (i + 1 < _values.size())
+					_values[i + 1] = static_cast<uint32>(bits >> 32);
+			}
+
+			return;
+		}
+
+		auto lanes = SeedLanes(*this);
+
+		const auto bulk = _values.size() / 16 * 16;
+		NextLanes(lanes, _values.data(), bulk);
+
+		if (bulk < _values.size())
+		{
+			uint32 tail[16];
+			NextLanes(lanes, tail, 16);
+
+			for (size_t i = bulk; i < _values.size(); ++i)
+			{
+				_values[i] = tail[i - bulk];
+			}
+		}
+	}
+
+	void Xoshiro256::fill(std::span<float32> _values, float32 _min, float32 _max) noexcept
+	{
+		const auto scale = _max - _min;
+
+		if (_values.size() < MinLaneCount)
+		{
+			for (auto& value : _values)
+			{
+				value = _min + scale * nextFloat();
+			}
+
+			return;
+		}
+
+		auto lanes = SeedLanes(*this);
+
+		alignas(32) uint32 bits[ChunkSize];
+
+		for (size_t first = 0; first < _values.size(); first += ChunkSize)
+		{
+			const auto count = Min(_values.size() - first, ChunkSize);
+			float32* out = _values.data() + first;
+
+			NextLanes(lanes, bits, RoundUp(count, 16));
+
+			size_t i = 0;
+
+#if defined(IRIS_SIMD_X86)
+			const __m128 vScale = _mm_set1_ps(scale);
+			const __m128 vMin = _mm_set1_ps(_min);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 u = UnitFloats(_mm_load_si128(reinterpret_cast<const __m128i*>(bits + i)));
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(u, vScale), vMin));
+			}
+#endif
+
+			for (; i < count; ++i)
+			{
+				out[i] = _min + scale * Detail::UnitFloat(bits[i]);
+			}
+		}
+	}
+
+	void Xoshiro256::fillOnCircle(std::span<Vector2> _values) noexcept
+	{
+		FillShapes<OnCircle>(*this, _values);
+	}
+
+	void Xoshiro256::fillInsideCircle(std::span<Vector2> _values) noexcept
+	{
+		FillShapes<InsideCircle>(*this, _values);
+	}
+
+	void Xoshiro256::fillOnSphere(std::span<Vector3> _values) noexcept
+	{
+		FillShapes<OnSphere>(*this, _values);
+	}
+
+	void Xoshiro256::fillInsideSphere(std::span<Vector3> _values) noexcept
+	{
+		FillShapes<InsideSphere>(*this, _values);
+	}
+
+	void Xoshiro256::fillRotations(std::span<Quaternion> _values) noexcept
+	{
+		FillShapes<Rotation>(*this, _values);
+	}
+
+	Xoshiro256& Xoshiro256::ThreadLocal() noexcept
+	{
+		static std::mutex mutex;
+		static Xoshiro256 master{ static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count()) };
+
+		thread_local Xoshiro256 generator = []()
+		{
+			std::lock_guard lock{ mutex };
+
+			const auto result = master;
+			master.jump();
+			return result;
+		}();
+
+		return generator;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,482 @@
+#include <Iris/Math/Skinning.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+#include <Iris/Common/Parallel.hpp>
+
+#include <thread>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	static_assert(sizeof(DualQuaternion) == sizeof(float32) * 8, "DualQuaternion must be two packed Quaternions");
+
+	namespace
+	{
+		template<class Bone>
+		using SkinKernel = void(*)(const Bone* palette, const SkinningInput& input, const SkinningOutput& output, bool normals, size_t first, size_t last)noexcept;
+
+		[[maybe_unused]] void SkinLinearScalar(const Matrix4x4* palette, const SkinningInput& input, const SkinningOutput& output, bool normals, size_t first, size_t last) noexcept
+		{
+			for (size_t i = first; i < last; ++i)
+			{
+				const auto& bones = input.bones[i];
+				const auto& weights = input.weights[i];
+
+				float32 m[4][3] = {};
+
+				for (size_t k = 0; k < 4; ++k)
+				{
+					const auto& bone = palette[bones[k]];
+
+					for (size_t r = 0; r < 4; ++r)
+					{
+						m[r][0] += weights[k] * bone.m[r][0];
+						m[r][1] += weights[k] * bone.m[r][1];
+						m[r][2] += weights[k] * bone.m[r][2];
+					}
+				}
+
+				const auto x = input.positionX[i];
+				const auto y = input.positionY[i];
+				const auto z = input.positionZ[i];
+
+				output.positionX[i] = x * m[0][0] + y * m[1][0] + z * m[2][0] + m[3][0];
+				output.positionY[i] = x * m[0][1] + y * m[1][1] + z * m[2][1] + m[3][1];
+				output.positionZ[i] = x * m[0][2] + y * m[1][2] + z * m[2][2] + m[3][2];
+
+				if (normals)
+				{
+					const auto nx = input.normalX[i];
+					const auto ny = input.normalY[i];
+					const auto nz = input.normalZ[i];
+
+					const auto normal = Vector3
+					{
+						nx * m[0][0] + ny * m[1][0] + nz * m[2][0],
+						nx * m[0][1] + ny * m[1][1] + nz * m[2][1],
+						nx * m[0][2] + ny * m[1][2] + nz * m[2][2]
+					}.normalize();
+
+					output.normalX[i] = normal.x;
+					output.normalY[i] = normal.y;
+					output.normalZ[i] = normal.z;
+				}
+			}
+		}
+
+		DualQuaternion BlendInfluences(const DualQuaternion* palette, const std::array<uint16, 4>& bones, const std::array<float32, 4>& weights) noexcept
+		{
+			const auto& pivot = palette[bones[0]];
+			auto blended = pivot * weights[0];
+
+			for (size_t k = 1; k < 4; ++k)
+			{
+				const auto& bone = palette[bones[k]];
+				blended += bone * (pivot.dot(bone) < 0.f ? -weights[k] : weights[k]);
+			}
+
+			return blended.normalize();
+		}
+
+		[[maybe_unused]] void SkinDualQuaternionScalar(const DualQuaternion* palette, const SkinningInput& input, const SkinningOutput& output, bool normals, size_t first, size_t last) noexcept
+		{
+			for (size_t i = first; i < last; ++i)
+			{
+				const auto blended = BlendInfluences(palette, input.bones[i], input.weights[i]);
+				const auto position = blended.transformPoint(Vector3{ input.positionX[i],input.positionY[i],input.positionZ[i] });
+
+				output.positionX[i] = position.x;
+				output.positionY[i] = position.y;
+				output.positionZ[i] = position.z;
+
+				if (normals)
+				{
+					const auto normal = blended.transformDirection(Vector3{ input.normalX[i],input.normalY[i],input.normalZ[i] });
+
+					output.normalX[i] = normal.x;
+					output.normalY[i] = normal.y;
+					output.normalZ[i] = normal.z;
+				}
+			}
+		}
+
+#if defined(IRIS_SIMD_X86)
+		// Four AoS results (x, y, z, unused) are transposed and stored to the SoA outputs
+		inline void StoreTransposed(__m128 v0, __m128 v1, __m128 v2, __m128 v3, float32* x, float32* y, float32* z) noexcept
+		{
+			_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+			_mm_storeu_ps(x, v0);
+			_mm_storeu_ps(y, v1);
+			_mm_storeu_ps(z, v2);
+		}
+
+		inline void NormalizeAndStore(__m128 v0, __m128 v1, __m128 v2, __m128 v3, float32* x, float32* y, float32* z) noexcept
+		{
+			_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+			const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(v0, v0), _mm_mul_ps(v1, v1)), _mm_mul_ps(v2, v2)));
+			const __m128 inverse = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.f), length), _mm_cmpgt_ps(length, _mm_setzero_ps()));
+
+			_mm_storeu_ps(x, _mm_mul_ps(v0, inverse));
+			_mm_storeu_ps(y, _mm_mul_ps(v1, inverse));
+			_mm_storeu_ps(z, _mm_mul_ps(v2, inverse));
+		}
+
+		void SkinLinearSSE(const Matrix4x4* palette, const SkinningInput& input, const SkinningOutput& output, bool normals, size_t first, size_t last) noexcept
+		{
+			size_t i = first;
+
+			for (; i + 4 <= last; i += 4)
+			{
+				__m128 position[4];
+				__m128 normal[4];
+
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					const auto v = i + lane;
+					const auto& bones = input.bones[v];
+					const auto& weights = input.weights[v];
+
+					__m128 r0 = _mm_setzero_ps(), r1 = _mm_setzero_ps(), r2 = _mm_setzero_ps(), r3 = _mm_setzero_ps();
+
+					for (size_t k = 0; k < 4; ++k)
+					{
+						const auto& bone = palette[bones[k]];
+						const __m128 w = _mm_set1_ps(weights[k]);
+
+						r0 = _mm_add_ps(r0, _mm_mul_ps(w, _mm_load_ps(bone.m0)));
+						r1 = _mm_add_ps(r1, _mm_mul_ps(w, _mm_load_ps(bone.m1)));
+						r2 = _mm_add_ps(r2, _mm_mul_ps(w, _mm_load_ps(bone.m2)));
+						r3 = _mm_add_ps(r3, _mm_mul_ps(w, _mm_load_ps(bone.m3)));
+					}
+
+					position[lane] = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(_mm_set1_ps(input.positionX[v]), r0),
+						_mm_mul_ps(_mm_set1_ps(input.positionY[v]), r1)),
+						_mm_mul_ps(_mm_set1_ps(input.positionZ[v]), r2)), r3);
+
+					if (normals)
+					{
+						normal[lane] = _mm_add_ps(_mm_add_ps(
+							_mm_mul_ps(_mm_set1_ps(input.normalX[v]), r0),
+							_mm_mul_ps(_mm_set1_ps(input.normalY[v]), r1)),
+							_mm_mul_ps(_mm_set1_ps(input.normalZ[v]), r2));
+					}
+				}
+
+				StoreTransposed(position[0], position[1], position[2], position[3], &output.positionX[i], &output.positionY[i], &output.positionZ[i]);
+
+				if (normals)
+					NormalizeAndStore(normal[0], normal[1], normal[2], normal[3], &output.normalX[i], &output.normalY[i], &output.normalZ[i]);
+			}
+
+			SkinLinearScalar(palette, input, output, normals, i, last);
+		}
+
+		// Rows 0-1 and rows 2-3 of each bone are blended as two 8-wide registers
+		IRIS_TARGET_AVX2 void SkinLinearAVX2(const Matrix4x4* palette, const SkinningInput& input, const SkinningOutput& output, bool normals, size_t first, size_t last) noexcept
+		{
+			size_t i = first;
+
+			for (; i + 4 <= last; i += 4)
+			{
+				__m128 position[4];
+				__m128 normal[4];
+
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					const auto v = i + lane;
+					const auto& bones = input.bones[v];
+					const auto& weights = input.weights[v];
+
+					__m256 r01 = _mm256_setzero_ps(), r23 = _mm256_setzero_ps();
+
+					for (size_t k = 0; k < 4; ++k)
+					{
+						const auto& bone = palette[bones[k]];
+						const __m256 w = _mm256_set1_ps(weights[k]);
+
+						r01 = _mm256_fmadd_ps(w, _mm256_loadu_ps(bone.m0), r01);
+						r23 = _mm256_fmadd_ps(w, _mm256_loadu_ps(bone.m2), r23);
+					}
+
+					// (x | y) * (row0 | row1) + (z | 1) * (row2 | row3), then the halves are summed
+					const __m256 xy = _mm256_setr_m128(_mm_set1_ps(input.positionX[v]), _mm_set1_ps(input.positionY[v]));
+					const __m256 z1 = _mm256_setr_m128(_mm_set1_ps(input.positionZ[v]), _mm_set1_ps(1.f));
+					const __m256 p = _mm256_fmadd_ps(xy, r01, _mm256_mul_ps(z1, r23));
+					position[lane] = _mm_add_ps(_mm256_castps256_ps128(p), _mm256_extractf128_ps(p, 1));
+
+					if (normals)
+					{
+						const __m256 nxy = _mm256_setr_m128(_mm_set1_ps(input.normalX[v]), _mm_set1_ps(input.normalY[v]));
+						const __m256 nz0 = _mm256_setr_m128(_mm_set1_ps(input.normalZ[v]), _mm_setzero_ps());
+						const __m256 n = _mm256_fmadd_ps(nxy, r01, _mm256_mul_ps(nz0, r23));
+						normal[lane] = _mm_add_ps(_mm256_castps256_ps128(n), _mm256_extractf128_ps(n, 1));
+					}
+				}
+
+				StoreTransposed(position[0], position[1], position[2], position[3], &output.positionX[i], &output.positionY[i], &output.positionZ[i]);
+
+				if (normals)
+					NormalizeAndStore(normal[0], normal[1], normal[2], normal[3], &output.normalX[i], &output.normalY[i], &output.normalZ[i]);
+			}
+
+			_mm256_zeroupper();
+			SkinLinearScalar(palette, input, output, normals, i, last);
+		}
+
+		// Dot product of two quaternions broadcast to every lane
+		inline __m128 Dot4(__m128 a, __m128 b) noexcept
+		{
+			__m128 m = _mm_mul_ps(a, b);
+			m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+		}
+
+		inline __m128 SignBit(__m128 v) noexcept
+		{
+			return _mm_and_ps(v, _mm_castsi128_ps(_mm_set1_epi32(static_cast<int32>(0x80000000u))));
+		}
+
+		inline __m128 Cross(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz, int32 component) noexcept
+		{
+			switch (component)
+			{
+			case 0:
+				return _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+			case 1:
+				return _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+			default:
+				return _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+			}
+		}
+
+		// Normalizes four blended dual quaternions in SoA form and applies them to four vertices
+		inline void TransformDualQuaternionsSoA(__m128 real[4], __m128 dual[4], const SkinningInput& input, const SkinningOutput& output, bool normals, size_t i) noexcept
+		{
+			_MM_TRANSPOSE4_PS(real[0], real[1], real[2], real[3]);
+			_MM_TRANSPOSE4_PS(dual[0], dual[1], dual[2], dual[3]);
+
+			const __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(real[0], real[0]), _mm_mul_ps(real[1], real[1])), _mm_mul_ps(real[2], real[2])), _mm_mul_ps(real[3], real[3]));
+			const __m128 length = _mm_sqrt_ps(lengthSq);
+			const __m128 valid = _mm_cmpnlt_ps(length, _mm_set1_ps(Math::Epsilon));
+			const __m128 scale = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(_mm_set1_ps(1.f), length)), _mm_andnot_ps(valid, _mm_set1_ps(1.f)));
+
+			const __m128 rw = _mm_mul_ps(real[0], scale), rx = _mm_mul_ps(real[1], scale), ry = _mm_mul_ps(real[2], scale), rz = _mm_mul_ps(real[3], scale);
+			const __m128 dw = _mm_mul_ps(dual[0], scale), dx = _mm_mul_ps(dual[1], scale), dy = _mm_mul_ps(dual[2], scale), dz = _mm_mul_ps(dual[3], scale);
+
+			// translation = 2 * (rw * dv - dw * rv + rv x dv)
+			const __m128 two = _mm_set1_ps(2.f);
+			const __m128 tx = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(dx, rw), _mm_mul_ps(rx, dw)), Cross(rx, ry, rz, dx, dy, dz, 0)), two);
+			const __m128 ty = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(dy, rw), _mm_mul_ps(ry, dw)), Cross(rx, ry, rz, dx, dy, dz, 1)), two);
+			const __m128 tz = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(dz, rw), _mm_mul_ps(rz, dw)), Cross(rx, ry, rz, dx, dy, dz, 2)), two);
+
+			// v + w * t + q x t with t = 2 * (q x v)
+			const auto rotate = [&](__m128 vx, __m128 vy, __m128 vz, __m128& ox, __m128& oy, __m128& oz)
+			{
+				const __m128 cx = _mm_mul_ps(Cross(rx, ry, rz, vx, vy, vz, 0), two);
+				const __m128 cy = _mm_mul_ps(Cross(rx, ry, rz, vx, vy, vz, 1), two);
+				const __m128 cz = _mm_mul_ps(Cross(rx, ry, rz, vx, vy, vz, 2), two);
+
+				ox = _mm_add_ps(_mm_add_ps(vx, _mm_mul_ps(cx, rw)), Cross(rx, ry, rz, cx, cy, cz, 0));
+				oy = _mm_add_ps(_mm_add_ps(vy, _mm_mul_ps(cy, rw)), Cross(rx, ry, rz, cx, cy, cz, 1));
+				oz = _mm_add_ps(_mm_add_ps(vz, _mm_mul_ps(cz, rw)), Cross(rx, ry, rz, cx, cy, cz, 2));
+			};
+
+			__m128 px, py, pz;
+			rotate(_mm_loadu_ps(&input.positionX[i]), _mm_loadu_ps(&input.positionY[i]), _mm_loadu_ps(&input.positionZ[i]), px, py, pz);
+
+			_mm_storeu_ps(&output.positionX[i], _mm_add_ps(px, tx));
+			_mm_storeu_ps(&output.positionY[i], _mm_add_ps(py, ty));
+			_mm_storeu_ps(&output.positionZ[i], _mm_add_ps(pz, tz));
+
+			if (normals)
+			{
+				__m128 nx, ny, nz;
+				rotate(_mm_loadu_ps(&input.normalX[i]), _mm_loadu_ps(&input.normalY[i]), _mm_loadu_ps(&input.normalZ[i]), nx, ny, nz);
+
+				_mm_storeu_ps(&output.normalX[i], nx);
+				_mm_storeu_ps(&output.normalY[i], ny);
+				_mm_storeu_ps(&output.normalZ[i], nz);
+			}
+		}
+
+		void SkinDualQuaternionSSE(const DualQuaternion* palette, const SkinningInput& input, const SkinningOutput& output, bool normals, size_t first, size_t last) noexcept
+		{
+			size_t i = first;
+
+			for (; i + 4 <= last; i += 4)
+			{
+				__m128 real[4];
+				__m128 dual[4];
+
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					const auto& bones = input.bones[i + lane];
+					const auto& weights = input.weights[i + lane];
+
+					const __m128 pivot = _mm_loadu_ps(palette[bones[0]].real.data);
+					real[lane] = _mm_setzero_ps();
+					dual[lane] = _mm_setzero_ps();
+
+					for (size_t k = 0; k < 4; ++k)
+					{
+						const auto& bone = palette[bones[k]];
+						const __m128 r = _mm_loadu_ps(bone.real.data);
+
+						// Influences on the far hemisphere from the first one are negated
+						const __m128 w = _mm_xor_ps(_mm_set1_ps(weights[k]), SignBit(Dot4(pivot, r)));
+
+						real[lane] = _mm_add_ps(real[lane], _mm_mul_ps(w, r));
+						dual[lane] = _mm_add_ps(dual[lane], _mm_mul_ps(w, _mm_loadu_ps(bone.dual.data)));
+					}
+				}
+
+				TransformDualQuaternionsSoA(real, dual, input, output, normals, i);
+			}
+
+			SkinDualQuaternionScalar(palette, input, output, normals, i, last);
+		}
+
+		IRIS_TARGET_AVX2 void SkinDualQuaternionAVX2(const DualQuaternion* palette, const SkinningInput& input, const SkinningOutput& output, bool normals, size_t first, size_t last) noexcept
+		{
+			size_t i = first;
+
+			for (; i + 4 <= last; i += 4)
+			{
+				__m128 real[4];
+				__m128 dual[4];
+
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					const auto& bones = input.bones[i + lane];
+					const auto& weights = input.weights[i + lane];
+
+					const __m128 pivot = _mm_loadu_ps(palette[bones[0]].real.data);
+					__m256 blended = _mm256_setzero_ps();
+
+					for (size_t k = 0; k < 4; ++k)
+					{
+						const __m256 bone = _mm256_loadu_ps(palette[bones[k]].real.data);
+						const __m128 sign = SignBit(Dot4(pivot, _mm256_castps256_ps128(bone)));
+						const __m128 w = _mm_xor_ps(_mm_set1_ps(weights[k]), sign);
+
+						blended = _mm256_fmadd_ps(_mm256_setr_m128(w, w), bone, blended);
+					}
+
+					real[lane] = _mm256_castps256_ps128(blended);
+					dual[lane] = _mm256_extractf128_ps(blended, 1);
+				}
+
+				TransformDualQuaternionsSoA(real, dual, input, output, normals, i);
+			}
+
+			_mm256_zeroupper();
+			SkinDualQuaternionScalar(palette, input, output, normals, i, last);
+		}
+#endif
+
+		SkinKernel<Matrix4x4> SelectLinearKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			if (cpu.avx2 && cpu.fma)
+				return SkinLinearAVX2;
+
+			return SkinLinearSSE;
+#else
+			return SkinLinearScalar;
+#endif
+		}
+
+		SkinKernel<DualQuaternion> SelectDualQuaternionKernel() noexcept
+		{
+#if defined(IRIS_SIMD_X86)
+			const auto& cpu = CPUFeature::Get();
+
+			if (cpu.avx2 && cpu.fma)
+				return SkinDualQuaternionAVX2;
+
+			return SkinDualQuaternionSSE;
+#else
+			return SkinDualQuaternionScalar;
+#endif
+		}
+
+		// Returns whether normals are skinned
+		bool Validate(size_t paletteSize, const SkinningInput& input, const SkinningOutput& output, const char* name)
+		{
+			const auto count = input.positionX.size();
+			const auto normals = !input.normalX.empty();
+
+			const auto fits = [&](size_t size, size_t required) { return size >= required; };
+
+			bool valid = fits(input.positionY.size(), count) && fits(input.positionZ.size(), count)
+				&& fits(input.bones.size(), count) && fits(input.weights.size(), count)
+				&& fits(output.positionX.size(), count) && fits(output.positionY.size(), count) && fits(output.positionZ.size(), count);
+
+			if (normals)
+			{
+				valid = valid && fits(input.normalX.size(), count) && fits(input.normalY.size(), count) && fits(input.normalZ.size(), count)
+					&& fits(output.normalX.size(), count) && fits(output.normalY.size(), count) && fits(output.normalZ.size(), count);
+			}
+
+			uint32 maxBone = 0;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const auto& bones = input.bones[i];
+				maxBone = Max<uint32>(maxBone, Max<uint32>(Max<uint32>(bones[0], bones[1]), Max<uint32>(bones[2], bones[3])));
+			}
+
+			if (!valid || (count != 0 && maxBone >= paletteSize))
+				throw Error::OutOfRange{ name };
+
+			return normals;
+		}
+
+		// Below this many vertices per thread the spawn cost outweighs the work
+		constexpr size_t MinVerticesPerThread = 4096;
+
+		template<class Bone>
+		void SkinRange(std::span<const Bone> palette, const SkinningInput& input, const SkinningOutput& output, size_t threadCount, SkinKernel<Bone> kernel, const char* name)
+		{
+			const auto normals = Validate(palette.size(), input, output, name);
+			const auto count = input.positionX.size();
+
+			if (threadCount == 0)
+				threadCount = Max<size_t>(std::thread::hardware_concurrency(), 1);
+
+			threadCount = Min(threadCount, Max<size_t>(count / MinVerticesPerThread, 1));
+
+			// Ranges start on multiples of 4 so every thread runs whole SIMD blocks
+			const auto perThread = ((count + threadCount - 1) / threadCount + 3) & ~size_t{ 3 };
+
+			const auto run = [&](size_t t)
+			{
+				const auto first = Min(t * perThread, count);
+				const auto last = Min(first + perThread, count);
+
+				if (first < last)
+					kernel(palette.data(), input, output, normals, first, last);
+			};
+
+			ParallelFor(threadCount, run);
+		}
+	}
+
+	void SkinLinear(std::span<const Matrix4x4> palette, const SkinningInput& input, const SkinningOutput& output, size_t threadCount)
+	{
+		static const SkinKernel<Matrix4x4> kernel = SelectLinearKernel();
+		SkinRange(palette, input, output, threadCount, kernel, "SkinLinear(span<const Matrix4x4>,const SkinningInput&,const SkinningOutput&,size_t)");
+	}
+
+	void SkinDualQuaternion(std::span<const DualQuaternion> palette, const SkinningInput& input, const SkinningOutput& output, size_t threadCount)
+	{
+		static const SkinKernel<DualQuaternion> kernel = SelectDualQuaternionKernel();
+		SkinRange(palette, input, output, threadCount, kernel, "SkinDualQuaternion(span<const DualQuaternion>,const SkinningInput&,const SkinningOutput&,size_t)");
+	}
+}
\ No newline at end of file
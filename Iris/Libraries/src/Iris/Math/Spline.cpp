@@ -0,0 +1,285 @@
+#include <Iris/Math/Spline.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	static_assert(sizeof(CubicCurve<Vector2>) == sizeof(float32) * 8 && sizeof(CubicCurve<Vector3>) == sizeof(float32) * 12, "CubicCurve must be packed float32 coefficients");
+
+	namespace
+	{
+		// Curves are read as float32[4][Components]: coefficient k of component c at curve[k * Components + c]
+		template<size_t Components>
+		inline void EvaluateScalar(const float32* curve, float32 t, float32* result) noexcept
+		{
+			for (size_t c = 0; c < Components; ++c)
+			{
+				result[c] = curve[c] + (curve[Components + c] + (curve[Components * 2 + c] + curve[Components * 3 + c] * t) * t) * t;
+			}
+		}
+
+#if defined(IRIS_SIMD_X86)
+		inline __m128 Horner(__m128 a, __m128 b, __m128 c, __m128 d, __m128 t) noexcept
+		{
+			return _mm_add_ps(a, _mm_mul_ps(_mm_add_ps(b, _mm_mul_ps(_mm_add_ps(c, _mm_mul_ps(d, t)), t)), t));
+		}
+
+		// Writes four results held as one register per component, interleaved as x0 y0 z0 x1 ...
+		template<size_t Components>
+		inline void StoreInterleaved(const __m128 (&lanes)[Components], float32* results) noexcept
+		{
+			if constexpr (Components == 1)
+			{
+				_mm_storeu_ps(results, lanes[0]);
+			}
+			else if constexpr (Components == 2)
+			{
+				_mm_storeu_ps(results, _mm_unpacklo_ps(lanes[0], lanes[1]));
+				_mm_storeu_ps(results + 4, _mm_unpackhi_ps(lanes[0], lanes[1]));
+			}
+			else
+			{
+				// Transposed rows hold one xyz each; the overlapping stores are ordered so every row wins its own 3 floats
+				__m128 r0 = lanes[0], r1 = lanes[1], r2 = lanes[2], r3 = _mm_setzero_ps();
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+				_mm_storeu_ps(results, r0);
+				_mm_storeu_ps(results + 3, r1);
+				_mm_storeu_ps(results + 6, r2);
+				_mm_storel_pi(reinterpret_cast<__m64*>(results + 9), r3);
+				_mm_store_ss(results + 11, _mm_movehl_ps(r3, r3));
+			}
+		}
+#endif
+
+		// One curve at 'count' parameters; the coefficients stay broadcast in registers
+		template<size_t Components>
+		void EvaluateCurve(const float32* curve, const float32* parameters, float32* results, size_t count) noexcept
+		{
+			size_t i = 0;
+
+#if defined(IRIS_SIMD_X86)
+			__m128 coefficients[4][Components];
+
+			for (size_t k = 0; k < 4; ++k)
+			{
+				for (size_t c = 0; c < Components; ++c)
+				{
+					coefficients[k][c] = _mm_set1_ps(curve[k * Components + c]);
+				}
+			}
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 t = _mm_loadu_ps(parameters + i);
+				__m128 lanes[Components];
+
+				for (size_t c = 0; c < Components; ++c)
+				{
+					lanes[c] = Horner(coefficients[0][c], coefficients[1][c], coefficients[2][c], coefficients[3][c], t);
+				}
+
+				StoreInterleaved(lanes, results + i * Components);
+			}
+#endif
+
+			for (; i < count; ++i)
+			{
+				EvaluateScalar<Components>(curve, parameters[i], results + i * Components);
+			}
+		}
+
+		// A different curve per parameter: 'locate(i, t)' returns the curve for element i and may rewrite t to its local parameter.
+		// Scalar floats load four curves as rows and transpose them, so each register holds one coefficient of all four.
+		// Vectors keep one coefficient per register with the components in lanes, which needs no transposes.
+		template<size_t Components, class Locate>
+		void EvaluateEach(const float32* parameters, float32* results, size_t count, Locate locate) noexcept
+		{
+			size_t i = 0;
+
+#if defined(IRIS_SIMD_X86)
+			if constexpr (Components == 1)
+			{
+				for (; i + 4 <= count; i += 4)
+				{
+					float32 t0 = parameters[i], t1 = parameters[i + 1], t2 = parameters[i + 2], t3 = parameters[i + 3];
+					__m128 a = _mm_loadu_ps(locate(i, t0));
+					__m128 b = _mm_loadu_ps(locate(i + 1, t1));
+					__m128 c = _mm_loadu_ps(locate(i + 2, t2));
+					__m128 d = _mm_loadu_ps(locate(i + 3, t3));
+					_MM_TRANSPOSE4_PS(a, b, c, d);
+
+					_mm_storeu_ps(results + i, Horner(a, b, c, d, _mm_setr_ps(t0, t1, t2, t3)));
+				}
+			}
+			else
+			{
+				for (; i < count; ++i)
+				{
+					auto t = parameters[i];
+					const float32* curve = locate(i, t);
+					const __m128 tv = _mm_set1_ps(t);
+					float32* result = results + i * Components;
+
+					if constexpr (Components == 2)
+					{
+						const __m128 ab = _mm_loadu_ps(curve);
+						const __m128 cd = _mm_loadu_ps(curve + 4);
+						const __m128 v = Horner(ab, _mm_movehl_ps(ab, ab), cd, _mm_movehl_ps(cd, cd), tv);
+						_mm_storel_pi(reinterpret_cast<__m64*>(result), v);
+					}
+					else
+					{
+						// The last coefficient is loaded from curve + 8 and shifted down, so no load reads past the curve
+						const __m128 d = _mm_loadu_ps(curve + 8);
+						const __m128 v = Horner(_mm_loadu_ps(curve), _mm_loadu_ps(curve + 3), _mm_loadu_ps(curve + 6), _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 3, 2, 1)), tv);
+						_mm_storel_pi(reinterpret_cast<__m64*>(result), v);
+						_mm_store_ss(result + 2, _mm_movehl_ps(v, v));
+					}
+				}
+			}
+#endif
+
+			for (; i < count; ++i)
+			{
+				auto t = parameters[i];
+				const float32* curve = locate(i, t);
+				EvaluateScalar<Components>(curve, t, results + i * Components);
+			}
+		}
+
+		template<class Type>
+		constexpr size_t ComponentCount = sizeof(Type) / sizeof(float32);
+
+		template<class Type>
+		void EvaluateCurveBatch(const CubicCurve<Type>& curve, std::span<const float32> parameters, std::span<Type> results, const char* name)
+		{
+			if (results.size() < parameters.size())
+				throw Error::OutOfRange{ name };
+
+			EvaluateCurve<ComponentCount<Type>>(reinterpret_cast<const float32*>(curve.coefficients), parameters.data(), reinterpret_cast<float32*>(results.data()), parameters.size());
+		}
+
+		template<class Type>
+		void EvaluateCurvesBatch(std::span<const CubicCurve<Type>> curves, std::span<const float32> parameters, std::span<Type> results, const char* name)
+		{
+			if (parameters.size() < curves.size() || results.size() < curves.size())
+				throw Error::OutOfRange{ name };
+
+			const auto* base = reinterpret_cast<const float32*>(curves.data());
+
+			EvaluateEach<ComponentCount<Type>>(parameters.data(), reinterpret_cast<float32*>(results.data()), curves.size(), [&](size_t i, float32&)
+			{
+				return base + i * ComponentCount<Type> * 4;
+			});
+		}
+
+		template<class Type>
+		void EvaluateSplineBatch(const CubicSpline<Type>& spline, std::span<const float32> parameters, std::span<Type> results, const char* name)
+		{
+			if (results.size() < parameters.size() || spline.empty())
+				throw Error::OutOfRange{ name };
+
+			const auto segments = spline.segments();
+			const auto* base = reinterpret_cast<const float32*>(segments.data());
+			const auto last = segments.size() - 1;
+			const auto domain = spline.domain();
+
+			// Same clamping as CubicSpline::evaluate
+			EvaluateEach<ComponentCount<Type>>(parameters.data(), reinterpret_cast<float32*>(results.data()), parameters.size(), [&](size_t, float32& s)
+			{
+				s = Clamp(s, 0.f, domain);
+				const auto index = Min(static_cast<size_t>(s), last);
+				s -= static_cast<float32>(index);
+				return base + index * ComponentCount<Type> * 4;
+			});
+		}
+	}
+
+	void ArcLengthTable::build(std::span<const float32> _lengths, float32 _domain)
+	{
+		const auto steps = _lengths.size() - 1;
+
+		mLength = _lengths[steps];
+		mParameters.resize(steps + 1);
+
+		if (mLength <= 0.f)
+		{
+			for (size_t i = 0; i <= steps; ++i)
+			{
+				mParameters[i] = 0.f;
+			}
+
+			mInverseStep = 0.f;
+			return;
+		}
+
+		mInverseStep = static_cast<float32>(steps) / mLength;
+
+		// Both sequences increase, so one forward walk inverts the table
+		size_t segment = 0;
+
+		for (size_t i = 0; i <= steps; ++i)
+		{
+			const auto distance = mLength * static_cast<float32>(i) / static_cast<float32>(steps);
+
+			while (segment + 1 < steps && _lengths[segment + 1] < distance)
+			{
+				++segment;
+			}
+
+			const auto span = _lengths[segment + 1] - _lengths[segment];
+			const auto fraction = (span > 0.f) ? Clamp((distance - _lengths[segment]) / span, 0.f, 1.f) : 0.f;
+
+			mParameters[i] = _domain * (static_cast<float32>(segment) + fraction) / static_cast<float32>(steps);
+		}
+	}
+
+	void Evaluate(const CubicCurve<float32>& curve, std::span<const float32> parameters, std::span<float32> results)
+	{
+		EvaluateCurveBatch(curve, parameters, results, "Evaluate(const CubicCurve<float32>&,span<const float32>,span<float32>)");
+	}
+
+	void Evaluate(const CubicCurve<Vector2>& curve, std::span<const float32> parameters, std::span<Vector2> results)
+	{
+		EvaluateCurveBatch(curve, parameters, results, "Evaluate(const CubicCurve<Vector2>&,span<const float32>,span<Vector2>)");
+	}
+
+	void Evaluate(const CubicCurve<Vector3>& curve, std::span<const float32> parameters, std::span<Vector3> results)
+	{
+		EvaluateCurveBatch(curve, parameters, results, "Evaluate(const CubicCurve<Vector3>&,span<const float32>,span<Vector3>)");
+	}
+
+	void Evaluate(std::span<const CubicCurve<float32>> curves, std::span<const float32> parameters, std::span<float32> results)
+	{
+		EvaluateCurvesBatch(curves, parameters, results, "Evaluate(span<const CubicCurve<float32>>,span<const float32>,span<float32>)");
+	}
+
+	void Evaluate(std::span<const CubicCurve<Vector2>> curves, std::span<const float32> parameters, std::span<Vector2> results)
+	{
+		EvaluateCurvesBatch(curves, parameters, results, "Evaluate(span<const CubicCurve<Vector2>>,span<const float32>,span<Vector2>)");
+	}
+
+	void Evaluate(std::span<const CubicCurve<Vector3>> curves, std::span<const float32> parameters, std::span<Vector3> results)
+	{
+		EvaluateCurvesBatch(curves, parameters, results, "Evaluate(span<const CubicCurve<Vector3>>,span<const float32>,span<Vector3>)");
+	}
+
+	void Evaluate(const CubicSpline<float32>& spline, std::span<const float32> parameters, std::span<float32> results)
+	{
+		EvaluateSplineBatch(spline, parameters, results, "Evaluate(const CubicSpline<float32>&,span<const float32>,span<float32>)");
+	}
+
+	void Evaluate(const CubicSpline<Vector2>& spline, std::span<const float32> parameters, std::span<Vector2> results)
+	{
+		EvaluateSplineBatch(spline, parameters, results, "Evaluate(const CubicSpline<Vector2>&,span<const float32>,span<Vector2>)");
+	}
+
+	void Evaluate(const CubicSpline<Vector3>& spline, std::span<const float32> parameters, std::span<Vector3> results)
+	{
+		EvaluateSplineBatch(spline, parameters, results, "Evaluate(const CubicSpline<Vector3>&,span<const float32>,span<Vector3>)");
+	}
+}
\ No newline at end of file
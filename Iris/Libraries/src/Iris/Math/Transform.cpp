@@ -0,0 +1,191 @@
+#include <Iris/Math/Transform.hpp>
+#include <Iris/Common/CPUFeature.hpp>
+
+#if defined(IRIS_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
+namespace Iris
+{
+	namespace
+	{
+#if defined(IRIS_SIMD_X86)
+		// Vectors are held as (x, y, z, 0) and quaternions as (x, y, z, w)
+		inline __m128 LoadVector(const Vector3& v) noexcept
+		{
+			return _mm_setr_ps(v.x, v.y, v.z, 0.f);
+		}
+
+		inline Vector3 StoreVector(__m128 v) noexcept
+		{
+			alignas(16) float32 out[4];
+			_mm_store_ps(out, v);
+			return Vector3{ out[0],out[1],out[2] };
+		}
+
+		inline __m128 LoadRotation(const Quaternion& q) noexcept
+		{
+			const __m128 wxyz = _mm_loadu_ps(q.data);
+			return _mm_shuffle_ps(wxyz, wxyz, _MM_SHUFFLE(0, 3, 2, 1));
+		}
+
+		inline Quaternion StoreRotation(__m128 q) noexcept
+		{
+			Quaternion result;
+			_mm_storeu_ps(result.data, _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 1, 0, 3)));
+			return result;
+		}
+
+		inline __m128 Cross(__m128 a, __m128 b) noexcept
+		{
+			const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+			return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+		}
+
+		// Hamilton product left * right, matching operator*(Quaternion, Quaternion)
+		inline __m128 Multiply(__m128 left, __m128 right) noexcept
+		{
+			const __m128 s1 = _mm_shuffle_ps(right, right, _MM_SHUFFLE(0, 1, 2, 3));
+			const __m128 s2 = _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 0, 3, 2));
+			const __m128 s3 = _mm_shuffle_ps(right, right, _MM_SHUFFLE(2, 3, 0, 1));
+
+			__m128 result = _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 3, 3, 3)), right);
+			result = _mm_add_ps(result, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(0, 0, 0, 0)), s1), _mm_setr_ps(0.f, -0.f, 0.f, -0.f)));
+			result = _mm_add_ps(result, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(1, 1, 1, 1)), s2), _mm_setr_ps(0.f, 0.f, -0.f, -0.f)));
+			result = _mm_add_ps(result, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 2, 2, 2)), s3), _mm_setr_ps(-0.f, 0.f, 0.f, -0.f)));
+			return result;
+		}
+
+		// v + w * t + q x t with t = 2 * (q x v)
+		inline __m128 Rotate(__m128 q, __m128 v) noexcept
+		{
+			const __m128 t = _mm_add_ps(Cross(q, v), Cross(q, v));
+			const __m128 w = _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3));
+			return _mm_add_ps(_mm_add_ps(v, _mm_mul_ps(w, t)), Cross(q, t));
+		}
+#else
+		Vector3 Rotate(const Quaternion& q, const Vector3& v) noexcept
+		{
+			const Vector3 axis{ q.x,q.y,q.z };
+			const auto t = axis.cross(v) * 2.f;
+			return v + (t * q.w) + axis.cross(t);
+		}
+#endif
+	}
+
+	Transform Transform::inverse() const noexcept
+	{
+		const Vector3 invScale{ 1.f / scale.x,1.f / scale.y,1.f / scale.z };
+		const auto invRotation = rotation.conjugate();
+
+#if defined(IRIS_SIMD_X86)
+		const __m128 p = Rotate(LoadRotation(invRotation), LoadVector(position));
+		const __m128 s = LoadVector(invScale);
+		return Transform{ StoreVector(_mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(p, s))),invRotation,invScale };
+#else
+		return Transform{ -(Rotate(invRotation, position) * invScale),invRotation,invScale };
+#endif
+	}
+
+	Vector3 Transform::transformPoint(const Vector3& _point) const noexcept
+	{
+#if defined(IRIS_SIMD_X86)
+		const __m128 scaled = _mm_mul_ps(LoadVector(_point), LoadVector(scale));
+		return StoreVector(_mm_add_ps(Rotate(LoadRotation(rotation), scaled), LoadVector(position)));
+#else
+		return Rotate(rotation, _point * scale) + position;
+#endif
+	}
+
+	Vector3 Transform::transformDirection(const Vector3& _direction) const noexcept
+	{
+#if defined(IRIS_SIMD_X86)
+		const __m128 scaled = _mm_mul_ps(LoadVector(_direction), LoadVector(scale));
+		return StoreVector(Rotate(LoadRotation(rotation), scaled));
+#else
+		return Rotate(rotation, _direction * scale);
+#endif
+	}
+
+	Matrix3x4 Transform::toMatrix3x4() const noexcept
+	{
+		const auto [w, x, y, z] = rotation.data;
+
+		const auto xx = x * x;
+		const auto yy = y * y;
+		const auto zz = z * z;
+		const auto xy = x * y;
+		const auto xz = x * z;
+		const auto yz = y * z;
+		const auto wx = w * x;
+		const auto wy = w * y;
+		const auto wz = w * z;
+
+		return Matrix3x4
+		{
+			(1.f - 2.f * (yy + zz)) * scale.x,2.f * (xy - wz) * scale.y,2.f * (xz + wy) * scale.z,position.x,
+			2.f * (xy + wz) * scale.x,(1.f - 2.f * (xx + zz)) * scale.y,2.f * (yz - wx) * scale.z,position.y,
+			2.f * (xz - wy) * scale.x,2.f * (yz + wx) * scale.y,(1.f - 2.f * (xx + yy)) * scale.z,position.z
+		};
+	}
+
+	Transform Transform::FromMatrix3x4(const Matrix3x4& matrix)
+	{
+		Vector3 axisScale
+		{
+			Vector3{ matrix.m00,matrix.m10,matrix.m20 }.length(),
+			Vector3{ matrix.m01,matrix.m11,matrix.m21 }.length(),
+			Vector3{ matrix.m02,matrix.m12,matrix.m22 }.length()
+		};
+
+		if (matrix.determinant() < 0.f)
+		{
+			axisScale.x = -axisScale.x;
+		}
+
+		Matrix3x4 unit = matrix;
+
+		for (size_t c = 0; c < 3; ++c)
+		{
+			const auto s = axisScale.data[c];
+
+			if (Math::Abs(s) < Math::Epsilon)
+				continue;
+
+			unit.m[0][c] /= s;
+			unit.m[1][c] /= s;
+			unit.m[2][c] /= s;
+		}
+
+		return Transform{ matrix.translation(),Quaternion::FromMatrix4x4(unit.toMatrix4x4()),axisScale };
+	}
+
+	Transform operator*(const Transform& left, const Transform& right) noexcept
+	{
+#if defined(IRIS_SIMD_X86)
+		const __m128 rightRotation = LoadRotation(right.rotation);
+		const __m128 rightScale = LoadVector(right.scale);
+
+		const __m128 position = _mm_add_ps(Rotate(rightRotation, _mm_mul_ps(LoadVector(left.position), rightScale)), LoadVector(right.position));
+		const __m128 rotation = Multiply(rightRotation, LoadRotation(left.rotation));
+		const __m128 scale = _mm_mul_ps(LoadVector(left.scale), rightScale);
+
+		return Transform{ StoreVector(position),StoreRotation(rotation),StoreVector(scale) };
+#else
+		return Transform
+		{
+			Rotate(right.rotation, left.position * right.scale) + right.position,
+			right.rotation * left.rotation,
+			left.scale * right.scale
+		};
+#endif
+	}
+
+	Transform& operator*=(Transform& left, const Transform& right) noexcept
+	{
+		left = left * right;
+		return left;
+	}
+}
\ No newline at end of file
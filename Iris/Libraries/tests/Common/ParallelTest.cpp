@@ -0,0 +1,76 @@
+#include "../Test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <Iris/Common/Parallel.hpp>
+#include <Iris/Common/Exceptions.hpp>
+
+using namespace Iris;
+
+IRIS_TEST(ParallelForRunsEveryTask)
+{
+	for (const size_t taskCount : { size_t{ 0 }, size_t{ 1 }, size_t{ 2 }, size_t{ 7 }, size_t{ 32 } })
+	{
+		std::vector<std::atomic<int>> runs(taskCount);
+
+		ParallelFor(taskCount, [&](size_t t) { runs[t].fetch_add(1); });
+
+		for (const auto& count : runs)
+			IRIS_CHECK(count.load() == 1);
+	}
+}
+
+IRIS_TEST(ParallelForRethrowsAfterJoining)
+{
+	// Task 0 runs on the calling thread and worker tasks throw as well; every task must still finish before the
+	// first exception reaches the caller, and the process must not terminate
+	std::atomic<int> finished = 0;
+
+	IRIS_CHECK_THROWS(ParallelFor(8, [&](size_t t)
+		{
+			if (t % 2 == 0)
+				throw std::runtime_error("task failed");
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			finished.fetch_add(1);
+		}), std::runtime_error);
+
+	IRIS_CHECK(finished.load() == 4);
+
+	IRIS_CHECK_THROWS(ParallelFor(4, [](size_t t)
+		{
+			if (t == 3)
+				throw Error::OutOfRange{ "worker" };
+		}), Error::OutOfRange);
+}
+
+IRIS_TEST(ParallelInvokeRunsBoth)
+{
+	int first = 0, second = 0;
+
+	ParallelInvoke([&]() { first = 1; }, [&]() { second = 2; });
+
+	IRIS_CHECK(first == 1 && second == 2);
+}
+
+IRIS_TEST(ParallelInvokeRethrowsAfterJoining)
+{
+	std::atomic<bool> firstDone = false;
+
+	// The calling thread's half throws while the worker is still running
+	IRIS_CHECK_THROWS(ParallelInvoke(
+		[&]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			firstDone = true;
+		},
+		[]() { throw std::bad_alloc(); }), std::bad_alloc);
+
+	IRIS_CHECK(firstDone.load());
+
+	IRIS_CHECK_THROWS(ParallelInvoke([]() { throw std::runtime_error("worker failed"); }, []() {}), std::runtime_error);
+}
\ No newline at end of file
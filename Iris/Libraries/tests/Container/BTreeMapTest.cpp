@@ -0,0 +1,87 @@
+#include "../Test.hpp"
+
+#include <map>
+#include <algorithm>
+#include <random>
+#include <iterator>
+
+#include <Iris/Container/BTreeMap.hpp>
+
+using namespace Iris;
+
+namespace
+{
+	template<class Map, class Reference>
+	bool SameOrder(const Map& map, const Reference& reference)
+	{
+		return map.size() == reference.size()
+			&& std::equal(map.begin(), map.end(), reference.begin(), reference.end(),
+				[](const auto& a, const auto& b) { return a.first == b.first && a.second == b.second; });
+	}
+}
+
+IRIS_TEST(MatchesStdMap)
+{
+	BTreeMap<uint32, uint32> map;
+	std::map<uint32, uint32> reference;
+	std::mt19937 random{ 12345 };
+
+	for (int i = 0; i < 200000; ++i)
+	{
+		const uint32 key = random() % 5000;
+
+		switch (random() % 4)
+		{
+		case 0:
+		case 1:
+			map[key] = static_cast<uint32>(i);
+			reference[key] = static_cast<uint32>(i);
+			break;
+
+		case 2:
+			IRIS_CHECK(map.erase(key) == reference.erase(key));
+			break;
+
+		default:
+		{
+			const auto lower = map.lowerBound(key);
+			const auto expected = reference.lower_bound(key);
+			IRIS_CHECK((lower == map.end()) == (expected == reference.end()));
+			IRIS_CHECK(lower == map.end() || lower->first == expected->first);
+			break;
+		}
+		}
+	}
+
+	IRIS_CHECK(SameOrder(map, reference));
+}
+
+IRIS_TEST(ReverseIteration)
+{
+	BTreeMap<int, int> map;
+	const auto& constMap = map;
+
+	IRIS_CHECK(map.rbegin() == map.rend());
+	IRIS_CHECK(constMap.crbegin() == constMap.crend());
+
+	// Enough elements to span many leaves
+	for (int i = 0; i < 10000; ++i)
+	{
+		map[i] = -i;
+	}
+
+	int expected = 9999;
+
+	for (auto it = map.rbegin(); it != map.rend(); ++it)
+	{
+		if (!IRIS_CHECK(it->first == expected && it->second == -expected))
+			return;
+
+		it->second = expected--;
+	}
+
+	IRIS_CHECK(expected == -1);
+	IRIS_CHECK(std::distance(constMap.crbegin(), constMap.crend()) == 10000);
+	IRIS_CHECK(constMap.rbegin()->first == 9999 && constMap.rbegin()->second == 9999);
+	IRIS_CHECK(std::prev(constMap.rend())->first == 0);
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "../Test.hpp"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include <Iris/Container/FlatMap.hpp>
+#include <Iris/Container/FlatSet.hpp>
+
+using namespace Iris;
+
+namespace
+{
+	template<class Map, class Reference>
+	bool SameOrder(const Map& map, const Reference& reference)
+	{
+		return map.size() == reference.size()
+			&& std::equal(map.begin(), map.end(), reference.begin(), reference.end(),
+				[](const auto& a, const auto& b) { return a.first == b.first && a.second == b.second; });
+	}
+}
+
+IRIS_TEST(MatchesStdMap)
+{
+	FlatMap<uint32, uint32> map;
+	std::map<uint32, uint32> reference;
+	std::mt19937 random{ 12345 };
+
+	for (int i = 0; i < 100000; ++i)
+	{
+		const uint32 key = random() % 2000;
+
+		switch (random() % 5)
+		{
+		case 0:
+			map[key] = static_cast<uint32>(i);
+			reference[key] = static_cast<uint32>(i);
+			break;
+
+		case 1:
+			IRIS_CHECK(map.emplace(key, static_cast<uint32>(i)).second == reference.emplace(key, static_cast<uint32>(i)).second);
+			break;
+
+		case 2:
+			IRIS_CHECK(map.erase(key) == reference.erase(key));
+			break;
+
+		default:
+		{
+			const auto it = map.find(key);
+			const auto expected = reference.find(key);
+			IRIS_CHECK((it == map.end()) == (expected == reference.end()));
+			IRIS_CHECK(it == map.end() || it->second == expected->second);
+			IRIS_CHECK(map.count(key) == reference.count(key));
+			break;
+		}
+		}
+	}
+
+	IRIS_CHECK(SameOrder(map, reference));
+	IRIS_CHECK_THROWS(map.at(5000), Error::OutOfRange);
+}
+
+IRIS_TEST(BulkConstructionKeepsFirst)
+{
+	const std::vector<std::pair<int, int>> pairs = { { 3, 0 }, { 1, 1 }, { 3, 2 }, { 2, 3 }, { 1, 4 } };
+	FlatMap<int, int> map(pairs.begin(), pairs.end());
+
+	IRIS_CHECK(SameOrder(map, std::map<int, int>{ { 1, 1 }, { 2, 3 }, { 3, 0 } }));
+
+	// Keys already present win over inserted ones
+	const std::vector<std::pair<int, int>> more = { { 0, 5 }, { 2, 6 }, { 4, 7 }, { 0, 8 } };
+	map.insert(more.begin(), more.end());
+
+	IRIS_CHECK(SameOrder(map, std::map<int, int>{ { 0, 5 }, { 1, 1 }, { 2, 3 }, { 3, 0 }, { 4, 7 } }));
+}
+
+IRIS_TEST(LookupAtEverySize)
+{
+	// The branch-free search halves an odd or even count differently, so every small size and both ends are checked
+	for (int size = 0; size <= 70; ++size)
+	{
+		FlatSet<int> set;
+		FlatMap<int, int> map;
+
+		for (int i = 0; i < size; ++i)
+		{
+			set.insert(i * 2);
+			map[i * 2] = i;
+		}
+
+		for (int key = -1; key <= size * 2; ++key)
+		{
+			const bool expected = (key >= 0) && (key < size * 2) && (key % 2 == 0);
+
+			if (!IRIS_CHECK(set.contains(key) == expected) ||
+				!IRIS_CHECK(map.contains(key) == expected) ||
+				!IRIS_CHECK(!expected || map.at(key) == key / 2))
+				return;
+		}
+	}
+}
+
+IRIS_TEST(FlatSetMatchesStdSet)
+{
+	FlatSet<uint32> set;
+	std::set<uint32> reference;
+	std::mt19937 random{ 777 };
+
+	for (int i = 0; i < 50000; ++i)
+	{
+		const uint32 key = random() % 3000;
+
+		if (random() % 3 == 0)
+		{
+			IRIS_CHECK(set.erase(key) == reference.erase(key));
+		}
+		else
+		{
+			IRIS_CHECK(set.insert(key).second == reference.insert(key).second);
+		}
+	}
+
+	IRIS_CHECK(std::equal(set.begin(), set.end(), reference.begin(), reference.end()));
+	IRIS_CHECK(std::is_sorted(set.data(), set.data() + set.size()));
+
+	std::vector<uint32> keys(reference.rbegin(), reference.rend());
+	keys.insert(keys.end(), reference.begin(), reference.end());
+
+	const FlatSet<uint32> bulk(keys.begin(), keys.end());
+	IRIS_CHECK(std::equal(bulk.begin(), bulk.end(), reference.begin(), reference.end()));
+}
+
+IRIS_TEST(TransparentLookup)
+{
+	FlatMap<std::string, int, std::less<>> map{ { "alpha", 1 }, { "beta", 2 }, { "gamma", 3 } };
+
+	IRIS_CHECK(map.contains("beta"));
+	IRIS_CHECK(!map.contains("delta"));
+	IRIS_CHECK(map.at("gamma") == 3);
+	IRIS_CHECK(map.find(std::string_view{ "alpha" })->second == 1);
+	IRIS_CHECK_THROWS(map.at("delta"), Error::OutOfRange);
+
+	const FlatSet<std::string, std::less<>> set{ "x", "y" };
+	IRIS_CHECK(set.contains("y") && set.count("z") == 0);
+}
\ No newline at end of file
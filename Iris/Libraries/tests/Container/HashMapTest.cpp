@@ -0,0 +1,253 @@
+#include "../Test.hpp"
+
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <Iris/Container/HashMap.hpp>
+#include <Iris/Container/String.hpp>
+
+using namespace Iris;
+
+namespace
+{
+	// Counts every global allocation, so lookups can be shown not to build a temporary String
+	int gAllocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	++gAllocations;
+
+	if (void* pointer = std::malloc(size ? size : 1))
+		return pointer;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+namespace
+{
+	struct CopyFailure {};
+
+	struct HashFailure {};
+
+	// Copies succeed until 'CopiesLeft' runs out; the move constructor is not noexcept, so rehashing has to copy
+	struct FragileKey
+	{
+		static inline int CopiesLeft = -1;
+
+		int value;
+
+		explicit FragileKey(int _value) : value(_value) {}
+
+		FragileKey(const FragileKey& _other) : value(_other.value)
+		{
+			if (CopiesLeft == 0)
+				throw CopyFailure{};
+
+			if (CopiesLeft > 0)
+				--CopiesLeft;
+		}
+
+		bool operator==(const FragileKey& _other)const { return value == _other.value; }
+	};
+
+	struct FragileKeyHash
+	{
+		size_t operator()(const FragileKey& _key)const noexcept { return static_cast<size_t>(_key.value); }
+	};
+
+	// Hashes succeed until 'CallsLeft' runs out
+	struct FragileHash
+	{
+		static inline int CallsLeft = -1;
+
+		size_t operator()(int _key)const
+		{
+			if (CallsLeft == 0)
+				throw HashFailure{};
+
+			if (CallsLeft > 0)
+				--CallsLeft;
+
+			return static_cast<size_t>(_key);
+		}
+	};
+
+	template<class Map>
+	bool Holds(const Map& map, int count)
+	{
+		if (map.size() != static_cast<size_t>(count))
+			return false;
+
+		for (int i = 0; i < count; ++i)
+		{
+			auto it = map.find(typename Map::key_type{ i });
+
+			if (it == map.end() || it->second != std::to_string(i))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+IRIS_TEST(MatchesUnorderedMap)
+{
+	HashMap<uint32, uint32> map;
+	std::unordered_map<uint32, uint32> reference;
+	std::mt19937 random{ 12345 };
+
+	for (int i = 0; i < 200000; ++i)
+	{
+		const uint32 key = random() % 5000;
+
+		switch (random() % 4)
+		{
+		case 0:
+		case 1:
+			map[key] = static_cast<uint32>(i);
+			reference[key] = static_cast<uint32>(i);
+			break;
+
+		case 2:
+			IRIS_CHECK(map.erase(key) == reference.erase(key));
+			break;
+
+		default:
+			IRIS_CHECK(map.contains(key) == reference.contains(key));
+			break;
+		}
+	}
+
+	IRIS_CHECK(map.size() == reference.size());
+
+	size_t visited = 0;
+
+	for (const auto& [key, value] : map)
+	{
+		const auto found = reference.find(key);
+		IRIS_CHECK(found != reference.end() && found->second == value);
+		++visited;
+	}
+
+	IRIS_CHECK(visited == reference.size());
+}
+
+IRIS_TEST(RehashKeepsMapWhenKeyCopyThrows)
+{
+	HashMap<FragileKey, std::string, FragileKeyHash> map;
+
+	for (int i = 0; i < 100; ++i)
+	{
+		map.try_emplace(FragileKey{ i }, std::to_string(i));
+	}
+
+	const auto capacity = map.capacity();
+
+	FragileKey::CopiesLeft = 40;
+	IRIS_CHECK_THROWS(map.rehash(capacity * 4), CopyFailure);
+	FragileKey::CopiesLeft = -1;
+
+	IRIS_CHECK(map.capacity() == capacity);
+	IRIS_CHECK(Holds(map, 100));
+
+	// Still usable: the next rehash succeeds and inserts go on
+	map.rehash(capacity * 4);
+	map.try_emplace(FragileKey{ 100 }, "100");
+	IRIS_CHECK(Holds(map, 101));
+}
+
+IRIS_TEST(GrowthKeepsMapWhenHashThrows)
+{
+	HashMap<int, std::string, FragileHash> map{ 100 };
+
+	int count = 0;
+
+	while (map.size() < map.capacity() * 7 / 8)
+	{
+		map.try_emplace(count, std::to_string(count));
+		++count;
+	}
+
+	// The insert below outgrows the table, and its rehash fails half way through the keys
+	const auto capacity = map.capacity();
+
+	while (map.capacity() == capacity)
+	{
+		FragileHash::CallsLeft = 1 + count / 2;
+		bool thrown = false;
+
+		try
+		{
+			map.try_emplace(count, std::to_string(count));
+		}
+		catch (const HashFailure&)
+		{
+			thrown = true;
+		}
+
+		FragileHash::CallsLeft = -1;
+
+		if (thrown)
+			break;
+
+		++count;
+	}
+
+	IRIS_CHECK(map.capacity() == capacity);
+	IRIS_CHECK(Holds(map, count));
+}
+
+IRIS_TEST(StringKeysFindByViewAndLiteral)
+{
+	HashMap<String, int> map;
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		const auto digits = std::to_string(i);
+		map.try_emplace(String{ std::u32string{ U"key number " } + std::u32string(digits.begin(), digits.end()) }, i);
+	}
+
+	// Longer than the small string buffer, so building a String from either of these would allocate
+	const String::view_type view = U"key number 421";
+	const char32_t* literal = U"key number 999";
+	const String::view_type missing = U"key number 1000";
+
+	gAllocations = 0;
+
+	const bool found = (map.find(view) != map.end()) && (map.find(view)->second == 421)
+		&& map.contains(literal) && (map.count(literal) == 1) && (map.at(view) == 421) && (std::as_const(map).at(literal) == 999)
+		&& (map.find(missing) == map.end()) && !map.contains(missing) && (map.count(U"") == 0);
+
+	const auto allocations = gAllocations;
+
+	std::printf("    allocations during transparent lookups: %d\n", allocations);
+	IRIS_CHECK(found);
+	IRIS_CHECK(allocations == 0);
+
+	// The counter does see a String being built from the same view
+	gAllocations = 0;
+	const String built{ std::u32string{ view } };
+	IRIS_CHECK(gAllocations > 0 && map.contains(built));
+
+	IRIS_CHECK_THROWS(map.at(missing), Error::OutOfRange);
+	IRIS_CHECK_THROWS(std::as_const(map).at(U"key number -1"), Error::OutOfRange);
+
+	// A String key still works, and a view hashes the same as the String it views
+	IRIS_CHECK(map.at(String{ U"key number 7" }) == 7);
+	IRIS_CHECK(std::hash<String>{}(String{ U"key number 7" }) == std::hash<String>{}(String::view_type{ U"key number 7" }));
+}
\ No newline at end of file
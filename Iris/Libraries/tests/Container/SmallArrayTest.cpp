@@ -0,0 +1,394 @@
+#include "../Test.hpp"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <climits>
+#include <utility>
+#include <algorithm>
+
+#include <Iris/Container/Array.hpp>
+#include <Iris/Container/SmallArray.hpp>
+
+using namespace Iris;
+
+// SmallArray against std::vector under random edits, its allocation counts at and past the inline capacity,
+// element lifetimes across the inline/heap moves, the Array-style API against Array itself, and growth that
+// copies elements whose move may throw and leaves the array untouched when a copy fails.
+
+namespace
+{
+	int gAllocations = 0;
+
+	int gReleases = 0;
+
+	int gLive = 0;
+
+	// Copies of ThrowingCopy left before the next one throws
+	int gCopyBudget = 0;
+
+	int gMoves = 0;
+
+	template<class Type>
+	struct CountingAllocator
+	{
+		using value_type = Type;
+
+		CountingAllocator() = default;
+
+		template<class Other>
+		CountingAllocator(const CountingAllocator<Other>&) noexcept {}
+
+		Type* allocate(size_t count)
+		{
+			++gAllocations;
+			return std::allocator<Type>{}.allocate(count);
+		}
+
+		void deallocate(Type* pointer, size_t count) noexcept
+		{
+			++gReleases;
+			std::allocator<Type>{}.deallocate(pointer, count);
+		}
+
+		template<class Other>
+		bool operator==(const CountingAllocator<Other>&) const noexcept { return true; }
+	};
+
+	// Counts live instances, so a leaked or doubly destroyed element shows up in gLive
+	struct Tracked
+	{
+		std::string text;
+
+		Tracked(int value = 0) : text(std::to_string(value)) { ++gLive; }
+
+		Tracked(const Tracked& other) : text(other.text) { ++gLive; }
+
+		Tracked(Tracked&& other) noexcept : text(std::move(other.text)) { ++gLive; }
+
+		Tracked& operator=(const Tracked&) = default;
+
+		Tracked& operator=(Tracked&&) noexcept = default;
+
+		~Tracked() { --gLive; }
+
+		bool operator==(const Tracked& other) const { return text == other.text; }
+	};
+
+	struct CopyFailure {};
+
+	// A move that may throw, so growth has to copy; the copy throws once gCopyBudget runs out
+	struct ThrowingCopy
+	{
+		int value;
+
+		ThrowingCopy(int _value = 0) : value(_value) { ++gLive; }
+
+		ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+		{
+			if (gCopyBudget-- <= 0)
+				throw CopyFailure{};
+
+			++gLive;
+		}
+
+		ThrowingCopy(ThrowingCopy&& other) noexcept(false) : value(std::exchange(other.value, -1)) { ++gMoves; ++gLive; }
+
+		ThrowingCopy& operator=(const ThrowingCopy&) = default;
+
+		ThrowingCopy& operator=(ThrowingCopy&&) = default;
+
+		~ThrowingCopy() { --gLive; }
+	};
+
+	using ThrowingList = SmallArray<ThrowingCopy, 4, CountingAllocator<ThrowingCopy>>;
+
+	ThrowingList MakeThrowingList(int size)
+	{
+		gCopyBudget = INT_MAX;
+		ThrowingList list;
+
+		for (int i = 0; i < size; ++i)
+			list.emplaceLast(i);
+
+		return list;
+	}
+
+	// The list starts with 0, 1, ... size - 1
+	bool StartsWith(const ThrowingList& list, int size)
+	{
+		if (list.size() < static_cast<size_t>(size))
+			return false;
+
+		for (int i = 0; i < size; ++i)
+		{
+			if (list[i].value != i)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Holds(const ThrowingList& list, int size)
+	{
+		return list.size() == static_cast<size_t>(size) && StartsWith(list, size);
+	}
+
+	// Every copy in 'operation' fails in turn; each failure must leave the list, its storage and the live element and
+	// block counts as they were. With enough copies the operation succeeds without moving anything
+	template<class Operation>
+	bool StrongOnFailure(int size, int copies, Operation operation)
+	{
+		for (int budget = 0; budget <= copies; ++budget)
+		{
+			auto list = MakeThrowingList(size);
+			const bool wasInline = list.isInline();
+			const auto capacity = list.capacity();
+			const int live = gLive, blocks = gAllocations - gReleases;
+
+			gCopyBudget = budget;
+			gMoves = 0;
+			bool threw = false;
+
+			try
+			{
+				operation(list);
+			}
+			catch (const CopyFailure&)
+			{
+				threw = true;
+			}
+
+			gCopyBudget = INT_MAX;
+
+			if (budget < copies)
+			{
+				if (!threw || !Holds(list, size) || list.isInline() != wasInline || list.capacity() != capacity
+					|| gLive != live || gAllocations - gReleases != blocks)
+					return false;
+			}
+			else if (threw || gMoves != 0 || !StartsWith(list, size))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<class List, class Reference>
+	bool SameElements(const List& list, const Reference& reference)
+	{
+		return list.size() == reference.size() && std::equal(list.begin(), list.end(), reference.begin(), reference.end());
+	}
+}
+
+IRIS_TEST(MatchesStdVector)
+{
+	{
+		SmallArray<Tracked, 4> list;
+		std::vector<Tracked> reference;
+		std::mt19937 random{ 12345 };
+
+		for (int i = 0; i < 20000; ++i)
+		{
+			const int value = static_cast<int>(random() % 100);
+			const size_t where = reference.empty() ? 0 : (random() % reference.size());
+
+			switch (random() % 8)
+			{
+			case 0:
+			case 1:
+				list.addLast(Tracked{ value });
+				reference.push_back(Tracked{ value });
+				break;
+
+			case 2:
+				list.addFirst(Tracked{ value });
+				reference.insert(reference.begin(), Tracked{ value });
+				break;
+
+			case 3:
+				list.insert(list.begin() + where, Tracked{ value });
+				reference.insert(reference.begin() + static_cast<std::ptrdiff_t>(where), Tracked{ value });
+				break;
+
+			case 4:
+				if (!reference.empty())
+				{
+					list.removeAt(where);
+					reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(where));
+				}
+				break;
+
+			case 5:
+				if (!reference.empty())
+				{
+					list.removeLast();
+					reference.pop_back();
+				}
+				break;
+
+			case 6:
+			{
+				// Keeps sizes crossing the inline capacity in both directions
+				const auto text = std::to_string(value % 10);
+				list.removeBy([&](const Tracked& t) { return t.text.back() == text.back(); });
+				reference.erase(std::remove_if(reference.begin(), reference.end(), [&](const Tracked& t) { return t.text.back() == text.back(); }), reference.end());
+
+				if (random() % 2)
+					list.shrinkToFit();
+				break;
+			}
+
+			default:
+			{
+				// Copies and moves keep the contents whether the source is inline or on the heap
+				auto copy = list;
+				const auto moved = std::move(copy);
+				list = moved;
+				break;
+			}
+			}
+
+			if (!IRIS_CHECK(SameElements(list, reference)) ||
+				!IRIS_CHECK(list.isInline() == (list.capacity() == 4)))
+				return;
+		}
+	}
+
+	IRIS_CHECK(gLive == 0);
+}
+
+IRIS_TEST(AllocatesOnlyPastInlineCapacity)
+{
+	gAllocations = 0;
+
+	{
+		SmallArray<int, 8, CountingAllocator<int>> list;
+
+		for (int i = 0; i < 8; ++i)
+			list.addLast(i);
+
+		IRIS_CHECK(list.isInline());
+		IRIS_CHECK(gAllocations == 0);
+
+		// Copies of an inline list stay inline too
+		const auto copy = list;
+		IRIS_CHECK(copy.isInline() && gAllocations == 0);
+
+		list.addLast(8);
+		IRIS_CHECK(!list.isInline());
+		IRIS_CHECK(gAllocations == 1);
+
+		for (int i = 9; i < 16; ++i)
+			list.addLast(i);
+
+		// Doubling from the inline capacity: 16 elements fit the first heap block
+		IRIS_CHECK(gAllocations == 1);
+
+		// Moving a heap list hands over its block
+		const auto moved = std::move(list);
+		IRIS_CHECK(gAllocations == 1);
+		IRIS_CHECK(moved.size() == 16 && moved.last() == 15);
+
+		auto shrunk = moved;
+		IRIS_CHECK(gAllocations == 2);
+		shrunk.resize(5);
+		shrunk.shrinkToFit();
+		IRIS_CHECK(shrunk.isInline() && shrunk.size() == 5 && shrunk.last() == 4);
+	}
+
+	// The same eight elements through Array allocate as it grows
+	gAllocations = 0;
+	Array<int, CountingAllocator<int>> array;
+
+	for (int i = 0; i < 8; ++i)
+		array.addLast(i);
+
+	std::printf("    allocations for 8 addLast: SmallArray<int, 8> 0, Array %d\n", gAllocations);
+	IRIS_CHECK(gAllocations > 0);
+}
+
+IRIS_TEST(ArrayApi)
+{
+	const SmallArray<int, 4> list{ 5, 3, 8, 1, 9, 2 };
+	const Array<int> array{ 5, 3, 8, 1, 9, 2 };
+
+	IRIS_CHECK(SameElements(list, array));
+	IRIS_CHECK(*list.findBy([](int v) { return v > 6; }) == *array.findBy([](int v) { return v > 6; }));
+	IRIS_CHECK(list.findBy([](int v) { return v > 100; }) == list.end());
+	IRIS_CHECK(list.countBy([](int v) { return v % 2 == 1; }) == array.countBy([](int v) { return v % 2 == 1; }));
+	IRIS_CHECK(list.contains(8) && !list.contains(7));
+	IRIS_CHECK(list.anyOf([](int v) { return v == 9; }) && list.allOf([](int v) { return v > 0; }) && list.noneOf([](int v) { return v > 9; }));
+	IRIS_CHECK(list.indexOf(list.find(1)) == 3);
+	IRIS_CHECK(list.findAt(6) == list.end());
+	IRIS_CHECK_THROWS(list.at(6), Error::OutOfRange);
+
+	const auto doubled = list.map([](int v) { return v * 2; });
+	IRIS_CHECK(SameElements(doubled, array.map([](int v) { return v * 2; })));
+
+	int sum = 0;
+	list.forEach([&sum](int v) { sum += v; });
+	IRIS_CHECK(sum == 28);
+
+	auto sorted = list;
+	auto sortedArray = array;
+	sorted.sortBy();
+	sortedArray.sortBy();
+	IRIS_CHECK(SameElements(sorted, sortedArray));
+
+	sorted.sortBy(std::greater<>{});
+	IRIS_CHECK(sorted.first() == 9 && sorted.last() == 1);
+
+	sorted.removeBy([](int v) { return v > 3; });
+	IRIS_CHECK(SameElements(sorted, std::vector<int>{ 3, 2, 1 }));
+
+	auto a = SmallArray<int, 4>{ 1, 2 };
+	auto b = SmallArray<int, 4>{ 3, 4, 5, 6, 7 };
+	a.swap(b);
+	IRIS_CHECK(SameElements(a, std::vector<int>{ 3, 4, 5, 6, 7 }) && !a.isInline());
+	IRIS_CHECK(SameElements(b, std::vector<int>{ 1, 2 }) && b.isInline());
+	IRIS_CHECK(a != b && a == (SmallArray<int, 4>{ 3, 4, 5, 6, 7 }));
+
+	a.append(b);
+	IRIS_CHECK(SameElements(a, std::vector<int>{ 3, 4, 5, 6, 7, 1, 2 }));
+}
+
+IRIS_TEST(GrowthCopiesWhenMoveMayThrow)
+{
+	gAllocations = gReleases = 0;
+	gCopyBudget = INT_MAX;
+
+	const std::vector<ThrowingCopy> extra{ 4, 5 };
+	const int outside = gLive;
+
+	// Inline to heap: the four inline elements are copied, then the new ones
+	IRIS_CHECK(StrongOnFailure(4, 4, [](ThrowingList& list) { list.emplaceLast(4); }));
+	IRIS_CHECK(StrongOnFailure(4, 6, [&](ThrowingList& list) { list.addLast(extra.begin(), extra.end()); }));
+	IRIS_CHECK(StrongOnFailure(4, 4, [](ThrowingList& list) { list.reserve(16); }));
+
+	// Heap to a larger heap block
+	IRIS_CHECK(StrongOnFailure(8, 8, [](ThrowingList& list) { list.emplaceLast(8); }));
+	IRIS_CHECK(StrongOnFailure(8, 10, [&](ThrowingList& list) { list.addLast(extra.begin(), extra.end()); }));
+	IRIS_CHECK(StrongOnFailure(6, 6, [](ThrowingList& list) { list.reserve(32); }));
+
+	// shrinkToFit swallows the failure and keeps the heap block
+	auto list = MakeThrowingList(6);
+	list.removeLast();
+	list.removeLast();
+	list.removeLast();
+
+	gCopyBudget = 1;
+	list.shrinkToFit();
+	IRIS_CHECK(!list.isInline() && Holds(list, 3));
+
+	gCopyBudget = INT_MAX;
+	list.shrinkToFit();
+	IRIS_CHECK(list.isInline() && Holds(list, 3));
+
+	list.removeAll();
+	IRIS_CHECK(gLive == outside);
+	IRIS_CHECK(gAllocations == gReleases);
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "../Test.hpp"
+
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+
+#include <Iris/Container/SortedMap.hpp>
+#include <Iris/Container/String.hpp>
+
+using namespace Iris;
+
+// SortedMap<String, V> looks up views and literals through the transparent std::less<String> without building a String
+
+namespace
+{
+	// Counts every global allocation, so lookups can be shown not to build a temporary String
+	int gAllocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	++gAllocations;
+
+	if (void* pointer = std::malloc(size ? size : 1))
+		return pointer;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+namespace
+{
+	String MakeKey(int index)
+	{
+		const auto digits = std::to_string(index);
+		return String{ std::u32string{ U"sorted key " } + std::u32string(digits.begin(), digits.end()) };
+	}
+}
+
+IRIS_TEST(StringKeysFindByViewAndLiteral)
+{
+	SortedMap<String, int> map;
+
+	for (int i = 0; i < 1000; ++i)
+		map[MakeKey(i)] = i;
+
+	const String::view_type view = U"sorted key 421";
+	const char32_t* literal = U"sorted key 999";
+	const String::view_type missing = U"sorted key 1000";
+
+	gAllocations = 0;
+
+	const bool found = (map.find(view) != map.end()) && (map.find(view)->second == 421)
+		&& map.contains(literal) && (map.count(literal) == 1) && (map.at(view) == 421) && (std::as_const(map).at(literal) == 999)
+		&& (map.find(missing) == map.end()) && !map.contains(missing) && (map.count(U"") == 0);
+
+	const auto allocations = gAllocations;
+
+	std::printf("    allocations during transparent lookups: %d\n", allocations);
+	IRIS_CHECK(found);
+	IRIS_CHECK(allocations == 0);
+
+	// The counter does see a String being built from the same view
+	gAllocations = 0;
+	const String built{ std::u32string{ view } };
+	IRIS_CHECK(gAllocations > 0 && map.contains(built));
+
+	IRIS_CHECK_THROWS(map.at(missing), Error::OutOfRange);
+	IRIS_CHECK_THROWS(std::as_const(map).at(U"sorted key -1"), Error::OutOfRange);
+	IRIS_CHECK(map.at(String{ U"sorted key 7" }) == 7);
+}
+
+IRIS_TEST(StringOrderMatchesStdMap)
+{
+	SortedMap<String, int> map;
+	std::map<std::u32string, int> reference;
+	std::mt19937 random{ 12345 };
+
+	for (int i = 0; i < 2000; ++i)
+	{
+		const auto key = MakeKey(static_cast<int>(random() % 700));
+		map[key] = i;
+		reference[std::u32string{ String::view_type{ key } }] = i;
+	}
+
+	IRIS_CHECK(map.size() == reference.size());
+
+	auto expected = reference.begin();
+	bool same = true;
+
+	for (const auto& [key, value] : map)
+	{
+		same &= (String::view_type{ key } == expected->first) && (value == expected->second);
+		++expected;
+	}
+
+	IRIS_CHECK(same);
+}
\ No newline at end of file
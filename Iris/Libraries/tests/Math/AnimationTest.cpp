@@ -0,0 +1,283 @@
+#include "../Test.hpp"
+
+#include <random>
+#include <vector>
+
+#include <Iris/Math/Animation.hpp>
+
+using namespace Iris;
+
+// The cursor-based samplers must give exactly what the stateless binary search in AnimationClip::sample gives, for
+// time running forward, running backward and falling outside the keys, serially and across threads
+
+namespace
+{
+	// Enough tracks across the samplers for SampleBatch to actually split the work
+	constexpr size_t TrackCount = 1024;
+
+	constexpr size_t SamplerCount = 8;
+
+	struct Keys
+	{
+		std::vector<float32> times;
+
+		std::vector<Vector3> positions;
+
+		std::vector<Quaternion> rotations;
+
+		std::vector<Vector3> scales;
+	};
+
+	Keys RandomKeys(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> gap{ 0.01f, 0.5f };
+		std::uniform_real_distribution<float32> component{ -5.f, 5.f };
+		std::normal_distribution<float32> direction;
+
+		Keys keys;
+		float32 time = gap(random) - 0.01f;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			keys.times.push_back(time);
+			keys.positions.emplace_back(component(random), component(random), component(random));
+			keys.rotations.push_back(Quaternion{ direction(random), direction(random), direction(random), direction(random) }.normalize());
+			keys.scales.emplace_back(1.f + component(random) * 0.1f, 1.f, 1.f - component(random) * 0.1f);
+			time += gap(random);
+		}
+
+		return keys;
+	}
+
+	size_t AddTrack(AnimationClip& clip, const Keys& keys)
+	{
+		return clip.addTrack(keys.times, keys.positions, keys.rotations, keys.scales);
+	}
+
+	AnimationClip RandomClip(std::mt19937& random, size_t trackCount)
+	{
+		std::uniform_int_distribution<size_t> keyCount{ 1, 24 };
+
+		AnimationClip clip;
+
+		for (size_t i = 0; i < trackCount; ++i)
+			AddTrack(clip, RandomKeys(random, keyCount(random)));
+
+		return clip;
+	}
+
+	bool Same(const Transform& a, const Transform& b)
+	{
+		return (a.position.x == b.position.x) && (a.position.y == b.position.y) && (a.position.z == b.position.z)
+			&& (a.rotation.x == b.rotation.x) && (a.rotation.y == b.rotation.y) && (a.rotation.z == b.rotation.z) && (a.rotation.w == b.rotation.w)
+			&& (a.scale.x == b.scale.x) && (a.scale.y == b.scale.y) && (a.scale.z == b.scale.z);
+	}
+
+	bool MatchesClip(const AnimationClip& clip, float32 time, const Array<Transform>& pose)
+	{
+		for (size_t track = 0; track < clip.trackCount(); ++track)
+		{
+			if (!Same(pose[track], clip.sample(track, time)))
+				return false;
+		}
+
+		return true;
+	}
+
+	// Per frame, one time per sampler: forward in small steps, then wrapping backward, then outside the keys
+	std::vector<std::vector<float32>> MakeFrames(std::mt19937& random, float32 duration)
+	{
+		std::uniform_real_distribution<float32> step{ 0.f, 0.05f };
+		std::uniform_real_distribution<float32> anywhere{ -1.f, duration + 1.f };
+
+		std::vector<std::vector<float32>> frames;
+		std::vector<float32> times(SamplerCount, 0.f);
+
+		for (size_t frame = 0; frame < 300; ++frame)
+		{
+			for (size_t i = 0; i < SamplerCount; ++i)
+			{
+				if (frame < 200)
+					times[i] = (i % 2) ? times[i] + step(random) : duration - frame * 0.02f * (1.f + i);
+				else
+					times[i] = (frame % 3 == 0) ? -0.5f - i : (frame % 3 == 1) ? duration + 0.25f * i : anywhere(random);
+			}
+
+			frames.push_back(times);
+		}
+
+		return frames;
+	}
+}
+
+IRIS_TEST(SamplerMatchesClip)
+{
+	std::mt19937 random{ 12345 };
+	const auto clip = RandomClip(random, 64);
+
+	AnimationSampler sampler{ clip };
+	Array<Transform> pose(clip.trackCount());
+
+	for (const auto& times : MakeFrames(random, clip.duration()))
+	{
+		sampler.sample(times[0], pose);
+
+		if (!IRIS_CHECK(MatchesClip(clip, times[0], pose)))
+			return;
+	}
+
+	// Exactly on every key of the first track, then past the end
+	std::vector<float32> keyTimes{ -1.f, 0.f };
+	for (float32 t = 0.f; t < clip.duration() + 1.f; t += 0.125f)
+		keyTimes.push_back(t);
+
+	for (const auto time : keyTimes)
+	{
+		sampler.sample(time, pose);
+		IRIS_CHECK(MatchesClip(clip, time, pose));
+	}
+}
+
+IRIS_TEST(SampleBatchMatchesClip)
+{
+	std::mt19937 random{ 777 };
+	const auto clip = RandomClip(random, TrackCount);
+	const auto frames = MakeFrames(random, clip.duration());
+
+	for (const size_t threadCount : { 1u, 3u, 0u })
+	{
+		std::vector<AnimationSampler> samplers(SamplerCount, AnimationSampler{ clip });
+		std::vector<Array<Transform>> poses(SamplerCount, Array<Transform>(clip.trackCount()));
+
+		bool same = true;
+
+		for (const auto& times : frames)
+		{
+			AnimationSampler::SampleBatch(samplers, times, poses, threadCount);
+
+			for (size_t i = 0; i < SamplerCount; ++i)
+				same &= MatchesClip(clip, times[i], poses[i]);
+
+			if (!same)
+				break;
+		}
+
+		IRIS_CHECK(same);
+	}
+}
+
+IRIS_TEST(SamplerPicksUpNewTracks)
+{
+	std::mt19937 random{ 12345 };
+	auto clip = RandomClip(random, 4);
+
+	AnimationSampler sampler{ clip };
+	Array<Transform> pose(clip.trackCount());
+	sampler.sample(0.3f, pose);
+
+	AddTrack(clip, RandomKeys(random, 5));
+	IRIS_CHECK_THROWS(sampler.sample(0.4f, pose), Error::OutOfRange);
+
+	pose.resize(clip.trackCount());
+	sampler.sample(0.4f, pose);
+	IRIS_CHECK(MatchesClip(clip, 0.4f, pose));
+
+	std::vector<AnimationSampler> samplers{ sampler };
+	std::vector<Array<Transform>> poses{ pose };
+	const float32 times[] = { 0.2f };
+
+	AddTrack(clip, RandomKeys(random, 3));
+	poses[0].resize(clip.trackCount());
+	AnimationSampler::SampleBatch(samplers, times, poses);
+	IRIS_CHECK(MatchesClip(clip, 0.2f, poses[0]));
+}
+
+IRIS_TEST(AddTrackValidation)
+{
+	std::mt19937 random{ 777 };
+	const auto keys = RandomKeys(random, 6);
+
+	AnimationClip clip;
+	IRIS_CHECK(AddTrack(clip, keys) == 0);
+
+	const auto check = [&](const Keys& bad)
+		{
+			IRIS_CHECK_THROWS(AddTrack(clip, bad), Error::OutOfRange);
+
+			// A rejected track leaves the clip as it was
+			IRIS_CHECK(clip.trackCount() == 1);
+			IRIS_CHECK(clip.keyCount() == keys.times.size());
+		};
+
+	check(Keys{});
+
+	for (const auto channel : { 0, 1, 2, 3 })
+	{
+		auto bad = keys;
+
+		switch (channel)
+		{
+		case 0: bad.times.pop_back(); break;
+		case 1: bad.positions.pop_back(); break;
+		case 2: bad.rotations.pop_back(); break;
+		default: bad.scales.pop_back(); break;
+		}
+
+		check(bad);
+	}
+
+	auto negative = keys;
+	negative.times[0] = -0.1f;
+	check(negative);
+
+	auto repeated = keys;
+	repeated.times[3] = repeated.times[2];
+	check(repeated);
+
+	auto decreasing = keys;
+	std::swap(decreasing.times[4], decreasing.times[5]);
+	check(decreasing);
+
+	// A single key at time zero is a valid constant track
+	auto single = RandomKeys(random, 1);
+	single.times[0] = 0.f;
+	IRIS_CHECK(AddTrack(clip, single) == 1);
+	IRIS_CHECK(Same(clip.sample(1, 10.f), Transform{ single.positions[0], single.rotations[0], single.scales[0] }));
+
+	IRIS_CHECK_THROWS(clip.sample(2, 0.f), Error::OutOfRange);
+}
+
+IRIS_TEST(SampleBatchValidation)
+{
+	std::mt19937 random{ 12345 };
+	const auto clip = RandomClip(random, 16);
+
+	std::vector<AnimationSampler> samplers(3, AnimationSampler{ clip });
+	std::vector<Array<Transform>> poses(3, Array<Transform>(clip.trackCount(), Transform::Identity()));
+	const std::vector<float32> times{ 0.1f, 0.2f, 0.3f };
+
+	const auto untouched = [&]()
+		{
+			for (const auto& pose : poses)
+			{
+				for (const auto& transform : pose)
+				{
+					if (!Same(transform, Transform::Identity()))
+						return false;
+				}
+			}
+
+			return true;
+		};
+
+	IRIS_CHECK_THROWS(AnimationSampler::SampleBatch(samplers, std::span{ times }.first(2), poses), Error::OutOfRange);
+	IRIS_CHECK_THROWS(AnimationSampler::SampleBatch(samplers, times, std::span{ poses }.first(2)), Error::OutOfRange);
+
+	poses[2].resize(clip.trackCount() - 1);
+	IRIS_CHECK_THROWS(AnimationSampler::SampleBatch(samplers, times, poses), Error::OutOfRange);
+
+	// Validation happens before any sampler runs
+	IRIS_CHECK(untouched());
+
+	AnimationSampler::SampleBatch(std::span<AnimationSampler>{}, std::span<const float32>{}, std::span<Array<Transform>>{});
+}
\ No newline at end of file
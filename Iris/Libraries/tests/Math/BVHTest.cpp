@@ -0,0 +1,175 @@
+#include "../Test.hpp"
+
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include <Iris/Math/BVH.hpp>
+
+using namespace Iris;
+
+// Every query is checked against a brute-force pass over the same boxes, for serial and threaded builds and after a refit
+
+namespace
+{
+	std::vector<AABB> RandomBoxes(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> position{ -100.f, 100.f };
+		std::uniform_real_distribution<float32> extent{ 0.1f, 3.f };
+
+		std::vector<AABB> boxes;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const Vector3 center{ position(random), position(random), position(random) };
+			boxes.push_back(AABB::FromCenterExtents(center, Vector3{ extent(random), extent(random), extent(random) }));
+		}
+
+		return boxes;
+	}
+
+	std::vector<Ray> RandomRays(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> position{ -120.f, 120.f };
+		std::normal_distribution<float32> direction;
+
+		std::vector<Ray> rays;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const Vector3 origin{ position(random), position(random), position(random) };
+			rays.push_back(Ray{ origin, Vector3{ direction(random), direction(random), direction(random) }.normalize(), (i % 3 == 0) ? 80.f : 1e30f });
+		}
+
+		return rays;
+	}
+
+	BVH::Hit BruteForce(const std::vector<AABB>& boxes, const Ray& ray)
+	{
+		BVH::Hit best;
+
+		for (uint32 i = 0; i < boxes.size(); ++i)
+		{
+			float32 distance;
+
+			if (ray.intersects(boxes[i], distance) && distance < best.distance)
+			{
+				best.primitive = i;
+				best.distance = distance;
+			}
+		}
+
+		return best;
+	}
+
+	bool Matches(const std::vector<AABB>& boxes, const BVH& bvh, const std::vector<Ray>& rays)
+	{
+		const auto intersect = [&boxes](uint32 primitive, const Ray& ray, float32& distance) { return ray.intersects(boxes[primitive], distance); };
+
+		std::vector<BVH::Hit> packet(rays.size());
+		bvh.raycast(rays, packet, intersect);
+
+		for (size_t i = 0; i < rays.size(); ++i)
+		{
+			const auto expected = BruteForce(boxes, rays[i]);
+			const auto single = bvh.raycast(rays[i], intersect);
+
+			// Ties between overlapping boxes may resolve to either primitive, so compare distances
+			if (!IRIS_CHECK(static_cast<bool>(single) == static_cast<bool>(expected)) ||
+				!IRIS_CHECK(static_cast<bool>(packet[i]) == static_cast<bool>(expected)))
+				return false;
+
+			if (expected && (!IRIS_CHECK(single.distance == expected.distance) || !IRIS_CHECK(packet[i].distance == expected.distance)))
+				return false;
+		}
+
+		std::mt19937 random{ 777 };
+		const auto queries = RandomBoxes(random, 50);
+
+		for (const auto& query : queries)
+		{
+			Array<uint32> found;
+			bvh.overlap(query, found);
+			std::vector<uint32> actual(found.begin(), found.end());
+			std::sort(actual.begin(), actual.end());
+
+			std::vector<uint32> expected;
+			for (uint32 i = 0; i < boxes.size(); ++i)
+				if (boxes[i].intersects(query)) expected.push_back(i);
+
+			if (!IRIS_CHECK(actual == expected))
+				return false;
+
+			const Sphere sphere{ query.center(), query.extents().x * 4.f };
+			found.resize(0);
+			bvh.overlap(sphere, found);
+			actual.assign(found.begin(), found.end());
+			std::sort(actual.begin(), actual.end());
+
+			expected.clear();
+			for (uint32 i = 0; i < boxes.size(); ++i)
+				if (sphere.intersects(boxes[i])) expected.push_back(i);
+
+			if (!IRIS_CHECK(actual == expected))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+IRIS_TEST(QueriesMatchBruteForce)
+{
+	std::mt19937 random{ 12345 };
+	const auto boxes = RandomBoxes(random, 20000);
+	const auto rays = RandomRays(random, 2003);
+
+	BVH serial;
+	serial.build(boxes, 1);
+	IRIS_CHECK(serial.primitives().size() == boxes.size());
+	IRIS_CHECK(Matches(boxes, serial, rays));
+
+	BVH threaded;
+	threaded.build(boxes, 4);
+	IRIS_CHECK(threaded.primitives().size() == boxes.size());
+	IRIS_CHECK(Matches(boxes, threaded, rays));
+}
+
+IRIS_TEST(RefitFollowsMovedBoxes)
+{
+	std::mt19937 random{ 54321 };
+	auto boxes = RandomBoxes(random, 5000);
+	const auto rays = RandomRays(random, 1001);
+
+	BVH bvh;
+	bvh.build(boxes, 1);
+
+	std::uniform_real_distribution<float32> offset{ -5.f, 5.f };
+
+	for (auto& box : boxes)
+	{
+		const Vector3 move{ offset(random), offset(random), offset(random) };
+		box = AABB{ box.min + move, box.max + move };
+	}
+
+	bvh.refit(boxes);
+	IRIS_CHECK(Matches(boxes, bvh, rays));
+
+	boxes.pop_back();
+	IRIS_CHECK_THROWS(bvh.refit(boxes), Error::OutOfRange);
+}
+
+IRIS_TEST(EmptyAndTiny)
+{
+	BVH bvh;
+	bvh.build(std::span<const AABB>{}, 1);
+	IRIS_CHECK(bvh.empty());
+	IRIS_CHECK(!bvh.raycast(Ray{}, [](uint32, const Ray&, float32&) { return true; }));
+
+	const std::vector<AABB> one{ AABB{ Vector3{ -1.f, -1.f, 4.f }, Vector3{ 1.f, 1.f, 6.f } } };
+	bvh.build(one, 1);
+
+	const auto hit = bvh.raycast(Ray{}, [&one](uint32 primitive, const Ray& ray, float32& distance) { return ray.intersects(one[primitive], distance); });
+	IRIS_CHECK(hit && hit.primitive == 0);
+	IRIS_CHECK_NEAR(hit.distance, 4.f, 1e-6);
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "../Test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <Iris/Math/BatchTransform.hpp>
+
+using namespace Iris;
+
+// Every batch entry point is checked against a scalar row-vector multiply for each SIMD tail length, in place,
+// and with the output starting at each offset within a 16-byte line so the Stream alignment head is exercised
+
+namespace
+{
+	const Vector3 Sentinel{ 1234.5f, -1234.5f, 42.f };
+
+	Matrix4x4 RandomMatrix(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float32> element{ -2.f, 2.f };
+
+		// Includes a projective column; the batch transforms ignore it and never divide by w
+		Matrix4x4 matrix;
+
+		for (auto& value : matrix.data)
+			value = element(random);
+
+		return matrix;
+	}
+
+	std::vector<Vector3> RandomVectors(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> component{ -50.f, 50.f };
+
+		std::vector<Vector3> vectors;
+
+		for (size_t i = 0; i < count; ++i)
+			vectors.emplace_back(component(random), component(random), component(random));
+
+		return vectors;
+	}
+
+	Vector3 Reference(const Matrix4x4& m, const Vector3& v, float32 w)
+	{
+		return Vector3
+		{
+			static_cast<float32>(double{ v.x } * m.m[0][0] + double{ v.y } * m.m[1][0] + double{ v.z } * m.m[2][0] + double{ w } * m.m[3][0]),
+			static_cast<float32>(double{ v.x } * m.m[0][1] + double{ v.y } * m.m[1][1] + double{ v.z } * m.m[2][1] + double{ w } * m.m[3][1]),
+			static_cast<float32>(double{ v.x } * m.m[0][2] + double{ v.y } * m.m[1][2] + double{ v.z } * m.m[2][2] + double{ w } * m.m[3][2])
+		};
+	}
+
+	float32 MaxError(const Matrix4x4& m, const std::vector<Vector3>& input, std::span<const Vector3> output, float32 w)
+	{
+		float32 error = 0.f;
+
+		for (size_t i = 0; i < input.size(); ++i)
+		{
+			const auto expected = Reference(m, input[i], w);
+			error = std::max({ error, std::abs(output[i].x - expected.x), std::abs(output[i].y - expected.y), std::abs(output[i].z - expected.z) });
+		}
+
+		return error;
+	}
+
+	bool IsSentinel(const Vector3& v)
+	{
+		return (v.x == Sentinel.x) && (v.y == Sentinel.y) && (v.z == Sentinel.z);
+	}
+
+	using BatchFunction = std::function<void(const Matrix4x4&, std::span<const Vector3>, std::span<Vector3>)>;
+
+	// Runs 'function' into a window of a padded buffer starting 'offset' Vector3s in, and checks the result and
+	// that nothing either side of the window was touched
+	bool Check(const char* name, const BatchFunction& function, float32 w, const Matrix4x4& m, const std::vector<Vector3>& input, size_t offset)
+	{
+		std::vector<Vector3> buffer(input.size() + 8, Sentinel);
+		const auto output = std::span<Vector3>{ buffer }.subspan(offset, input.size());
+
+		function(m, input, output);
+
+		const auto error = MaxError(m, input, output, w);
+		const bool guarded = std::all_of(buffer.begin(), buffer.begin() + offset, IsSentinel)
+			&& std::all_of(buffer.begin() + offset + input.size(), buffer.end(), IsSentinel);
+
+		if (error > 1e-3f || !guarded)
+		{
+			std::printf("    %s: count %zu, offset %zu, max error %g, guard %s\n", name, input.size(), offset, error, guarded ? "intact" : "overwritten");
+			return false;
+		}
+
+		return true;
+	}
+}
+
+IRIS_TEST(MatchesScalarForEveryTail)
+{
+	std::mt19937 random{ 12345 };
+	const auto matrix = RandomMatrix(random);
+
+	const BatchFunction points = [](const Matrix4x4& m, std::span<const Vector3> in, std::span<Vector3> out) { TransformPoints(m, in, out); };
+	const BatchFunction directions = [](const Matrix4x4& m, std::span<const Vector3> in, std::span<Vector3> out) { TransformDirections(m, in, out); };
+	const BatchFunction pointsStream = [](const Matrix4x4& m, std::span<const Vector3> in, std::span<Vector3> out) { TransformPointsStream(m, in, out); };
+	const BatchFunction directionsStream = [](const Matrix4x4& m, std::span<const Vector3> in, std::span<Vector3> out) { TransformDirectionsStream(m, in, out); };
+
+	const BatchFunction pointsArray = [](const Matrix4x4& m, std::span<const Vector3> in, std::span<Vector3> out)
+		{
+			TransformPoints(m, Array<Vector3>(in.begin(), in.end()), out);
+		};
+
+	const BatchFunction directionsArray = [](const Matrix4x4& m, std::span<const Vector3> in, std::span<Vector3> out)
+		{
+			TransformDirections(m, Array<Vector3>(in.begin(), in.end()), out);
+		};
+
+	// 0-4 element tails after both the 4-wide and the 8-wide loops
+	std::vector<size_t> counts;
+	for (size_t count = 0; count <= 20; ++count)
+		counts.push_back(count);
+	for (size_t tail = 0; tail <= 4; ++tail)
+		counts.push_back(1024 + tail);
+
+	for (const auto count : counts)
+	{
+		const auto input = RandomVectors(random, count);
+
+		// Vector3 is 12 bytes, so offsets 0-3 cover every position within a 16-byte line
+		for (size_t offset = 0; offset < 4; ++offset)
+		{
+			IRIS_CHECK(Check("TransformPoints", points, 1.f, matrix, input, offset));
+			IRIS_CHECK(Check("TransformDirections", directions, 0.f, matrix, input, offset));
+			IRIS_CHECK(Check("TransformPointsStream", pointsStream, 1.f, matrix, input, offset));
+			IRIS_CHECK(Check("TransformDirectionsStream", directionsStream, 0.f, matrix, input, offset));
+		}
+
+		IRIS_CHECK(Check("TransformPoints(Array)", pointsArray, 1.f, matrix, input, 1));
+		IRIS_CHECK(Check("TransformDirections(Array)", directionsArray, 0.f, matrix, input, 1));
+	}
+}
+
+IRIS_TEST(InPlaceMatchesScalar)
+{
+	std::mt19937 random{ 777 };
+	const auto matrix = RandomMatrix(random);
+
+	static_assert(noexcept(TransformPoints(matrix, std::span<Vector3>{})));
+	static_assert(noexcept(TransformDirections(matrix, std::span<Vector3>{})));
+
+	for (const size_t count : { 0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 12u, 13u, 1027u })
+	{
+		const auto input = RandomVectors(random, count);
+
+		auto points = input;
+		TransformPoints(matrix, std::span<Vector3>{ points });
+		IRIS_CHECK(MaxError(matrix, input, points, 1.f) < 1e-3f);
+
+		auto directions = input;
+		TransformDirections(matrix, std::span<Vector3>{ directions });
+		IRIS_CHECK(MaxError(matrix, input, directions, 0.f) < 1e-3f);
+
+		// The span overloads are documented as safe with output aliasing input
+		auto aliased = input;
+		TransformPointsStream(matrix, aliased, aliased);
+		IRIS_CHECK(MaxError(matrix, input, aliased, 1.f) < 1e-3f);
+	}
+}
+
+IRIS_TEST(ThrowsOnShortOutput)
+{
+	std::mt19937 random{ 12345 };
+	const auto matrix = RandomMatrix(random);
+	const auto input = RandomVectors(random, 9);
+
+	std::vector<Vector3> output(8);
+
+	IRIS_CHECK_THROWS(TransformPoints(matrix, input, output), Error::OutOfRange);
+	IRIS_CHECK_THROWS(TransformDirections(matrix, input, output), Error::OutOfRange);
+	IRIS_CHECK_THROWS(TransformPointsStream(matrix, input, output), Error::OutOfRange);
+	IRIS_CHECK_THROWS(TransformDirectionsStream(matrix, input, output), Error::OutOfRange);
+}
\ No newline at end of file
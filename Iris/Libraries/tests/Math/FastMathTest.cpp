@@ -0,0 +1,220 @@
+#include "../Test.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+#include <Iris/Math/Math.hpp>
+#include <Iris/Math/FastMath.hpp>
+#include <Iris/Math/Matrix4x4.hpp>
+#include <Iris/Math/Quaternion.hpp>
+
+using namespace Iris;
+
+// Accuracy table for the Math::Fast* approximations. Each function is swept densely over its domain against the
+// double-precision std result; the measured maximum absolute error is printed and checked against the bound
+// documented in Math.hpp, and the SIMD overloads must agree with the scalar ones lane for lane.
+
+namespace
+{
+	constexpr int Samples = 1 << 20;
+
+	constexpr double TrigBound = 1e-7;
+	constexpr double Atan2Bound = 2e-6;
+	constexpr double AcosBound = 5e-7;
+
+	template<class Fty>
+	double MaxError(float32 min, float32 max, Fty error)
+	{
+		double worst = 0;
+
+		for (int i = 0; i <= Samples; ++i)
+		{
+			const auto x = min + (max - min) * static_cast<float32>(i) / Samples;
+			worst = std::max(worst, error(x));
+		}
+
+		return worst;
+	}
+
+	void Report(const char* name, const char* domain, double error, double bound)
+	{
+		std::printf("    %-12s %-18s max abs error %.3e (bound %.0e)\n", name, domain, error, bound);
+	}
+
+	IRIS_TARGET_AVX2 void WideSinCos(const float32* x, float32* sin, float32* cos)
+	{
+		__m256 s, c;
+		Math::FastSinCos(_mm256_load_ps(x), s, c);
+		_mm256_store_ps(sin, s);
+		_mm256_store_ps(cos, c);
+	}
+
+	float32 Lane(__m128 v, int i)
+	{
+		alignas(16) float32 lanes[4];
+		_mm_store_ps(lanes, v);
+		return lanes[i];
+	}
+}
+
+IRIS_TEST(FastSinCosAccuracy)
+{
+	const float32 ranges[] = { Math::Pi, 100.f, 8192.f };
+	const char* names[] = { "[-pi, pi]", "[-100, 100]", "[-8192, 8192]" };
+
+	for (int r = 0; r < 3; ++r)
+	{
+		const auto range = ranges[r];
+
+		const auto sinError = MaxError(-range, range, [](float32 x) { return std::abs(Math::FastSin(x) - std::sin(static_cast<double>(x))); });
+		const auto cosError = MaxError(-range, range, [](float32 x) { return std::abs(Math::FastCos(x) - std::cos(static_cast<double>(x))); });
+		const auto sinCosError = MaxError(-range, range, [](float32 x)
+			{
+				float32 s, c;
+				Math::FastSinCos(x, s, c);
+				return std::max(std::abs(s - std::sin(static_cast<double>(x))), std::abs(c - std::cos(static_cast<double>(x))));
+			});
+
+		Report("FastSin", names[r], sinError, TrigBound);
+		Report("FastCos", names[r], cosError, TrigBound);
+		Report("FastSinCos", names[r], sinCosError, TrigBound);
+
+		IRIS_CHECK(sinError <= TrigBound);
+		IRIS_CHECK(cosError <= TrigBound);
+		IRIS_CHECK(sinCosError <= TrigBound);
+	}
+}
+
+IRIS_TEST(FastAtan2Accuracy)
+{
+	// Sweeps the angle around the circle at several radii so every octant and both argument orders are hit
+	double worst = 0;
+
+	for (const float32 radius : { 1e-3f, 1.f, 1e4f })
+	{
+		worst = std::max(worst, MaxError(-Math::Pi, Math::Pi, [radius](float32 angle)
+			{
+				const auto x = radius * std::cos(angle);
+				const auto y = radius * std::sin(angle);
+				return std::abs(Math::FastAtan2(x, y) - std::atan2(static_cast<double>(y), static_cast<double>(x)));
+			}));
+	}
+
+	Report("FastAtan2", "all octants", worst, Atan2Bound);
+	IRIS_CHECK(worst <= Atan2Bound);
+	IRIS_CHECK(Math::FastAtan2(0.f, 0.f) == 0.f);
+}
+
+IRIS_TEST(FastAcosAccuracy)
+{
+	const auto error = MaxError(-1.f, 1.f, [](float32 x) { return std::abs(Math::FastAcos(x) - std::acos(static_cast<double>(x))); });
+
+	Report("FastAcos", "[-1, 1]", error, AcosBound);
+	IRIS_CHECK(error <= AcosBound);
+
+	// Clamped outside the domain instead of returning NaN
+	IRIS_CHECK_NEAR(Math::FastAcos(1.5f), 0.f, AcosBound);
+	IRIS_CHECK_NEAR(Math::FastAcos(-1.5f), Math::Pi, AcosBound);
+}
+
+IRIS_TEST(SimdMatchesScalar)
+{
+	const bool avx2 = CPUFeature::Get().avx2 && CPUFeature::Get().fma;
+
+	for (int i = 0; i < Samples; i += 4)
+	{
+		alignas(32) float32 x[8], y[8];
+		for (int k = 0; k < 8; ++k)
+		{
+			x[k] = -8192.f + 16384.f * static_cast<float32>(i + k) / Samples;
+			y[k] = std::cos(x[k]) * 3.f;
+		}
+
+		const __m128 vx = _mm_load_ps(x);
+		const __m128 vy = _mm_load_ps(y);
+		const __m128 unit = _mm_set_ps(0.999f, -0.5f, 0.25f, -1.f);
+
+		__m128 s, c;
+		Math::FastSinCos(vx, s, c);
+		const __m128 sin = Math::FastSin(vx);
+		const __m128 cos = Math::FastCos(vx);
+		const __m128 atan = Math::FastAtan2(vx, vy);
+		const __m128 acos = Math::FastAcos(unit);
+
+		for (int k = 0; k < 4; ++k)
+		{
+			if (!IRIS_CHECK_NEAR(Lane(sin, k), Math::FastSin(x[k]), 2e-7) ||
+				!IRIS_CHECK_NEAR(Lane(cos, k), Math::FastCos(x[k]), 2e-7) ||
+				!IRIS_CHECK_NEAR(Lane(s, k), Lane(sin, k), 0) ||
+				!IRIS_CHECK_NEAR(Lane(c, k), Lane(cos, k), 0) ||
+				!IRIS_CHECK_NEAR(Lane(atan, k), Math::FastAtan2(x[k], y[k]), 1e-6) ||
+				!IRIS_CHECK_NEAR(Lane(acos, k), Math::FastAcos(Lane(unit, k)), 2e-7))
+				return;
+		}
+
+		if (!avx2)
+			continue;
+
+		alignas(32) float32 wideSin[8], wideCos[8];
+		WideSinCos(x, wideSin, wideCos);
+
+		for (int k = 0; k < 8; ++k)
+		{
+			if (!IRIS_CHECK_NEAR(wideSin[k], Math::FastSin(x[k]), 2e-7) ||
+				!IRIS_CHECK_NEAR(wideCos[k], Math::FastCos(x[k]), 2e-7))
+				return;
+		}
+	}
+}
+
+IRIS_TEST(SinCosMatchesSinAndCos)
+{
+	const auto error = MaxError(-8192.f, 8192.f, [](float32 x)
+		{
+			float32 s, c;
+			Math::SinCos(x, s, c);
+			return std::max(std::abs(s - std::sin(static_cast<double>(x))), std::abs(c - std::cos(static_cast<double>(x))));
+		});
+
+	Report("SinCos", "[-8192, 8192]", error, TrigBound);
+	IRIS_CHECK(error <= TrigBound);
+
+	// Outside the shared-reduction range it is exactly Sin and Cos
+	for (const float32 x : { 1e5f, -3.5e6f, 1e30f })
+	{
+		float32 s, c;
+		Math::SinCos(x, s, c);
+		IRIS_CHECK(s == Math::Sin(x));
+		IRIS_CHECK(c == Math::Cos(x));
+	}
+
+	float32 s, c;
+	Math::SinCos(std::nanf(""), s, c);
+	IRIS_CHECK(std::isnan(s) && std::isnan(c));
+}
+
+IRIS_TEST(SinCosInConstantExpressions)
+{
+	constexpr auto rotation = Matrix4x4::RotateZ(Math::Pi / 6.f);
+	constexpr auto quaternion = Quaternion::FromAxisAngle(Vector3::Up(), Math::Pi / 3.f);
+
+	IRIS_CHECK_NEAR(rotation.m00, std::cos(Math::Pi / 6.f), 1e-7);
+	IRIS_CHECK_NEAR(rotation.m01, std::sin(Math::Pi / 6.f), 1e-7);
+	IRIS_CHECK_NEAR(quaternion.w, std::cos(Math::Pi / 6.f), 1e-7);
+}
+
+IRIS_TEST(RotationConstructorsUseSinCos)
+{
+	for (const float32 angle : { -3.f, -0.5f, 0.f, 0.75f, 2.5f, 100.f })
+	{
+		const auto x = Matrix4x4::RotateX(angle);
+		const auto y = Matrix4x4::RotateY(angle);
+		const auto z = Matrix4x4::RotateZ(angle);
+
+		IRIS_CHECK_NEAR(x.m11, std::cos(static_cast<double>(angle)), TrigBound);
+		IRIS_CHECK_NEAR(x.m12, std::sin(static_cast<double>(angle)), TrigBound);
+		IRIS_CHECK_NEAR(y.m00, std::cos(static_cast<double>(angle)), TrigBound);
+		IRIS_CHECK_NEAR(z.m00, std::cos(static_cast<double>(angle)), TrigBound);
+		IRIS_CHECK_NEAR(z.m01, std::sin(static_cast<double>(angle)), TrigBound);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include "../Test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <Iris/Math/Frustum.hpp>
+
+using namespace Iris;
+
+// The cull bitmasks are checked bit by bit against Frustum::intersects across word boundaries, serial against
+// threaded, and the bits past the last bound must come back clear even when the mask starts out dirty
+
+namespace
+{
+	constexpr uint64 Dirty = ~uint64{ 0 };
+
+	// Looks at the origin from 20 units away, turned 0.3 radians about y; 60 degree vertical field of view, D3D clip space
+	Frustum MakeFrustum()
+	{
+		constexpr float32 Near = 1.f, Far = 60.f, Aspect = 16.f / 9.f;
+		const float32 yScale = 1.f / std::tan(0.5236f);
+		const float32 xScale = yScale / Aspect;
+
+		const Matrix4x4 projection
+		{
+			xScale, 0.f, 0.f, 0.f,
+			0.f, yScale, 0.f, 0.f,
+			0.f, 0.f, Far / (Far - Near), 1.f,
+			0.f, 0.f, -Near * Far / (Far - Near), 0.f
+		};
+
+		return Frustum::FromViewProjection(Matrix4x4::RotateY(0.3f) * Matrix4x4::Translate(Vector3{ 0.f, 0.f, 20.f }) * projection);
+	}
+
+	std::vector<AABB> RandomBoxes(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> position{ -60.f, 60.f };
+		std::uniform_real_distribution<float32> extent{ 0.1f, 4.f };
+
+		std::vector<AABB> boxes;
+
+		for (size_t i = 0; i < count; ++i)
+			boxes.push_back(AABB::FromCenterExtents(Vector3{ position(random), position(random), position(random) }, Vector3{ extent(random), extent(random), extent(random) }));
+
+		return boxes;
+	}
+
+	std::vector<Sphere> RandomSpheres(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> position{ -60.f, 60.f };
+		std::uniform_real_distribution<float32> radius{ 0.1f, 4.f };
+
+		std::vector<Sphere> spheres;
+
+		for (size_t i = 0; i < count; ++i)
+			spheres.emplace_back(Vector3{ position(random), position(random), position(random) }, radius(random));
+
+		return spheres;
+	}
+
+	// How far the bound sits inside its worst plane; the SIMD kernels sum in a different order, so bounds that
+	// just touch a plane may legitimately land on either side
+	float32 Margin(const Frustum& frustum, const AABB& box)
+	{
+		const auto center = box.center();
+		const auto extents = box.extents();
+		float32 margin = 1e30f;
+
+		for (const auto& plane : frustum.planes)
+		{
+			const auto radius = std::abs(plane.normal.x) * extents.x + std::abs(plane.normal.y) * extents.y + std::abs(plane.normal.z) * extents.z;
+			margin = std::min(margin, plane.signedDistance(center) + radius);
+		}
+
+		return margin;
+	}
+
+	float32 Margin(const Frustum& frustum, const Sphere& sphere)
+	{
+		float32 margin = 1e30f;
+
+		for (const auto& plane : frustum.planes)
+			margin = std::min(margin, plane.signedDistance(sphere.center) + sphere.radius);
+
+		return margin;
+	}
+
+	template<class Bounds>
+	bool MatchesIntersects(const Frustum& frustum, const std::vector<Bounds>& bounds, const std::vector<uint64>& visibility, size_t visible)
+	{
+		size_t mismatches = 0, bits = 0;
+
+		for (size_t i = 0; i < bounds.size(); ++i)
+		{
+			const bool bit = ((visibility[i / 64] >> (i % 64)) & 1) != 0;
+			bits += bit;
+
+			if ((bit != frustum.intersects(bounds[i])) && (std::abs(Margin(frustum, bounds[i])) > 1e-3f))
+				++mismatches;
+		}
+
+		// Bits past the last bound in the final word stay clear
+		if ((bounds.size() % 64) != 0)
+		{
+			if ((visibility[bounds.size() / 64] >> (bounds.size() % 64)) != 0)
+				return false;
+		}
+
+		return (mismatches == 0) && (bits == visible);
+	}
+
+	template<class Bounds>
+	void CheckCounts(const std::vector<Bounds>& all)
+	{
+		const auto frustum = MakeFrustum();
+
+		for (const size_t count : { 0u, 1u, 3u, 7u, 8u, 9u, 63u, 64u, 65u, 127u, 129u, 100003u })
+		{
+			const std::vector<Bounds> bounds(all.begin(), all.begin() + count);
+
+			// One extra word past MaskWords must never be written
+			std::vector<uint64> visibility(Frustum::MaskWords(count) + 1, Dirty);
+			const auto visible = frustum.cull(bounds, visibility);
+
+			IRIS_CHECK(MatchesIntersects(frustum, bounds, visibility, visible));
+			IRIS_CHECK(visibility.back() == Dirty);
+
+			for (const size_t threadCount : { 1u, 3u, 0u })
+			{
+				std::vector<uint64> parallel(Frustum::MaskWords(count) + 1, Dirty);
+				const auto parallelVisible = frustum.cullParallel(bounds, parallel, threadCount);
+
+				IRIS_CHECK(parallelVisible == visible);
+				IRIS_CHECK(parallel == visibility);
+			}
+		}
+	}
+}
+
+IRIS_TEST(CullAABBMatchesIntersects)
+{
+	std::mt19937 random{ 12345 };
+	const auto boxes = RandomBoxes(random, 100003);
+
+	const auto frustum = MakeFrustum();
+	const auto inside = std::count_if(boxes.begin(), boxes.end(), [&](const AABB& box) { return frustum.intersects(box); });
+	std::printf("    %zu of %zu boxes visible\n", static_cast<size_t>(inside), boxes.size());
+
+	// Both outcomes have to be well represented for the comparison to mean anything
+	IRIS_CHECK(inside > 1000 && inside < 99000);
+
+	CheckCounts(boxes);
+}
+
+IRIS_TEST(CullSphereMatchesIntersects)
+{
+	std::mt19937 random{ 777 };
+	CheckCounts(RandomSpheres(random, 100003));
+}
+
+IRIS_TEST(CullThrowsOnShortMask)
+{
+	std::mt19937 random{ 12345 };
+
+	const auto frustum = MakeFrustum();
+	const auto boxes = RandomBoxes(random, 65);
+	const auto spheres = RandomSpheres(random, 65);
+
+	std::vector<uint64> visibility(1);
+
+	IRIS_CHECK_THROWS(frustum.cull(boxes, visibility), Error::OutOfRange);
+	IRIS_CHECK_THROWS(frustum.cull(spheres, visibility), Error::OutOfRange);
+	IRIS_CHECK_THROWS(frustum.cullParallel(boxes, visibility, 2), Error::OutOfRange);
+	IRIS_CHECK_THROWS(frustum.cullParallel(spheres, visibility, 2), Error::OutOfRange);
+
+	// Nothing to cull needs no mask
+	IRIS_CHECK(frustum.cull(std::span<const AABB>{}, std::span<uint64>{}) == 0);
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "../Test.hpp"
+
+#include <random>
+#include <vector>
+
+#include <Iris/Math/LazyExpression.hpp>
+
+using namespace Iris;
+
+// Lazy expressions against the same arithmetic written with the eager operators
+
+namespace
+{
+	constexpr double Tolerance = 1e-5;
+
+	std::vector<Vector3> RandomVectors(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> component{ -4.f, 4.f };
+		std::vector<Vector3> vectors(count);
+
+		for (auto& v : vectors)
+			v = Vector3{ component(random), component(random), component(random) };
+
+		return vectors;
+	}
+
+	bool Near(const Vector3& actual, const Vector3& expected)
+	{
+		return IRIS_CHECK_NEAR(actual.x, expected.x, Tolerance)
+			&& IRIS_CHECK_NEAR(actual.y, expected.y, Tolerance)
+			&& IRIS_CHECK_NEAR(actual.z, expected.z, Tolerance);
+	}
+}
+
+IRIS_TEST(MatchesEagerOperators)
+{
+	std::mt19937 random{ 12345 };
+	const auto a = RandomVectors(random, 257);
+	const auto b = RandomVectors(random, 257);
+	const auto c = RandomVectors(random, 257);
+	const Vector3 d{ 0.5f, -1.5f, 2.f };
+	const auto rotation = Quaternion::FromAxisAngle(Vector3{ 1.f, 2.f, 3.f }.normalize(), 0.7f);
+	const float32 s = 0.75f;
+
+	const std::span<const Vector3> sa{ a }, sb{ b }, sc{ c };
+	std::vector<Vector3> output(a.size());
+	std::vector<float32> scalars(a.size());
+
+	Lazy::Evaluate(Lazy::Each(sa) + Lazy::Each(sb) * s - Lazy::Cross(Lazy::Each(sc), d), std::span<Vector3>{ output });
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (!Near(output[i], a[i] + b[i] * s - c[i].cross(d)))
+			return;
+	}
+
+	Lazy::Evaluate(-(Lazy::Each(sa) * Lazy::Each(sb)) / 2.f + Lazy::Normalize(Lazy::Each(sc)), std::span<Vector3>{ output });
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (!Near(output[i], -(a[i] * b[i]) / 2.f + c[i].normalize()))
+			return;
+	}
+
+	Lazy::Evaluate(Lazy::Rotate(Lazy::Each(sa), rotation) + Lazy::Each(sb), std::span<Vector3>{ output });
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (!Near(output[i], a[i].rotate(rotation) + b[i]))
+			return;
+	}
+
+	Lazy::Evaluate(Lazy::Dot(Lazy::Each(sa), Lazy::Each(sb)) * s + Lazy::Dot(Lazy::Each(sc), d), std::span<float32>{ scalars });
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (!IRIS_CHECK_NEAR(scalars[i], a[i].dot(b[i]) * s + c[i].dot(d), Tolerance))
+			return;
+	}
+}
+
+IRIS_TEST(OutputMayAliasAnInput)
+{
+	std::mt19937 random{ 777 };
+	auto a = RandomVectors(random, 64);
+	const auto b = RandomVectors(random, 64);
+	const auto original = a;
+
+	Lazy::Evaluate(Lazy::Each(std::span<const Vector3>{ a }) * 2.f + Lazy::Each(std::span<const Vector3>{ b }), std::span<Vector3>{ a });
+
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (!Near(a[i], original[i] * 2.f + b[i]))
+			return;
+	}
+}
+
+IRIS_TEST(BroadcastAndSizes)
+{
+	const Vector3 d{ 1.f, 2.f, 3.f };
+
+	// An expression over values alone fills the whole output
+	std::vector<Vector3> output(5);
+	Lazy::Evaluate(Lazy::Value(d) * 2.f, std::span<Vector3>{ output });
+	for (const auto& v : output)
+		IRIS_CHECK(v == Vector3(2.f, 4.f, 6.f));
+
+	IRIS_CHECK(Lazy::Evaluate(Lazy::Cross(Lazy::Value(Vector3{ 1.f, 0.f, 0.f }), Vector3{ 0.f, 1.f, 0.f })) == Vector3(0.f, 0.f, 1.f));
+
+	const std::vector<Vector3> three(3, d), four(4, d);
+	IRIS_CHECK_THROWS(Lazy::Each(std::span<const Vector3>{ three }) + Lazy::Each(std::span<const Vector3>{ four }), Error::OutOfRange);
+
+	std::vector<Vector3> shortOutput(2);
+	IRIS_CHECK_THROWS(Lazy::Evaluate(Lazy::Each(std::span<const Vector3>{ three }) * 2.f, std::span<Vector3>{ shortOutput }), Error::OutOfRange);
+
+	IRIS_CHECK_THROWS(Lazy::Evaluate(Lazy::Each(std::span<const Vector3>{ three }) / 0.f, std::span<Vector3>{ output }), Error::ZeroDivisionException);
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+#include "../Test.hpp"
+
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+#include <Iris/Math/Matrix4x4.hpp>
+
+using namespace Iris;
+
+namespace
+{
+	static_assert(Matrix4x4::RotateX(0.5f).isAffine());
+	static_assert(Matrix4x4::Translate(Vector3{ 1.f, 2.f, 3.f }).isAffine());
+	static_assert(!Matrix4x4{ 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1 }.isAffine());
+
+	Matrix4x4 RandomMatrix(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float32> component{ -4.f, 4.f };
+		Matrix4x4 m;
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+				m.m[row][column] = component(random);
+		}
+
+		return m;
+	}
+
+	// Largest deviation of 'm' from the identity
+	float32 IdentityError(const Matrix4x4& m)
+	{
+		float32 worst = 0;
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+				worst = std::max(worst, std::abs(m.m[row][column] - ((row == column) ? 1.f : 0.f)));
+		}
+
+		return worst;
+	}
+
+	// The same sums as the scalar kernel in Matrix4x4.cpp, in double, with the magnitude of the terms for a tolerance
+	void MultiplyReference(const Matrix4x4& left, const Matrix4x4& right, double (&product)[4][4], double (&magnitude)[4][4])
+	{
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+			{
+				product[row][column] = magnitude[row][column] = 0.0;
+
+				for (size_t k = 0; k < 4; ++k)
+				{
+					const double term = static_cast<double>(left.m[row][k]) * right.m[k][column];
+					product[row][column] += term;
+					magnitude[row][column] += std::abs(term);
+				}
+			}
+		}
+	}
+
+	// Worst error of 'm' against the reference product, relative to the size of the terms summed
+	float32 ProductError(const Matrix4x4& m, const Matrix4x4& left, const Matrix4x4& right)
+	{
+		double product[4][4], magnitude[4][4];
+		MultiplyReference(left, right, product, magnitude);
+
+		double worst = 0.0;
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+				worst = std::max(worst, std::abs(m.m[row][column] - product[row][column]) / std::max(magnitude[row][column], 1e-30));
+		}
+
+		return static_cast<float32>(worst);
+	}
+
+	Vector3 RandomAxis(std::mt19937& random)
+	{
+		std::normal_distribution<float32> direction;
+		return Vector3{ direction(random), direction(random), direction(random) }.normalize();
+	}
+
+	// Rotation then translation, with an optional non-uniform scale first
+	Matrix4x4 RandomAffine(std::mt19937& random, bool rigid)
+	{
+		std::uniform_real_distribution<float32> offset{ -10.f, 10.f };
+		std::uniform_real_distribution<float32> angle{ -3.1f, 3.1f };
+		std::uniform_real_distribution<float32> scale{ 0.25f, 4.f };
+
+		const auto rotation = Matrix4x4::FromAxisAngle(RandomAxis(random), angle(random));
+		const auto translation = Matrix4x4::Translate(Vector3{ offset(random), offset(random), offset(random) });
+
+		if (rigid)
+			return rotation * translation;
+
+		return Matrix4x4::Scaling(Vector3{ scale(random), scale(random), scale(random) }) * rotation * translation;
+	}
+
+	float32 MaxDifference(const Matrix4x4& a, const Matrix4x4& b)
+	{
+		float32 worst = 0.f;
+
+		for (size_t i = 0; i < 16; ++i)
+			worst = std::max(worst, std::abs(a.data[i] - b.data[i]));
+
+		return worst;
+	}
+}
+
+IRIS_TEST(InverseOfGeneralMatrices)
+{
+	std::mt19937 random{ 12345 };
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		const auto m = RandomMatrix(random);
+		const auto det = m.determinant();
+
+		// Near-singular draws lose precision in any float inverse
+		if (std::abs(det) < 1.f)
+			continue;
+
+		const auto inverse = m.inverse();
+
+		if (!IRIS_CHECK(IdentityError(m * inverse) < 1e-3f) || !IRIS_CHECK(IdentityError(inverse * m) < 1e-3f))
+			return;
+
+		// The adjugate is the inverse scaled by the determinant
+		const auto adjoint = m.adjoint();
+
+		for (size_t row = 0; row < 4; ++row)
+		{
+			for (size_t column = 0; column < 4; ++column)
+			{
+				if (!IRIS_CHECK_NEAR(adjoint.m[row][column], inverse.m[row][column] * det, 1e-3 * std::abs(det)))
+					return;
+			}
+		}
+	}
+}
+
+IRIS_TEST(InverseOfSingularMatrix)
+{
+	// Row 2 is twice row 0; small integers keep every sub-determinant exact
+	const Matrix4x4 singular{
+		1.f, 2.f, 3.f, 4.f,
+		0.f, 1.f, 5.f, 2.f,
+		2.f, 4.f, 6.f, 8.f,
+		3.f, 0.f, 1.f, 1.f };
+
+	IRIS_CHECK(singular.determinant() == 0.f);
+	IRIS_CHECK(IdentityError(singular.inverse()) == 0.f);
+	IRIS_CHECK_THROWS(singular.inverseChecked(), Error::ZeroDivisionException);
+}
+
+IRIS_TEST(MultiplyMatchesScalar)
+{
+	std::mt19937 random{ 777 };
+	float32 worst = 0.f;
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		const auto left = RandomMatrix(random);
+		const auto right = RandomMatrix(random);
+
+		worst = std::max(worst, ProductError(left * right, left, right));
+
+		auto compound = left;
+		compound *= right;
+		worst = std::max(worst, ProductError(compound, left, right));
+
+		// Both operands are the destination
+		auto squared = left;
+		squared *= squared;
+		worst = std::max(worst, ProductError(squared, left, left));
+	}
+
+	std::printf("    max relative error %g\n", worst);
+	IRIS_CHECK(worst < 1e-6f);
+
+	// Small integers make every product exact whatever the summation order or FMA use
+	const Matrix4x4 a{
+		1.f, 2.f, 3.f, 4.f,
+		5.f, 6.f, 7.f, 8.f,
+		9.f, 10.f, 11.f, 12.f,
+		13.f, 14.f, 15.f, 16.f };
+
+	const auto exact = a * Matrix4x4::Identity();
+	const auto product = a * a;
+
+	bool same = true;
+
+	for (size_t row = 0; row < 4; ++row)
+	{
+		for (size_t column = 0; column < 4; ++column)
+		{
+			float32 expected = 0.f;
+
+			for (size_t k = 0; k < 4; ++k)
+				expected += a.m[row][k] * a.m[k][column];
+
+			same &= (product.m[row][column] == expected) && (exact.m[row][column] == a.m[row][column]);
+		}
+	}
+
+	IRIS_CHECK(same);
+}
+
+IRIS_TEST(ScaleMatchesScalar)
+{
+	std::mt19937 random{ 12345 };
+	std::uniform_real_distribution<float32> factor{ -8.f, 8.f };
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		const auto m = RandomMatrix(random);
+		const auto s = (i == 0) ? 0.f : (i == 1) ? -1.f : factor(random);
+
+		const auto scaled = m * s;
+
+		auto compound = m;
+		compound *= s;
+
+		// One multiply per element, so every kernel must agree bit for bit
+		bool same = true;
+
+		for (size_t e = 0; e < 16; ++e)
+			same &= (scaled.data[e] == m.data[e] * s) && (compound.data[e] == m.data[e] * s);
+
+		if (!IRIS_CHECK(same))
+			return;
+	}
+}
+
+IRIS_TEST(InverseAffineAndRigid)
+{
+	std::mt19937 random{ 12345 };
+	float32 worstAffine = 0.f, worstRigid = 0.f;
+	bool affine = true;
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		const auto m = RandomAffine(random, false);
+		const auto inverse = m.inverseAffine();
+
+		affine &= m.isAffine() && inverse.isAffine();
+		worstAffine = std::max({ worstAffine, IdentityError(m * inverse), IdentityError(inverse * m), MaxDifference(inverse, m.inverse()) });
+
+		const auto r = RandomAffine(random, true);
+		const auto rigid = r.inverseRigid();
+
+		affine &= r.isAffine() && rigid.isAffine();
+		worstRigid = std::max({ worstRigid, IdentityError(r * rigid), IdentityError(rigid * r), MaxDifference(rigid, r.inverseAffine()) });
+	}
+
+	std::printf("    max affine error %g, max rigid error %g\n", worstAffine, worstRigid);
+	IRIS_CHECK(affine);
+	IRIS_CHECK(worstAffine < 1e-3f);
+	IRIS_CHECK(worstRigid < 1e-4f);
+
+	// A pure translation inverts exactly
+	const auto translate = Matrix4x4::Translate(Vector3{ 1.5f, -2.f, 8.f });
+	IRIS_CHECK(MaxDifference(translate.inverseAffine(), Matrix4x4::Translate(Vector3{ -1.5f, 2.f, -8.f })) == 0.f);
+	IRIS_CHECK(MaxDifference(translate.inverseRigid(), Matrix4x4::Translate(Vector3{ -1.5f, 2.f, -8.f })) == 0.f);
+
+	// A singular upper 3x3 falls back to the identity
+	const auto flat = Matrix4x4::Scaling(Vector3{ 1.f, 0.f, 1.f }) * translate;
+	IRIS_CHECK(IdentityError(flat.inverseAffine()) == 0.f);
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "../Test.hpp"
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstdio>
+#include <algorithm>
+
+#include <Iris/Math/Packing.hpp>
+
+using namespace Iris;
+
+// Smallest-three error bounds against Quaternion::normalize, and the bulk Pack/Unpack overloads against the scalar
+// constructors they are documented to match bit for bit
+
+namespace
+{
+	constexpr double Bound32 = 2e-3;
+	constexpr double Bound48 = 6e-5;
+
+	// Random rotations plus the awkward cases: axis-aligned, ties for the largest component, unnormalized and negated
+	std::vector<Quaternion> MakeQuaternions(size_t count)
+	{
+		std::mt19937 random{ 12345 };
+		std::normal_distribution<float32> normal;
+		std::uniform_real_distribution<float32> scale{ 0.01f, 100.f };
+
+		std::vector<Quaternion> quaternions =
+		{
+			Quaternion::Identity(), Quaternion{ 0.f, 1.f, 0.f, 0.f }, Quaternion{ 0.f, 0.f, -1.f, 0.f }, Quaternion{ 0.f, 0.f, 0.f, 1.f },
+			Quaternion{ 0.5f, 0.5f, 0.5f, 0.5f }, Quaternion{ -0.5f, 0.5f, -0.5f, 0.5f }, Quaternion{ 0.70710678f, 0.70710678f, 0.f, 0.f },
+			Quaternion{ 0.f, -0.70710678f, 0.f, 0.70710678f },
+		};
+
+		while (quaternions.size() < count)
+		{
+			const Quaternion q{ normal(random), normal(random), normal(random), normal(random) };
+			quaternions.push_back(q * scale(random));
+		}
+
+		return quaternions;
+	}
+
+	// Packing may return -q, which is the same rotation
+	double ComponentError(const Quaternion& expected, const Quaternion& actual)
+	{
+		const auto sign = (expected.dot(actual) < 0.f) ? -1.f : 1.f;
+		const auto a = actual * sign;
+
+		return std::max({ std::abs(a.w - expected.w), std::abs(a.x - expected.x), std::abs(a.y - expected.y), std::abs(a.z - expected.z) });
+	}
+
+	template<class Packed>
+	double MaxError(const std::vector<Quaternion>& quaternions)
+	{
+		double worst = 0;
+
+		for (const auto& q : quaternions)
+			worst = std::max(worst, ComponentError(q.normalize(), Packed{ q }.toQuaternion()));
+
+		return worst;
+	}
+
+	bool SameBits(const Quaternion& a, const Quaternion& b)
+	{
+		return std::equal(a.data, a.data + 4, b.data, b.data + 4, [](float32 x, float32 y) { return std::bit_cast<uint32>(x) == std::bit_cast<uint32>(y); });
+	}
+
+	std::vector<float32> MakeFloats(size_t count)
+	{
+		std::mt19937 random{ 777 };
+		std::uniform_real_distribution<float32> wide{ -70000.f, 70000.f };
+		std::uniform_real_distribution<float32> unit{ -1.5f, 1.5f };
+
+		std::vector<float32> values =
+		{
+			0.f, -0.f, 1.f, -1.f, 0.5f, 65504.f, 65520.f, 1e-8f, -6e-5f, 5.96e-8f,
+			std::numeric_limits<float32>::infinity(), -std::numeric_limits<float32>::infinity(), std::numeric_limits<float32>::quiet_NaN(),
+			std::numeric_limits<float32>::denorm_min(),
+		};
+
+		while (values.size() < count)
+			values.push_back((values.size() % 2 == 0) ? wide(random) : unit(random));
+
+		return values;
+	}
+}
+
+IRIS_TEST(PackedQuaternion32ErrorBound)
+{
+	const auto quaternions = MakeQuaternions(200003);
+	const auto error = MaxError<PackedQuaternion32>(quaternions);
+
+	std::printf("    PackedQuaternion32 max component error %.3e (bound %.0e)\n", error, Bound32);
+	IRIS_CHECK(error < Bound32);
+}
+
+IRIS_TEST(PackedQuaternion48ErrorBound)
+{
+	const auto quaternions = MakeQuaternions(200003);
+	const auto error = MaxError<PackedQuaternion48>(quaternions);
+
+	std::printf("    PackedQuaternion48 max component error %.3e (bound %.0e)\n", error, Bound48);
+	IRIS_CHECK(error < Bound48);
+}
+
+IRIS_TEST(PackedQuaternionUnpacksToUnitLength)
+{
+	for (const auto& q : MakeQuaternions(10000))
+	{
+		const auto a = PackedQuaternion32{ q }.toQuaternion();
+		const auto b = PackedQuaternion48{ q }.toQuaternion();
+
+		if (!IRIS_CHECK_NEAR(a.dot(a), 1.f, 1e-5) || !IRIS_CHECK_NEAR(b.dot(b), 1.f, 1e-5))
+			return;
+	}
+}
+
+IRIS_TEST(PackedQuaternionInConstantExpressions)
+{
+	constexpr auto packed = PackedQuaternion48{ Quaternion{ 0.5f, 0.5f, 0.5f, 0.5f } };
+	constexpr auto unpacked = packed.toQuaternion();
+
+	IRIS_CHECK(ComponentError(Quaternion{ 0.5f, 0.5f, 0.5f, 0.5f }, unpacked) < Bound48);
+}
+
+IRIS_TEST(BatchQuaternionsMatchScalar)
+{
+	const auto quaternions = MakeQuaternions(1003);
+
+	std::vector<PackedQuaternion32> packed32(quaternions.size());
+	std::vector<PackedQuaternion48> packed48(quaternions.size());
+	std::vector<Quaternion> unpacked32(quaternions.size()), unpacked48(quaternions.size());
+
+	Pack(quaternions, packed32);
+	Pack(quaternions, packed48);
+	Unpack(packed32, unpacked32);
+	Unpack(packed48, unpacked48);
+
+	for (size_t i = 0; i < quaternions.size(); ++i)
+	{
+		const PackedQuaternion32 scalar32{ quaternions[i] };
+		const PackedQuaternion48 scalar48{ quaternions[i] };
+
+		if (!IRIS_CHECK(packed32[i].bits == scalar32.bits) ||
+			!IRIS_CHECK(std::equal(packed48[i].bits, packed48[i].bits + 3, scalar48.bits)) ||
+			!IRIS_CHECK(SameBits(unpacked32[i], scalar32.toQuaternion())) ||
+			!IRIS_CHECK(SameBits(unpacked48[i], scalar48.toQuaternion())))
+			return;
+	}
+
+	std::vector<PackedQuaternion32> tooShort(quaternions.size() - 1);
+	IRIS_CHECK_THROWS(Pack(quaternions, tooShort), Error::OutOfRange);
+}
+
+IRIS_TEST(BatchFloatsMatchScalar)
+{
+	const auto values = MakeFloats(1003);
+	const auto count = values.size();
+
+	std::vector<float16> halves(count);
+	std::vector<unorm8> unorms(count);
+	std::vector<snorm16> snorms(count);
+	std::vector<unorm1010102> normals(count / 4);
+
+	Pack(values, halves);
+	Pack(values, unorms);
+	Pack(values, snorms);
+	Pack(std::span<const float32>{ values.data(), normals.size() * 4 }, normals);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!IRIS_CHECK(halves[i].bits == float16{ values[i] }.bits) ||
+			!IRIS_CHECK(unorms[i].bits == unorm8{ values[i] }.bits) ||
+			!IRIS_CHECK(snorms[i].bits == snorm16{ values[i] }.bits))
+			return;
+	}
+
+	for (size_t i = 0; i < normals.size(); ++i)
+	{
+		const unorm1010102 scalar{ values[i * 4], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3] };
+
+		if (!IRIS_CHECK(normals[i].bits == scalar.bits))
+			return;
+	}
+
+	std::vector<float32> decoded(count);
+
+	Unpack(halves, decoded);
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!IRIS_CHECK(std::bit_cast<uint32>(decoded[i]) == std::bit_cast<uint32>(static_cast<float32>(halves[i]))))
+			return;
+	}
+
+	Unpack(snorms, decoded);
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!IRIS_CHECK(decoded[i] == static_cast<float32>(snorms[i])))
+			return;
+	}
+
+	std::vector<float16> tooShort(count - 1);
+	IRIS_CHECK_THROWS(Pack(values, tooShort), Error::OutOfRange);
+}
\ No newline at end of file
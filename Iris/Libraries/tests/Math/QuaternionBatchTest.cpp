@@ -0,0 +1,142 @@
+#include "../Test.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <cstdio>
+#include <algorithm>
+
+#include <Iris/Math/Quaternion.hpp>
+
+using namespace Iris;
+
+// SlerpBatch and NlerpBatch against the scalar Slerp and Nlerp. Lengths that are not a multiple of the SIMD width
+// exercise the scalar tail, and the pairs include near-equal and near-opposite rotations.
+
+namespace
+{
+	constexpr double SlerpBound = 3e-5;
+	constexpr double NlerpBound = 1e-6;
+
+	struct Pairs
+	{
+		std::vector<Quaternion> from, to;
+		std::vector<float32> t;
+	};
+
+	Quaternion RandomUnit(std::mt19937& random)
+	{
+		std::normal_distribution<float32> normal;
+		return Quaternion{ normal(random), normal(random), normal(random), normal(random) }.normalize();
+	}
+
+	Pairs MakePairs(size_t count)
+	{
+		std::mt19937 random{ 12345 };
+		std::uniform_real_distribution<float32> unit{ 0.f, 1.f };
+		std::normal_distribution<float32> jitter{ 0.f, 1e-3f };
+
+		Pairs pairs;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const auto from = RandomUnit(random);
+			auto to = RandomUnit(random);
+
+			// Every fourth pair is nearly the same rotation, half of them with the sign flipped
+			if (i % 4 == 3)
+			{
+				to = Quaternion{ from.w + jitter(random), from.x + jitter(random), from.y + jitter(random), from.z + jitter(random) }.normalize();
+
+				if (i % 8 == 7)
+					to = -to;
+			}
+
+			pairs.from.push_back(from);
+			pairs.to.push_back(to);
+			pairs.t.push_back(unit(random));
+		}
+
+		return pairs;
+	}
+
+	double MaxDifference(const Quaternion& a, const Quaternion& b)
+	{
+		return std::max({ std::abs(a.w - b.w), std::abs(a.x - b.x), std::abs(a.y - b.y), std::abs(a.z - b.z) });
+	}
+}
+
+IRIS_TEST(SlerpBatchMatchesSlerp)
+{
+	for (const size_t count : { size_t{ 1 }, size_t{ 7 }, size_t{ 100003 } })
+	{
+		const auto pairs = MakePairs(count);
+		std::vector<Quaternion> output(count), uniform(count);
+
+		Quaternion::SlerpBatch(pairs.from, pairs.to, pairs.t, output);
+		Quaternion::SlerpBatch(pairs.from, pairs.to, 0.3f, uniform);
+
+		double worst = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			worst = std::max(worst, MaxDifference(output[i], Quaternion::Slerp(pairs.from[i], pairs.to[i], pairs.t[i])));
+			worst = std::max(worst, MaxDifference(uniform[i], Quaternion::Slerp(pairs.from[i], pairs.to[i], 0.3f)));
+		}
+
+		std::printf("    SlerpBatch   count %-7zu max component error %.3e (bound %.0e)\n", count, worst, SlerpBound);
+		IRIS_CHECK(worst <= SlerpBound);
+	}
+}
+
+IRIS_TEST(NlerpBatchMatchesNlerp)
+{
+	for (const size_t count : { size_t{ 1 }, size_t{ 7 }, size_t{ 100003 } })
+	{
+		const auto pairs = MakePairs(count);
+		std::vector<Quaternion> output(count), uniform(count);
+
+		Quaternion::NlerpBatch(pairs.from, pairs.to, pairs.t, output);
+		Quaternion::NlerpBatch(pairs.from, pairs.to, 0.3f, uniform);
+
+		double worst = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			worst = std::max(worst, MaxDifference(output[i], Quaternion::Nlerp(pairs.from[i], pairs.to[i], pairs.t[i])));
+			worst = std::max(worst, MaxDifference(uniform[i], Quaternion::Nlerp(pairs.from[i], pairs.to[i], 0.3f)));
+		}
+
+		std::printf("    NlerpBatch   count %-7zu max component error %.3e (bound %.0e)\n", count, worst, NlerpBound);
+		IRIS_CHECK(worst <= NlerpBound);
+	}
+}
+
+IRIS_TEST(BatchEndpoints)
+{
+	const auto pairs = MakePairs(64);
+	std::vector<Quaternion> output(64);
+
+	Quaternion::SlerpBatch(pairs.from, pairs.to, 0.f, output);
+
+	for (size_t i = 0; i < 64; ++i)
+		IRIS_CHECK(MaxDifference(output[i], pairs.from[i]) <= SlerpBound);
+
+	// t = 1 lands on 'to' or on -to, whichever is nearer to 'from'
+	Quaternion::SlerpBatch(pairs.from, pairs.to, 1.f, output);
+
+	for (size_t i = 0; i < 64; ++i)
+		IRIS_CHECK(std::min(MaxDifference(output[i], pairs.to[i]), MaxDifference(output[i], -pairs.to[i])) <= SlerpBound);
+}
+
+IRIS_TEST(BatchSizeMismatch)
+{
+	const auto pairs = MakePairs(8);
+	std::vector<Quaternion> shortOutput(7);
+	const std::vector<float32> shortT(7, 0.5f);
+
+	IRIS_CHECK_THROWS(Quaternion::SlerpBatch(pairs.from, pairs.to, 0.5f, shortOutput), Error::OutOfRange);
+	IRIS_CHECK_THROWS(Quaternion::NlerpBatch(pairs.from, pairs.to, 0.5f, shortOutput), Error::OutOfRange);
+	IRIS_CHECK_THROWS(Quaternion::SlerpBatch(pairs.from, pairs.to, shortT, std::span<Quaternion>{ shortOutput }), Error::OutOfRange);
+	IRIS_CHECK_THROWS(Quaternion::NlerpBatch(std::span<const Quaternion>{ pairs.from }, std::span<const Quaternion>{ pairs.to.data(), 7 }, 0.5f, shortOutput), Error::OutOfRange);
+}
\ No newline at end of file
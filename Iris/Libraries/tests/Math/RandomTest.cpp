@@ -0,0 +1,374 @@
+#include "../Test.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <Iris/Math/Random.hpp>
+
+using namespace Iris;
+
+// PCG32::advance against stepping, Xoshiro256 jumps against the step function raised to 2^128 and 2^192 over GF(2),
+// the lane fills against a scalar model of the eight lanes, and the shape fills against their geometric bounds
+
+namespace
+{
+	static_assert(std::uniform_random_bit_generator<Xoshiro256>);
+	static_assert(std::uniform_random_bit_generator<PCG32>);
+
+	using State = std::array<uint64, 4>;
+
+	State Seeded(uint64 seed)
+	{
+		State state;
+
+		for (auto& word : state)
+			word = Detail::SplitMix64(seed);
+
+		return state;
+	}
+
+	// xoshiro256++ as published
+	uint64 Next(State& s)
+	{
+		const auto result = std::rotl(s[0] + s[3], 23) + s[0];
+		const auto t = s[1] << 17;
+
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = std::rotl(s[3], 45);
+
+		return result;
+	}
+
+	// The state update is linear over GF(2), so it is a 256x256 bit matrix; column j is the image of bit j
+	struct StepMatrix
+	{
+		State columns[256];
+
+		State apply(const State& v) const
+		{
+			State result{};
+
+			for (size_t j = 0; j < 256; ++j)
+			{
+				if ((v[j / 64] >> (j % 64)) & 1)
+				{
+					for (size_t w = 0; w < 4; ++w)
+						result[w] ^= columns[j][w];
+				}
+			}
+
+			return result;
+		}
+
+		void square()
+		{
+			StepMatrix squared;
+
+			for (size_t j = 0; j < 256; ++j)
+				squared.columns[j] = apply(columns[j]);
+
+			*this = squared;
+		}
+
+		static StepMatrix Step()
+		{
+			StepMatrix matrix;
+
+			for (size_t j = 0; j < 256; ++j)
+			{
+				State unit{};
+				unit[j / 64] = uint64{ 1 } << (j % 64);
+				Next(unit);
+				matrix.columns[j] = unit;
+			}
+
+			return matrix;
+		}
+	};
+
+	// Eight lanes seeded from one output of the generator, interleaved low word first
+	std::vector<uint32> LaneReference(uint64 seed, size_t count)
+	{
+		State lanes[8];
+
+		for (size_t w = 0; w < 4; ++w)
+		{
+			for (auto& lane : lanes)
+				lane[w] = Detail::SplitMix64(seed);
+		}
+
+		std::vector<uint32> out;
+
+		while (out.size() < count)
+		{
+			for (auto& lane : lanes)
+			{
+				const auto result = Next(lane);
+				out.push_back(static_cast<uint32>(result));
+				out.push_back(static_cast<uint32>(result >> 32));
+			}
+		}
+
+		out.resize(count);
+		return out;
+	}
+
+	constexpr size_t Sizes[] = { 0, 1, 2, 15, 63, 64, 65, 100, 1023, 1024, 1025, 5000 };
+}
+
+IRIS_TEST(PCG32MatchesReference)
+{
+	// First outputs of the PCG reference implementation for seed 42, stream 54
+	PCG32 generator{ 42, 54 };
+	const uint32 expected[] = { 0xA15C02B7u, 0x7B47F409u, 0xBA1D3330u, 0x83D2F293u, 0xBFA4784Bu, 0xCBED606Eu };
+
+	for (const auto value : expected)
+		IRIS_CHECK(generator() == value);
+}
+
+IRIS_TEST(PCG32AdvanceMatchesStepping)
+{
+	for (const uint64 delta : { 0ull, 1ull, 2ull, 3ull, 63ull, 64ull, 1000ull, 12345ull, 1ull << 20 })
+	{
+		PCG32 stepped{ 12345, 777 };
+		PCG32 advanced = stepped;
+
+		for (uint64 i = 0; i < delta; ++i)
+			stepped();
+
+		advanced.advance(delta);
+
+		bool same = true;
+
+		for (int i = 0; i < 8; ++i)
+			same &= (stepped() == advanced());
+
+		IRIS_CHECK(same);
+
+		// A two's complement delta steps back to where the generator started
+		advanced.advance(0 - (delta + 8));
+		PCG32 start{ 12345, 777 };
+		IRIS_CHECK(advanced() == start());
+	}
+}
+
+IRIS_TEST(Xoshiro256MatchesReference)
+{
+	Xoshiro256 generator{ 777 };
+	auto state = Seeded(777);
+
+	bool same = true;
+
+	for (int i = 0; i < 1000; ++i)
+		same &= (generator() == Next(state));
+
+	IRIS_CHECK(same);
+}
+
+IRIS_TEST(Xoshiro256JumpsMatchStepPowers)
+{
+	// The step matrix raised to 2^128 and then on to 2^192 by repeated squaring
+	auto matrix = StepMatrix::Step();
+
+	for (int i = 0; i < 128; ++i)
+		matrix.square();
+
+	const auto jump128 = matrix;
+
+	for (int i = 0; i < 64; ++i)
+		matrix.square();
+
+	const auto jump192 = matrix;
+
+	for (const uint64 seed : { uint64{ 0 }, uint64{ 1 }, uint64{ 12345 }, Xoshiro256::DefaultSeed })
+	{
+		Xoshiro256 jumped{ seed };
+		jumped.jump();
+		auto expected = jump128.apply(Seeded(seed));
+
+		bool same = true;
+
+		for (int i = 0; i < 16; ++i)
+			same &= (jumped() == Next(expected));
+
+		IRIS_CHECK(same);
+
+		Xoshiro256 longJumped{ seed };
+		longJumped.longJump();
+		expected = jump192.apply(Seeded(seed));
+
+		same = true;
+
+		for (int i = 0; i < 16; ++i)
+			same &= (longJumped() == Next(expected));
+
+		IRIS_CHECK(same);
+	}
+}
+
+IRIS_TEST(FillMatchesLanes)
+{
+	for (const auto size : Sizes)
+	{
+		Xoshiro256 generator{ 12345 };
+		Xoshiro256 reference = generator;
+
+		std::vector<uint32> values(size);
+		generator.fill(values);
+
+		std::vector<uint32> expected;
+
+		if (size < 64)
+		{
+			// Short fills take the generator's own outputs, low word first
+			for (size_t i = 0; i < size; i += 2)
+			{
+				const auto bits = reference();
+				expected.push_back(static_cast<uint32>(bits));
+				expected.push_back(static_cast<uint32>(bits >> 32));
+			}
+
+			expected.resize(size);
+		}
+		else
+		{
+			expected = LaneReference(reference(), size);
+		}
+
+		IRIS_CHECK(values == expected);
+
+		// The fill leaves the generator exactly where the reference is
+		IRIS_CHECK(generator() == reference());
+	}
+}
+
+IRIS_TEST(FillFloatRange)
+{
+	for (const auto size : Sizes)
+	{
+		Xoshiro256 generator{ 777 };
+		Xoshiro256 reference = generator;
+
+		std::vector<float32> values(size);
+		generator.fill(values, -3.f, 5.f);
+
+		const auto expected = (size < 64) ? std::vector<uint32>{} : LaneReference(reference(), size);
+
+		float32 worst = 0.f;
+		bool inRange = true;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			inRange &= (values[i] >= -3.f) && (values[i] < 5.f);
+
+			const auto u = (size < 64) ? reference.nextFloat() : Detail::UnitFloat(expected[i]);
+			worst = std::max(worst, std::abs(values[i] - (-3.f + 8.f * u)));
+		}
+
+		IRIS_CHECK(inRange);
+		IRIS_CHECK(worst < 1e-6f);
+	}
+
+	// The default range is [0, 1)
+	Xoshiro256 generator{ 12345 };
+	std::vector<float32> unit(4096);
+	generator.fill(unit);
+	IRIS_CHECK(std::all_of(unit.begin(), unit.end(), [](float32 v) { return v >= 0.f && v < 1.f; }));
+}
+
+IRIS_TEST(ShapesStayOnAndInside)
+{
+	for (const auto size : Sizes)
+	{
+		Xoshiro256 generator{ 12345 + size };
+		float32 onError = 0.f, insideExcess = 0.f;
+
+		std::vector<Vector2> circle(size);
+		generator.fillOnCircle(circle);
+		for (const auto& v : circle)
+			onError = std::max(onError, std::abs(v.length() - 1.f));
+
+		generator.fillInsideCircle(circle);
+		for (const auto& v : circle)
+			insideExcess = std::max(insideExcess, v.length() - 1.f);
+
+		std::vector<Vector3> sphere(size);
+		generator.fillOnSphere(sphere);
+		for (const auto& v : sphere)
+			onError = std::max(onError, std::abs(v.length() - 1.f));
+
+		generator.fillInsideSphere(sphere);
+		for (const auto& v : sphere)
+			insideExcess = std::max(insideExcess, v.length() - 1.f);
+
+		std::vector<Quaternion> rotations(size);
+		generator.fillRotations(rotations);
+		for (const auto& q : rotations)
+			onError = std::max(onError, std::abs(q.length() - 1.f));
+
+		if (!IRIS_CHECK(onError < 1e-5f) || !IRIS_CHECK(insideExcess < 1e-5f))
+		{
+			std::printf("    size %zu: unit length error %g, excess outside %g\n", size, onError, insideExcess);
+			return;
+		}
+	}
+}
+
+IRIS_TEST(ShapesAreUniform)
+{
+	Xoshiro256 generator{ 777 };
+	constexpr size_t Count = 100000;
+
+	// Archimedes: z of a uniform point on the sphere is uniform, so its mean is 0 and a third lies in |z| > 2/3
+	std::vector<Vector3> sphere(Count);
+	generator.fillOnSphere(sphere);
+
+	double meanZ = 0.0;
+	size_t caps = 0;
+
+	for (const auto& v : sphere)
+	{
+		meanZ += v.z;
+		caps += (std::abs(v.z) > 2.f / 3.f);
+	}
+
+	meanZ /= Count;
+	std::printf("    sphere mean z %g, polar cap fraction %g\n", meanZ, static_cast<double>(caps) / Count);
+
+	IRIS_CHECK(std::abs(meanZ) < 0.01);
+	IRIS_CHECK(std::abs(static_cast<double>(caps) / Count - 1.0 / 3.0) < 0.01);
+
+	// A uniform point in the unit disc lies within radius 1/2 a quarter of the time
+	std::vector<Vector2> disc(Count);
+	generator.fillInsideCircle(disc);
+
+	const auto inner = std::count_if(disc.begin(), disc.end(), [](const Vector2& v) { return v.length() < 0.5f; });
+	IRIS_CHECK(std::abs(static_cast<double>(inner) / Count - 0.25) < 0.01);
+}
+
+IRIS_TEST(BoundedStaysInRange)
+{
+	Xoshiro256 xoshiro{ 12345 };
+	PCG32 pcg{ 12345 };
+
+	IRIS_CHECK(xoshiro.bounded(0) == 0);
+	IRIS_CHECK(pcg.bounded(0) == 0);
+
+	for (const uint32 bound : { 1u, 2u, 3u, 7u, 100u, 0x80000001u, 0xFFFFFFFFu })
+	{
+		bool inRange = true;
+
+		for (int i = 0; i < 10000; ++i)
+			inRange &= (xoshiro.bounded(bound) < bound) && (pcg.bounded(bound) < bound);
+
+		IRIS_CHECK(inRange);
+	}
+}
\ No newline at end of file
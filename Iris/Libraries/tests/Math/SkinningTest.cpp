@@ -0,0 +1,404 @@
+#include "../Test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <Iris/Math/Skinning.hpp>
+#include <Iris/Math/Transform.hpp>
+
+using namespace Iris;
+
+// SkinLinear and SkinDualQuaternion are checked against Matrix4x4/Transform for single-bone vertices and against
+// a scalar blend for four influences, across SIMD tails and thread counts, plus the span and bone index validation
+
+namespace
+{
+	constexpr size_t PaletteSize = 16;
+
+	struct Mesh
+	{
+		std::vector<float32> px, py, pz, nx, ny, nz;
+
+		std::vector<std::array<uint16, 4>> bones;
+
+		std::vector<std::array<float32, 4>> weights;
+
+		std::vector<float32> ox, oy, oz, onx, ony, onz;
+
+		Mesh(std::mt19937& random, size_t count, bool singleBone)
+			: px(count), py(count), pz(count), nx(count), ny(count), nz(count)
+			, bones(count), weights(count)
+			, ox(count), oy(count), oz(count), onx(count), ony(count), onz(count)
+		{
+			std::uniform_real_distribution<float32> position{ -10.f, 10.f };
+			std::normal_distribution<float32> direction;
+			std::uniform_int_distribution<uint32> bone{ 0, PaletteSize - 1 };
+			std::uniform_real_distribution<float32> weight{ 0.05f, 1.f };
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				px[i] = position(random);
+				py[i] = position(random);
+				pz[i] = position(random);
+
+				const auto normal = Vector3{ direction(random), direction(random), direction(random) }.normalize();
+				nx[i] = normal.x;
+				ny[i] = normal.y;
+				nz[i] = normal.z;
+
+				for (auto& b : bones[i])
+					b = static_cast<uint16>(bone(random));
+
+				if (singleBone)
+				{
+					weights[i] = { 1.f, 0.f, 0.f, 0.f };
+				}
+				else
+				{
+					std::array<float32, 4> w{ weight(random), weight(random), weight(random), weight(random) };
+					const auto sum = w[0] + w[1] + w[2] + w[3];
+					weights[i] = { w[0] / sum, w[1] / sum, w[2] / sum, w[3] / sum };
+				}
+			}
+		}
+
+		SkinningInput input(bool normals = true) const
+		{
+			SkinningInput result;
+			result.positionX = px;
+			result.positionY = py;
+			result.positionZ = pz;
+			result.bones = bones;
+			result.weights = weights;
+
+			if (normals)
+			{
+				result.normalX = nx;
+				result.normalY = ny;
+				result.normalZ = nz;
+			}
+
+			return result;
+		}
+
+		SkinningOutput output(bool normals = true)
+		{
+			SkinningOutput result;
+			result.positionX = ox;
+			result.positionY = oy;
+			result.positionZ = oz;
+
+			if (normals)
+			{
+				result.normalX = onx;
+				result.normalY = ony;
+				result.normalZ = onz;
+			}
+
+			return result;
+		}
+
+		Vector3 position(size_t i) const
+		{
+			return{ px[i], py[i], pz[i] };
+		}
+
+		Vector3 normal(size_t i) const
+		{
+			return{ nx[i], ny[i], nz[i] };
+		}
+
+		Vector3 skinnedPosition(size_t i) const
+		{
+			return{ ox[i], oy[i], oz[i] };
+		}
+
+		Vector3 skinnedNormal(size_t i) const
+		{
+			return{ onx[i], ony[i], onz[i] };
+		}
+	};
+
+	std::vector<Transform> RandomTransforms(std::mt19937& random, bool rigid)
+	{
+		std::uniform_real_distribution<float32> offset{ -5.f, 5.f };
+		std::uniform_real_distribution<float32> angle{ -3.f, 3.f };
+		std::uniform_real_distribution<float32> scale{ 0.5f, 2.f };
+		std::normal_distribution<float32> direction;
+
+		std::vector<Transform> transforms;
+
+		for (size_t i = 0; i < PaletteSize; ++i)
+		{
+			const auto axis = Vector3{ direction(random), direction(random), direction(random) }.normalize();
+			const auto s = rigid ? 1.f : scale(random);
+
+			transforms.emplace_back(Vector3{ offset(random), offset(random), offset(random) }, Quaternion::FromAxisAngle(axis, angle(random)), Vector3{ s, s, s });
+		}
+
+		return transforms;
+	}
+
+	std::vector<Matrix4x4> ToMatrices(const std::vector<Transform>& transforms)
+	{
+		std::vector<Matrix4x4> palette;
+
+		for (const auto& transform : transforms)
+			palette.push_back(transform.toMatrix4x4());
+
+		return palette;
+	}
+
+	// Rigid transforms only; every other entry is negated so the blend has to flip it onto the pivot's hemisphere
+	std::vector<DualQuaternion> ToDualQuaternions(const std::vector<Transform>& transforms)
+	{
+		std::vector<DualQuaternion> palette;
+
+		for (size_t i = 0; i < transforms.size(); ++i)
+		{
+			const auto bone = DualQuaternion::FromTransform(transforms[i]);
+			palette.push_back((i % 2) ? bone * -1.f : bone);
+		}
+
+		return palette;
+	}
+
+	// Reference linear blend: the weighted bone matrices applied to the point, normals through the upper 3x3
+	void LinearReference(const std::vector<Matrix4x4>& palette, const Mesh& mesh, size_t i, Vector3& position, Vector3& normal)
+	{
+		float32 m[4][3] = {};
+
+		for (size_t k = 0; k < 4; ++k)
+		{
+			const auto& bone = palette[mesh.bones[i][k]];
+
+			for (size_t r = 0; r < 4; ++r)
+			{
+				for (size_t c = 0; c < 3; ++c)
+					m[r][c] += mesh.weights[i][k] * bone.m[r][c];
+			}
+		}
+
+		const auto p = mesh.position(i);
+		const auto n = mesh.normal(i);
+
+		position = Vector3
+		{
+			p.x * m[0][0] + p.y * m[1][0] + p.z * m[2][0] + m[3][0],
+			p.x * m[0][1] + p.y * m[1][1] + p.z * m[2][1] + m[3][1],
+			p.x * m[0][2] + p.y * m[1][2] + p.z * m[2][2] + m[3][2]
+		};
+
+		normal = Vector3
+		{
+			n.x * m[0][0] + n.y * m[1][0] + n.z * m[2][0],
+			n.x * m[0][1] + n.y * m[1][1] + n.z * m[2][1],
+			n.x * m[0][2] + n.y * m[1][2] + n.z * m[2][2]
+		}.normalize();
+	}
+
+	// Reference dual quaternion blend, antipodal bones flipped against the first influence
+	DualQuaternion DualQuaternionReference(const std::vector<DualQuaternion>& palette, const Mesh& mesh, size_t i)
+	{
+		const auto& pivot = palette[mesh.bones[i][0]];
+		DualQuaternion blended = pivot * mesh.weights[i][0];
+
+		for (size_t k = 1; k < 4; ++k)
+		{
+			const auto& bone = palette[mesh.bones[i][k]];
+			const auto weight = mesh.weights[i][k];
+			blended = blended + bone * ((pivot.dot(bone) < 0.f) ? -weight : weight);
+		}
+
+		return blended.normalize();
+	}
+
+	float32 MaxError(const Vector3& a, const Vector3& b)
+	{
+		return std::max({ std::abs(a.x - b.x), std::abs(a.y - b.y), std::abs(a.z - b.z) });
+	}
+
+	bool SameOutput(const Mesh& a, const Mesh& b)
+	{
+		return (a.ox == b.ox) && (a.oy == b.oy) && (a.oz == b.oz)
+			&& (a.onx == b.onx) && (a.ony == b.ony) && (a.onz == b.onz);
+	}
+}
+
+IRIS_TEST(SingleBoneMatchesMatrixAndTransform)
+{
+	std::mt19937 random{ 12345 };
+
+	const auto scaled = RandomTransforms(random, false);
+	const auto rigid = RandomTransforms(random, true);
+	const auto matrices = ToMatrices(scaled);
+	const auto dualQuaternions = ToDualQuaternions(rigid);
+
+	for (const size_t count : { 1u, 4u, 7u, 64u, 1023u })
+	{
+		Mesh linear{ random, count, true };
+		SkinLinear(matrices, linear.input(), linear.output());
+
+		Mesh dq = linear;
+		SkinDualQuaternion(dualQuaternions, dq.input(), dq.output());
+
+		float32 maxLinear = 0.f, maxDQ = 0.f;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const auto bone = linear.bones[i][0];
+			const auto p = linear.position(i);
+			const auto n = linear.normal(i);
+
+			maxLinear = std::max(maxLinear, MaxError(linear.skinnedPosition(i), p.transform(matrices[bone])));
+			maxLinear = std::max(maxLinear, MaxError(linear.skinnedPosition(i), scaled[bone].transformPoint(p)));
+			maxLinear = std::max(maxLinear, MaxError(linear.skinnedNormal(i), scaled[bone].transformDirection(n).normalize()));
+
+			maxDQ = std::max(maxDQ, MaxError(dq.skinnedPosition(i), rigid[bone].transformPoint(p)));
+			maxDQ = std::max(maxDQ, MaxError(dq.skinnedNormal(i), rigid[bone].transformDirection(n)));
+		}
+
+		std::printf("    count %zu: linear max error %g, dual quaternion max error %g\n", count, maxLinear, maxDQ);
+
+		IRIS_CHECK(maxLinear < 1e-4f);
+		IRIS_CHECK(maxDQ < 1e-4f);
+	}
+}
+
+IRIS_TEST(BlendedMatchesScalar)
+{
+	std::mt19937 random{ 777 };
+
+	const auto matrices = ToMatrices(RandomTransforms(random, false));
+	const auto dualQuaternions = ToDualQuaternions(RandomTransforms(random, true));
+
+	for (const size_t count : { 0u, 1u, 3u, 5u, 7u, 13u, 1023u })
+	{
+		Mesh linear{ random, count, false };
+		SkinLinear(matrices, linear.input(), linear.output());
+
+		Mesh dq = linear;
+		SkinDualQuaternion(dualQuaternions, dq.input(), dq.output());
+
+		float32 maxLinear = 0.f, maxDQ = 0.f;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			Vector3 position, normal;
+			LinearReference(matrices, linear, i, position, normal);
+
+			maxLinear = std::max(maxLinear, MaxError(linear.skinnedPosition(i), position));
+			maxLinear = std::max(maxLinear, MaxError(linear.skinnedNormal(i), normal));
+
+			const auto blended = DualQuaternionReference(dualQuaternions, dq, i);
+
+			maxDQ = std::max(maxDQ, MaxError(dq.skinnedPosition(i), blended.transformPoint(dq.position(i))));
+			maxDQ = std::max(maxDQ, MaxError(dq.skinnedNormal(i), blended.transformDirection(dq.normal(i))));
+		}
+
+		std::printf("    count %zu: linear max error %g, dual quaternion max error %g\n", count, maxLinear, maxDQ);
+
+		IRIS_CHECK(maxLinear < 1e-4f);
+		IRIS_CHECK(maxDQ < 1e-4f);
+	}
+}
+
+IRIS_TEST(ThreadsMatchSingleThread)
+{
+	std::mt19937 random{ 12345 };
+
+	const auto matrices = ToMatrices(RandomTransforms(random, false));
+	const auto dualQuaternions = ToDualQuaternions(RandomTransforms(random, true));
+
+	// Enough vertices for three workers at the per-thread minimum, with a ragged end
+	const Mesh mesh{ random, 3 * 4096 + 3, false };
+
+	Mesh linearSerial = mesh;
+	SkinLinear(matrices, linearSerial.input(), linearSerial.output(), 1);
+
+	Mesh dqSerial = mesh;
+	SkinDualQuaternion(dualQuaternions, dqSerial.input(), dqSerial.output(), 1);
+
+	for (const size_t threadCount : { 2u, 3u, 0u })
+	{
+		Mesh linear = mesh;
+		SkinLinear(matrices, linear.input(), linear.output(), threadCount);
+		IRIS_CHECK(SameOutput(linear, linearSerial));
+
+		Mesh dq = mesh;
+		SkinDualQuaternion(dualQuaternions, dq.input(), dq.output(), threadCount);
+		IRIS_CHECK(SameOutput(dq, dqSerial));
+	}
+}
+
+IRIS_TEST(PositionsOnly)
+{
+	std::mt19937 random{ 777 };
+
+	const auto matrices = ToMatrices(RandomTransforms(random, false));
+	const auto dualQuaternions = ToDualQuaternions(RandomTransforms(random, true));
+
+	Mesh withNormals{ random, 37, false };
+	SkinLinear(matrices, withNormals.input(), withNormals.output());
+
+	Mesh linear = withNormals;
+	std::fill(linear.onx.begin(), linear.onx.end(), -7.f);
+	SkinLinear(matrices, linear.input(false), linear.output(false));
+
+	IRIS_CHECK(linear.ox == withNormals.ox && linear.oy == withNormals.oy && linear.oz == withNormals.oz);
+	IRIS_CHECK(std::all_of(linear.onx.begin(), linear.onx.end(), [](float32 v) { return v == -7.f; }));
+
+	Mesh dq = withNormals;
+	std::fill(dq.onx.begin(), dq.onx.end(), -7.f);
+	SkinDualQuaternion(dualQuaternions, dq.input(false), dq.output(false));
+
+	IRIS_CHECK(std::all_of(dq.onx.begin(), dq.onx.end(), [](float32 v) { return v == -7.f; }));
+}
+
+IRIS_TEST(ThrowsOutOfRange)
+{
+	std::mt19937 random{ 12345 };
+
+	const auto matrices = ToMatrices(RandomTransforms(random, false));
+	const auto dualQuaternions = ToDualQuaternions(RandomTransforms(random, true));
+
+	Mesh mesh{ random, 9, false };
+
+	{
+		auto input = mesh.input();
+		input.positionY = input.positionY.first(8);
+		IRIS_CHECK_THROWS(SkinLinear(matrices, input, mesh.output()), Error::OutOfRange);
+		IRIS_CHECK_THROWS(SkinDualQuaternion(dualQuaternions, input, mesh.output()), Error::OutOfRange);
+	}
+
+	{
+		auto input = mesh.input();
+		input.weights = input.weights.first(8);
+		IRIS_CHECK_THROWS(SkinLinear(matrices, input, mesh.output()), Error::OutOfRange);
+	}
+
+	{
+		auto output = mesh.output();
+		output.positionZ = output.positionZ.first(8);
+		IRIS_CHECK_THROWS(SkinLinear(matrices, mesh.input(), output), Error::OutOfRange);
+		IRIS_CHECK_THROWS(SkinDualQuaternion(dualQuaternions, mesh.input(), output), Error::OutOfRange);
+	}
+
+	{
+		auto output = mesh.output();
+		output.normalX = output.normalX.first(8);
+		IRIS_CHECK_THROWS(SkinLinear(matrices, mesh.input(), output), Error::OutOfRange);
+	}
+
+	// One bone index just past the palette
+	mesh.bones[8][3] = static_cast<uint16>(PaletteSize);
+	IRIS_CHECK_THROWS(SkinLinear(matrices, mesh.input(), mesh.output()), Error::OutOfRange);
+	IRIS_CHECK_THROWS(SkinDualQuaternion(dualQuaternions, mesh.input(), mesh.output()), Error::OutOfRange);
+
+	// No vertices needs no palette
+	Mesh empty{ random, 0, false };
+	SkinLinear({}, empty.input(), empty.output());
+	SkinDualQuaternion({}, empty.input(), empty.output());
+}
\ No newline at end of file
@@ -0,0 +1,313 @@
+#include "../Test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <Iris/Math/Spline.hpp>
+
+using namespace Iris;
+
+// Batch Evaluate is checked against the scalar evaluate for every SIMD tail and with parameters outside the domain,
+// the curve constructors against their end point conditions, and ArcLengthTable against uniform spacing along the curve
+
+namespace
+{
+	template<class Type>
+	Type RandomPoint(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float32> component{ -10.f, 10.f };
+
+		if constexpr (std::is_same_v<Type, float32>)
+			return component(random);
+		else if constexpr (std::is_same_v<Type, Vector2>)
+			return Vector2{ component(random), component(random) };
+		else
+			return Vector3{ component(random), component(random), component(random) };
+	}
+
+	template<class Type>
+	float32 Difference(const Type& a, const Type& b)
+	{
+		if constexpr (std::is_same_v<Type, float32>)
+		{
+			return std::abs(a - b);
+		}
+		else
+		{
+			float32 worst = 0.f;
+
+			for (size_t c = 0; c < sizeof(Type) / sizeof(float32); ++c)
+				worst = std::max(worst, std::abs(a.data[c] - b.data[c]));
+
+			return worst;
+		}
+	}
+
+	template<class Type>
+	bool Same(const Type& a, const Type& b)
+	{
+		return Difference(a, b) == 0.f;
+	}
+
+	template<class Type>
+	CubicCurve<Type> RandomCurve(std::mt19937& random)
+	{
+		return CubicCurve<Type>::Bezier(RandomPoint<Type>(random), RandomPoint<Type>(random), RandomPoint<Type>(random), RandomPoint<Type>(random));
+	}
+
+	constexpr size_t Counts[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 13, 1027 };
+
+	template<class Type>
+	void CheckBatchEvaluate(uint32 seed)
+	{
+		std::mt19937 random{ seed };
+		const auto sentinel = RandomPoint<Type>(random);
+
+		for (const auto count : Counts)
+		{
+			// Single curves are not clamped, so the parameters run a little past [0, 1] on both sides
+			std::uniform_real_distribution<float32> unit{ -0.25f, 1.25f };
+			std::vector<float32> parameters(count);
+			for (auto& t : parameters)
+				t = unit(random);
+
+			const auto curve = RandomCurve<Type>(random);
+			std::vector<Type> results(count + 1, sentinel);
+			Evaluate(curve, parameters, results);
+
+			float32 worst = 0.f;
+			for (size_t i = 0; i < count; ++i)
+				worst = std::max(worst, Difference(results[i], curve.evaluate(parameters[i])));
+
+			IRIS_CHECK(worst < 1e-4f);
+			IRIS_CHECK(Same(results.back(), sentinel));
+
+			// A different curve per element
+			std::vector<CubicCurve<Type>> curves;
+			for (size_t i = 0; i < count; ++i)
+				curves.push_back(RandomCurve<Type>(random));
+
+			std::vector<Type> each(count + 1, sentinel);
+			Evaluate(std::span<const CubicCurve<Type>>{ curves }, parameters, each);
+
+			worst = 0.f;
+			for (size_t i = 0; i < count; ++i)
+				worst = std::max(worst, Difference(each[i], curves[i].evaluate(parameters[i])));
+
+			IRIS_CHECK(worst < 1e-4f);
+			IRIS_CHECK(Same(each.back(), sentinel));
+
+			// Splines clamp to [0, domain]; whole numbers land on segment boundaries
+			std::vector<Type> points;
+			for (size_t i = 0; i < 6; ++i)
+				points.push_back(RandomPoint<Type>(random));
+
+			const auto spline = CubicSpline<Type>::CatmullRom(points);
+			std::uniform_real_distribution<float32> wide{ -2.f, spline.domain() + 2.f };
+
+			for (size_t i = 0; i < count; ++i)
+				parameters[i] = (i % 5 == 0) ? static_cast<float32>(i % 9) - 1.f : wide(random);
+
+			std::vector<Type> sampled(count + 1, sentinel);
+			Evaluate(spline, parameters, sampled);
+
+			worst = 0.f;
+			for (size_t i = 0; i < count; ++i)
+				worst = std::max(worst, Difference(sampled[i], spline.evaluate(parameters[i])));
+
+			IRIS_CHECK(worst < 1e-4f);
+			IRIS_CHECK(Same(sampled.back(), sentinel));
+		}
+
+		// Out of range
+		const auto curve = RandomCurve<Type>(random);
+		const std::vector<float32> parameters(5, 0.5f);
+		std::vector<Type> results(4);
+		const std::vector<CubicCurve<Type>> curves(5, curve);
+
+		IRIS_CHECK_THROWS(Evaluate(curve, parameters, results), Error::OutOfRange);
+		IRIS_CHECK_THROWS(Evaluate(std::span<const CubicCurve<Type>>{ curves }, parameters, results), Error::OutOfRange);
+		IRIS_CHECK_THROWS(Evaluate(std::span<const CubicCurve<Type>>{ curves }, std::span{ parameters }.first(4), std::span{ results }), Error::OutOfRange);
+		IRIS_CHECK_THROWS(Evaluate(CubicSpline<Type>{}, std::span{ parameters }.first(4), std::span{ results }), Error::OutOfRange);
+	}
+
+	template<class Type>
+	void CheckEndPoints(uint32 seed)
+	{
+		std::mt19937 random{ seed };
+		constexpr float32 Tolerance = 1e-4f;
+
+		for (int i = 0; i < 100; ++i)
+		{
+			const auto p0 = RandomPoint<Type>(random), p1 = RandomPoint<Type>(random), p2 = RandomPoint<Type>(random), p3 = RandomPoint<Type>(random);
+
+			const auto bezier = CubicCurve<Type>::Bezier(p0, p1, p2, p3);
+			IRIS_CHECK(Difference(bezier.evaluate(0.f), p0) < Tolerance);
+			IRIS_CHECK(Difference(bezier.evaluate(1.f), p3) < Tolerance);
+			IRIS_CHECK(Difference(bezier.derivative(0.f), (p1 - p0) * 3.f) < Tolerance);
+			IRIS_CHECK(Difference(bezier.derivative(1.f), (p3 - p2) * 3.f) < Tolerance);
+
+			// p1 and p2 double as tangents here
+			const auto hermite = CubicCurve<Type>::Hermite(p0, p1, p3, p2);
+			IRIS_CHECK(Difference(hermite.evaluate(0.f), p0) < Tolerance);
+			IRIS_CHECK(Difference(hermite.evaluate(1.f), p3) < Tolerance);
+			IRIS_CHECK(Difference(hermite.derivative(0.f), p1) < Tolerance);
+			IRIS_CHECK(Difference(hermite.derivative(1.f), p2) < Tolerance);
+
+			const auto catmullRom = CubicCurve<Type>::CatmullRom(p0, p1, p2, p3);
+			IRIS_CHECK(Difference(catmullRom.evaluate(0.f), p1) < Tolerance);
+			IRIS_CHECK(Difference(catmullRom.evaluate(1.f), p2) < Tolerance);
+			IRIS_CHECK(Difference(catmullRom.derivative(0.f), (p2 - p0) * 0.5f) < Tolerance);
+			IRIS_CHECK(Difference(catmullRom.derivative(1.f), (p3 - p1) * 0.5f) < Tolerance);
+		}
+
+		// Splines pass through their points at whole parameters
+		std::vector<Type> points, tangents;
+		for (size_t i = 0; i < 10; ++i)
+		{
+			points.push_back(RandomPoint<Type>(random));
+			tangents.push_back(RandomPoint<Type>(random));
+		}
+
+		const auto catmullRom = CubicSpline<Type>::CatmullRom(points);
+		const auto hermite = CubicSpline<Type>::Hermite(points, tangents);
+		const auto bezier = CubicSpline<Type>::Bezier(points);
+
+		IRIS_CHECK(catmullRom.segmentCount() == 9 && hermite.segmentCount() == 9 && bezier.segmentCount() == 3);
+
+		for (size_t i = 0; i < points.size(); ++i)
+		{
+			const auto s = static_cast<float32>(i);
+			IRIS_CHECK(Difference(catmullRom.evaluate(s), points[i]) < Tolerance);
+			IRIS_CHECK(Difference(hermite.evaluate(s), points[i]) < Tolerance);
+			IRIS_CHECK(Difference(hermite.derivative(s), tangents[i]) < Tolerance);
+
+			if (i % 3 == 0)
+				IRIS_CHECK(Difference(bezier.evaluate(s / 3.f), points[i]) < Tolerance);
+		}
+
+		// Clamped outside the domain
+		IRIS_CHECK(Same(catmullRom.evaluate(-3.f), catmullRom.evaluate(0.f)));
+		IRIS_CHECK(Same(catmullRom.evaluate(100.f), catmullRom.evaluate(catmullRom.domain())));
+
+		IRIS_CHECK_THROWS(CubicSpline<Type>::CatmullRom(std::span{ points }.first(1)), Error::OutOfRange);
+		IRIS_CHECK_THROWS(CubicSpline<Type>::Hermite(points, std::span{ tangents }.first(9)), Error::OutOfRange);
+		IRIS_CHECK_THROWS(CubicSpline<Type>::Bezier(std::span{ points }.first(9)), Error::OutOfRange);
+	}
+
+	// Arc length from 0 to 'end' as a fine chord sum
+	template<class Curve>
+	double ReferenceLength(const Curve& curve, float32 end)
+	{
+		const auto steps = Max<size_t>(static_cast<size_t>(end * 20000.f), 1);
+		double length = 0.0;
+		auto previous = curve.evaluate(0.f);
+
+		for (size_t i = 1; i <= steps; ++i)
+		{
+			const auto point = curve.evaluate(end * static_cast<float32>(i) / static_cast<float32>(steps));
+			length += Detail::CurveDistance(previous, point);
+			previous = point;
+		}
+
+		return length;
+	}
+
+	// Takes equal distance steps through the table and measures how far along the curve each one really lands,
+	// relative to the total length
+	template<class Curve>
+	double SpacingError(const Curve& curve, const ArcLengthTable& table, size_t steps)
+	{
+		double worst = 0.0;
+
+		for (size_t i = 0; i <= steps; ++i)
+		{
+			const auto distance = table.length() * static_cast<float32>(i) / static_cast<float32>(steps);
+			worst = std::max(worst, std::abs(ReferenceLength(curve, table.parameter(distance)) - distance) / table.length());
+		}
+
+		return worst;
+	}
+}
+
+IRIS_TEST(BatchEvaluateFloat)
+{
+	CheckBatchEvaluate<float32>(12345);
+}
+
+IRIS_TEST(BatchEvaluateVector2)
+{
+	CheckBatchEvaluate<Vector2>(777);
+}
+
+IRIS_TEST(BatchEvaluateVector3)
+{
+	CheckBatchEvaluate<Vector3>(12345);
+}
+
+IRIS_TEST(EndPointInterpolation)
+{
+	CheckEndPoints<float32>(777);
+	CheckEndPoints<Vector2>(12345);
+	CheckEndPoints<Vector3>(777);
+}
+
+IRIS_TEST(ArcLengthSpacing)
+{
+	// A tightly bent Bezier whose parameter speed varies a lot along the curve
+	const auto curve = CubicCurve<Vector2>::Bezier(Vector2{ 0.f, 0.f }, Vector2{ 10.f, 0.f }, Vector2{ 0.f, 1.f }, Vector2{ 10.f, 1.f });
+	const ArcLengthTable curveTable{ curve, 1024 };
+
+	std::mt19937 random{ 777 };
+	std::vector<Vector3> points;
+	for (size_t i = 0; i < 8; ++i)
+		points.push_back(RandomPoint<Vector3>(random));
+
+	const auto spline = CubicSpline<Vector3>::CatmullRom(points);
+	const ArcLengthTable splineTable{ spline, 4096 };
+
+	const auto curveLength = ReferenceLength(curve, 1.f);
+	const auto splineLength = ReferenceLength(spline, spline.domain());
+	const auto curveSpacing = SpacingError(curve, curveTable, 64);
+	const auto splineSpacing = SpacingError(spline, splineTable, 64);
+
+	std::printf("    curve: length %g (reference %g), spacing error %g\n", curveTable.length(), curveLength, curveSpacing);
+	std::printf("    spline: length %g (reference %g), spacing error %g\n", splineTable.length(), splineLength, splineSpacing);
+
+	IRIS_CHECK(std::abs(curveTable.length() - curveLength) < curveLength * 1e-3);
+	IRIS_CHECK(std::abs(splineTable.length() - splineLength) < splineLength * 1e-3);
+	IRIS_CHECK(curveSpacing < 1e-3);
+	IRIS_CHECK(splineSpacing < 1e-3);
+
+	// The ends map to the ends of the domain, and distances outside [0, length] clamp
+	IRIS_CHECK(curveTable.parameter(0.f) == 0.f);
+	IRIS_CHECK(std::abs(curveTable.parameter(curveTable.length()) - 1.f) < 1e-5f);
+	IRIS_CHECK(curveTable.parameter(-5.f) == 0.f);
+	IRIS_CHECK(std::abs(splineTable.parameter(splineTable.length() + 5.f) - spline.domain()) < 1e-4f);
+
+	// The parameter never decreases with distance
+	bool monotonic = true;
+	for (float32 d = 0.f, previous = 0.f; d <= splineTable.length(); d += 0.01f)
+	{
+		const auto s = splineTable.parameter(d);
+		monotonic &= (s >= previous);
+		previous = s;
+	}
+
+	IRIS_CHECK(monotonic);
+
+	// One-dimensional and degenerate curves
+	const auto line = CubicCurve<float32>::Bezier(0.f, 1.f, 2.f, 3.f);
+	const ArcLengthTable lineTable{ line };
+	IRIS_CHECK(std::abs(lineTable.length() - 3.f) < 1e-4f);
+	IRIS_CHECK(std::abs(lineTable.parameter(1.5f) - 0.5f) < 1e-3f);
+
+	const ArcLengthTable point{ CubicCurve<Vector2>::Bezier(Vector2{ 1.f, 1.f }, Vector2{ 1.f, 1.f }, Vector2{ 1.f, 1.f }, Vector2{ 1.f, 1.f }) };
+	IRIS_CHECK(point.length() == 0.f && point.parameter(1.f) == 0.f);
+
+	const ArcLengthTable empty{ CubicSpline<Vector3>{} };
+	IRIS_CHECK(empty.length() == 0.f && empty.parameter(1.f) == 0.f);
+}
\ No newline at end of file
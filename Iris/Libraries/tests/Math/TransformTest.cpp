@@ -0,0 +1,208 @@
+#include "../Test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <Iris/Math/Transform.hpp>
+#include <Iris/Math/Matrix3x4.hpp>
+
+using namespace Iris;
+
+// Transform and Matrix3x4 composition and inversion are checked against the equivalent Matrix4x4 products, and
+// Quaternion::FromMatrix4x4 against FromAxisAngle for angles that reach every branch of the trace test
+
+namespace
+{
+	constexpr int Iterations = 2000;
+
+	Vector3 RandomAxis(std::mt19937& random)
+	{
+		std::normal_distribution<float32> direction;
+		return Vector3{ direction(random), direction(random), direction(random) }.normalize();
+	}
+
+	// Uniform scale only, where composition and inverse are exact
+	Transform RandomTransform(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float32> offset{ -10.f, 10.f };
+		std::uniform_real_distribution<float32> angle{ -3.1f, 3.1f };
+		std::uniform_real_distribution<float32> scale{ 0.5f, 2.f };
+
+		const auto s = scale(random);
+		return Transform{ Vector3{ offset(random), offset(random), offset(random) }, Quaternion::FromAxisAngle(RandomAxis(random), angle(random)), Vector3{ s, s, s } };
+	}
+
+	float32 MaxDifference(const Matrix4x4& a, const Matrix4x4& b)
+	{
+		float32 worst = 0.f;
+
+		for (size_t i = 0; i < 16; ++i)
+			worst = std::max(worst, std::abs(a.data[i] - b.data[i]));
+
+		return worst;
+	}
+
+	float32 IdentityError(const Matrix4x4& m)
+	{
+		return MaxDifference(m, Matrix4x4::Identity());
+	}
+
+	// q and -q are the same rotation
+	float32 RotationDifference(const Quaternion& a, const Quaternion& b)
+	{
+		const auto aligned = (a.dot(b) < 0.f) ? -b : b;
+		return std::max({ std::abs(a.x - aligned.x), std::abs(a.y - aligned.y), std::abs(a.z - aligned.z), std::abs(a.w - aligned.w) });
+	}
+}
+
+IRIS_TEST(TransformCompositionMatchesMatrix)
+{
+	std::mt19937 random{ 12345 };
+	float32 worst = 0.f;
+
+	for (int i = 0; i < Iterations; ++i)
+	{
+		const auto a = RandomTransform(random);
+		const auto b = RandomTransform(random);
+
+		worst = std::max(worst, MaxDifference((a * b).toMatrix4x4(), a.toMatrix4x4() * b.toMatrix4x4()));
+
+		auto compound = a;
+		compound *= b;
+		worst = std::max(worst, MaxDifference(compound.toMatrix4x4(), a.toMatrix4x4() * b.toMatrix4x4()));
+	}
+
+	std::printf("    max element difference %g\n", worst);
+	IRIS_CHECK(worst < 1e-3f);
+}
+
+IRIS_TEST(TransformInverseRoundTrips)
+{
+	std::mt19937 random{ 777 };
+	std::uniform_real_distribution<float32> component{ -20.f, 20.f };
+	float32 worstMatrix = 0.f, worstPoint = 0.f;
+
+	for (int i = 0; i < Iterations; ++i)
+	{
+		const auto transform = RandomTransform(random);
+		const auto inverse = transform.inverse();
+
+		worstMatrix = std::max(worstMatrix, IdentityError((transform * inverse).toMatrix4x4()));
+		worstMatrix = std::max(worstMatrix, IdentityError((inverse * transform).toMatrix4x4()));
+		worstMatrix = std::max(worstMatrix, MaxDifference(inverse.toMatrix4x4(), transform.toMatrix4x4().inverse()));
+
+		const Vector3 point{ component(random), component(random), component(random) };
+		const auto back = inverse.transformPoint(transform.transformPoint(point));
+		worstPoint = std::max({ worstPoint, std::abs(back.x - point.x), std::abs(back.y - point.y), std::abs(back.z - point.z) });
+	}
+
+	std::printf("    max identity error %g, max point error %g\n", worstMatrix, worstPoint);
+	IRIS_CHECK(worstMatrix < 1e-3f);
+	IRIS_CHECK(worstPoint < 1e-3f);
+}
+
+IRIS_TEST(QuaternionFromMatrixMatchesAxisAngle)
+{
+	std::mt19937 random{ 12345 };
+	std::uniform_real_distribution<float32> angle{ -3.14f, 3.14f };
+	float32 worst = 0.f;
+
+	// Axis-aligned rotations near pi make each diagonal element the largest in turn
+	const Vector3 axes[] = { Vector3{ 1.f, 0.f, 0.f }, Vector3{ 0.f, 1.f, 0.f }, Vector3{ 0.f, 0.f, 1.f } };
+
+	for (const auto& axis : axes)
+	{
+		for (const float32 theta : { 0.f, 0.5f, 3.f, 3.14f, -3.14f })
+			worst = std::max(worst, RotationDifference(Quaternion::FromMatrix4x4(Matrix4x4::FromAxisAngle(axis, theta)), Quaternion::FromAxisAngle(axis, theta)));
+	}
+
+	for (int i = 0; i < Iterations; ++i)
+	{
+		const auto axis = RandomAxis(random);
+		const auto theta = angle(random);
+
+		worst = std::max(worst, RotationDifference(Quaternion::FromMatrix4x4(Matrix4x4::FromAxisAngle(axis, theta)), Quaternion::FromAxisAngle(axis, theta)));
+	}
+
+	std::printf("    max component difference %g\n", worst);
+	IRIS_CHECK(worst < 1e-4f);
+}
+
+IRIS_TEST(TransformMatrixRoundTrip)
+{
+	std::mt19937 random{ 777 };
+	float32 worst = 0.f;
+
+	for (int i = 0; i < Iterations; ++i)
+	{
+		const auto transform = RandomTransform(random);
+
+		worst = std::max(worst, MaxDifference(Transform::FromMatrix4x4(transform.toMatrix4x4()).toMatrix4x4(), transform.toMatrix4x4()));
+		worst = std::max(worst, MaxDifference(Transform::FromMatrix3x4(transform.toMatrix3x4()).toMatrix4x4(), transform.toMatrix4x4()));
+	}
+
+	std::printf("    max element difference %g\n", worst);
+	IRIS_CHECK(worst < 1e-3f);
+}
+
+IRIS_TEST(Matrix3x4CompositionAndInverse)
+{
+	std::mt19937 random{ 12345 };
+	std::uniform_real_distribution<float32> component{ -20.f, 20.f };
+	float32 worstProduct = 0.f, worstInverse = 0.f, worstPoint = 0.f;
+
+	for (int i = 0; i < Iterations; ++i)
+	{
+		const auto a = RandomTransform(random).toMatrix3x4();
+		const auto b = RandomTransform(random).toMatrix3x4();
+
+		worstProduct = std::max(worstProduct, MaxDifference((a * b).toMatrix4x4(), a.toMatrix4x4() * b.toMatrix4x4()));
+
+		auto compound = a;
+		compound *= b;
+		worstProduct = std::max(worstProduct, MaxDifference(compound.toMatrix4x4(), a.toMatrix4x4() * b.toMatrix4x4()));
+
+		worstProduct = std::max(worstProduct, MaxDifference(Matrix3x4::FromMatrix4x4(a.toMatrix4x4()).toMatrix4x4(), a.toMatrix4x4()));
+
+		worstInverse = std::max(worstInverse, IdentityError((a * a.inverse()).toMatrix4x4()));
+		worstInverse = std::max(worstInverse, MaxDifference(a.inverse().toMatrix4x4(), a.toMatrix4x4().inverse()));
+
+		const Vector3 point{ component(random), component(random), component(random) };
+		const auto back = a.inverse().transformPoint(a.transformPoint(point));
+		worstPoint = std::max({ worstPoint, std::abs(back.x - point.x), std::abs(back.y - point.y), std::abs(back.z - point.z) });
+
+		const auto expected = point.transform(a.toMatrix4x4());
+		const auto actual = a.transformPoint(point);
+		worstPoint = std::max({ worstPoint, std::abs(actual.x - expected.x), std::abs(actual.y - expected.y), std::abs(actual.z - expected.z) });
+	}
+
+	std::printf("    max product difference %g, max inverse error %g, max point error %g\n", worstProduct, worstInverse, worstPoint);
+	IRIS_CHECK(worstProduct < 1e-3f);
+	IRIS_CHECK(worstInverse < 1e-3f);
+	IRIS_CHECK(worstPoint < 1e-3f);
+}
+
+IRIS_TEST(Matrix3x4InverseRigid)
+{
+	std::mt19937 random{ 777 };
+	std::uniform_real_distribution<float32> offset{ -10.f, 10.f };
+	std::uniform_real_distribution<float32> angle{ -3.1f, 3.1f };
+	float32 worst = 0.f;
+
+	for (int i = 0; i < Iterations; ++i)
+	{
+		const Transform rigid{ Vector3{ offset(random), offset(random), offset(random) }, Quaternion::FromAxisAngle(RandomAxis(random), angle(random)) };
+		const auto m = rigid.toMatrix3x4();
+
+		worst = std::max(worst, MaxDifference(m.inverseRigid().toMatrix4x4(), m.inverse().toMatrix4x4()));
+		worst = std::max(worst, IdentityError((m * m.inverseRigid()).toMatrix4x4()));
+	}
+
+	std::printf("    max element difference %g\n", worst);
+	IRIS_CHECK(worst < 1e-4f);
+
+	// Singular matrices fall back to the identity
+	const Matrix3x4 singular{ 1, 2, 3, 4, 2, 4, 6, 8, 0, 0, 1, 0 };
+	IRIS_CHECK(IdentityError(singular.inverse().toMatrix4x4()) == 0.f);
+}
\ No newline at end of file
@@ -0,0 +1,328 @@
+#include "../Test.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <Iris/Math/Vector3x4.hpp>
+#include <Iris/Math/Vector3x8.hpp>
+
+using namespace Iris;
+
+// Vector3x4 and Vector3x8 against Vector3 lane by lane: Pack/Unpack and Load/store with partial packets, normalize
+// with a threshold, and the mask comparisons. The checks are IRIS_TARGET_AVX2 so one template serves both widths;
+// the test is skipped on CPUs without AVX2 and FMA
+
+namespace
+{
+	const Vector3 Sentinel{ 1234.5f, -1234.5f, 42.f };
+
+	bool Same(const Vector3& a, const Vector3& b)
+	{
+		return (a.x == b.x) && (a.y == b.y) && (a.z == b.z);
+	}
+
+	bool Near(const Vector3& a, const Vector3& b, float32 tolerance)
+	{
+		return (std::abs(a.x - b.x) <= tolerance) && (std::abs(a.y - b.y) <= tolerance) && (std::abs(a.z - b.z) <= tolerance);
+	}
+
+	// Summed in the same order as the packet lengthSq
+	float32 LengthSq(const Vector3& v)
+	{
+		return (v.x * v.x + v.y * v.y) + v.z * v.z;
+	}
+
+	std::vector<Vector3> RandomVectors(std::mt19937& random, size_t count)
+	{
+		std::uniform_real_distribution<float32> component{ -10.f, 10.f };
+
+		std::vector<Vector3> vectors;
+
+		for (size_t i = 0; i < count; ++i)
+			vectors.emplace_back(component(random), component(random), component(random));
+
+		return vectors;
+	}
+
+	template<class Packet>
+	IRIS_TARGET_AVX2 bool CheckPackUnpack(std::mt19937& random)
+	{
+		constexpr size_t Width = Packet::Width;
+
+		for (size_t count = 0; count <= Width * 3 + 1; ++count)
+		{
+			const auto source = RandomVectors(random, count);
+			const Array<Vector3> vectors(source.begin(), source.end());
+
+			const auto packets = Packet::Pack(vectors);
+
+			if (packets.size() != (count + Width - 1) / Width)
+				return false;
+
+			// The last packet is zero-padded
+			for (size_t lane = count % Width; (count % Width) != 0 && lane < Width; ++lane)
+			{
+				if (!Same(packets[packets.size() - 1].get(lane), Vector3{ 0.f, 0.f, 0.f }))
+					return false;
+			}
+
+			const auto unpacked = Packet::Unpack(packets, count);
+
+			if (unpacked.size() != count)
+				return false;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (!Same(unpacked[i], source[i]) || !Same(packets[i / Width].get(i % Width), source[i]))
+					return false;
+			}
+
+			// Asking for more than the packets hold stops at the packets
+			if (Packet::Unpack(packets, count + Width * 2).size() != packets.size() * Width)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<class Packet>
+	IRIS_TARGET_AVX2 bool CheckLoadStore(std::mt19937& random)
+	{
+		constexpr size_t Width = Packet::Width;
+		const auto source = RandomVectors(random, Width + 2);
+
+		for (size_t count = 0; count <= Width + 1; ++count)
+		{
+			const auto packet = Packet::Load(source.data(), count);
+
+			for (size_t lane = 0; lane < Width; ++lane)
+			{
+				const auto expected = (lane < count) ? source[lane] : Vector3{ 0.f, 0.f, 0.f };
+
+				if (!Same(packet.get(lane), expected))
+					return false;
+			}
+
+			// Only the first 'count' elements are written, never past Width
+			std::vector<Vector3> out(Width + 2, Sentinel);
+			packet.store(out.data(), count);
+
+			for (size_t i = 0; i < out.size(); ++i)
+			{
+				const auto expected = (i < count && i < Width) ? source[i] : Sentinel;
+
+				if (!Same(out[i], expected))
+					return false;
+			}
+		}
+
+		// Full packets round-trip exactly in lane order
+		const auto packet = Packet::Load(source.data());
+		std::vector<Vector3> out(Width + 1, Sentinel);
+		packet.store(out.data());
+
+		for (size_t lane = 0; lane < Width; ++lane)
+		{
+			if (!Same(packet.get(lane), source[lane]) || !Same(out[lane], source[lane]))
+				return false;
+		}
+
+		// set() touches one lane
+		auto edited = packet;
+		edited.set(Width - 1, Sentinel);
+
+		return Same(out[Width], Sentinel) && Same(edited.get(Width - 1), Sentinel) && Same(edited.get(0), source[0]);
+	}
+
+	template<class Packet>
+	IRIS_TARGET_AVX2 bool CheckNormalize(std::mt19937& random)
+	{
+		constexpr size_t Width = Packet::Width;
+		constexpr float32 Threshold = 0.5f;
+
+		// Lengths on both sides of the threshold, exactly on it, and at and below Math::Epsilon
+		const float32 lengths[] = { 0.f, 1e-9f, Math::Epsilon, 0.4999f, Threshold, 0.5001f, 1.f, 250.f };
+
+		std::normal_distribution<float32> direction;
+		std::vector<Vector3> source;
+
+		for (size_t i = 0; i < Width * 4; ++i)
+		{
+			const auto unit = Vector3{ direction(random), direction(random), direction(random) }.normalize();
+			source.push_back(unit * lengths[i % std::size(lengths)]);
+		}
+
+		for (size_t first = 0; first < source.size(); first += Width)
+		{
+			const auto packet = Packet::Load(source.data() + first);
+			const auto thresholded = packet.normalize(Threshold);
+			const auto defaulted = packet.normalize();
+
+			for (size_t lane = 0; lane < Width; ++lane)
+			{
+				const auto& v = source[first + lane];
+
+				if (!Near(thresholded.get(lane), v.normalize(Threshold), 1e-6f) || !Near(defaulted.get(lane), v.normalize(), 1e-6f))
+					return false;
+
+				// Lanes below the threshold come back untouched
+				if (v.length() < Threshold && !Same(thresholded.get(lane), v))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<class Packet>
+	IRIS_TARGET_AVX2 bool CheckMasks(std::mt19937& random)
+	{
+		constexpr size_t Width = Packet::Width;
+		constexpr uint32 AllLanes = (1u << Width) - 1;
+
+		const auto a = RandomVectors(random, Width);
+		auto b = RandomVectors(random, Width);
+
+		// Some lanes equal, some off in a single component, one zero vector and one with a zero component
+		b[0] = a[0];
+		b[1] = Vector3{ a[1].x, a[1].y, a[1].z + 1.f };
+		b[2] = a[2] * 2.f;
+		b[3] = Vector3{ 0.f, 0.f, 0.f };
+
+		if constexpr (Width > 4)
+			b[5] = Vector3{ a[5].x, 0.f, a[5].z };
+
+		const auto pa = Packet::Load(a.data());
+		const auto pb = Packet::Load(b.data());
+
+		uint32 equal = 0, less = 0, greater = 0, lessEqual = 0, greaterEqual = 0, zero = 0, hasZero = 0;
+
+		for (size_t lane = 0; lane < Width; ++lane)
+		{
+			const auto bit = 1u << lane;
+			const auto la = LengthSq(a[lane]), lb = LengthSq(b[lane]);
+
+			equal |= Same(a[lane], b[lane]) ? bit : 0;
+			less |= (la < lb) ? bit : 0;
+			greater |= (la > lb) ? bit : 0;
+			lessEqual |= (la <= lb) ? bit : 0;
+			greaterEqual |= (la >= lb) ? bit : 0;
+			zero |= Same(b[lane], Vector3{ 0.f, 0.f, 0.f }) ? bit : 0;
+			hasZero |= (b[lane].x == 0.f || b[lane].y == 0.f || b[lane].z == 0.f) ? bit : 0;
+		}
+
+		const bool comparisons = ((pa == pb).bits() == equal) && ((pa != pb).bits() == (AllLanes & ~equal))
+			&& ((pa < pb).bits() == less) && ((pa > pb).bits() == greater)
+			&& ((pa <= pb).bits() == lessEqual) && ((pa >= pb).bits() == greaterEqual)
+			&& (pb.isZero().bits() == zero) && (pb.hasZero().bits() == hasZero);
+
+		const auto mask = pa == pb;
+
+		const bool logic = ((!mask).bits() == (AllLanes & ~equal)) && ((mask & !mask).bits() == 0) && ((mask | !mask).bits() == AllLanes)
+			&& mask.any() && !mask.all() && !mask.none()
+			&& (pa == pa).all() && (pa != pa).none();
+
+		// Select takes pa where the lanes were equal and pb elsewhere
+		const auto selected = Packet::Select(pb.isZero(), pa, pb);
+		bool select = true;
+
+		for (size_t lane = 0; lane < Width; ++lane)
+			select &= Same(selected.get(lane), (zero & (1u << lane)) ? a[lane] : b[lane]);
+
+		return comparisons && logic && select;
+	}
+
+	template<class Packet>
+	IRIS_TARGET_AVX2 bool CheckArithmetic(std::mt19937& random)
+	{
+		constexpr size_t Width = Packet::Width;
+		const auto a = RandomVectors(random, Width);
+		const auto b = RandomVectors(random, Width);
+
+		const auto pa = Packet::Load(a.data());
+		const auto pb = Packet::Load(b.data());
+
+		const auto sum = pa + pb;
+		const auto cross = pa.cross(pb);
+		const auto lerp = Packet::Lerp(pa, pb, 0.25f);
+
+		alignas(32) float32 dot[Width];
+		alignas(32) float32 distance[Width];
+
+		if constexpr (Width == 8)
+		{
+			_mm256_store_ps(dot, pa.dot(pb));
+			_mm256_store_ps(distance, pa.distance(pb));
+		}
+		else
+		{
+			_mm_store_ps(dot, pa.dot(pb));
+			_mm_store_ps(distance, pa.distance(pb));
+		}
+
+		for (size_t lane = 0; lane < Width; ++lane)
+		{
+			if (!Near(sum.get(lane), a[lane] + b[lane], 1e-5f) || !Near(cross.get(lane), a[lane].cross(b[lane]), 1e-4f)
+				|| !Near(lerp.get(lane), a[lane] + (b[lane] - a[lane]) * 0.25f, 1e-5f)
+				|| std::abs(dot[lane] - a[lane].dot(b[lane])) > 1e-4f || std::abs(distance[lane] - a[lane].distance(b[lane])) > 1e-4f)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<class Packet>
+	IRIS_TARGET_AVX2 void CheckPacket(std::mt19937& random)
+	{
+		IRIS_CHECK(CheckPackUnpack<Packet>(random));
+		IRIS_CHECK(CheckLoadStore<Packet>(random));
+		IRIS_CHECK(CheckNormalize<Packet>(random));
+		IRIS_CHECK(CheckMasks<Packet>(random));
+		IRIS_CHECK(CheckArithmetic<Packet>(random));
+	}
+
+	// Two Vector3x4 halves make one Vector3x8, low lanes first
+	IRIS_TARGET_AVX2 bool CheckJoin(std::mt19937& random)
+	{
+		const auto source = RandomVectors(random, 8);
+		const Vector3x8 joined{ Vector3x4::Load(source.data()), Vector3x4::Load(source.data() + 4) };
+
+		bool same = true;
+
+		for (size_t lane = 0; lane < 8; ++lane)
+			same &= Same(joined.get(lane), source[lane]);
+
+		return same;
+	}
+
+	bool HasAVX2()
+	{
+		const auto& cpu = CPUFeature::Get();
+
+		if (cpu.avx2 && cpu.fma)
+			return true;
+
+		std::printf("    skipped: the CPU lacks AVX2 or FMA\n");
+		return false;
+	}
+}
+
+IRIS_TEST(Vector3x4MatchesVector3)
+{
+	std::mt19937 random{ 12345 };
+
+	if (HasAVX2())
+		CheckPacket<Vector3x4>(random);
+}
+
+IRIS_TEST(Vector3x8MatchesVector3)
+{
+	std::mt19937 random{ 777 };
+
+	if (!HasAVX2())
+		return;
+
+	CheckPacket<Vector3x8>(random);
+	IRIS_CHECK(CheckJoin(random));
+}
\ No newline at end of file
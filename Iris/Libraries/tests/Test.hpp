@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <exception>
+#include <functional>
+
+#include <Iris/Common/Exceptions.hpp>
+
+// Minimal test harness: every test file is its own executable registered with CTest. IRIS_TEST bodies run in
+// declaration order, failed checks are reported and counted, and the exit status is non-zero if any failed.
+
+#define IRIS_TEST_CONCAT_IMPL(a, b) a##b
+#define IRIS_TEST_CONCAT(a, b) IRIS_TEST_CONCAT_IMPL(a, b)
+
+#define IRIS_TEST(name) \
+	static void IRIS_TEST_CONCAT(IrisTest_, name)(); \
+	[[maybe_unused]] static const bool IRIS_TEST_CONCAT(IrisTestRegistered_, name) = ::Iris::Test::Register(#name, IRIS_TEST_CONCAT(IrisTest_, name)); \
+	static void IRIS_TEST_CONCAT(IrisTest_, name)()
+
+#define IRIS_CHECK(expression) ::Iris::Test::Check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#define IRIS_CHECK_NEAR(actual, expected, tolerance) \
+	::Iris::Test::CheckNear(static_cast<double>(actual), static_cast<double>(expected), static_cast<double>(tolerance), \
+		#actual " ~ " #expected, __FILE__, __LINE__)
+
+// Passes when 'expression' throws 'Exception'
+#define IRIS_CHECK_THROWS(expression, Exception) \
+	do \
+	{ \
+		bool thrown = false; \
+		try { static_cast<void>(expression); } catch (const Exception&) { thrown = true; } \
+		::Iris::Test::Check(thrown, #expression " throws " #Exception, __FILE__, __LINE__); \
+	} while (false)
+
+namespace Iris::Test
+{
+	struct Case
+	{
+		const char* name;
+
+		std::function<void()> body;
+	};
+
+	inline std::vector<Case>& Cases()
+	{
+		static std::vector<Case> cases;
+		return cases;
+	}
+
+	inline int& Failures()
+	{
+		static int failures = 0;
+		return failures;
+	}
+
+	inline bool Register(const char* name, std::function<void()> body)
+	{
+		Cases().push_back(Case{ name, std::move(body) });
+		return true;
+	}
+
+	inline bool Check(bool condition, const char* expression, const char* file, int line)
+	{
+		if (!condition)
+		{
+			std::fprintf(stderr, "%s(%d): check failed: %s\n", file, line, expression);
+			++Failures();
+		}
+
+		return condition;
+	}
+
+	inline bool CheckNear(double actual, double expected, double tolerance, const char* expression, const char* file, int line)
+	{
+		const bool near = std::abs(actual - expected) <= tolerance;
+
+		if (!near)
+		{
+			std::fprintf(stderr, "%s(%d): check failed: %s\n    actual %.9g, expected %.9g, tolerance %.3g\n",
+				file, line, expression, actual, expected, tolerance);
+			++Failures();
+		}
+
+		return near;
+	}
+
+	inline int Main()
+	{
+		for (const auto& test : Cases())
+		{
+			const int before = Failures();
+
+			try
+			{
+				test.body();
+			}
+			catch (const Error::Exception& e)
+			{
+				std::fprintf(stderr, "%s: unexpected exception: %s\n", test.name, e.what());
+				++Failures();
+			}
+			catch (const std::exception& e)
+			{
+				std::fprintf(stderr, "%s: unexpected exception: %s\n", test.name, e.what());
+				++Failures();
+			}
+			catch (...)
+			{
+				std::fprintf(stderr, "%s: unexpected exception\n", test.name);
+				++Failures();
+			}
+
+			std::printf("[%s] %s\n", (Failures() == before) ? "  OK  " : " FAIL ", test.name);
+		}
+
+		return (Failures() == 0) ? 0 : 1;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#include "Test.hpp"
+
+int main()
+{
+	return Iris::Test::Main();
+}
\ No newline at end of file